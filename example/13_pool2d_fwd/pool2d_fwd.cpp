@@ -10,11 +10,11 @@
 #include "device.hpp"
 #include "host_tensor.hpp"
 #include "host_tensor_generator.hpp"
-#include "host_reduce_util.hpp"
 #include "device_tensor.hpp"
 #include "tensor_layout.hpp"
 #include "reduction_operator.hpp"
 #include "device_pool2d_fwd_nhwc_nhwc.hpp"
+#include "reference_pool_fwd.hpp"
 
 using InDataType  = ck::half_t;
 using OutDataType = ck::half_t;
@@ -46,109 +46,8 @@ using DevicePoolFwdInstance =
         1,  // ReduceKThreadSliceSize
         4>; // InSrcOutDstVectorSize
 
-template <typename InDataType,
-          typename OutDataType,
-          typename AccDataType,
-          ck::ReduceTensorOp ReduceOpId,
-          bool PropagateNan,
-          bool NeedIndices>
-static void pool_host_verify(const Tensor<InDataType>& in,
-                             Tensor<OutDataType>& out,
-                             Tensor<int>& out_indices,
-                             const std::array<ck::index_t, 2>& window_spatial_lengths,
-                             const std::array<ck::index_t, 2>& window_strides,
-                             const std::array<ck::index_t, 2>& in_left_pads,
-                             const std::array<ck::index_t, 2>& /*in_right_pads*/)
-{
-    using namespace ck::host_reduce;
-
-    const int divider = window_spatial_lengths[0] * window_spatial_lengths[1];
-
-    const auto PreUnaryOp = PreUnaryOpFn<AccDataType, ReduceOpId>(divider);
-    const auto PosUnaryOp = PosUnaryOpFn<AccDataType, ReduceOpId>(divider);
-
-    if constexpr(!NeedIndices)
-    {
-        auto opReduce = ReduceOpFn<AccDataType, ReduceOpId>();
-
-        auto f_nchw = [&](auto n, auto c, auto ho, auto wo) {
-            auto accuVal = ReduceOpZeroVal<AccDataType, ReduceOpId>();
-
-            for(int y = 0; y < window_spatial_lengths[0]; ++y)
-            {
-                int hi = ho * window_strides[0] + y - in_left_pads[0];
-                for(int x = 0; x < window_spatial_lengths[1]; ++x)
-                {
-                    int wi = wo * window_strides[1] + x - in_left_pads[1];
-                    if(hi >= 0 && hi < ck::type_convert<int>(in.mDesc.GetLengths()[2]) && wi >= 0 &&
-                       wi < ck::type_convert<int>(in.mDesc.GetLengths()[3]))
-                    {
-                        AccDataType currVal = static_cast<AccDataType>(in(n, c, hi, wi));
-
-                        PreUnaryOp(currVal);
-
-                        binop_with_nan_check<AccDataType, PropagateNan>(opReduce, accuVal, currVal);
-                    }
-                }
-            }
-
-            PosUnaryOp(accuVal);
-
-            out(n, c, ho, wo) = accuVal;
-        };
-
-        make_ParallelTensorFunctor(f_nchw,
-                                   out.mDesc.GetLengths()[0],
-                                   out.mDesc.GetLengths()[1],
-                                   out.mDesc.GetLengths()[2],
-                                   out.mDesc.GetLengths()[3])(std::thread::hardware_concurrency());
-    }
-    else
-    {
-        auto opReduce = ReduceOpFn2<AccDataType, ReduceOpId>();
-
-        auto f_nchw = [&](auto n, auto c, auto ho, auto wo) {
-            auto accuVal  = ReduceOpZeroVal<AccDataType, ReduceOpId>();
-            int accuIndex = 0;
-
-            for(int y = 0; y < window_spatial_lengths[0]; ++y)
-            {
-                int hi = ho * window_strides[0] + y - in_left_pads[0];
-                for(int x = 0; x < window_spatial_lengths[1]; ++x)
-                {
-                    int wi = wo * window_strides[1] + x - in_left_pads[1];
-                    if(hi >= 0 && hi < in.mDesc.GetLengths()[2] && wi >= 0 &&
-                       wi < in.mDesc.GetLengths()[3])
-                    {
-                        AccDataType currVal = static_cast<AccDataType>(in(n, c, hi, wi));
-                        int currIndex       = y * window_spatial_lengths[1] + x;
-
-                        PreUnaryOp(currVal);
-
-                        binop_with_nan_check2<AccDataType, PropagateNan>(
-                            opReduce, accuVal, currVal, accuIndex, currIndex);
-                    }
-                }
-            }
-
-            PosUnaryOp(accuVal);
-
-            out(n, c, ho, wo)         = accuVal;
-            out_indices(n, c, ho, wo) = accuIndex;
-        };
-
-        make_ParallelTensorFunctor(f_nchw,
-                                   out.mDesc.GetLengths()[0],
-                                   out.mDesc.GetLengths()[1],
-                                   out.mDesc.GetLengths()[2],
-                                   out.mDesc.GetLengths()[3])(std::thread::hardware_concurrency());
-    };
-}
-
 int main(int argc, char* argv[])
 {
-    using namespace ck::host_reduce;
-
     bool do_verification = true;
     int init_method      = 1;
     bool time_kernel     = false;
@@ -205,7 +104,6 @@ int main(int argc, char* argv[])
     const ck::index_t Ho = (Hi + in_left_pad_h + in_right_pad_h - Y) / window_stride_h + 1;
     const ck::index_t Wo = (Wi + in_left_pad_w + in_right_pad_w - X) / window_stride_w + 1;
 
-    const std::array<ck::index_t, 2> window_spatial_lengths{{Y, X}};
     const std::array<ck::index_t, 2> window_strides{{window_stride_h, window_stride_w}};
     const std::array<ck::index_t, 2> input_left_pads{{in_left_pad_h, in_left_pad_w}};
     const std::array<ck::index_t, 2> input_right_pads{{in_right_pad_h, in_right_pad_w}};
@@ -288,18 +186,26 @@ int main(int argc, char* argv[])
     bool pass = true;
     if(do_verification)
     {
-        pool_host_verify<InDataType,
-                         OutDataType,
-                         AccDataType,
-                         ReduceOpId,
-                         PropagateNan,
-                         NeedIndices>(in_n_c_hi_wi,
-                                      out_n_c_ho_wo_host,
-                                      out_indices_n_c_ho_wo_host,
-                                      window_spatial_lengths,
-                                      window_strides,
-                                      input_left_pads,
-                                      input_right_pads);
+        using ReferencePoolFwdInstance =
+            ck::tensor_operation::host::ReferencePoolFwd<2,
+                                                         InDataType,
+                                                         OutDataType,
+                                                         AccDataType,
+                                                         ReduceOpId,
+                                                         PropagateNan,
+                                                         NeedIndices>;
+
+        auto ref_pool     = ReferencePoolFwdInstance{};
+        auto ref_invoker  = ref_pool.MakeInvoker();
+        auto ref_argument = ref_pool.MakeArgument(in_n_c_hi_wi,
+                                                  out_n_c_ho_wo_host,
+                                                  out_indices_n_c_ho_wo_host,
+                                                  {Y, X},
+                                                  {window_stride_h, window_stride_w},
+                                                  {in_left_pad_h, in_left_pad_w},
+                                                  {in_right_pad_h, in_right_pad_w});
+
+        ref_invoker.Run(ref_argument);
 
         out_device_buf.FromDevice(out_n_c_ho_wo_device.mData.data());
 
@@ -0,0 +1,143 @@
+#include <iostream>
+#include <cstdlib>
+#include "check_err.hpp"
+#include "config.hpp"
+#include "device.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+
+#include "device_tensor.hpp"
+#include "device_elementwise.hpp"
+#include "reference_elementwise.hpp"
+
+// y = relu((x + bias + residual) * scale) on NHWC tensors, with a per-channel bias and a
+// per-pixel scale. The dims fold to [N * H * W, C]; the scale is broadcast along C, so it is read
+// element by element while the other tensors are accessed in vectors of 8.
+
+using F16 = ck::half_t;
+using F32 = float;
+
+struct AddAddScaleRelu
+{
+    __host__ __device__ void operator()(
+        float& y, const float& x, const float& bias, const float& res, const float& scale) const
+    {
+        const float v = (x + bias + res) * scale;
+
+        y = v > 0 ? v : 0;
+    }
+};
+
+using InDataTypeTuple  = ck::Tuple<F16, F16, F16, F32>;
+using OutDataTypeTuple = ck::Tuple<F16>;
+
+using DeviceElementwiseInstance =
+    ck::tensor_operation::device::DeviceElementwise<InDataTypeTuple,
+                                                    OutDataTypeTuple,
+                                                    F32,
+                                                    AddAddScaleRelu,
+                                                    2, // NumDim after folding
+                                                    8, // MPerThread
+                                                    ck::Sequence<8, 8, 8, 1>,
+                                                    ck::Sequence<8>>;
+
+using ReferenceElementwiseInstance = ck::tensor_operation::host::
+    ReferenceElementwise<InDataTypeTuple, OutDataTypeTuple, F32, AddAddScaleRelu>;
+
+template <typename T>
+std::vector<ck::index_t> to_index_vector(const std::vector<T>& v)
+{
+    return {v.begin(), v.end()};
+}
+
+int main()
+{
+    bool do_verification = true;
+    bool time_kernel     = false;
+
+    const std::size_t N = 4, H = 16, W = 16, C = 64;
+
+    const std::vector<std::size_t> nhwc = {N, H, W, C};
+
+    Tensor<F16> x(nhwc);
+    Tensor<F16> residual(nhwc);
+    Tensor<F16> bias(std::vector<std::size_t>{C});
+    Tensor<F32> scale(std::vector<std::size_t>{N * H * W});
+    Tensor<F16> y(nhwc);
+
+    x.GenerateTensorValue(GeneratorTensor_3<F16>{-1.0, 1.0});
+    residual.GenerateTensorValue(GeneratorTensor_3<F16>{-1.0, 1.0});
+    bias.GenerateTensorValue(GeneratorTensor_3<F16>{-0.5, 0.5});
+    scale.GenerateTensorValue(GeneratorTensor_3<F32>{0.5, 2.0});
+
+    const std::vector<ck::index_t> lengths = to_index_vector(nhwc);
+
+    const std::array<std::vector<ck::index_t>, 4> in_strides{
+        {to_index_vector(x.mDesc.GetStrides()),
+         {0, 0, 0, 1},
+         to_index_vector(residual.mDesc.GetStrides()),
+         {static_cast<ck::index_t>(H * W), static_cast<ck::index_t>(W), 1, 0}}};
+    const std::array<std::vector<ck::index_t>, 1> out_strides{
+        {to_index_vector(y.mDesc.GetStrides())}};
+
+    DeviceMem x_device_buf(sizeof(F16) * x.mDesc.GetElementSpace());
+    DeviceMem bias_device_buf(sizeof(F16) * bias.mDesc.GetElementSpace());
+    DeviceMem residual_device_buf(sizeof(F16) * residual.mDesc.GetElementSpace());
+    DeviceMem scale_device_buf(sizeof(F32) * scale.mDesc.GetElementSpace());
+    DeviceMem y_device_buf(sizeof(F16) * y.mDesc.GetElementSpace());
+
+    x_device_buf.ToDevice(x.mData.data());
+    bias_device_buf.ToDevice(bias.mData.data());
+    residual_device_buf.ToDevice(residual.mData.data());
+    scale_device_buf.ToDevice(scale.mData.data());
+
+    auto elementwise = DeviceElementwiseInstance{};
+    auto argument    = elementwise.MakeArgumentPointer({x_device_buf.GetDeviceBuffer(),
+                                                     bias_device_buf.GetDeviceBuffer(),
+                                                     residual_device_buf.GetDeviceBuffer(),
+                                                     scale_device_buf.GetDeviceBuffer()},
+                                                    {y_device_buf.GetDeviceBuffer()},
+                                                    lengths,
+                                                    in_strides,
+                                                    out_strides,
+                                                    AddAddScaleRelu{});
+
+    if(!elementwise.IsSupportedArgument(argument.get()))
+    {
+        throw std::runtime_error("The runtime parameters seems not supported by the "
+                                 "DeviceElementwise instance, exiting!");
+    };
+
+    auto invoker_ptr = elementwise.MakeInvokerPointer();
+    float ave_time   = invoker_ptr->Run(argument.get(), StreamConfig{nullptr, time_kernel});
+
+    std::size_t num_byte = sizeof(F16) * (3 * x.mDesc.GetElementSize() + C) +
+                           sizeof(F32) * scale.mDesc.GetElementSize();
+
+    float gb_per_sec = num_byte / 1.E6 / ave_time;
+
+    std::cout << "Perf: " << ave_time << " ms, " << gb_per_sec << " GB/s" << std::endl;
+
+    bool pass = true;
+    if(do_verification)
+    {
+        y_device_buf.FromDevice(y.mData.data());
+
+        Tensor<F16> host_y(nhwc);
+
+        auto ref_invoker  = ReferenceElementwiseInstance::MakeInvoker();
+        auto ref_argument = ReferenceElementwiseInstance::MakeArgument(
+            {x.mData.data(), bias.mData.data(), residual.mData.data(), scale.mData.data()},
+            {host_y.mData.data()},
+            lengths,
+            in_strides,
+            out_strides,
+            AddAddScaleRelu{});
+
+        ref_invoker.Run(ref_argument);
+
+        pass &= ck::utils::check_err(y.mData, host_y.mData, "Error: Incorrect results", 1e-3, 1e-3);
+    }
+
+    return pass ? 0 : 1;
+}
@@ -1,6 +1,11 @@
 #ifndef CK_CONFIG_AMD_HPP
 #define CK_CONFIG_AMD_HPP
 
+// host backend: kernels run on the CPU, see library/include/ck/library/host_backend
+#ifndef CK_HOST_BACKEND
+#define CK_HOST_BACKEND 0
+#endif
+
 #ifndef CK_DONT_USE_HIP_RUNTIME_HEADERS
 #include "hip/hip_runtime.h"
 #include "hip/hip_fp16.h"
@@ -8,7 +13,11 @@
 
 // constant address space for kernel parameter
 // https://llvm.org/docs/AMDGPUUsage.html#address-spaces
+#if CK_HOST_BACKEND
+#define CK_CONSTANT_ADDRESS_SPACE
+#else
 #define CK_CONSTANT_ADDRESS_SPACE __attribute__((address_space(4)))
+#endif
 
 // launch bounds
 #define CK_USE_LAUNCH_BOUNDS 1
@@ -48,7 +57,8 @@
 #endif
 
 // MFMA instruction
-#ifndef __HIP_DEVICE_COMPILE__ // for host code
+#if CK_HOST_BACKEND                    // not emulated
+#elif !defined(__HIP_DEVICE_COMPILE__) // for host code
 #define CK_USE_AMD_MFMA
 #elif defined(__gfx908__) || defined(__gfx90a__) // for GPU code
 #define CK_USE_AMD_MFMA
@@ -76,7 +86,7 @@
 #define CK_USE_AMD_BUFFER_ATOMIC_ADD_FLOAT 0
 #endif
 
-#if defined(__gfx90a__) // for GPU code
+#if CK_HOST_BACKEND || defined(__gfx90a__)
 #define CK_USE_AMD_BUFFER_ATOMIC_MAX_FLOAT64 1
 #else
 #define CK_USE_AMD_BUFFER_ATOMIC_MAX_FLOAT64 0
@@ -89,7 +99,11 @@
 #define CK_USE_AMD_INNER_PRODUCT_INLINE_ASM 1
 
 // block synchronization only s_wait lgkmcnt(0), not vmcnt(0)
+#if CK_HOST_BACKEND
+#define CK_EXPERIMENTAL_BLOCK_SYNC_LDS_WITHOUT_SYNC_VMEM 0
+#else
 #define CK_EXPERIMENTAL_BLOCK_SYNC_LDS_WITHOUT_SYNC_VMEM 1
+#endif
 
 // experimental feature: multi index implemented as array
 #define CK_EXPERIMENTAL_USE_DYNAMICALLY_INDEXED_MULTI_INDEX 0
@@ -3,8 +3,19 @@
 #include <hip/hip_runtime.h>
 #include <hip/hip_fp16.h>
 
+struct KernelTimingResult;
+
 struct StreamConfig
 {
     hipStream_t stream_id_ = nullptr;
     bool time_kernel_      = false;
+
+    // untimed warm-up runs and timed runs of a timed kernel, and if the L2 cache is flushed
+    // before each timed run
+    int n_warmup_     = 1;
+    int n_repeat_     = 10;
+    bool flush_cache_ = false;
+
+    // if set, timed kernels add the times of their runs to it, see launch_and_time_kernel()
+    KernelTimingResult* timing_result_ = nullptr;
 };
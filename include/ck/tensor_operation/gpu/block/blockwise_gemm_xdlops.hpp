@@ -22,6 +22,16 @@ constexpr LoopScheduler make_default_loop_scheduler()
 #endif // if CK_EXPERIMENTAL_INTER_WAVE_SCHEDULING
 }
 
+inline const char* getLoopSchedulerStr(LoopScheduler s)
+{
+    switch(s)
+    {
+    case LoopScheduler::Default: return "Default";
+    case LoopScheduler::Interwave: return "Interwave";
+    default: return "Unrecognized scheduler!";
+    }
+}
+
 template <index_t BlockSize,
           typename FloatAB,
           typename FloatAcc,
@@ -193,6 +193,102 @@ struct PartitionedBlockwiseReductionWithIndex
     };
 };
 
+// clang-format off
+// Assume:
+//  1) work_mean_buffer/work_m2_buffer/work_count_buffer is buffer (typically LDS) allocated outside as workspace, does not include any in/out data
+//  2) work_mean_buffer/work_m2_buffer/work_count_buffer has AccDataType/AccDataType/index_t elements, and space size is no less than BlockSize
+//  3) in_out_mean/in_out_m2/in_out_count is the input Welford triple in vgpr from each thread
+//  4) in_out_mean/in_out_m2/in_out_count is the over-written merged triple in vgpr for each thread
+// clang-format on
+template <typename AccDataType,
+          index_t BlockSize,
+          typename ThreadClusterLengths_M_K,
+          typename ThreadClusterArrangeOrder>
+struct PartitionedBlockwiseWelford
+{
+    static_assert(BlockSize == ThreadClusterLengths_M_K::At(0) * ThreadClusterLengths_M_K::At(1),
+                  "The product of cluster lengths should be same as BlockSize!");
+
+    static constexpr auto BufferLength_M = ThreadClusterLengths_M_K::At(0);
+    static constexpr auto BufferLength_K = ThreadClusterLengths_M_K::At(1);
+
+    static_assert(BufferLength_K > 1, "Parallel reduction need work on at least two elements");
+
+    static constexpr auto block_buf_desc_m_k = make_naive_tensor_descriptor_packed(
+        make_tuple(Number<BufferLength_M>{}, Number<BufferLength_K>{}));
+
+    static constexpr auto thread_cluster_desc =
+        make_cluster_descriptor(ThreadClusterLengths_M_K{}, ThreadClusterArrangeOrder{});
+
+    using Accumulation = detail::AccumulateWelford<AccDataType>;
+
+    template <typename BufferType, typename CountBufferType>
+    __device__ static void Reduce(BufferType& work_mean_buffer,
+                                  BufferType& work_m2_buffer,
+                                  CountBufferType& work_count_buffer,
+                                  AccDataType& in_out_mean,
+                                  AccDataType& in_out_m2,
+                                  index_t& in_out_count)
+    {
+        static_assert(is_same<typename BufferType::type, AccDataType>{},
+                      "Buffer data type should be consistent as AccDataType!");
+        static_assert(is_same<typename CountBufferType::type, index_t>{},
+                      "Count buffer data type should be index_t!");
+
+        constexpr auto cluster_len_shift = get_shift<BufferLength_K>();
+
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(get_thread_local_1d_id()));
+
+        const auto thread_m_cluster_id = thread_cluster_idx[Number<0>{}];
+        const auto thread_k_cluster_id = thread_cluster_idx[Number<1>{}];
+
+        const index_t own_offset = block_buf_desc_m_k.CalculateOffset(thread_cluster_idx);
+
+        // a previous call may still be reading the results of its row
+        __syncthreads();
+
+        work_mean_buffer(own_offset)  = in_out_mean;
+        work_m2_buffer(own_offset)    = in_out_m2;
+        work_count_buffer(own_offset) = in_out_count;
+
+        __syncthreads();
+
+        static_for<0, cluster_len_shift, 1>{}([&](auto I) {
+            constexpr index_t indOffset = 1 << (cluster_len_shift - 1 - I());
+
+            if(thread_k_cluster_id < indOffset)
+            {
+                index_t offset2 = block_buf_desc_m_k.CalculateOffset(thread_cluster_idx +
+                                                                     make_tuple(0, indOffset));
+
+                AccDataType mean1 = work_mean_buffer[own_offset];
+                AccDataType m2_1  = work_m2_buffer[own_offset];
+                index_t count1    = work_count_buffer[own_offset];
+
+                Accumulation::Merge(mean1,
+                                    m2_1,
+                                    count1,
+                                    work_mean_buffer[offset2],
+                                    work_m2_buffer[offset2],
+                                    work_count_buffer[offset2]);
+
+                work_mean_buffer(own_offset)  = mean1;
+                work_m2_buffer(own_offset)    = m2_1;
+                work_count_buffer(own_offset) = count1;
+            }
+
+            __syncthreads();
+        });
+
+        index_t offset = block_buf_desc_m_k.CalculateOffset(make_tuple(thread_m_cluster_id, 0));
+
+        in_out_mean  = work_mean_buffer[offset];
+        in_out_m2    = work_m2_buffer[offset];
+        in_out_count = work_count_buffer[offset];
+    };
+};
+
 }; // end of namespace ck
 
 #endif
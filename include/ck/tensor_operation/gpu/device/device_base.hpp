@@ -1,6 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "stream_config.hpp"
 
@@ -15,6 +20,9 @@ struct BaseArgument
     BaseArgument& operator=(const BaseArgument&) = default;
 
     virtual ~BaseArgument() {}
+
+    // device memory of GetWorkSpaceSize() bytes owned by the caller, see BaseOperator
+    void* p_workspace_ = nullptr;
 };
 
 struct BaseInvoker
@@ -31,6 +39,81 @@ struct BaseInvoker
     virtual ~BaseInvoker() {}
 };
 
+// Compile-time parameters of an operator instance, keyed by the name of the template parameter
+// (BlockSize, MPerBlock, K1, vector widths, prefetch stages, ...), so tuning tools can filter and
+// rank instances without parsing GetTypeString(). Enumerations such as GemmSpecialization are
+// kept as their names in the options. Estimates derived from the parameters are stored under
+// fixed keys:
+//   LdsBytes: LDS allocated per workgroup
+//   AccVgprs: 32-bit registers per thread holding the thread's tile of accumulators
+struct TuningParams
+{
+    TuningParams() = default;
+
+    explicit TuningParams(std::string name) : name_(std::move(name)) {}
+
+    TuningParams& Set(const std::string& key, int64_t value)
+    {
+        values_.emplace_back(key, value);
+        return *this;
+    }
+
+    TuningParams& SetOption(const std::string& key, std::string value)
+    {
+        options_.emplace_back(key, std::move(value));
+        return *this;
+    }
+
+    const std::string& GetName() const { return name_; }
+
+    bool Has(const std::string& key) const { return Find(values_, key) != nullptr; }
+
+    bool HasOption(const std::string& key) const { return Find(options_, key) != nullptr; }
+
+    // throws std::out_of_range if the instance has no parameter `key`
+    int64_t Get(const std::string& key) const { return At(values_, key); }
+
+    int64_t Get(const std::string& key, int64_t default_value) const
+    {
+        const auto* p = Find(values_, key);
+
+        return p == nullptr ? default_value : p->second;
+    }
+
+    const std::string& GetOption(const std::string& key) const { return At(options_, key); }
+
+    // in the order of the template parameters
+    const std::vector<std::pair<std::string, int64_t>>& GetValues() const { return values_; }
+    const std::vector<std::pair<std::string, std::string>>& GetOptions() const { return options_; }
+
+    private:
+    template <typename V>
+    static const std::pair<std::string, V>* Find(const std::vector<std::pair<std::string, V>>& kvs,
+                                                 const std::string& key)
+    {
+        for(const auto& kv : kvs)
+            if(kv.first == key)
+                return &kv;
+
+        return nullptr;
+    }
+
+    template <typename V>
+    const V& At(const std::vector<std::pair<std::string, V>>& kvs, const std::string& key) const
+    {
+        const auto* p = Find(kvs, key);
+
+        if(p == nullptr)
+            throw std::out_of_range(name_ + " has no tuning parameter " + key);
+
+        return p->second;
+    }
+
+    std::string name_;
+    std::vector<std::pair<std::string, int64_t>> values_;
+    std::vector<std::pair<std::string, std::string>> options_;
+};
+
 struct BaseOperator
 {
     BaseOperator()                    = default;
@@ -39,6 +122,20 @@ struct BaseOperator
 
     virtual bool IsSupportedArgument(const BaseArgument*) { return false; }
     virtual std::string GetTypeString() const { return ""; }
+    virtual TuningParams GetTuningParams() const { return TuningParams{GetTypeString()}; }
+
+    // number of workgroups launched for an argument, summed over all kernels, 0 if unknown
+    virtual int64_t GetGridSize(const BaseArgument*) const { return 0; }
+
+    // Device memory an argument needs besides its tensors. The caller allocates it and passes it
+    // with SetWorkSpacePointer() before running the argument; it stays in use until the last
+    // kernel launched with the argument is done.
+    virtual std::size_t GetWorkSpaceSize(const BaseArgument*) const { return 0; }
+
+    virtual void SetWorkSpacePointer(BaseArgument* p_arg, void* p_workspace) const
+    {
+        p_arg->p_workspace_ = p_workspace;
+    }
 
     virtual ~BaseOperator() {}
 };
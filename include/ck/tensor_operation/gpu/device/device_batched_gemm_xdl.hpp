@@ -611,6 +611,44 @@ struct DeviceBatchedGemmXdl
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceBatchedGemmXdl"};
+
+        // clang-format off
+        params.Set("BlockSize", BlockSize)
+              .Set("MPerBlock", MPerBlock)
+              .Set("NPerBlock", NPerBlock)
+              .Set("K0PerBlock", K0PerBlock)
+              .Set("K1", K1)
+              .Set("MPerXDL", MPerXDL)
+              .Set("NPerXDL", NPerXDL)
+              .Set("MXdlPerWave", MXdlPerWave)
+              .Set("NXdlPerWave", NXdlPerWave)
+              .Set("ABlockTransferSrcVectorDim", ABlockTransferSrcVectorDim)
+              .Set("ABlockTransferSrcScalarPerVector", ABlockTransferSrcScalarPerVector)
+              .Set("ABlockTransferDstScalarPerVector_K1", ABlockTransferDstScalarPerVector_K1)
+              .Set("ABlockLdsAddExtraM", ABlockLdsAddExtraM)
+              .Set("BBlockTransferSrcVectorDim", BBlockTransferSrcVectorDim)
+              .Set("BBlockTransferSrcScalarPerVector", BBlockTransferSrcScalarPerVector)
+              .Set("BBlockTransferDstScalarPerVector_K1", BBlockTransferDstScalarPerVector_K1)
+              .Set("BBlockLdsAddExtraN", BBlockLdsAddExtraN)
+              .Set("CThreadTransferSrcDstVectorDim", CThreadTransferSrcDstVectorDim)
+              .Set("CThreadTransferDstScalarPerVector", CThreadTransferDstScalarPerVector)
+              .Set("LdsBytes", GridwiseGemm::GetSharedMemoryNumberOfByte())
+              .Set("AccVgprs", MPerBlock * NPerBlock / BlockSize * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.block_2_ctile_map_.CalculateGridSize(arg.c_grid_desc_m_n_) * arg.BatchCount_;
+    }
 };
 
 } // namespace device
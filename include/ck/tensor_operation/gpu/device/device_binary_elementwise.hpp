@@ -4,6 +4,7 @@
 
 #include "device.hpp"
 #include "device_base.hpp"
+#include "device_properties.hpp"
 #include "gridwise_binary_elementwise_1d.hpp"
 
 namespace ck {
@@ -61,6 +62,21 @@ struct DeviceBinaryElementwise : public BaseOperator
             return PadDescriptor_M0_1d(desc, gridSize, blockSize);
     }
 
+    // as many workgroups as the device runs at once, each looping over vectors of the problem
+    static index_t CalculateGridSize(const std::vector<index_t>& shape, index_t blockSize)
+    {
+        int64_t m0 = 1;
+
+        for(const auto length : shape)
+            m0 *= length;
+
+        // a workgroup reads blockSize vectors per iteration
+        const int64_t num_block_iter =
+            math::integer_divide_ceil(m0, int64_t{blockSize} * ScalarPerVector);
+
+        return static_cast<index_t>(get_persistent_grid_size(blockSize, 0, num_block_iter));
+    }
+
     using GridDesc_M0        = decltype(MakeDescriptor_M0({1, 1}, {1, 1}, 1, 1));
     using GridwiseBinEltwise = GridwiseBinaryElementwise_1D<ADataType,
                                                             BDataType,
@@ -86,7 +102,7 @@ struct DeviceBinaryElementwise : public BaseOperator
               shape_(shape),
               functor_(functor),
               blockSize_(256),
-              gridSize_(120) // FIXME - Calculate the grid size by number of CU in the future
+              gridSize_(CalculateGridSize(shape, blockSize_))
         {
             a_grid_desc_m0_ = MakeDescriptor_M0(shape, stride_a, gridSize_, blockSize_);
             b_grid_desc_m0_ = MakeDescriptor_M0(shape, stride_b, gridSize_, blockSize_);
@@ -186,6 +202,26 @@ struct DeviceBinaryElementwise : public BaseOperator
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceBinaryElementwise"};
+
+        // clang-format off
+        params.Set("Dim", Dim)
+              .Set("ScalarPerVector", ScalarPerVector)
+              .Set("LdsBytes", 0);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.gridSize_;
+    }
 };
 
 } // namespace device
@@ -816,6 +816,54 @@ struct DeviceConv2dBwdDataXdl_Input_N_Hi_Wi_C_Weight_K_Y_X_C_Output_N_Ho_Wo_K
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceConv2dBwdDataXdl_Input_N_Hi_Wi_C_Weight_K_Y_X_C_Output_N_Ho_Wo_K"};
+
+        // clang-format off
+        params.SetOption("ConvBackwardDataSpecialization", getConvBwdDataSpecializationStr(ConvBackwardDataSpecialization))
+              .Set("BlockSize", BlockSize)
+              .Set("MPerBlock", MPerBlock)
+              .Set("NPerBlock", NPerBlock)
+              .Set("K0PerBlock", K0PerBlock)
+              .Set("K1", K1)
+              .Set("MPerXdl", MPerXdl)
+              .Set("NPerXdl", NPerXdl)
+              .Set("MXdlPerWave", MXdlPerWave)
+              .Set("NXdlPerWave", NXdlPerWave)
+              .Set("ABlockTransferSrcVectorDim", ABlockTransferSrcVectorDim)
+              .Set("ABlockTransferSrcScalarPerVector", ABlockTransferSrcScalarPerVector)
+              .Set("ABlockTransferDstScalarPerVector_K1", ABlockTransferDstScalarPerVector_K1)
+              .Set("ABlockLdsAddExtraM", ABlockLdsAddExtraM)
+              .Set("BBlockTransferSrcVectorDim", BBlockTransferSrcVectorDim)
+              .Set("BBlockTransferSrcScalarPerVector", BBlockTransferSrcScalarPerVector)
+              .Set("BBlockTransferDstScalarPerVector_K1", BBlockTransferDstScalarPerVector_K1)
+              .Set("BBlockLdsAddExtraN", BBlockLdsAddExtraN)
+              .Set("CThreadTransferSrcDstVectorDim", CThreadTransferSrcDstVectorDim)
+              .Set("CThreadTransferDstScalarPerVector", CThreadTransferDstScalarPerVector)
+              .Set("LdsBytes", GridwiseGemm::GetSharedMemoryNumberOfByte())
+              .Set("AccVgprs", MPerBlock * NPerBlock / BlockSize * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        // one kernel per group of filter taps
+        int64_t grid_size = 0;
+
+        for(std::size_t i = 0; i < arg.a_grid_desc_k0_m_k1_container_.size(); i++)
+        {
+            grid_size += arg.block_2_ctile_map_container_[i].CalculateGridSize(
+                arg.c_grid_desc_m_n_container_[i]);
+        }
+
+        return grid_size;
+    }
 };
 
 } // namespace device
@@ -966,6 +966,46 @@ struct
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceConv2dFwdXdl_C_Shuffle_Bias_Activation_Add_Input_N_Hi_Wi_C_Weight_K_Y_X_C_Output_N_Ho_Wo_K"};
+
+        // clang-format off
+        params.SetOption("ConvForwardSpecialization", getConvFwdSpecializationStr(ConvForwardSpecialization))
+              .Set("BlockSize", BlockSize)
+              .Set("MPerBlock", MPerBlock)
+              .Set("NPerBlock", NPerBlock)
+              .Set("K0PerBlock", K0PerBlock)
+              .Set("K1", K1)
+              .Set("MPerXDL", MPerXDL)
+              .Set("NPerXDL", NPerXDL)
+              .Set("MXdlPerWave", MXdlPerWave)
+              .Set("NXdlPerWave", NXdlPerWave)
+              .Set("ABlockTransferSrcVectorDim", ABlockTransferSrcVectorDim)
+              .Set("ABlockTransferSrcScalarPerVector", ABlockTransferSrcScalarPerVector)
+              .Set("ABlockTransferDstScalarPerVector_K1", ABlockTransferDstScalarPerVector_K1)
+              .Set("ABlockLdsAddExtraM", ABlockLdsAddExtraM)
+              .Set("BBlockTransferSrcVectorDim", BBlockTransferSrcVectorDim)
+              .Set("BBlockTransferSrcScalarPerVector", BBlockTransferSrcScalarPerVector)
+              .Set("BBlockTransferDstScalarPerVector_K1", BBlockTransferDstScalarPerVector_K1)
+              .Set("BBlockLdsAddExtraN", BBlockLdsAddExtraN)
+              .Set("CShuffleMXdlPerWavePerShuffle", CShuffleMXdlPerWavePerShuffle)
+              .Set("CShuffleNXdlPerWavePerShuffle", CShuffleNXdlPerWavePerShuffle)
+              .Set("CBlockTransferScalarPerVector_NWaveNPerXdl", CBlockTransferScalarPerVector_NWaveNPerXdl)
+              .Set("LdsBytes", GridwiseGemm::GetSharedMemoryNumberOfByte())
+              .Set("AccVgprs", MPerBlock * NPerBlock / BlockSize * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.block_2_ctile_map_.CalculateGridSize(arg.c_grid_desc_m_n_);
+    }
 };
 } // namespace device
 } // namespace tensor_operation
@@ -257,6 +257,15 @@ struct DeviceConv3dFwdNaive_Input_N_Di_Hi_Wi_C_Weight_K_Z_Y_X_C_Output_N_Do_Ho_W
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        return TuningParams{"DeviceConv3dFwdNaive_Input_N_Di_Hi_Wi_C_Weight_K_Z_Y_X_C_Output_N_Do_Ho_Wo_K"}
+            .Set("LdsBytes", 0);
+    }
+
+    // the naive kernel is always launched on 256 workgroups
+    int64_t GetGridSize(const BaseArgument*) const override { return 256; }
 };
 
 } // namespace device
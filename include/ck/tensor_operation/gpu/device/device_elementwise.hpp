@@ -0,0 +1,318 @@
+#pragma once
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "device.hpp"
+#include "device_base.hpp"
+#include "device_properties.hpp"
+#include "elementwise_dim_folding.hpp"
+#include "gridwise_elementwise_1d.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// out_0, ..., out_M-1 = elementwise_op(in_0, ..., in_N-1) over tensors of the same lengths, each
+// with its own strides; an input broadcast along a dimension has stride 0 in it. The dimensions
+// are folded on the host (fold_elementwise_dims) before the descriptors are made, so a problem
+// whose tensors are contiguous together runs as a 1-D one whatever its rank, and NumDim only
+// bounds the rank after folding.
+//
+// In/OutDataTypeTuple are ck::Tuple of the data types of the tensors, In/OutScalarPerVectorSeq
+// the width of the vector each tensor is accessed in, which must divide MPerThread. An argument is
+// supported if every tensor can be accessed in vectors of its width
+// (get_elementwise_vector_size).
+template <typename InDataTypeTuple,
+          typename OutDataTypeTuple,
+          typename ComputeDataType,
+          typename ElementwiseOperation,
+          index_t NumDim,
+          index_t MPerThread,
+          typename InScalarPerVectorSeq,
+          typename OutScalarPerVectorSeq>
+struct DeviceElementwise : public BaseOperator
+{
+    static constexpr index_t NumInput  = InDataTypeTuple::Size();
+    static constexpr index_t NumOutput = OutDataTypeTuple::Size();
+
+    static constexpr auto I0 = Number<0>{};
+
+    static constexpr index_t BlockSize = 256;
+
+    static auto GenerateInDataTypePointerTuple()
+    {
+        return generate_tuple(
+            [&](auto I) {
+                using DataType = remove_cvref_t<decltype(InDataTypeTuple{}[I])>;
+
+                return static_cast<const DataType*>(nullptr);
+            },
+            Number<NumInput>{});
+    }
+
+    static auto GenerateOutDataTypePointerTuple()
+    {
+        return generate_tuple(
+            [&](auto I) {
+                using DataType = remove_cvref_t<decltype(OutDataTypeTuple{}[I])>;
+
+                return static_cast<DataType*>(nullptr);
+            },
+            Number<NumOutput>{});
+    }
+
+    using InDataTypePointerTuple  = decltype(GenerateInDataTypePointerTuple());
+    using OutDataTypePointerTuple = decltype(GenerateOutDataTypePointerTuple());
+
+    // 1-D descriptor of a tensor of a folded problem of at most NumDim dims, padded to a whole
+    // number of iterations of the grid
+    static auto MakeDescriptor_M(const std::vector<index_t>& lengths,
+                                 const std::vector<index_t>& strides,
+                                 index_t gridSize)
+    {
+        // outer dims of length 1 make up for the dims folded away
+        const index_t num_pad_dim = NumDim - static_cast<index_t>(lengths.size());
+
+        const auto tupleOfShape = generate_tuple(
+            [&](auto I) {
+                const index_t d = I;
+                return d < num_pad_dim ? 1 : lengths[d - num_pad_dim];
+            },
+            Number<NumDim>{});
+        const auto tupleOfStride = generate_tuple(
+            [&](auto I) {
+                const index_t d = I;
+                return d < num_pad_dim ? 0 : strides[d - num_pad_dim];
+            },
+            Number<NumDim>{});
+
+        // nd desc - [s0, s1, s2, ...]
+        const auto desc = make_naive_tensor_descriptor(tupleOfShape, tupleOfStride);
+
+        // merge nd to 1d desc - [s0 * s1 * ...]
+        const auto desc_m = transform_tensor_descriptor(
+            desc,
+            make_tuple(make_merge_transform(tupleOfShape)),
+            make_tuple(generate_sequence_v2([&](auto I) { return I; }, Number<NumDim>{})),
+            make_tuple(Sequence<0>{}));
+
+        const auto m            = desc_m.GetLength(I0);
+        const index_t loop_step = gridSize * BlockSize * MPerThread;
+        // an empty problem still runs the one iteration the kernel starts with
+        const auto pad = math::integer_least_multiple(math::max(m, index_t{1}), loop_step) - m;
+
+        return transform_tensor_descriptor(desc_m,
+                                           make_tuple(make_right_pad_transform(m, pad)),
+                                           make_tuple(Sequence<0>{}),
+                                           make_tuple(Sequence<0>{}));
+    }
+
+    using GridDesc_M = decltype(MakeDescriptor_M({1}, {1}, 1));
+
+    using InGridDescTuple =
+        decltype(generate_tuple([](auto) { return GridDesc_M{}; }, Number<NumInput>{}));
+    using OutGridDescTuple =
+        decltype(generate_tuple([](auto) { return GridDesc_M{}; }, Number<NumOutput>{}));
+
+    using GridwiseElementwise = GridwiseElementwise_1D<InDataTypeTuple,
+                                                       OutDataTypeTuple,
+                                                       ComputeDataType,
+                                                       GridDesc_M,
+                                                       ElementwiseOperation,
+                                                       MPerThread,
+                                                       InScalarPerVectorSeq,
+                                                       OutScalarPerVectorSeq>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const std::array<const void*, NumInput>& p_in,
+                 const std::array<void*, NumOutput>& p_out,
+                 const std::vector<index_t>& lengths,
+                 const std::array<std::vector<index_t>, NumInput>& in_strides,
+                 const std::array<std::vector<index_t>, NumOutput>& out_strides,
+                 ElementwiseOperation elementwise_op)
+            : elementwise_op_(elementwise_op), blockSize_(BlockSize)
+        {
+            p_in_tuple_ = generate_tuple(
+                [&](auto I) {
+                    using DataType = remove_cvref_t<decltype(InDataTypeTuple{}[I])>;
+
+                    return static_cast<const DataType*>(p_in[I]);
+                },
+                Number<NumInput>{});
+
+            p_out_tuple_ = generate_tuple(
+                [&](auto I) {
+                    using DataType = remove_cvref_t<decltype(OutDataTypeTuple{}[I])>;
+
+                    return static_cast<DataType*>(p_out[I]);
+                },
+                Number<NumOutput>{});
+
+            // inputs first
+            std::vector<std::vector<index_t>> strides(in_strides.begin(), in_strides.end());
+            strides.insert(strides.end(), out_strides.begin(), out_strides.end());
+
+            problem_ = fold_elementwise_dims(lengths, strides);
+
+            index_t num_element = 1;
+
+            for(const auto length : problem_.lengths)
+                num_element *= length;
+
+            // as many workgroups as the device runs at once, looping if there are fewer than the
+            // problem takes
+            const index_t num_block_iter =
+                math::integer_divide_ceil(num_element, BlockSize * MPerThread);
+
+            gridSize_ =
+                static_cast<index_t>(get_persistent_grid_size(BlockSize, 0, num_block_iter));
+
+            if(static_cast<index_t>(problem_.lengths.size()) > NumDim)
+                return;
+
+            in_grid_desc_m_tuple_ = generate_tuple(
+                [&](auto I) {
+                    return MakeDescriptor_M(problem_.lengths, problem_.strides[I], gridSize_);
+                },
+                Number<NumInput>{});
+
+            out_grid_desc_m_tuple_ = generate_tuple(
+                [&](auto I) {
+                    return MakeDescriptor_M(
+                        problem_.lengths, problem_.strides[NumInput + I], gridSize_);
+                },
+                Number<NumOutput>{});
+        }
+
+        InDataTypePointerTuple p_in_tuple_;
+        OutDataTypePointerTuple p_out_tuple_;
+        // folded, strides of the inputs then the outputs
+        ElementwiseProblem problem_;
+        InGridDescTuple in_grid_desc_m_tuple_;
+        OutGridDescTuple out_grid_desc_m_tuple_;
+        ElementwiseOperation elementwise_op_;
+        index_t blockSize_;
+        index_t gridSize_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            const auto kernel = kernel_elementwise_1d<GridwiseElementwise,
+                                                      InDataTypePointerTuple,
+                                                      OutDataTypePointerTuple,
+                                                      InGridDescTuple,
+                                                      OutGridDescTuple,
+                                                      ElementwiseOperation>;
+
+            float elapsed_time = launch_and_time_kernel(stream_config,
+                                                        kernel,
+                                                        dim3(arg.gridSize_),
+                                                        dim3(arg.blockSize_),
+                                                        0,
+                                                        arg.p_in_tuple_,
+                                                        arg.p_out_tuple_,
+                                                        arg.in_grid_desc_m_tuple_,
+                                                        arg.out_grid_desc_m_tuple_,
+                                                        arg.elementwise_op_);
+            return elapsed_time;
+        }
+
+        // polymorphic
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const Argument* pArg = dynamic_cast<const Argument*>(p_arg);
+
+        if(pArg == nullptr)
+            return false;
+
+        const auto& problem = pArg->problem_;
+
+        if(static_cast<index_t>(problem.lengths.size()) > NumDim)
+            return false;
+
+        bool valid = true;
+
+        static_for<0, NumInput, 1>{}([&](auto I) {
+            valid &= get_elementwise_vector_size(problem.lengths, problem.strides[I], MPerThread) %
+                         InScalarPerVectorSeq::At(I) ==
+                     0;
+        });
+
+        static_for<0, NumOutput, 1>{}([&](auto I) {
+            valid &= get_elementwise_vector_size(
+                         problem.lengths, problem.strides[NumInput + I], MPerThread) %
+                         OutScalarPerVectorSeq::At(I) ==
+                     0;
+        });
+
+        return valid;
+    };
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const std::array<const void*, NumInput>& p_in,
+                        const std::array<void*, NumOutput>& p_out,
+                        const std::vector<index_t>& lengths,
+                        const std::array<std::vector<index_t>, NumInput>& in_strides,
+                        const std::array<std::vector<index_t>, NumOutput>& out_strides,
+                        ElementwiseOperation elementwise_op)
+    {
+        return std::make_unique<Argument>(
+            p_in, p_out, lengths, in_strides, out_strides, elementwise_op);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() { return std::make_unique<Invoker>(); }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceElementwise"
+            << "<"
+            << "NumInput = " << NumInput << ", "
+            << "NumOutput = " << NumOutput << ", "
+            << "NumDim = " << NumDim << ", "
+            << "MPerThread = " << MPerThread
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceElementwise"};
+
+        // clang-format off
+        params.Set("NumDim", NumDim)
+              .Set("BlockSize", BlockSize)
+              .Set("MPerThread", MPerThread)
+              .Set("LdsBytes", 0);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.gridSize_;
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -14,6 +14,12 @@ struct GemmShape
     ck::index_t StrideA, StrideB, StrideC;
 };
 
+inline bool operator==(const GemmShape& a, const GemmShape& b)
+{
+    return a.M == b.M && a.N == b.N && a.K == b.K && a.StrideA == b.StrideA &&
+           a.StrideB == b.StrideB && a.StrideC == b.StrideC;
+}
+
 template <typename AElementwiseOperation,
           typename BElementwiseOperation,
           typename CElementwiseOperation>
@@ -56,6 +62,14 @@ struct DeviceGroupedGemm : public BaseOperator
                                                               CElementwiseOperation c_element_op,
                                                               ck::index_t KBatch = 1) = 0;
 
+    // Point an argument at new tensors and shapes. Group descriptors whose shape is unchanged
+    // are not rebuilt, so changing only the pointers is cheap. The workspace size may change.
+    virtual void UpdateArgument(BaseArgument* p_arg,
+                                std::vector<const void*>& p_a,
+                                std::vector<const void*>& p_b,
+                                std::vector<void*>& p_c,
+                                std::vector<GemmShape>& gemm_shapes) = 0;
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
@@ -750,6 +750,51 @@ struct DeviceGemmReduce_Xdl_CShuffle : public DeviceGemmReduce<DPtrsGlobal,
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceGemmReduce_Xdl_CShuffle"};
+
+        // clang-format off
+        params.SetOption("GemmSpec", getGemmSpecializationStr(GemmSpec))
+              .Set("NumGemmKPrefetchStage", NumGemmKPrefetchStage)
+              .Set("BlockSize", BlockSize)
+              .Set("MPerBlock", MPerBlock)
+              .Set("NPerBlock", NPerBlock)
+              .Set("KPerBlock", KPerBlock)
+              .Set("AK1", AK1)
+              .Set("BK1", BK1)
+              .Set("MPerXDL", MPerXDL)
+              .Set("NPerXDL", NPerXDL)
+              .Set("MXdlPerWave", MXdlPerWave)
+              .Set("NXdlPerWave", NXdlPerWave)
+              .Set("ABlockTransferSrcVectorDim", ABlockTransferSrcVectorDim)
+              .Set("ABlockTransferSrcScalarPerVector", ABlockTransferSrcScalarPerVector)
+              .Set("ABlockTransferDstScalarPerVector_AK1", ABlockTransferDstScalarPerVector_AK1)
+              .Set("ABlockLdsExtraM", ABlockLdsExtraM)
+              .Set("BBlockTransferSrcVectorDim", BBlockTransferSrcVectorDim)
+              .Set("BBlockTransferSrcScalarPerVector", BBlockTransferSrcScalarPerVector)
+              .Set("BBlockTransferDstScalarPerVector_BK1", BBlockTransferDstScalarPerVector_BK1)
+              .Set("BBlockLdsExtraN", BBlockLdsExtraN)
+              .Set("CShuffleMXdlPerWavePerShuffle", CShuffleMXdlPerWavePerShuffle)
+              .Set("CShuffleNXdlPerWavePerShuffle", CShuffleNXdlPerWavePerShuffle)
+              .Set("CShuffleBlockTransferScalarPerVector_NPerBlock", CShuffleBlockTransferScalarPerVector_NPerBlock)
+              .Set("CReduceThreadLds2VGprCopySrcDstScalarPerVector_NPerBlock", CReduceThreadLds2VGprCopySrcDstScalarPerVector_NPerBlock)
+              .Set("CReduceThreadVgpr2GlobalCopySrcDstScalarPerVector_MPerBlock", CReduceThreadVgpr2GlobalCopySrcDstScalarPerVector_MPerBlock)
+              .SetOption("LoopSched", getLoopSchedulerStr(LoopSched))
+              .Set("LdsBytes", GridwiseGemm::GetSharedMemoryNumberOfByte())
+              .Set("AccVgprs", MPerBlock * NPerBlock / BlockSize * static_cast<index_t>(sizeof(GemmAccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.block_2_ctile_map_.CalculateGridSize(arg.c_grid_desc_m_n_);
+    }
 };
 
 } // namespace device
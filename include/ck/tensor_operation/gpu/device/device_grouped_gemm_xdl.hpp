@@ -1,7 +1,6 @@
 #ifndef DEVICE_GROUPED_GEMM_XDL_HPP
 #define DEVICE_GROUPED_GEMM_XDL_HPP
 
-#include <iostream>
 #include <sstream>
 #include "device.hpp"
 #include "device_base.hpp"
@@ -12,6 +11,7 @@
 #include "tensor_descriptor_helper.hpp"
 #include "gridwise_gemm_xdlops_v2r3.hpp"
 #include "gemm_specialization.hpp"
+#include "grouped_gemm_table.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -24,74 +24,41 @@ template <typename GridwiseGemm,
           typename AElementwiseOperation,
           typename BElementwiseOperation,
           typename CElementwiseOperation,
-          bool HasMainKBlockLoop,
-          index_t MaxGroupCount>
+          bool HasMainKBlockLoop>
 __global__ void
 #if CK_USE_LAUNCH_BOUNDS
     __launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
 #endif
-        kernel_grouped_gemm_xdlops_v2r3(
-            const StaticallyIndexedArray<GemmDesc, MaxGroupCount> gemm_descs,
-            const index_t group_count,
-            const AElementwiseOperation a_element_op,
-            const BElementwiseOperation b_element_op,
-            const CElementwiseOperation c_element_op)
+        kernel_grouped_gemm_xdlops_v2r3(const void CK_CONSTANT_ADDRESS_SPACE* gemm_descs_const,
+                                        const index_t group_count,
+                                        const AElementwiseOperation a_element_op,
+                                        const BElementwiseOperation b_element_op,
+                                        const CElementwiseOperation c_element_op)
 {
 #if(!defined(__HIP_DEVICE_COMPILE__) || defined(__gfx908__) || defined(__gfx90a__))
     __shared__ char p_shared[GridwiseGemm::GetSharedMemoryNumberOfByte()];
 
     const index_t block_id = get_block_1d_id();
 
-#if 1
-    static_for<0, MaxGroupCount, 1>{}([&](auto i) {
-        if(block_id >= gemm_descs[i].BlockStart_ && block_id < gemm_descs[i].BlockEnd_ &&
-           i < group_count)
-        {
-            auto group_id = i;
-
-            GridwiseGemm::template Run<HasMainKBlockLoop>(
-                gemm_descs[group_id].a_ptr,
-                gemm_descs[group_id].b_ptr,
-                gemm_descs[group_id].c_ptr,
-                p_shared,
-                gemm_descs[group_id].a_grid_desc_k0_m_k1_,
-                gemm_descs[group_id].b_grid_desc_k0_n_k1_,
-                gemm_descs[group_id].c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
-                a_element_op,
-                b_element_op,
-                c_element_op,
-                gemm_descs[group_id].grouped_gemm_block_2_ctile_map_);
-        }
-    });
-#else
-    const auto gemm_desc_ptr = reinterpret_cast<const GemmDesc*>(&gemm_descs);
+    const auto gemm_descs = reinterpret_cast<const GemmDesc*>(
+        cast_pointer_to_generic_address_space(gemm_descs_const));
 
-    index_t group_id = 0;
-    static_for<0, MaxGroupCount, 1>{}([&](auto i) {
-        group_id = (block_id >= gemm_descs[i].BlockStart && block_id < gemm_descs[i].BlockEnd &&
-                    i < group_count)
-                       ? i
-                       : group_id;
-    });
-
-    const index_t block_id_grp = block_id - gemm_desc_ptr[group_id].BlockStart;
+    const index_t group_id = find_grouped_gemm_group(gemm_descs, group_count, block_id);
 
     GridwiseGemm::template Run<HasMainKBlockLoop>(
-        gemm_desc_ptr[group_id].a_ptr,
-        gemm_desc_ptr[group_id].b_ptr,
-        gemm_desc_ptr[group_id].c_ptr,
+        gemm_descs[group_id].a_ptr,
+        gemm_descs[group_id].b_ptr,
+        gemm_descs[group_id].c_ptr,
         p_shared,
-        gemm_desc_ptr[group_id].a_grid_desc_k0_m_k1_,
-        gemm_desc_ptr[group_id].b_grid_desc_k0_n_k1_,
-        gemm_desc_ptr[group_id].c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
+        gemm_descs[group_id].a_grid_desc_k0_m_k1_,
+        gemm_descs[group_id].b_grid_desc_k0_n_k1_,
+        gemm_descs[group_id].c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
         a_element_op,
         b_element_op,
         c_element_op,
-        gemm_desc_ptr[group_id].block_2_ctile_map_,
-        block_id_grp);
-#endif
+        gemm_descs[group_id].grouped_gemm_block_2_ctile_map_);
 #else
-    ignore = gemm_descs;
+    ignore = gemm_descs_const;
     ignore = group_count;
     ignore = a_element_op;
     ignore = b_element_op;
@@ -135,8 +102,7 @@ template <typename ADataType,
           bool BBlockLdsAddExtraN,
           ck::index_t CThreadTransferSrcDstVectorDim,
           ck::index_t CThreadTransferDstScalarPerVector,
-          ck::index_t NumPrefetch   = 1,
-          ck::index_t MaxGroupCount = 10>
+          ck::index_t NumPrefetch = 1>
 struct DeviceGroupedGemmXdl
     : public DeviceGroupedGemm<AElementwiseOperation, BElementwiseOperation, CElementwiseOperation>
 {
@@ -387,8 +353,14 @@ struct DeviceGroupedGemmXdl
               b_element_op_{b_element_op},
               c_element_op_{c_element_op}
         {
-            grid_size_ = 0;
+            Update(p_a, p_b, p_c, gemm_shapes);
+        }
 
+        void Update(std::vector<const void*>& p_a,
+                    std::vector<const void*>& p_b,
+                    std::vector<void*>& p_c,
+                    std::vector<GemmShape>& gemm_shapes)
+        {
             group_count_ = ck::type_convert<ck::index_t>(gemm_shapes.size());
 
             if(!(group_count_ == ck::type_convert<ck::index_t>(p_a.size()) &&
@@ -398,58 +370,70 @@ struct DeviceGroupedGemmXdl
                 throw std::runtime_error("wrong! group_count_ != P_a/b/c.size");
             }
 
-            gemm_desc_kernel_arg_.reserve(group_count_);
-
-            for(std::size_t i = 0; i < gemm_shapes.size(); i++)
-            {
-                const index_t M = gemm_shapes[i].M;
-                const index_t N = gemm_shapes[i].N;
-                const index_t K = gemm_shapes[i].K;
-
-                const index_t StrideA = gemm_shapes[i].StrideA;
-                const index_t StrideB = gemm_shapes[i].StrideB;
-                const index_t StrideC = gemm_shapes[i].StrideC;
-
-                const auto a_grid_desc_k0_m_k1_ =
-                    DeviceGroupedGemmXdl::MakeAGridDescriptor_K0_M_K1(M, K, StrideA);
-                const auto b_grid_desc_k0_n_k1_ =
-                    DeviceGroupedGemmXdl::MakeBGridDescriptor_K0_N_K1(K, N, StrideB);
+            const auto make_desc = [&](index_t, const GemmShape& shape, index_t BlockStart) {
+                const auto a_grid_desc_k0_m_k1_ = DeviceGroupedGemmXdl::MakeAGridDescriptor_K0_M_K1(
+                    shape.M, shape.K, shape.StrideA);
+                const auto b_grid_desc_k0_n_k1_ = DeviceGroupedGemmXdl::MakeBGridDescriptor_K0_N_K1(
+                    shape.K, shape.N, shape.StrideB);
                 const auto c_grid_desc_m_n_ =
-                    DeviceGroupedGemmXdl::MakeCGridDescriptor_M_N(M, N, StrideC);
+                    DeviceGroupedGemmXdl::MakeCGridDescriptor_M_N(shape.M, shape.N, shape.StrideC);
 
                 const index_t grid_size_grp =
                     typename GroupedGemmBlock2CTileMap::UnderlyingBlock2CTileMap(
-                        c_grid_desc_m_n_, M01, N01)
+                        c_grid_desc_m_n_, M01_, N01_)
                         .CalculateGridSize(c_grid_desc_m_n_);
 
-                const index_t BlockStart = grid_size_;
-                const index_t BlockEnd   = grid_size_ + grid_size_grp;
-
-                grid_size_ += grid_size_grp;
+                const index_t BlockEnd = BlockStart + grid_size_grp;
 
                 const auto grouped_gemm_block_2_ctile_map_ =
-                    GroupedGemmBlock2CTileMap(c_grid_desc_m_n_, M01, N01, BlockStart);
-
-                if(GridwiseGemm::CheckValidity(a_grid_desc_k0_m_k1_,
-                                               b_grid_desc_k0_n_k1_,
-                                               c_grid_desc_m_n_,
-                                               grouped_gemm_block_2_ctile_map_))
-                {
-                    const auto c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_ =
-                        GridwiseGemm::MakeCGridDescriptor_M0_N0_M1_N1_M2_M3_M4_N2(c_grid_desc_m_n_);
-
-                    gemm_desc_kernel_arg_.push_back(
-                        GemmDescKernelArg{a_grid_desc_k0_m_k1_,
-                                          b_grid_desc_k0_n_k1_,
-                                          c_grid_desc_m_n_,
-                                          c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
-                                          grouped_gemm_block_2_ctile_map_,
-                                          static_cast<const ADataType*>(p_a[i]),
-                                          static_cast<const BDataType*>(p_b[i]),
-                                          static_cast<CDataType*>(p_c[i]),
-                                          BlockStart,
-                                          BlockEnd});
-                }
+                    GroupedGemmBlock2CTileMap(c_grid_desc_m_n_, M01_, N01_, BlockStart);
+
+                const auto c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_ =
+                    GridwiseGemm::MakeCGridDescriptor_M0_N0_M1_N1_M2_M3_M4_N2(c_grid_desc_m_n_);
+
+                return GemmDescKernelArg{a_grid_desc_k0_m_k1_,
+                                         b_grid_desc_k0_n_k1_,
+                                         c_grid_desc_m_n_,
+                                         c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
+                                         grouped_gemm_block_2_ctile_map_,
+                                         nullptr,
+                                         nullptr,
+                                         nullptr,
+                                         BlockStart,
+                                         BlockEnd};
+            };
+
+            const auto set_pointers = [&](index_t i, GemmDescKernelArg& gemm_desc) {
+                gemm_desc.a_ptr = static_cast<const ADataType*>(p_a[i]);
+                gemm_desc.b_ptr = static_cast<const BDataType*>(p_b[i]);
+                gemm_desc.c_ptr = static_cast<CDataType*>(p_c[i]);
+            };
+
+            grid_size_ = gemm_desc_table_.Update(gemm_shapes, make_desc, set_pointers);
+
+            // all groups run in one kernel, which has one value of HasMainKBlockLoop
+            is_valid_              = true;
+            has_main_k_block_loop_ = true;
+
+            const auto& gemm_descs = gemm_desc_table_.GetDescs();
+
+            for(std::size_t i = 0; i < gemm_descs.size(); ++i)
+            {
+                is_valid_ = is_valid_ && GridwiseGemm::CheckValidity(
+                                             gemm_descs[i].a_grid_desc_k0_m_k1_,
+                                             gemm_descs[i].b_grid_desc_k0_n_k1_,
+                                             gemm_descs[i].c_grid_desc_m_n_,
+                                             gemm_descs[i].grouped_gemm_block_2_ctile_map_);
+
+                const auto K = gemm_descs[i].a_grid_desc_k0_m_k1_.GetLength(I0) *
+                               gemm_descs[i].a_grid_desc_k0_m_k1_.GetLength(I2);
+
+                const bool has_main_k_block_loop = GridwiseGemm::CalculateHasMainKBlockLoop(K);
+
+                if(i == 0)
+                    has_main_k_block_loop_ = has_main_k_block_loop;
+                else
+                    is_valid_ = is_valid_ && has_main_k_block_loop == has_main_k_block_loop_;
             }
         }
 
@@ -461,9 +445,12 @@ struct DeviceGroupedGemmXdl
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
 
-        std::vector<GemmDescKernelArg> gemm_desc_kernel_arg_;
+        // copied to the workspace by every Run
+        GroupedGemmTable<GemmShape, GemmDescKernelArg> gemm_desc_table_;
 
         index_t grid_size_;
+        bool is_valid_;
+        bool has_main_k_block_loop_;
     };
 
     // Invoker
@@ -473,53 +460,32 @@ struct DeviceGroupedGemmXdl
 
         float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
         {
-            StaticallyIndexedArray<GemmDescKernelArg, MaxGroupCount> gemm_desc_kernel_args;
-
-            bool has_main_k_block_loop = true;
-
-            static_for<0, MaxGroupCount, 1>{}([&](auto i) {
-                if(i < arg.gemm_desc_kernel_arg_.size())
-                {
-                    gemm_desc_kernel_args(i) = arg.gemm_desc_kernel_arg_[i];
-
-                    std::cout << "group: " << i << " arg.a_grid_desc_k0_m_k1_{"
-                              << gemm_desc_kernel_args[i].a_grid_desc_k0_m_k1_.GetLength(I0) << ", "
-                              << gemm_desc_kernel_args[i].a_grid_desc_k0_m_k1_.GetLength(I1) << ", "
-                              << gemm_desc_kernel_args[i].a_grid_desc_k0_m_k1_.GetLength(I2) << "}";
-
-                    std::cout << ", arg.b_grid_desc_k0_n_k1_{"
-                              << gemm_desc_kernel_args[i].b_grid_desc_k0_n_k1_.GetLength(I0) << ", "
-                              << gemm_desc_kernel_args[i].b_grid_desc_k0_n_k1_.GetLength(I1) << ", "
-                              << gemm_desc_kernel_args[i].b_grid_desc_k0_n_k1_.GetLength(I2) << "}";
-
-                    std::cout << ", arg.c_grid_desc_m_n_{ "
-                              << gemm_desc_kernel_args[i].c_grid_desc_m_n_.GetLength(I0) << ", "
-                              << gemm_desc_kernel_args[i].c_grid_desc_m_n_.GetLength(I1) << "}"
-                              << std::endl;
-
-                    if(!GridwiseGemm::CheckValidity(
-                           gemm_desc_kernel_args[i].a_grid_desc_k0_m_k1_,
-                           gemm_desc_kernel_args[i].b_grid_desc_k0_n_k1_,
-                           gemm_desc_kernel_args[i].c_grid_desc_m_n_,
-                           gemm_desc_kernel_args[i].grouped_gemm_block_2_ctile_map_))
-                    {
-                        throw std::runtime_error(
-                            "wrong! GridwiseGemm_k0mk1_k0nk1_mn_xdlops_v2r3 has invalid setting");
-                    }
-
-                    const auto K = gemm_desc_kernel_args[i].a_grid_desc_k0_m_k1_.GetLength(I0) *
-                                   gemm_desc_kernel_args[i].a_grid_desc_k0_m_k1_.GetLength(I2);
-
-                    if(GridwiseGemm::CalculateHasMainKBlockLoop(K) != has_main_k_block_loop)
-                    {
-                        throw std::runtime_error("wrong! not all gemm has_main_k_block_loop");
-                    }
-                }
-            });
+            if(!arg.is_valid_)
+            {
+                throw std::runtime_error(
+                    "wrong! GridwiseGemm_k0mk1_k0nk1_mn_xdlops_v2r3 has invalid setting");
+            }
+
+            if(arg.group_count_ == 0)
+                return 0;
+
+            if(arg.p_workspace_ == nullptr)
+            {
+                throw std::runtime_error("wrong! workspace of the group descriptors is not set");
+            }
+
+            hip_check_error(hipMemcpyAsync(arg.p_workspace_,
+                                           arg.gemm_desc_table_.GetDescs().data(),
+                                           arg.gemm_desc_table_.GetByteSize(),
+                                           hipMemcpyHostToDevice,
+                                           stream_config.stream_id_));
 
             float ave_time = 0;
 
-            if(has_main_k_block_loop)
+            const auto p_gemm_descs =
+                cast_pointer_to_constant_address_space(static_cast<const void*>(arg.p_workspace_));
+
+            if(arg.has_main_k_block_loop_)
             {
                 const auto kernel =
                     kernel_grouped_gemm_xdlops_v2r3<GridwiseGemm,
@@ -529,16 +495,15 @@ struct DeviceGroupedGemmXdl
                                                     AElementwiseOperation,
                                                     BElementwiseOperation,
                                                     CElementwiseOperation,
-                                                    true,
-                                                    MaxGroupCount>;
+                                                    true>;
 
                 ave_time = launch_and_time_kernel(stream_config,
                                                   kernel,
                                                   dim3(arg.grid_size_),
                                                   dim3(BlockSize),
                                                   0,
-                                                  gemm_desc_kernel_args,
-                                                  arg.gemm_desc_kernel_arg_.size(),
+                                                  p_gemm_descs,
+                                                  arg.group_count_,
                                                   arg.a_element_op_,
                                                   arg.b_element_op_,
                                                   arg.c_element_op_);
@@ -553,16 +518,15 @@ struct DeviceGroupedGemmXdl
                                                     AElementwiseOperation,
                                                     BElementwiseOperation,
                                                     CElementwiseOperation,
-                                                    false,
-                                                    MaxGroupCount>;
+                                                    false>;
 
                 ave_time = launch_and_time_kernel(stream_config,
                                                   kernel,
                                                   dim3(arg.grid_size_),
                                                   dim3(BlockSize),
                                                   0,
-                                                  gemm_desc_kernel_args,
-                                                  arg.gemm_desc_kernel_arg_.size(),
+                                                  p_gemm_descs,
+                                                  arg.group_count_,
                                                   arg.a_element_op_,
                                                   arg.b_element_op_,
                                                   arg.c_element_op_);
@@ -585,13 +549,7 @@ struct DeviceGroupedGemmXdl
         return true;
     }
 
-    static bool IsSupportedArgument(const Argument& arg)
-    {
-        if(ck::type_convert<ck::index_t>(arg.gemm_desc_kernel_arg_.size()) != arg.group_count_)
-            return false;
-        else
-            return true;
-    }
+    static bool IsSupportedArgument(const Argument& arg) { return arg.is_valid_; }
 
     // polymorphic
     bool IsSupportedArgument(const BaseArgument* p_arg) override
@@ -626,6 +584,16 @@ struct DeviceGroupedGemmXdl
             p_a, p_b, p_c, gemm_shapes, 1, 1, a_element_op, b_element_op, c_element_op);
     }
 
+    // polymorphic
+    void UpdateArgument(BaseArgument* p_arg,
+                        std::vector<const void*>& p_a,
+                        std::vector<const void*>& p_b,
+                        std::vector<void*>& p_c,
+                        std::vector<GemmShape>& gemm_shapes) override
+    {
+        dynamic_cast<Argument*>(p_arg)->Update(p_a, p_b, p_c, gemm_shapes);
+    }
+
     // polymorphic
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
@@ -654,6 +622,53 @@ struct DeviceGroupedGemmXdl
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceGroupedGemmXdl"};
+
+        // clang-format off
+        params.SetOption("GemmSpec", getGemmSpecializationStr(GemmSpec))
+              .Set("BlockSize", BlockSize)
+              .Set("MPerBlock", MPerBlock)
+              .Set("NPerBlock", NPerBlock)
+              .Set("K0PerBlock", K0PerBlock)
+              .Set("K1", K1)
+              .Set("MPerXDL", MPerXDL)
+              .Set("NPerXDL", NPerXDL)
+              .Set("MXdlPerWave", MXdlPerWave)
+              .Set("NXdlPerWave", NXdlPerWave)
+              .Set("ABlockTransferSrcVectorDim", ABlockTransferSrcVectorDim)
+              .Set("ABlockTransferSrcScalarPerVector", ABlockTransferSrcScalarPerVector)
+              .Set("ABlockTransferDstScalarPerVector_K1", ABlockTransferDstScalarPerVector_K1)
+              .Set("ABlockLdsAddExtraM", ABlockLdsAddExtraM)
+              .Set("BBlockTransferSrcVectorDim", BBlockTransferSrcVectorDim)
+              .Set("BBlockTransferSrcScalarPerVector", BBlockTransferSrcScalarPerVector)
+              .Set("BBlockTransferDstScalarPerVector_K1", BBlockTransferDstScalarPerVector_K1)
+              .Set("BBlockLdsAddExtraN", BBlockLdsAddExtraN)
+              .Set("CThreadTransferSrcDstVectorDim", CThreadTransferSrcDstVectorDim)
+              .Set("CThreadTransferDstScalarPerVector", CThreadTransferDstScalarPerVector)
+              .Set("NumPrefetch", NumPrefetch)
+              .Set("LdsBytes", GridwiseGemm::GetSharedMemoryNumberOfByte())
+              .Set("AccVgprs", MPerBlock * NPerBlock / BlockSize * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    std::size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.gemm_desc_table_.GetByteSize();
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.grid_size_;
+    }
 };
 
 } // namespace device
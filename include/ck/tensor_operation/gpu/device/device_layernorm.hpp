@@ -0,0 +1,39 @@
+#ifndef DEVICE_LAYERNORM_HPP
+#define DEVICE_LAYERNORM_HPP
+
+#include <vector>
+#include <memory>
+
+#include "common_header.hpp"
+#include "device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// y = (x - mean) / sqrt(var + epsilon) * gamma + beta, the mean and population variance taken
+// over reduceDims. gamma and beta are given with the lengths of x and strides of 0 along the
+// other dimensions, over which they are broadcast. y has the lengths and strides of x.
+struct DeviceLayernorm : public BaseOperator
+{
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const std::vector<int> lengths,
+                        const std::vector<int> xStrides,
+                        const std::vector<int> gammaStrides,
+                        const std::vector<int> betaStrides,
+                        const std::vector<int> reduceDims,
+                        float epsilon,
+                        const void* x_dev,
+                        const void* gamma_dev,
+                        const void* beta_dev,
+                        void* y_dev) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+using DeviceLayernormPtr = std::unique_ptr<DeviceLayernorm>;
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,358 @@
+#ifndef DEVICE_LAYERNORM_BLOCKWISE_HPP
+#define DEVICE_LAYERNORM_BLOCKWISE_HPP
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include "device.hpp"
+#include "device_layernorm.hpp"
+#include "device_reduce_common.hpp"
+#include "gridwise_layernorm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// DeviceLayernorm with workgroups of MThreadClusterSize x KThreadClusterSize threads, each
+// workgroup normalizing MThreadClusterSize x MThreadSliceSize whole rows. Rows of up to
+// KThreadClusterSize x KThreadSliceSize elements are read once, longer rows twice.
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename YDataType,
+          index_t Rank,
+          index_t NumReduceDim,
+          index_t BlockSize,
+          index_t MThreadClusterSize,
+          index_t KThreadClusterSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t XSrcVectorDim,
+          index_t XSrcVectorSize,
+          index_t YDstVectorSize>
+struct DeviceLayernormBlockwise : public DeviceLayernorm
+{
+    static_assert(Rank <= 6, "Bigger Rank size is not supported!");
+    static_assert(BlockSize == MThreadClusterSize * KThreadClusterSize,
+                  "Invalid thread cluster size assignments!");
+
+    static_assert(((XSrcVectorDim == 0 && MThreadSliceSize % XSrcVectorSize == 0 &&
+                    MThreadSliceSize % YDstVectorSize == 0) ||
+                   (XSrcVectorDim == 1 && KThreadSliceSize % XSrcVectorSize == 0 &&
+                    KThreadSliceSize % YDstVectorSize == 0)),
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    static constexpr index_t NumInvariantDim = Rank - NumReduceDim;
+
+    static constexpr index_t numSrcDim = Rank;
+    static constexpr bool reduceAllDim = (NumInvariantDim == 0);
+
+    static constexpr int M_BlockTileSize = MThreadClusterSize * MThreadSliceSize;
+    static constexpr int K_BlockTileSize = KThreadClusterSize * KThreadSliceSize;
+
+    // gamma and beta are only contiguous along K
+    static constexpr index_t GammaBetaSrcVectorSize = XSrcVectorDim == 1 ? XSrcVectorSize : 1;
+
+    static auto MakeSrc2dDescriptor(const std::vector<int>& inLengths,
+                                    const std::vector<int>& inStrides,
+                                    int kBlockTileIterations)
+    {
+        const auto tupleSrcLengths = make_tuple_from_array(inLengths, Number<numSrcDim>{});
+        const auto tupleSrcStrides = make_tuple_from_array(inStrides, Number<numSrcDim>{});
+
+        const auto inDesc = make_naive_tensor_descriptor(tupleSrcLengths, tupleSrcStrides);
+
+        const auto in_grid_desc_m_k = [&]() {
+            if constexpr(reduceAllDim)
+            {
+                const auto one_dim_inDesc = transform_tensor_descriptor(
+                    inDesc,
+                    make_tuple(make_merge_transform(tupleSrcLengths)),
+                    make_tuple(typename arithmetic_sequence_gen<0, numSrcDim, 1>::type{}),
+                    make_tuple(Sequence<0>{}));
+
+                return transform_tensor_descriptor(one_dim_inDesc,
+                                                   make_tuple(make_unmerge_transform(make_tuple(
+                                                       1, one_dim_inDesc.GetLength(Number<0>{})))),
+                                                   make_tuple(Sequence<0>{}),
+                                                   make_tuple(Sequence<0, 1>{}));
+            }
+            else
+            {
+                using InvariantDims = typename arithmetic_sequence_gen<0, NumInvariantDim, 1>::type;
+                using ReduceDims = typename arithmetic_sequence_gen<NumInvariantDim, Rank, 1>::type;
+
+                const auto reduceDimLengths =
+                    make_tuple_from_array_and_index_seq(inLengths, ReduceDims{});
+                const auto invariantDimLengths =
+                    make_tuple_from_array_and_index_seq(inLengths, InvariantDims{});
+
+                return transform_tensor_descriptor(
+                    inDesc,
+                    make_tuple(make_merge_transform(invariantDimLengths),
+                               make_merge_transform(reduceDimLengths)),
+                    make_tuple(InvariantDims{}, ReduceDims{}),
+                    make_tuple(Sequence<0>{}, Sequence<1>{}));
+            }
+        }();
+
+        const auto invariantLength = in_grid_desc_m_k.GetLength(Number<0>{});
+        const auto reduceLength    = in_grid_desc_m_k.GetLength(Number<1>{});
+
+        const auto inPad_M =
+            math::integer_least_multiple(invariantLength, M_BlockTileSize) - invariantLength;
+        const auto inPad_K = K_BlockTileSize * kBlockTileIterations - reduceLength;
+
+        auto in_grid_desc_m_k_padded = transform_tensor_descriptor(
+            in_grid_desc_m_k,
+            make_tuple(make_right_pad_transform(invariantLength, inPad_M),
+                       make_right_pad_transform(reduceLength, inPad_K)),
+            make_tuple(Sequence<0>{}, Sequence<1>{}),
+            make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+        return (in_grid_desc_m_k_padded);
+    };
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const std::vector<int> lengths,
+                 const std::vector<int> xStrides,
+                 const std::vector<int> gammaStrides,
+                 const std::vector<int> betaStrides,
+                 const std::vector<int> reduceDims,
+                 AccDataType epsilon,
+                 const XDataType* x_dev,
+                 const GammaDataType* gamma_dev,
+                 const BetaDataType* beta_dev,
+                 YDataType* y_dev)
+            : epsilon_{epsilon},
+              x_dev_{x_dev},
+              gamma_dev_{gamma_dev},
+              beta_dev_{beta_dev},
+              y_dev_{y_dev}
+        {
+            lengths_      = shuffle_tensor_dimensions<Rank, NumReduceDim>(lengths, reduceDims);
+            xStrides_     = shuffle_tensor_dimensions<Rank, NumReduceDim>(xStrides, reduceDims);
+            gammaStrides_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(gammaStrides, reduceDims);
+            betaStrides_  = shuffle_tensor_dimensions<Rank, NumReduceDim>(betaStrides, reduceDims);
+
+            std::tie(invariant_total_length, reduce_total_length) =
+                get_2d_lengths<Rank, NumReduceDim>(lengths_);
+
+            if constexpr(NumInvariantDim == 0)
+                invariant_lowest_length = 1;
+            else
+                invariant_lowest_length = lengths_[NumInvariantDim - 1];
+
+            reduce_lowest_length = lengths_[Rank - 1];
+
+            kBlockTileIterations = static_cast<index_t>(
+                std::max<size_t>(math::integer_divide_ceil(reduce_total_length, K_BlockTileSize),
+                                 1));
+
+            gridSize = math::integer_least_multiple(invariant_total_length, M_BlockTileSize) /
+                       M_BlockTileSize;
+        }
+
+        std::vector<int> lengths_;
+        std::vector<int> xStrides_;
+        std::vector<int> gammaStrides_;
+        std::vector<int> betaStrides_;
+
+        AccDataType epsilon_;
+
+        const XDataType* x_dev_;
+        const GammaDataType* gamma_dev_;
+        const BetaDataType* beta_dev_;
+        YDataType* y_dev_;
+
+        int invariant_lowest_length;
+        int reduce_lowest_length;
+        size_t invariant_total_length;
+        size_t reduce_total_length;
+
+        index_t kBlockTileIterations;
+        size_t gridSize;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            const auto x_grid_desc_m_k = DeviceLayernormBlockwise::MakeSrc2dDescriptor(
+                arg.lengths_, arg.xStrides_, arg.kBlockTileIterations);
+            const auto gamma_grid_desc_m_k = DeviceLayernormBlockwise::MakeSrc2dDescriptor(
+                arg.lengths_, arg.gammaStrides_, arg.kBlockTileIterations);
+            const auto beta_grid_desc_m_k = DeviceLayernormBlockwise::MakeSrc2dDescriptor(
+                arg.lengths_, arg.betaStrides_, arg.kBlockTileIterations);
+            using GridDesc_M_K = decltype(x_grid_desc_m_k);
+
+            using GridwiseLayernorm = GridwiseLayernorm_mk_to_mk<XDataType,
+                                                                 GammaDataType,
+                                                                 BetaDataType,
+                                                                 YDataType,
+                                                                 AccDataType,
+                                                                 GridDesc_M_K,
+                                                                 BlockSize,
+                                                                 MThreadClusterSize,
+                                                                 KThreadClusterSize,
+                                                                 MThreadSliceSize,
+                                                                 KThreadSliceSize,
+                                                                 XSrcVectorDim,
+                                                                 XSrcVectorSize,
+                                                                 YDstVectorSize>;
+
+            const auto kernel = kernel_layernorm<GridwiseLayernorm,
+                                                 XDataType,
+                                                 GammaDataType,
+                                                 BetaDataType,
+                                                 YDataType,
+                                                 AccDataType,
+                                                 GridDesc_M_K>;
+
+            // y has the layout of x
+            return launch_and_time_kernel(stream_config,
+                                          kernel,
+                                          dim3(arg.gridSize),
+                                          dim3(BlockSize),
+                                          0,
+                                          x_grid_desc_m_k,
+                                          gamma_grid_desc_m_k,
+                                          beta_grid_desc_m_k,
+                                          x_grid_desc_m_k,
+                                          static_cast<index_t>(arg.reduce_total_length),
+                                          arg.kBlockTileIterations,
+                                          arg.epsilon_,
+                                          arg.x_dev_,
+                                          arg.gamma_dev_,
+                                          arg.beta_dev_,
+                                          arg.y_dev_);
+        };
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const Argument* pArg = dynamic_cast<const Argument*>(p_arg);
+
+        if constexpr(XSrcVectorDim == 0)
+        {
+            if constexpr(NumInvariantDim == 0)
+            {
+                return (false);
+            }
+            else
+            {
+                if(pArg->xStrides_[NumInvariantDim - 1] != 1)
+                    return (false);
+
+                if(pArg->invariant_lowest_length % XSrcVectorSize != 0 ||
+                   pArg->invariant_lowest_length % YDstVectorSize != 0)
+                    return (false);
+            };
+        }
+        else
+        {
+            if(pArg->xStrides_[Rank - 1] != 1)
+                return (false);
+
+            if(pArg->reduce_lowest_length % XSrcVectorSize != 0 ||
+               pArg->reduce_lowest_length % YDstVectorSize != 0)
+                return (false);
+        };
+
+        if constexpr(GammaBetaSrcVectorSize > 1)
+        {
+            if(pArg->gammaStrides_[Rank - 1] != 1 || pArg->betaStrides_[Rank - 1] != 1)
+                return (false);
+        }
+
+        // the count of a row is an index_t
+        if(pArg->reduce_total_length > static_cast<size_t>(std::numeric_limits<index_t>::max()))
+            return (false);
+
+        return (true);
+    };
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const std::vector<int> lengths,
+                                                      const std::vector<int> xStrides,
+                                                      const std::vector<int> gammaStrides,
+                                                      const std::vector<int> betaStrides,
+                                                      const std::vector<int> reduceDims,
+                                                      float epsilon,
+                                                      const void* x_dev,
+                                                      const void* gamma_dev,
+                                                      const void* beta_dev,
+                                                      void* y_dev) override
+    {
+        return std::make_unique<Argument>(lengths,
+                                          xStrides,
+                                          gammaStrides,
+                                          betaStrides,
+                                          reduceDims,
+                                          type_convert<AccDataType>(epsilon),
+                                          static_cast<const XDataType*>(x_dev),
+                                          static_cast<const GammaDataType*>(gamma_dev),
+                                          static_cast<const BetaDataType*>(beta_dev),
+                                          static_cast<YDataType*>(y_dev));
+    };
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    };
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceLayernormBlockwise<" << BlockSize << ",";
+        str << "M_C" << MThreadClusterSize << "_S" << MThreadSliceSize << ",";
+        str << "K_C" << KThreadClusterSize << "_S" << KThreadSliceSize << ",";
+        str << "XSrcVectorDim_" << XSrcVectorDim << "_XSrcVectorSize_" << XSrcVectorSize << "_YDstVectorSize_" << YDstVectorSize << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceLayernormBlockwise"};
+
+        // clang-format off
+        params.Set("Rank", Rank)
+              .Set("NumReduceDim", NumReduceDim)
+              .Set("BlockSize", BlockSize)
+              .Set("MThreadClusterSize", MThreadClusterSize)
+              .Set("KThreadClusterSize", KThreadClusterSize)
+              .Set("MThreadSliceSize", MThreadSliceSize)
+              .Set("KThreadSliceSize", KThreadSliceSize)
+              .Set("XSrcVectorDim", XSrcVectorDim)
+              .Set("XSrcVectorSize", XSrcVectorSize)
+              .Set("YDstVectorSize", YDstVectorSize)
+              .Set("LdsBytes", KThreadClusterSize > 1 ? BlockSize * static_cast<index_t>(2 * sizeof(AccDataType) + sizeof(index_t)) : 0)
+              .Set("AccVgprs", MThreadSliceSize * (4 * KThreadSliceSize + 3) * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return static_cast<int64_t>(arg.gridSize);
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
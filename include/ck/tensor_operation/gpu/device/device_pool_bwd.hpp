@@ -0,0 +1,44 @@
+#ifndef DEVICE_POOL_BWD_HPP
+#define DEVICE_POOL_BWD_HPP
+
+#include <iostream>
+#include <array>
+#include "device_base.hpp"
+#include "reduction_enums.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// din[N, Xi..., C] = gradient of the pooling DevicePoolFwd<NumDimSpatial, ReduceOpId> computes,
+// given dout[N, Xo..., C]. MAX/MIN/AMAX pass each element of dout to the element of its window
+// selected by the forward pass, read from out_indices_dev; AVG spreads it over its window, divided
+// by the size of the window if count_include_pad, otherwise by the number of its elements inside
+// the input. out_indices_dev is ignored for AVG, count_include_pad for the others.
+template <ck::index_t NumDimSpatial, ck::ReduceTensorOp ReduceOpId>
+struct DevicePoolBwd : public BaseOperator
+{
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* dout_dev,
+                        const void* out_indices_dev,
+                        void* din_dev,
+                        ck::index_t N,
+                        ck::index_t C,
+                        std::array<ck::index_t, NumDimSpatial> input_spatial_lengths,
+                        std::array<ck::index_t, NumDimSpatial> window_spatial_lengths,
+                        std::array<ck::index_t, NumDimSpatial> output_spatial_lengths,
+                        std::array<ck::index_t, NumDimSpatial> window_strides,
+                        std::array<ck::index_t, NumDimSpatial> input_left_pads,
+                        std::array<ck::index_t, NumDimSpatial> input_right_pads,
+                        bool count_include_pad) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+template <ck::index_t NumDimSpatial, ck::ReduceTensorOp ReduceOpId>
+using DevicePoolBwdPtr = std::unique_ptr<DevicePoolBwd<NumDimSpatial, ReduceOpId>>;
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,42 @@
+#ifndef DEVICE_POOL_FWD_HPP
+#define DEVICE_POOL_FWD_HPP
+
+#include <iostream>
+#include <array>
+#include "device_base.hpp"
+#include "reduction_enums.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// out[N, Xo..., C] = reduction over the window of in[N, Xi..., C], with NumDimSpatial spatial
+// dimensions. For MAX/MIN/AMAX out_indices_dev, if the instance outputs indices, receives the
+// index of the selected element in its window, row-major over window_spatial_lengths. AVG counts
+// the padding, i.e. divides by the size of the window.
+template <ck::index_t NumDimSpatial, ck::ReduceTensorOp ReduceOpId>
+struct DevicePoolFwd : public BaseOperator
+{
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* in_dev,
+                        void* out_dev,
+                        void* out_indices_dev,
+                        ck::index_t N,
+                        ck::index_t C,
+                        std::array<ck::index_t, NumDimSpatial> input_spatial_lengths,
+                        std::array<ck::index_t, NumDimSpatial> window_spatial_lengths,
+                        std::array<ck::index_t, NumDimSpatial> output_spatial_lengths,
+                        std::array<ck::index_t, NumDimSpatial> window_strides,
+                        std::array<ck::index_t, NumDimSpatial> input_left_pads,
+                        std::array<ck::index_t, NumDimSpatial> input_right_pads) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+template <ck::index_t NumDimSpatial, ck::ReduceTensorOp ReduceOpId>
+using DevicePoolFwdPtr = std::unique_ptr<DevicePoolFwd<NumDimSpatial, ReduceOpId>>;
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,214 @@
+#ifndef DEVICE_POOLND_BWD_NHWC_NHWC_HPP
+#define DEVICE_POOLND_BWD_NHWC_NHWC_HPP
+
+#include <iostream>
+#include <sstream>
+#include "device.hpp"
+#include "device_pool_bwd.hpp"
+#include "device_properties.hpp"
+#include "gridwise_pool_bwd.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Backward pooling of a channel-last input, [N, Wi, C], [N, Hi, Wi, C] or [N, Di, Hi, Wi, C]. Each
+// element of din gathers from the outputs whose windows hold it (GridwisePoolBwd_1D), so it is
+// written once and din needs no zeroing beforehand.
+template <ck::index_t NumDimSpatial,
+          typename DInDataType,
+          typename DOutDataType,
+          typename AccDataType,
+          ck::ReduceTensorOp ReduceOpId,
+          ck::index_t BlockSize,
+          ck::index_t InOutVectorSize>
+struct DevicePoolNdBwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C
+    : public DevicePoolBwd<NumDimSpatial, ReduceOpId>
+{
+    static_assert(NumDimSpatial >= 1 && NumDimSpatial <= 3, "wrong! 1 to 3 spatial dimensions");
+
+    using IndexDataType = int32_t;
+
+    using SpatialArray = std::array<ck::index_t, NumDimSpatial>;
+
+    using Problem = PoolProblem<NumDimSpatial>;
+
+    using GridwisePoolBwd = GridwisePoolBwd_1D<NumDimSpatial,
+                                               DOutDataType,
+                                               IndexDataType,
+                                               DInDataType,
+                                               AccDataType,
+                                               ReduceOpId,
+                                               InOutVectorSize>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const DOutDataType* p_dout_dev,
+                 const IndexDataType* p_out_indices_dev,
+                 DInDataType* p_din_dev,
+                 ck::index_t N,
+                 ck::index_t C,
+                 const SpatialArray& input_spatial_lengths,
+                 const SpatialArray& window_spatial_lengths,
+                 const SpatialArray& output_spatial_lengths,
+                 const SpatialArray& window_strides,
+                 const SpatialArray& input_left_pads,
+                 bool count_include_pad)
+            : p_dout_dev_{p_dout_dev},
+              p_out_indices_dev_{p_out_indices_dev},
+              p_din_dev_{p_din_dev},
+              problem_{},
+              count_include_pad_{count_include_pad}
+        {
+            problem_.N = N;
+            problem_.C = C;
+
+            index_t num_input_pixel = N;
+
+            for(index_t d = 0; d < NumDimSpatial; ++d)
+            {
+                problem_.input_spatial_lengths(d)  = input_spatial_lengths[d];
+                problem_.window_spatial_lengths(d) = window_spatial_lengths[d];
+                problem_.output_spatial_lengths(d) = output_spatial_lengths[d];
+                problem_.window_strides(d)         = window_strides[d];
+                problem_.input_left_pads(d)        = input_left_pads[d];
+
+                num_input_pixel *= input_spatial_lengths[d];
+            }
+
+            // a thread per vector of channels of an input pixel, looping if the device runs fewer
+            const index_t num_block =
+                math::integer_divide_ceil(num_input_pixel * (C / InOutVectorSize), BlockSize);
+
+            gridSize_ = static_cast<index_t>(get_persistent_grid_size(BlockSize, 0, num_block));
+        }
+
+        const DOutDataType* p_dout_dev_;
+        const IndexDataType* p_out_indices_dev_;
+        DInDataType* p_din_dev_;
+        Problem problem_;
+        bool count_include_pad_;
+        index_t gridSize_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            const auto kernel = kernel_pool_bwd<GridwisePoolBwd,
+                                                DOutDataType,
+                                                IndexDataType,
+                                                DInDataType,
+                                                Problem>;
+
+            return launch_and_time_kernel(stream_config,
+                                          kernel,
+                                          dim3(arg.gridSize_),
+                                          dim3(BlockSize),
+                                          0,
+                                          arg.p_dout_dev_,
+                                          arg.p_out_indices_dev_,
+                                          arg.p_din_dev_,
+                                          arg.problem_,
+                                          arg.count_include_pad_);
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const Argument* pArg = dynamic_cast<const Argument*>(p_arg);
+
+        if(pArg == nullptr)
+            return false;
+
+        if(GridwisePoolBwd::UseIndices && pArg->p_out_indices_dev_ == nullptr)
+            return false;
+
+        if(pArg->problem_.C % InOutVectorSize != 0)
+            return false;
+
+        for(index_t d = 0; d < NumDimSpatial; ++d)
+            if(pArg->problem_.window_strides[d] <= 0)
+                return false;
+
+        return true;
+    }
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* p_dout_dev,
+                        const void* p_out_indices_dev,
+                        void* p_din_dev,
+                        ck::index_t N,
+                        ck::index_t C,
+                        SpatialArray input_spatial_lengths,
+                        SpatialArray window_spatial_lengths,
+                        SpatialArray output_spatial_lengths,
+                        SpatialArray window_strides,
+                        SpatialArray input_left_pads,
+                        SpatialArray /* input_right_pads */,
+                        bool count_include_pad) override
+    {
+        return std::make_unique<Argument>(static_cast<const DOutDataType*>(p_dout_dev),
+                                          static_cast<const IndexDataType*>(p_out_indices_dev),
+                                          static_cast<DInDataType*>(p_din_dev),
+                                          N,
+                                          C,
+                                          input_spatial_lengths,
+                                          window_spatial_lengths,
+                                          output_spatial_lengths,
+                                          window_strides,
+                                          input_left_pads,
+                                          count_include_pad);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DevicePool" << NumDimSpatial << "dBwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<" << BlockSize << ",";
+        str << "InOutVectorSize_" << InOutVectorSize << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DevicePool" + std::to_string(NumDimSpatial) +
+                                   "dBwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C"};
+
+        // clang-format off
+        params.Set("NumDimSpatial", NumDimSpatial)
+              .Set("ReduceOpId", static_cast<int64_t>(ReduceOpId))
+              .Set("BlockSize", BlockSize)
+              .Set("InOutVectorSize", InOutVectorSize)
+              .Set("LdsBytes", 0);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.gridSize_;
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,433 @@
+#ifndef DEVICE_POOLND_FWD_NHWC_NHWC_HPP
+#define DEVICE_POOLND_FWD_NHWC_NHWC_HPP
+
+#include <iostream>
+#include <sstream>
+#include "device_pool_fwd.hpp"
+#include "tensor_descriptor.hpp"
+#include "tensor_descriptor_helper.hpp"
+#include "reduction_operator_mapping.hpp"
+#include "gridwise_2d_reduction_threadwise.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Pooling of a channel-last input, [N, Wi, C], [N, Hi, Wi, C] or [N, Di, Hi, Wi, C], as a
+// threadwise reduction of A[N * Xo... * C, window size] into B[N * Xo... * C], where A reads the
+// padded input through the window.
+template <ck::index_t NumDimSpatial,
+          typename InDataType,
+          typename OutDataType,
+          typename AccDataType,
+          ck::ReduceTensorOp ReduceOpId,
+          bool NeedIndices,
+          ck::index_t BlockSize,
+          ck::index_t ReduceMThreadClusterSize,
+          ck::index_t ReduceKThreadClusterSize,
+          ck::index_t ReduceMThreadSliceSize,
+          ck::index_t ReduceKThreadSliceSize,
+          ck::index_t InSrcOutDstVectorSize>
+struct DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C
+    : public DevicePoolFwd<NumDimSpatial, ReduceOpId>
+{
+    static_assert(NumDimSpatial >= 1 && NumDimSpatial <= 3, "wrong! 1 to 3 spatial dimensions");
+
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    static constexpr index_t NumDim = NumDimSpatial + 2;
+
+    using IndexDataType = int32_t;
+
+    using ReduceOperation = typename reduce_binary_operator<AccDataType, ReduceOpId>::opType;
+
+    using InElementwiseOperation =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, true, true>::InElementwiseOperation;
+
+    using AccElementwiseOperation =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, true, true>::
+            AccElementwiseOperation;
+
+    static constexpr bool BetaIsZero = true;
+
+    static constexpr index_t InSrcOutDstVectorDim =
+        0; // for NHWC, the dim C is the vector Dim for both input and output in memory, which is
+           // not reduced.
+
+    static constexpr ck::index_t ReduceM_BlockTileSize =
+        ReduceMThreadClusterSize * ReduceMThreadSliceSize;
+    static constexpr ck::index_t ReduceK_BlockTileSize =
+        ReduceKThreadClusterSize * ReduceKThreadSliceSize;
+
+    using SpatialArray = std::array<ck::index_t, NumDimSpatial>;
+
+    // lengths of [N, X..., C]
+    static auto MakeLengths(ck::index_t N, ck::index_t C, const SpatialArray& spatial_lengths)
+    {
+        return generate_tuple(
+            [&](auto I) {
+                if constexpr(I == 0)
+                    return N;
+                else if constexpr(I == NumDim - 1)
+                    return C;
+                else
+                    return spatial_lengths[I - 1];
+            },
+            Number<NumDim>{});
+    }
+
+    static auto MakeABGridDescriptor_A_M_K_B_M(ck::index_t N,
+                                               ck::index_t C,
+                                               SpatialArray input_spatial_lengths,
+                                               SpatialArray window_spatial_lengths,
+                                               SpatialArray output_spatial_lengths,
+                                               SpatialArray window_strides,
+                                               SpatialArray input_left_pads,
+                                               SpatialArray input_right_pads)
+    {
+        index_t num_output_pixel = 1;
+        index_t window_size      = 1;
+
+        for(index_t d = 0; d < NumDimSpatial; ++d)
+        {
+            num_output_pixel *= output_spatial_lengths[d];
+            window_size *= window_spatial_lengths[d];
+        }
+
+        const index_t ReduceMRaw = N * num_output_pixel * C;
+        const index_t ReduceMPad =
+            math::integer_least_multiple(ReduceMRaw, ReduceM_BlockTileSize) - ReduceMRaw;
+
+        const index_t ReduceKRaw = window_size;
+        const index_t ReduceKPad =
+            math::integer_least_multiple(ReduceKRaw, ReduceK_BlockTileSize) - ReduceKRaw;
+
+        // each dimension of [N, X..., C] stays one dimension
+        const auto same_dims = generate_tuple(
+            [&](auto I) { return Sequence<I>{}; }, Number<NumDim>{});
+
+        // A[ReduceM, ReduceK]
+        const auto in_grid_desc_n_xi_c =
+            make_naive_tensor_descriptor_packed(MakeLengths(N, C, input_spatial_lengths));
+
+        const auto in_grid_desc_n_xip_c = transform_tensor_descriptor(
+            in_grid_desc_n_xi_c,
+            generate_tuple(
+                [&](auto I) {
+                    if constexpr(I == 0)
+                        return make_pass_through_transform(N);
+                    else if constexpr(I == NumDim - 1)
+                        return make_pass_through_transform(C);
+                    else
+                        return make_pad_transform(input_spatial_lengths[I - 1],
+                                                  input_left_pads[I - 1],
+                                                  input_right_pads[I - 1]);
+                },
+                Number<NumDim>{}),
+            same_dims,
+            same_dims);
+
+        // [N, Y0, Xo0, Y1, Xo1, ..., C]: spatial dimension d becomes dimensions 2d + 1 (window)
+        // and 2d + 2 (output)
+        const auto in_grid_desc_n_y_xo_c = transform_tensor_descriptor(
+            in_grid_desc_n_xip_c,
+            generate_tuple(
+                [&](auto I) {
+                    if constexpr(I == 0)
+                        return make_pass_through_transform(N);
+                    else if constexpr(I == NumDim - 1)
+                        return make_pass_through_transform(C);
+                    else
+                        return make_embed_transform(make_tuple(window_spatial_lengths[I - 1],
+                                                               output_spatial_lengths[I - 1]),
+                                                    make_tuple(I1, window_strides[I - 1]));
+                },
+                Number<NumDim>{}),
+            same_dims,
+            generate_tuple(
+                [&](auto I) {
+                    if constexpr(I == 0)
+                        return Sequence<0>{};
+                    else if constexpr(I == NumDim - 1)
+                        return Sequence<2 * NumDimSpatial + 1>{};
+                    else
+                        return Sequence<2 * I - 1, 2 * I>{};
+                },
+                Number<NumDim>{}));
+
+        // N, Xo..., C
+        const auto reduce_m_dims = generate_sequence_v2(
+            [&](auto I) {
+                if constexpr(I == 0)
+                    return Number<0>{};
+                else if constexpr(I == NumDim - 1)
+                    return Number<2 * NumDimSpatial + 1>{};
+                else
+                    return Number<2 * I>{};
+            },
+            Number<NumDim>{});
+
+        // Y...
+        const auto reduce_k_dims =
+            generate_sequence_v2([&](auto I) { return Number<2 * I + 1>{}; },
+                                 Number<NumDimSpatial>{});
+
+        const auto in_grid_desc_reducemraw_reducekraw = transform_tensor_descriptor(
+            in_grid_desc_n_y_xo_c,
+            make_tuple(make_merge_transform(MakeLengths(N, C, output_spatial_lengths)),
+                       make_merge_transform(generate_tuple(
+                           [&](auto I) { return window_spatial_lengths[I]; },
+                           Number<NumDimSpatial>{}))),
+            make_tuple(reduce_m_dims, reduce_k_dims),
+            make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+        const auto in_grid_desc_reducem_reducek = transform_tensor_descriptor(
+            in_grid_desc_reducemraw_reducekraw,
+            make_tuple(make_right_pad_transform(ReduceMRaw, ReduceMPad),
+                       make_right_pad_transform(ReduceKRaw, ReduceKPad)),
+            make_tuple(Sequence<0>{}, Sequence<1>{}),
+            make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+        // B[ReduceM]
+        const auto out_grid_desc_reducemraw =
+            make_naive_tensor_descriptor_packed(make_tuple(ReduceMRaw));
+
+        const auto out_grid_desc_reducem = transform_tensor_descriptor(
+            out_grid_desc_reducemraw,
+            make_tuple(make_right_pad_transform(ReduceMRaw, ReduceMPad)),
+            make_tuple(Sequence<0>{}),
+            make_tuple(Sequence<0>{}));
+
+        return make_tuple(in_grid_desc_reducem_reducek, out_grid_desc_reducem);
+    }
+
+    static auto MakeDummyABGridDescriptors()
+    {
+        SpatialArray ones;
+        ones.fill(1);
+
+        return MakeABGridDescriptor_A_M_K_B_M(1, 1, ones, ones, ones, ones, ones, ones);
+    }
+
+    using ABGridDescs = decltype(MakeDummyABGridDescriptors());
+
+    using AGridDesc_M_K = remove_cvref_t<decltype(ABGridDescs{}[I0])>;
+    using BGridDesc_M   = remove_cvref_t<decltype(ABGridDescs{}[I1])>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const InDataType* p_in_dev,
+                 OutDataType* p_out_dev,
+                 int* p_out_indices_dev,
+                 ck::index_t N,
+                 ck::index_t C,
+                 const SpatialArray& input_spatial_lengths,
+                 const SpatialArray& window_spatial_lengths,
+                 const SpatialArray& output_spatial_lengths,
+                 const SpatialArray& window_strides,
+                 const SpatialArray& input_left_pads,
+                 const SpatialArray& input_right_pads)
+            : p_in_dev_{p_in_dev},
+              p_out_dev_{p_out_dev},
+              p_out_indices_dev_{p_out_indices_dev},
+              a_grid_desc_m_k_{},
+              b_grid_desc_m_{}
+        {
+            const auto descs = MakeABGridDescriptor_A_M_K_B_M(N,
+                                                              C,
+                                                              input_spatial_lengths,
+                                                              window_spatial_lengths,
+                                                              output_spatial_lengths,
+                                                              window_strides,
+                                                              input_left_pads,
+                                                              input_right_pads);
+
+            a_grid_desc_m_k_ = descs[I0];
+            b_grid_desc_m_   = descs[I1];
+
+            invariant_lowest_length_ = C;
+            reduce_lowest_length_    = window_spatial_lengths[NumDimSpatial - 1];
+
+            // padding counts, as the reduction reads it as zero
+            if constexpr(ReduceOpId == ck::ReduceTensorOp::AVG)
+            {
+                ck::index_t divider = 1;
+
+                for(const auto length : window_spatial_lengths)
+                    divider *= length;
+
+                in_element_op_  = InElementwiseOperation{divider};
+                acc_element_op_ = AccElementwiseOperation{divider};
+            }
+        }
+
+        const InDataType* p_in_dev_;
+        OutDataType* p_out_dev_;
+        int* p_out_indices_dev_;
+        AGridDesc_M_K a_grid_desc_m_k_;
+        BGridDesc_M b_grid_desc_m_;
+        InElementwiseOperation in_element_op_;
+        AccElementwiseOperation acc_element_op_;
+
+        // for checking vector load/store
+        ck::index_t invariant_lowest_length_;
+        ck::index_t reduce_lowest_length_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            using gridwise_reduce = GridwiseReduction_mk_to_m_threadwise<InDataType,
+                                                                         OutDataType,
+                                                                         AccDataType,
+                                                                         IndexDataType,
+                                                                         AGridDesc_M_K,
+                                                                         BGridDesc_M,
+                                                                         ReduceOperation,
+                                                                         InElementwiseOperation,
+                                                                         AccElementwiseOperation,
+                                                                         false, // propagate_nan
+                                                                         BetaIsZero,
+                                                                         BlockSize,
+                                                                         ReduceMThreadClusterSize,
+                                                                         ReduceKThreadClusterSize,
+                                                                         ReduceMThreadSliceSize,
+                                                                         ReduceKThreadSliceSize,
+                                                                         InSrcOutDstVectorDim,
+                                                                         InSrcOutDstVectorSize,
+                                                                         InSrcOutDstVectorSize>;
+
+            const auto kernel = kernel_reduce_threadwise<gridwise_reduce,
+                                                         NeedIndices,
+                                                         InDataType,
+                                                         OutDataType,
+                                                         AccDataType,
+                                                         IndexDataType,
+                                                         AGridDesc_M_K,
+                                                         BGridDesc_M,
+                                                         InElementwiseOperation,
+                                                         AccElementwiseOperation>;
+
+            ck::index_t ReduceM = arg.a_grid_desc_m_k_.GetLength(I0);
+
+            const index_t grid_size = (ReduceM / ReduceM_BlockTileSize);
+
+            return launch_and_time_kernel(stream_config,
+                                          kernel,
+                                          dim3(grid_size),
+                                          dim3(BlockSize),
+                                          0,
+                                          arg.a_grid_desc_m_k_,
+                                          arg.b_grid_desc_m_,
+                                          arg.in_element_op_,
+                                          arg.acc_element_op_,
+                                          float(1),
+                                          arg.p_in_dev_,
+                                          float(0),
+                                          arg.p_out_dev_,
+                                          arg.p_out_indices_dev_);
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const Argument* pArg = dynamic_cast<const Argument*>(p_arg);
+
+        if(pArg == nullptr)
+            return false;
+
+        if(pArg->invariant_lowest_length_ % InSrcOutDstVectorSize != 0)
+        {
+            return (false);
+        }
+
+        return (true);
+    }
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* p_in_dev,
+                        void* p_out_dev,
+                        void* p_out_indices_dev,
+                        ck::index_t N,
+                        ck::index_t C,
+                        SpatialArray input_spatial_lengths,
+                        SpatialArray window_spatial_lengths,
+                        SpatialArray output_spatial_lengths,
+                        SpatialArray window_strides,
+                        SpatialArray input_left_pads,
+                        SpatialArray input_right_pads) override
+    {
+        return std::make_unique<Argument>(static_cast<const InDataType*>(p_in_dev),
+                                          static_cast<OutDataType*>(p_out_dev),
+                                          static_cast<int*>(p_out_indices_dev),
+                                          N,
+                                          C,
+                                          input_spatial_lengths,
+                                          window_spatial_lengths,
+                                          output_spatial_lengths,
+                                          window_strides,
+                                          input_left_pads,
+                                          input_right_pads);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DevicePool" << NumDimSpatial << "dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<" << BlockSize << ",";
+        str << "M_C" << ReduceMThreadClusterSize << "_S" << ReduceMThreadSliceSize << ",";
+        str << "K_C" << ReduceKThreadClusterSize << "_S" << ReduceKThreadSliceSize << ",";
+        str <<"InSrcOutDstVectorSize_" << InSrcOutDstVectorSize << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DevicePool" + std::to_string(NumDimSpatial) +
+                                   "dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C"};
+
+        // clang-format off
+        params.Set("NumDimSpatial", NumDimSpatial)
+              .Set("ReduceOpId", static_cast<int64_t>(ReduceOpId))
+              .Set("NeedIndices", NeedIndices)
+              .Set("BlockSize", BlockSize)
+              .Set("ReduceMThreadClusterSize", ReduceMThreadClusterSize)
+              .Set("ReduceKThreadClusterSize", ReduceKThreadClusterSize)
+              .Set("ReduceMThreadSliceSize", ReduceMThreadSliceSize)
+              .Set("ReduceKThreadSliceSize", ReduceKThreadSliceSize)
+              .Set("InSrcOutDstVectorSize", InSrcOutDstVectorSize)
+              .Set("LdsBytes", 0)
+              .Set("AccVgprs", ReduceMThreadSliceSize * (ReduceKThreadSliceSize + 1) * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.a_grid_desc_m_k_.GetLength(I0) / ReduceM_BlockTileSize;
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -366,6 +366,37 @@ struct DeviceReduceBlockWise : public DeviceReduce<InElementwiseOperation, AccEl
 
         return str.str();
     }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceReduceBlockWise"};
+
+        // clang-format off
+        params.Set("Rank", Rank)
+              .Set("NumReduceDim", NumReduceDim)
+              .Set("PropagateNan", PropagateNan)
+              .Set("NeedIndices", NeedIndices)
+              .Set("BlockSize", BlockSize)
+              .Set("MThreadClusterSize", MThreadClusterSize)
+              .Set("KThreadClusterSize", KThreadClusterSize)
+              .Set("MThreadSliceSize", MThreadSliceSize)
+              .Set("KThreadSliceSize", KThreadSliceSize)
+              .Set("InSrcVectorDim", InSrcVectorDim)
+              .Set("InSrcVectorSize", InSrcVectorSize)
+              .Set("OutDstVectorSize", OutDstVectorSize)
+              .Set("LdsBytes", BlockSize * static_cast<index_t>(sizeof(AccDataType) + (NeedIndices ? sizeof(IndexDataType) : 0)))
+              .Set("AccVgprs", MThreadSliceSize * (KThreadSliceSize + 1) * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return static_cast<int64_t>(arg.gridSize);
+    }
 };
 
 } // namespace device
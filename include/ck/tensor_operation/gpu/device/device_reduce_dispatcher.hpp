@@ -0,0 +1,524 @@
+#ifndef DEVICE_REDUCE_DISPATCHER_HPP
+#define DEVICE_REDUCE_DISPATCHER_HPP
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "device_base.hpp"
+#include "device_properties.hpp"
+#include "device_reduce.hpp"
+#include "reduction_method_selection.hpp"
+#include "reduction_operator_mapping.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// A reduction which picks the method and the instance for each problem from instances of every
+// method, so the caller makes one argument whatever the shape. select_reduce_method() orders the
+// methods from the lengths, the strides and the data types; the first method with an instance
+// supporting the problem is used, with its instance of the highest
+// estimate_reduce_instance_efficiency(). MultiBlockPartialReduce runs as two calls, the second of
+// a DeviceReduceBlockWiseSecondCall instance over its workspace, which the dispatcher sizes and
+// passes on itself.
+//
+// As a DeviceReduce, it takes the element-wise operations of a single call, which the one-call
+// methods use. The two calls of MultiBlockPartialReduce build theirs from the reduce length, as
+// every reduce_unary_operator is made from it.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          ReduceTensorOp ReduceOpId,
+          bool NeedIndices>
+struct DeviceReduceDispatcher
+    : public DeviceReduce<
+          typename reduce_unary_operator<AccDataType, ReduceOpId, true, true>::
+              InElementwiseOperation,
+          typename reduce_unary_operator<AccDataType, ReduceOpId, true, true>::
+              AccElementwiseOperation>
+{
+    using InElementwiseOperation =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, true, true>::InElementwiseOperation;
+    using AccElementwiseOperation =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, true, true>::
+            AccElementwiseOperation;
+    using InElementwiseOperation_1 =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, true, false>::
+            InElementwiseOperation;
+    using AccElementwiseOperation_1 =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, true, false>::
+            AccElementwiseOperation;
+    using InElementwiseOperation_2 =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, false, true>::
+            InElementwiseOperation;
+    using AccElementwiseOperation_2 =
+        typename reduce_unary_operator<AccDataType, ReduceOpId, false, true>::
+            AccElementwiseOperation;
+
+    using DeviceReduceOneCallPtr = DeviceReducePtr<InElementwiseOperation, AccElementwiseOperation>;
+    using DeviceReduceFirstCallPtr =
+        DeviceReducePtr<InElementwiseOperation_1, AccElementwiseOperation_1>;
+    using DeviceReduceSecondCallPtr =
+        DeviceReducePtr<InElementwiseOperation_2, AccElementwiseOperation_2>;
+
+    // instances of each method for the data types, operation and indices of the dispatcher; a
+    // method without instances is never used
+    struct Instances
+    {
+        std::vector<DeviceReduceOneCallPtr> threadwise;
+        std::vector<DeviceReduceOneCallPtr> blockwise;
+        std::vector<DeviceReduceOneCallPtr> multiblock_atomic_add;
+        std::vector<DeviceReduceFirstCallPtr> multiblock_partial_reduce;
+        std::vector<DeviceReduceSecondCallPtr> blockwise_second_call;
+    };
+
+    explicit DeviceReduceDispatcher(Instances instances,
+                                    ReduceMethodHeuristics heuristics = ReduceMethodHeuristics{})
+        : instances_(std::move(instances)), heuristics_(heuristics)
+    {
+    }
+
+    // a call of an instance
+    struct Call
+    {
+        BaseOperator* op_ = nullptr;
+        std::unique_ptr<BaseArgument> arg_;
+        std::unique_ptr<BaseInvoker> invoker_;
+    };
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const std::vector<int>& inLengths,
+                 const std::vector<int>& inStrides,
+                 const std::vector<int>& outLengths,
+                 const std::vector<int>& outStrides,
+                 const std::vector<int>& reduceDims,
+                 float alpha,
+                 float beta,
+                 const void* in_dev,
+                 void* out_dev,
+                 void* out_indices_dev,
+                 const InElementwiseOperation& in_elementwise_op,
+                 const AccElementwiseOperation& acc_elementwise_op)
+            : inLengths_(inLengths),
+              inStrides_(inStrides),
+              outLengths_(outLengths),
+              outStrides_(outStrides),
+              reduceDims_(reduceDims),
+              alpha_(alpha),
+              beta_(beta),
+              in_dev_(in_dev),
+              out_dev_(out_dev),
+              out_indices_dev_(out_indices_dev),
+              in_elementwise_op_(in_elementwise_op),
+              acc_elementwise_op_(acc_elementwise_op)
+        {
+            reduce_total_length_ = std::accumulate(
+                reduceDims.begin(), reduceDims.end(), int32_t{1}, [&](int32_t len, int dim) {
+                    return len * inLengths[static_cast<std::size_t>(dim)];
+                });
+        }
+
+        std::vector<int> inLengths_;
+        std::vector<int> inStrides_;
+        std::vector<int> outLengths_;
+        std::vector<int> outStrides_;
+        std::vector<int> reduceDims_;
+        float alpha_;
+        float beta_;
+        const void* in_dev_;
+        void* out_dev_;
+        void* out_indices_dev_;
+        InElementwiseOperation in_elementwise_op_;
+        AccElementwiseOperation acc_elementwise_op_;
+        int32_t reduce_total_length_;
+
+        // the plan: the method and the index of its instance, and of the second call's for
+        // MultiBlockPartialReduce; no calls if no instance supports the problem
+        ReduceMethod method_ = ReduceMethod::ThreadWise;
+        std::size_t instance_        = 0;
+        std::size_t second_instance_ = 0;
+        long_index_t workspace_size_ = 0;
+        std::vector<Call> calls_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(arg.calls_.empty())
+                throw std::runtime_error("wrong! no reduce instance supports the argument");
+
+            if(arg.workspace_size_ > 0 && arg.p_workspace_ == nullptr)
+                throw std::runtime_error("wrong! the reduce workspace is not set");
+
+            float ave_time = 0;
+
+            for(const auto& call : arg.calls_)
+                ave_time += call.invoker_->Run(call.arg_.get(), stream_config);
+
+            return ave_time;
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    // Workspace of any argument of these lengths: the largest MultiBlockPartialReduce needs, as
+    // the method depends on the strides and beta too. GetWorkSpaceSize() of an argument is exact.
+    long_index_t GetWorkspaceSizeInBytes(const std::vector<int> inLengths,
+                                         const std::vector<int> reduceDims) override
+    {
+        long_index_t workspace_size = 0;
+
+        for(auto& op : instances_.multiblock_partial_reduce)
+            workspace_size =
+                std::max(workspace_size, op->GetWorkspaceSizeInBytes(inLengths, reduceDims));
+
+        return workspace_size;
+    }
+
+    std::size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return static_cast<std::size_t>(dynamic_cast<const Argument*>(p_arg)->workspace_size_);
+    }
+
+    // the calls of MultiBlockPartialReduce hold the workspace, so they are remade
+    void SetWorkSpacePointer(BaseArgument* p_arg, void* p_workspace) const override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.p_workspace_ = p_workspace;
+
+        if(arg.method_ == ReduceMethod::MultiBlockPartialReduce && !arg.calls_.empty())
+            MakeCalls(arg);
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return !dynamic_cast<const Argument*>(p_arg)->calls_.empty();
+    }
+
+    ReduceProblem MakeProblem(const std::vector<int>& inLengths,
+                              const std::vector<int>& inStrides,
+                              const std::vector<int>& reduceDims,
+                              float beta) const
+    {
+        const bool can_use_atomic_add =
+            reduce_supports_atomic_add<OutDataType>(ReduceOpId, NeedIndices) && beta == 0.0f;
+
+        return make_reduce_problem(inLengths,
+                                   inStrides,
+                                   reduceDims,
+                                   static_cast<index_t>(sizeof(InDataType)),
+                                   can_use_atomic_add);
+    }
+
+    // Plans the reduction, with a workspace of GetWorkspaceSizeInBytes() bytes at workspace_dev,
+    // which may also be null and set later with SetWorkSpacePointer().
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const std::vector<int> inLengths,
+                        const std::vector<int> inStrides,
+                        const std::vector<int> outLengths,
+                        const std::vector<int> outStrides,
+                        const std::vector<int> reduceDims,
+                        float alpha,
+                        float beta,
+                        const void* in_dev,
+                        void* out_dev,
+                        void* out_indices_dev,
+                        void* workspace_dev,
+                        const InElementwiseOperation in_elementwise_op,
+                        const AccElementwiseOperation acc_elementwise_op) override
+    {
+        auto arg = std::make_unique<Argument>(inLengths,
+                                              inStrides,
+                                              outLengths,
+                                              outStrides,
+                                              reduceDims,
+                                              alpha,
+                                              beta,
+                                              in_dev,
+                                              out_dev,
+                                              out_indices_dev,
+                                              in_elementwise_op,
+                                              acc_elementwise_op);
+
+        arg->p_workspace_ = workspace_dev;
+
+        const auto problem = MakeProblem(inLengths, inStrides, reduceDims, beta);
+        const auto num_cu  = get_device_properties().num_cu;
+
+        for(auto method : get_reduce_method_candidates(problem, num_cu, heuristics_))
+        {
+            if(Plan(*arg, problem, method, num_cu))
+                break;
+        }
+
+        return arg;
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceReduceDispatcher<" << instances_.threadwise.size() << ","
+            << instances_.blockwise.size() << "," << instances_.multiblock_atomic_add.size() << ","
+            << instances_.multiblock_partial_reduce.size() << ","
+            << instances_.blockwise_second_call.size() << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    // the method and the instances an argument runs, e.g. for logging
+    std::string GetPlanString(const BaseArgument* p_arg) const
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        if(arg.calls_.empty())
+            return "unsupported";
+
+        auto str = std::stringstream();
+
+        str << get_reduce_method_name(arg.method_) << ": " << arg.calls_[0].op_->GetTypeString();
+
+        if(arg.calls_.size() > 1)
+            str << " => " << arg.calls_[1].op_->GetTypeString();
+
+        return str.str();
+    }
+
+    private:
+    static ReduceInstanceTile GetInstanceTile(const BaseOperator& op)
+    {
+        const auto params = op.GetTuningParams();
+
+        return ReduceInstanceTile{
+            params.Get("MThreadClusterSize", 1) * params.Get("MThreadSliceSize", 1),
+            params.Get("KThreadClusterSize", 1) * params.Get("KThreadSliceSize", 1),
+            params.Get("InSrcVectorSize", 1)};
+    }
+
+    // indices of the instances in `ops` supporting the argument make_arg(op) makes, from the
+    // highest estimated efficiency on `problem` down
+    template <typename DeviceOpPtr, typename MakeArg>
+    static std::vector<std::size_t> GetSupportingInstances(const std::vector<DeviceOpPtr>& ops,
+                                                           const ReduceProblem& problem,
+                                                           ReduceMethod method,
+                                                           index_t num_cu,
+                                                           const ReduceMethodHeuristics& heuristics,
+                                                           MakeArg make_arg)
+    {
+        std::vector<std::size_t> indices;
+        std::vector<double> efficiencies(ops.size(), 0);
+
+        for(std::size_t i = 0; i < ops.size(); ++i)
+        {
+            const auto p_arg = make_arg(*ops[i]);
+
+            if(!ops[i]->IsSupportedArgument(p_arg.get()))
+                continue;
+
+            indices.push_back(i);
+            efficiencies[i] = estimate_reduce_instance_efficiency(
+                problem, method, GetInstanceTile(*ops[i]), num_cu, heuristics);
+        }
+
+        std::stable_sort(indices.begin(), indices.end(), [&](std::size_t a, std::size_t b) {
+            return efficiencies[a] > efficiencies[b];
+        });
+
+        return indices;
+    }
+
+    const std::vector<DeviceReduceOneCallPtr>& GetOneCallInstances(ReduceMethod method) const
+    {
+        switch(method)
+        {
+        case ReduceMethod::ThreadWise: return instances_.threadwise;
+        case ReduceMethod::BlockWise: return instances_.blockwise;
+        default: return instances_.multiblock_atomic_add;
+        }
+    }
+
+    std::unique_ptr<BaseArgument> MakeOneCallArgument(DeviceReduce<InElementwiseOperation,
+                                                                    AccElementwiseOperation>& op,
+                                                      const Argument& arg) const
+    {
+        return op.MakeArgumentPointer(arg.inLengths_,
+                                      arg.inStrides_,
+                                      arg.outLengths_,
+                                      arg.outStrides_,
+                                      arg.reduceDims_,
+                                      arg.alpha_,
+                                      arg.beta_,
+                                      arg.in_dev_,
+                                      arg.out_dev_,
+                                      arg.out_indices_dev_,
+                                      nullptr,
+                                      arg.in_elementwise_op_,
+                                      arg.acc_elementwise_op_);
+    }
+
+    std::unique_ptr<BaseArgument>
+    MakeFirstCallArgument(DeviceReduce<InElementwiseOperation_1, AccElementwiseOperation_1>& op,
+                          const Argument& arg,
+                          void* workspace_dev) const
+    {
+        return op.MakeArgumentPointer(arg.inLengths_,
+                                      arg.inStrides_,
+                                      arg.outLengths_,
+                                      arg.outStrides_,
+                                      arg.reduceDims_,
+                                      arg.alpha_,
+                                      arg.beta_,
+                                      arg.in_dev_,
+                                      arg.out_dev_,
+                                      arg.out_indices_dev_,
+                                      workspace_dev,
+                                      InElementwiseOperation_1{arg.reduce_total_length_},
+                                      AccElementwiseOperation_1{arg.reduce_total_length_});
+    }
+
+    // the second call reduces the [M, blkGroupSize] workspace of the first
+    std::unique_ptr<BaseArgument>
+    MakeSecondCallArgument(DeviceReduce<InElementwiseOperation_2, AccElementwiseOperation_2>& op,
+                           const Argument& arg,
+                           const std::vector<int>& inLengths2,
+                           void* workspace_dev) const
+    {
+        const std::vector<int> inStrides2{inLengths2[1], 1};
+
+        return op.MakeArgumentPointer(inLengths2,
+                                      inStrides2,
+                                      arg.outLengths_,
+                                      arg.outStrides_,
+                                      arg.reduceDims_,
+                                      arg.alpha_,
+                                      arg.beta_,
+                                      workspace_dev,
+                                      arg.out_dev_,
+                                      arg.out_indices_dev_,
+                                      workspace_dev,
+                                      InElementwiseOperation_2{arg.reduce_total_length_},
+                                      AccElementwiseOperation_2{arg.reduce_total_length_});
+    }
+
+    // Plans `arg` with the best instances of `method` supporting it; false if there are none.
+    bool Plan(Argument& arg, const ReduceProblem& problem, ReduceMethod method, index_t num_cu)
+    {
+        if(method != ReduceMethod::MultiBlockPartialReduce)
+        {
+            const auto indices = GetSupportingInstances(
+                GetOneCallInstances(method), problem, method, num_cu, heuristics_, [&](auto& op) {
+                    return MakeOneCallArgument(op, arg);
+                });
+
+            if(indices.empty())
+                return false;
+
+            arg.method_         = method;
+            arg.instance_       = indices.front();
+            arg.workspace_size_ = 0;
+
+            MakeCalls(arg);
+
+            return true;
+        }
+
+        const auto first_indices = GetSupportingInstances(
+            instances_.multiblock_partial_reduce,
+            problem,
+            method,
+            num_cu,
+            heuristics_,
+            [&](auto& op) { return MakeFirstCallArgument(op, arg, nullptr); });
+
+        // the first instance whose workspace a second call instance supports
+        for(auto i : first_indices)
+        {
+            auto& op           = *instances_.multiblock_partial_reduce[i];
+            const auto p_arg   = MakeFirstCallArgument(op, arg, nullptr);
+            const auto lengths = op.GetWorkspace2dLengths(p_arg.get());
+
+            ReduceProblem problem2;
+
+            problem2.invariant_total_length = lengths[0];
+            problem2.reduce_total_length    = lengths[1];
+            problem2.in_data_size           = static_cast<index_t>(sizeof(AccDataType));
+
+            auto make_second_arg = [&](auto& op2) {
+                return MakeSecondCallArgument(op2, arg, lengths, nullptr);
+            };
+
+            const auto second_indices = GetSupportingInstances(instances_.blockwise_second_call,
+                                                               problem2,
+                                                               ReduceMethod::BlockWise,
+                                                               num_cu,
+                                                               heuristics_,
+                                                               make_second_arg);
+
+            if(second_indices.empty())
+                continue;
+
+            arg.method_          = method;
+            arg.instance_        = i;
+            arg.second_instance_ = second_indices.front();
+            arg.workspace_size_  = op.GetWorkspaceSizeInBytes(arg.inLengths_, arg.reduceDims_);
+
+            MakeCalls(arg);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // (re)makes the calls of the plan of `arg`, with its workspace
+    void MakeCalls(Argument& arg) const
+    {
+        arg.calls_.clear();
+
+        if(arg.method_ != ReduceMethod::MultiBlockPartialReduce)
+        {
+            auto& op = *GetOneCallInstances(arg.method_)[arg.instance_];
+
+            arg.calls_.push_back(
+                Call{&op, MakeOneCallArgument(op, arg), op.MakeInvokerPointer()});
+
+            return;
+        }
+
+        auto& op  = *instances_.multiblock_partial_reduce[arg.instance_];
+        auto& op2 = *instances_.blockwise_second_call[arg.second_instance_];
+
+        auto p_arg         = MakeFirstCallArgument(op, arg, arg.p_workspace_);
+        const auto lengths = op.GetWorkspace2dLengths(p_arg.get());
+
+        arg.calls_.push_back(Call{&op, std::move(p_arg), op.MakeInvokerPointer()});
+        arg.calls_.push_back(Call{&op2,
+                                  MakeSecondCallArgument(op2, arg, lengths, arg.p_workspace_),
+                                  op2.MakeInvokerPointer()});
+    }
+
+    Instances instances_;
+    ReduceMethodHeuristics heuristics_;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
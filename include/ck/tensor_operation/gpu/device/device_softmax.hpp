@@ -0,0 +1,33 @@
+#ifndef DEVICE_SOFTMAX_HPP
+#define DEVICE_SOFTMAX_HPP
+
+#include <vector>
+#include <memory>
+
+#include "common_header.hpp"
+#include "device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// out = exp(in - max) / sum(exp(in - max)), the max and sum taken over reduceDims, in a single
+// operation instead of a max reduction, an elementwise pass, a sum reduction and another
+// elementwise pass. out has the lengths and strides of in.
+struct DeviceSoftmax : public BaseOperator
+{
+    virtual std::unique_ptr<BaseArgument> MakeArgumentPointer(const std::vector<int> inLengths,
+                                                              const std::vector<int> inStrides,
+                                                              const std::vector<int> reduceDims,
+                                                              const void* in_dev,
+                                                              void* out_dev) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+using DeviceSoftmaxPtr = std::unique_ptr<DeviceSoftmax>;
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,48 @@
+#ifndef DEVICE_WELFORD_HPP
+#define DEVICE_WELFORD_HPP
+
+#include <vector>
+#include <memory>
+
+#include "common_header.hpp"
+#include "device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// mean and var, the mean and population variance of the elements of `in` over reduceDims, in
+// one pass over `in` with Welford's algorithm. The output has the invariant dimensions, as the
+// output of DeviceReduce does. Splitting the rows over several workgroups needs a workspace of
+// GetWorkspaceSizeInBytes() bytes, which may also be set later with SetWorkSpacePointer().
+struct DeviceWelford : public BaseOperator
+{
+    virtual long_index_t GetWorkspaceSizeInBytes(const std::vector<int> inLengths,
+                                                 const std::vector<int> reduceDims)
+    {
+        (void)inLengths;
+        (void)reduceDims;
+
+        return (0);
+    };
+
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const std::vector<int> inLengths,
+                        const std::vector<int> inStrides,
+                        const std::vector<int> outLengths,
+                        const std::vector<int> outStrides,
+                        const std::vector<int> reduceDims,
+                        const void* in_dev,
+                        void* mean_dev,
+                        void* var_dev,
+                        void* workspace_dev) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+using DeviceWelfordPtr = std::unique_ptr<DeviceWelford>;
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,542 @@
+#ifndef DEVICE_WELFORD_MULTIBLOCK_HPP
+#define DEVICE_WELFORD_MULTIBLOCK_HPP
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include "device.hpp"
+#include "device_properties.hpp"
+#include "device_welford.hpp"
+#include "device_reduce_common.hpp"
+#include "reduction_method_selection.hpp"
+#include "gridwise_2d_welford.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// DeviceWelford with workgroups of MThreadClusterSize x KThreadClusterSize threads: threadwise
+// for KThreadClusterSize == 1, blockwise otherwise. When there are too few rows to fill the
+// device it splits them over up to MaxBlockGroupSize workgroups, which write their partial
+// results into the workspace for a second kernel to merge.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          index_t Rank,
+          index_t NumReduceDim,
+          index_t BlockSize,
+          index_t MThreadClusterSize,
+          index_t KThreadClusterSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t InSrcVectorDim,
+          index_t InSrcVectorSize,
+          index_t OutDstVectorSize>
+struct DeviceWelfordMultiBlock : public DeviceWelford
+{
+    static_assert(Rank <= 6, "Bigger Rank size is not supported!");
+    static_assert(BlockSize == MThreadClusterSize * KThreadClusterSize,
+                  "Invalid thread cluster size assignments!");
+
+    static_assert(((InSrcVectorDim == 0 && MThreadSliceSize % InSrcVectorSize == 0) ||
+                   (InSrcVectorDim == 1 && KThreadSliceSize % InSrcVectorSize == 0)) &&
+                      (MThreadSliceSize % OutDstVectorSize == 0),
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    static constexpr index_t NumInvariantDim = Rank - NumReduceDim;
+
+    static constexpr index_t numSrcDim = Rank;
+    static constexpr index_t numDstDim = (NumInvariantDim == 0) ? 1 : NumInvariantDim;
+    static constexpr bool reduceAllDim = (NumInvariantDim == 0);
+
+    static constexpr int M_BlockTileSize = MThreadClusterSize * MThreadSliceSize;
+    static constexpr int K_BlockTileSize = KThreadClusterSize * KThreadSliceSize;
+
+    static constexpr int MaxBlockGroupSize = 256;
+
+    // the second kernel, merging the partial results of a row, has a thread per row
+    static constexpr int MergeBlockSize  = 256;
+    static constexpr int M_MergeTileSize = MergeBlockSize;
+
+    static ReduceBlockGroup GetBlockGroup(size_t invariant_total_length,
+                                          size_t reduce_total_length)
+    {
+        ReduceProblem problem;
+
+        problem.invariant_total_length = static_cast<long_index_t>(invariant_total_length);
+        problem.reduce_total_length    = static_cast<long_index_t>(reduce_total_length);
+
+        ReduceInstanceTile tile;
+
+        tile.m_tile = M_BlockTileSize;
+        tile.k_tile = K_BlockTileSize;
+
+        return get_reduce_block_group(
+            problem, tile, get_device_properties().num_cu, MaxBlockGroupSize);
+    };
+
+    // mean and m2 of AccDataType, then the count, each 64-byte aligned
+    static long_index_t GetWorkspaceBufferSize(size_t invariant_total_length, int blkGroupSize)
+    {
+        if(blkGroupSize <= 1)
+            return (0);
+
+        const size_t workspace_size = invariant_total_length * blkGroupSize;
+
+        return static_cast<long_index_t>(
+            2 * math::integer_least_multiple(workspace_size * sizeof(AccDataType), 64) +
+            workspace_size * sizeof(index_t));
+    };
+
+    long_index_t GetWorkspaceSizeInBytes(const std::vector<int> inLengths,
+                                         const std::vector<int> reduceDims) override
+    {
+        size_t invariant_total_length;
+        size_t reduce_total_length;
+
+        auto inLengths_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inLengths, reduceDims);
+
+        std::tie(invariant_total_length, reduce_total_length) =
+            get_2d_lengths<Rank, NumReduceDim>(inLengths_);
+
+        const auto group = GetBlockGroup(invariant_total_length, reduce_total_length);
+
+        return GetWorkspaceBufferSize(invariant_total_length, group.block_group_size);
+    };
+
+    static auto MakeSrc2dDescriptor(const std::vector<int>& inLengths,
+                                    const std::vector<int>& inStrides,
+                                    int blkGroupSize,
+                                    int kBlockTileIterations)
+    {
+        const auto tupleSrcLengths = make_tuple_from_array(inLengths, Number<numSrcDim>{});
+        const auto tupleSrcStrides = make_tuple_from_array(inStrides, Number<numSrcDim>{});
+
+        const auto inDesc = make_naive_tensor_descriptor(tupleSrcLengths, tupleSrcStrides);
+
+        const auto in_grid_desc_m_k = [&]() {
+            if constexpr(reduceAllDim)
+            {
+                const auto one_dim_inDesc = transform_tensor_descriptor(
+                    inDesc,
+                    make_tuple(make_merge_transform(tupleSrcLengths)),
+                    make_tuple(typename arithmetic_sequence_gen<0, numSrcDim, 1>::type{}),
+                    make_tuple(Sequence<0>{}));
+
+                return transform_tensor_descriptor(one_dim_inDesc,
+                                                   make_tuple(make_unmerge_transform(make_tuple(
+                                                       1, one_dim_inDesc.GetLength(Number<0>{})))),
+                                                   make_tuple(Sequence<0>{}),
+                                                   make_tuple(Sequence<0, 1>{}));
+            }
+            else
+            {
+                using InvariantDims = typename arithmetic_sequence_gen<0, NumInvariantDim, 1>::type;
+                using ReduceDims = typename arithmetic_sequence_gen<NumInvariantDim, Rank, 1>::type;
+
+                const auto reduceDimLengths =
+                    make_tuple_from_array_and_index_seq(inLengths, ReduceDims{});
+                const auto invariantDimLengths =
+                    make_tuple_from_array_and_index_seq(inLengths, InvariantDims{});
+
+                return transform_tensor_descriptor(
+                    inDesc,
+                    make_tuple(make_merge_transform(invariantDimLengths),
+                               make_merge_transform(reduceDimLengths)),
+                    make_tuple(InvariantDims{}, ReduceDims{}),
+                    make_tuple(Sequence<0>{}, Sequence<1>{}));
+            }
+        }();
+
+        const auto invariantLength = in_grid_desc_m_k.GetLength(Number<0>{});
+        const auto reduceLength    = in_grid_desc_m_k.GetLength(Number<1>{});
+
+        const int reduceSizePerBlock = K_BlockTileSize * kBlockTileIterations;
+        const auto inPad_M =
+            math::integer_least_multiple(invariantLength, M_BlockTileSize) - invariantLength;
+        const auto inPad_K = reduceSizePerBlock * blkGroupSize - reduceLength;
+
+        auto in_grid_desc_m_k_padded = transform_tensor_descriptor(
+            in_grid_desc_m_k,
+            make_tuple(make_right_pad_transform(invariantLength, inPad_M),
+                       make_right_pad_transform(reduceLength, inPad_K)),
+            make_tuple(Sequence<0>{}, Sequence<1>{}),
+            make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+        return (in_grid_desc_m_k_padded);
+    };
+
+    template <int MTileSize>
+    static auto MakeDst1dDescriptor(const std::vector<int>& outLengths,
+                                    const std::vector<int>& outStrides)
+    {
+        const auto tupleDstLengths = make_tuple_from_array(outLengths, Number<numDstDim>{});
+        const auto tupleDstStrides = make_tuple_from_array(outStrides, Number<numDstDim>{});
+
+        auto outDesc = make_naive_tensor_descriptor(tupleDstLengths, tupleDstStrides);
+
+        auto out_grid_desc_m = transform_tensor_descriptor(
+            outDesc,
+            make_tuple(make_merge_transform(tupleDstLengths)),
+            make_tuple(typename arithmetic_sequence_gen<0, numDstDim, 1>::type{}),
+            make_tuple(Sequence<0>{}));
+
+        const auto invariantLength = out_grid_desc_m.GetLength(Number<0>{});
+
+        const auto outPad =
+            math::integer_least_multiple(invariantLength, MTileSize) - invariantLength;
+
+        auto out_grid_desc_m_padded = transform_tensor_descriptor(
+            out_grid_desc_m,
+            make_tuple(make_right_pad_transform(invariantLength, outPad)),
+            make_tuple(Sequence<0>{}),
+            make_tuple(Sequence<0>{}));
+        return (out_grid_desc_m_padded);
+    };
+
+    template <int MTileSize>
+    static auto MakeWorkspace2dDescriptor(int invariantLength, int blkGroupSize)
+    {
+        auto ws_desc_m_k =
+            make_naive_tensor_descriptor_packed(make_tuple(invariantLength, blkGroupSize));
+
+        const auto wsPad =
+            math::integer_least_multiple(invariantLength, MTileSize) - invariantLength;
+
+        auto ws_desc_m_k_padded =
+            transform_tensor_descriptor(ws_desc_m_k,
+                                        make_tuple(make_right_pad_transform(invariantLength, wsPad),
+                                                   make_pass_through_transform(blkGroupSize)),
+                                        make_tuple(Sequence<0>{}, Sequence<1>{}),
+                                        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+        return (ws_desc_m_k_padded);
+    };
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const std::vector<int> inLengths,
+                 const std::vector<int> inStrides,
+                 const std::vector<int> outLengths,
+                 const std::vector<int> outStrides,
+                 const std::vector<int> reduceDims,
+                 const InDataType* in_dev,
+                 OutDataType* mean_dev,
+                 OutDataType* var_dev,
+                 void* workspace_dev)
+            : outLengths_{outLengths},
+              outStrides_{outStrides},
+              in_dev_{in_dev},
+              mean_dev_{mean_dev},
+              var_dev_{var_dev}
+        {
+            inLengths_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inLengths, reduceDims);
+            inStrides_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inStrides, reduceDims);
+
+            std::tie(invariant_total_length, reduce_total_length) =
+                get_2d_lengths<Rank, NumReduceDim>(inLengths_);
+
+            if constexpr(NumInvariantDim == 0)
+                invariant_lowest_length = 1;
+            else
+                invariant_lowest_length = inLengths_[NumInvariantDim - 1];
+
+            reduce_lowest_length = inLengths_[Rank - 1];
+
+            const auto group = GetBlockGroup(invariant_total_length, reduce_total_length);
+
+            blkGroupSize         = group.block_group_size;
+            kBlockTileIterations = group.num_k_block_tile_iteration;
+
+            gridSize = math::integer_least_multiple(invariant_total_length, M_BlockTileSize) /
+                       M_BlockTileSize * blkGroupSize;
+
+            gridSize_merge =
+                math::integer_least_multiple(invariant_total_length, M_MergeTileSize) /
+                M_MergeTileSize;
+
+            SetWorkspace(workspace_dev);
+        }
+
+        void SetWorkspace(void* workspace_dev)
+        {
+            p_workspace_ = workspace_dev;
+
+            if(workspace_dev == nullptr)
+            {
+                workspace_mean_dev_  = nullptr;
+                workspace_m2_dev_    = nullptr;
+                workspace_count_dev_ = nullptr;
+                return;
+            }
+
+            const size_t ws_buf_bytes = math::integer_least_multiple(
+                invariant_total_length * blkGroupSize * sizeof(AccDataType), 64);
+
+            char* p_ws = static_cast<char*>(workspace_dev);
+
+            workspace_mean_dev_  = reinterpret_cast<AccDataType*>(p_ws);
+            workspace_m2_dev_    = reinterpret_cast<AccDataType*>(p_ws + ws_buf_bytes);
+            workspace_count_dev_ = reinterpret_cast<index_t*>(p_ws + 2 * ws_buf_bytes);
+        };
+
+        std::vector<int> inLengths_;
+        std::vector<int> inStrides_;
+        std::vector<int> outLengths_;
+        std::vector<int> outStrides_;
+
+        const InDataType* in_dev_;
+        OutDataType* mean_dev_;
+        OutDataType* var_dev_;
+        AccDataType* workspace_mean_dev_;
+        AccDataType* workspace_m2_dev_;
+        index_t* workspace_count_dev_;
+
+        int invariant_lowest_length;
+        int reduce_lowest_length;
+        size_t invariant_total_length;
+        size_t reduce_total_length;
+
+        index_t blkGroupSize;
+        index_t kBlockTileIterations;
+        size_t gridSize;
+        size_t gridSize_merge;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(arg.blkGroupSize > 1 && arg.p_workspace_ == nullptr)
+                throw std::runtime_error("wrong! DeviceWelfordMultiBlock needs a workspace");
+
+            const auto in_grid_desc_m_k = DeviceWelfordMultiBlock::MakeSrc2dDescriptor(
+                arg.inLengths_, arg.inStrides_, arg.blkGroupSize, arg.kBlockTileIterations);
+            const auto out_grid_desc_m =
+                DeviceWelfordMultiBlock::MakeDst1dDescriptor<M_BlockTileSize>(arg.outLengths_,
+                                                                              arg.outStrides_);
+            const auto ws_desc_m_k =
+                DeviceWelfordMultiBlock::MakeWorkspace2dDescriptor<M_BlockTileSize>(
+                    arg.invariant_total_length, arg.blkGroupSize);
+            using InGridDesc_M_K    = decltype(in_grid_desc_m_k);
+            using OutGridDesc_M     = decltype(out_grid_desc_m);
+            using WorkspaceDesc_M_K = decltype(ws_desc_m_k);
+
+            using GridwiseWelford = GridwiseWelford_mk_to_m_multiblock<InDataType,
+                                                                       OutDataType,
+                                                                       AccDataType,
+                                                                       InGridDesc_M_K,
+                                                                       OutGridDesc_M,
+                                                                       WorkspaceDesc_M_K,
+                                                                       BlockSize,
+                                                                       MThreadClusterSize,
+                                                                       KThreadClusterSize,
+                                                                       MThreadSliceSize,
+                                                                       KThreadSliceSize,
+                                                                       InSrcVectorDim,
+                                                                       InSrcVectorSize,
+                                                                       OutDstVectorSize>;
+
+            float avg_time = 0;
+
+            const auto kernel = kernel_welford_multiblock<GridwiseWelford,
+                                                          InDataType,
+                                                          OutDataType,
+                                                          AccDataType,
+                                                          InGridDesc_M_K,
+                                                          OutGridDesc_M,
+                                                          WorkspaceDesc_M_K>;
+
+            avg_time += launch_and_time_kernel(stream_config,
+                                               kernel,
+                                               dim3(arg.gridSize),
+                                               dim3(BlockSize),
+                                               0,
+                                               in_grid_desc_m_k,
+                                               out_grid_desc_m,
+                                               ws_desc_m_k,
+                                               static_cast<index_t>(arg.reduce_total_length),
+                                               arg.blkGroupSize,
+                                               arg.kBlockTileIterations,
+                                               arg.in_dev_,
+                                               arg.mean_dev_,
+                                               arg.var_dev_,
+                                               arg.workspace_mean_dev_,
+                                               arg.workspace_m2_dev_,
+                                               arg.workspace_count_dev_);
+
+            if(arg.blkGroupSize > 1)
+            {
+                const auto merge_ws_desc_m_k =
+                    DeviceWelfordMultiBlock::MakeWorkspace2dDescriptor<M_MergeTileSize>(
+                        arg.invariant_total_length, arg.blkGroupSize);
+                const auto merge_out_grid_desc_m =
+                    DeviceWelfordMultiBlock::MakeDst1dDescriptor<M_MergeTileSize>(
+                        arg.outLengths_, arg.outStrides_);
+                using MergeWorkspaceDesc_M_K = decltype(merge_ws_desc_m_k);
+                using MergeOutGridDesc_M     = decltype(merge_out_grid_desc_m);
+
+                using GridwiseWelfordMerge = GridwiseWelfordMerge_mk_to_m<AccDataType,
+                                                                          OutDataType,
+                                                                          MergeWorkspaceDesc_M_K,
+                                                                          MergeOutGridDesc_M,
+                                                                          MergeBlockSize,
+                                                                          1,
+                                                                          1>;
+
+                const auto merge_kernel = kernel_welford_merge<GridwiseWelfordMerge,
+                                                               AccDataType,
+                                                               OutDataType,
+                                                               MergeWorkspaceDesc_M_K,
+                                                               MergeOutGridDesc_M>;
+
+                avg_time += launch_and_time_kernel(stream_config,
+                                                   merge_kernel,
+                                                   dim3(arg.gridSize_merge),
+                                                   dim3(MergeBlockSize),
+                                                   0,
+                                                   merge_ws_desc_m_k,
+                                                   merge_out_grid_desc_m,
+                                                   arg.workspace_mean_dev_,
+                                                   arg.workspace_m2_dev_,
+                                                   arg.workspace_count_dev_,
+                                                   arg.mean_dev_,
+                                                   arg.var_dev_);
+            }
+
+            return (avg_time);
+        };
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const Argument* pArg = dynamic_cast<const Argument*>(p_arg);
+
+        if constexpr(InSrcVectorDim == 0)
+        {
+            if constexpr(NumInvariantDim == 0)
+            {
+                return (false);
+            }
+            else
+            {
+                if(pArg->inStrides_[NumInvariantDim - 1] != 1)
+                    return (false);
+
+                if(pArg->invariant_lowest_length % InSrcVectorSize != 0)
+                    return (false);
+            };
+        }
+        else
+        {
+            if(pArg->inStrides_[Rank - 1] != 1)
+                return (false);
+
+            if(pArg->reduce_lowest_length % InSrcVectorSize != 0)
+                return (false);
+        };
+
+        if(pArg->invariant_lowest_length % OutDstVectorSize != 0)
+            return (false);
+
+        // the count of a row is an index_t
+        if(pArg->reduce_total_length > static_cast<size_t>(std::numeric_limits<index_t>::max()))
+            return (false);
+
+        return (true);
+    };
+
+    std::size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        const Argument* pArg = dynamic_cast<const Argument*>(p_arg);
+
+        return static_cast<std::size_t>(
+            GetWorkspaceBufferSize(pArg->invariant_total_length, pArg->blkGroupSize));
+    };
+
+    void SetWorkSpacePointer(BaseArgument* p_arg, void* p_workspace) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->SetWorkspace(p_workspace);
+    };
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const std::vector<int> inLengths,
+                                                      const std::vector<int> inStrides,
+                                                      const std::vector<int> outLengths,
+                                                      const std::vector<int> outStrides,
+                                                      const std::vector<int> reduceDims,
+                                                      const void* in_dev,
+                                                      void* mean_dev,
+                                                      void* var_dev,
+                                                      void* workspace_dev) override
+    {
+        return std::make_unique<Argument>(inLengths,
+                                          inStrides,
+                                          outLengths,
+                                          outStrides,
+                                          reduceDims,
+                                          static_cast<const InDataType*>(in_dev),
+                                          static_cast<OutDataType*>(mean_dev),
+                                          static_cast<OutDataType*>(var_dev),
+                                          workspace_dev);
+    };
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    };
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceWelfordMultiBlock<" << BlockSize << ",";
+        str << "M_C" << MThreadClusterSize << "_S" << MThreadSliceSize << ",";
+        str << "K_C" << KThreadClusterSize << "_S" << KThreadSliceSize << ",";
+        str << "InSrcVectorDim_" << InSrcVectorDim << "_InSrcVectorSize_" << InSrcVectorSize << "_OutDstVectorSize_" << OutDstVectorSize << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    TuningParams GetTuningParams() const override
+    {
+        auto params = TuningParams{"DeviceWelfordMultiBlock"};
+
+        // clang-format off
+        params.Set("Rank", Rank)
+              .Set("NumReduceDim", NumReduceDim)
+              .Set("BlockSize", BlockSize)
+              .Set("MThreadClusterSize", MThreadClusterSize)
+              .Set("KThreadClusterSize", KThreadClusterSize)
+              .Set("MThreadSliceSize", MThreadSliceSize)
+              .Set("KThreadSliceSize", KThreadSliceSize)
+              .Set("InSrcVectorDim", InSrcVectorDim)
+              .Set("InSrcVectorSize", InSrcVectorSize)
+              .Set("OutDstVectorSize", OutDstVectorSize)
+              .Set("LdsBytes", KThreadClusterSize > 1 ? BlockSize * static_cast<index_t>(2 * sizeof(AccDataType) + sizeof(index_t)) : 0)
+              .Set("AccVgprs", MThreadSliceSize * (KThreadSliceSize + 3) * static_cast<index_t>(sizeof(AccDataType)) / 4);
+        // clang-format on
+
+        return params;
+    }
+
+    int64_t GetGridSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return static_cast<int64_t>(arg.gridSize);
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
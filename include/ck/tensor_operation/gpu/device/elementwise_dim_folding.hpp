@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "config.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Lengths of an elementwise problem, row-major, and the strides of each of its tensors. A
+// tensor broadcast along a dimension has stride 0 in it.
+struct ElementwiseProblem
+{
+    std::vector<index_t> lengths;
+    std::vector<std::vector<index_t>> strides;
+};
+
+// Fold the dimensions of an elementwise problem into as few as possible. Dimensions of length 1
+// are dropped, and a dimension is merged into the next inner one if every tensor steps over it as
+// over a run of the inner one, i.e. stride[d] == stride[d + 1] * length[d + 1]. Broadcast dims
+// merge with each other, as 0 == 0 * length. The folded problem has at least one dimension and
+// addresses the same elements in the same order.
+inline ElementwiseProblem fold_elementwise_dims(const std::vector<index_t>& lengths,
+                                                const std::vector<std::vector<index_t>>& strides)
+{
+    const std::size_t num_tensor = strides.size();
+
+    ElementwiseProblem folded{{}, std::vector<std::vector<index_t>>(num_tensor)};
+
+    // built innermost first, reversed at the end
+    for(std::size_t d = lengths.size(); d-- > 0;)
+    {
+        if(lengths[d] == 1)
+            continue;
+
+        bool mergeable = !folded.lengths.empty() && lengths[d] != 0;
+
+        for(std::size_t t = 0; t < num_tensor && mergeable; ++t)
+        {
+            assert(strides[t].size() == lengths.size());
+
+            mergeable = strides[t][d] == folded.strides[t].back() * folded.lengths.back();
+        }
+
+        if(mergeable)
+        {
+            folded.lengths.back() *= lengths[d];
+        }
+        else
+        {
+            folded.lengths.push_back(lengths[d]);
+
+            for(std::size_t t = 0; t < num_tensor; ++t)
+                folded.strides[t].push_back(strides[t][d]);
+        }
+    }
+
+    if(folded.lengths.empty())
+    {
+        folded.lengths.push_back(1);
+
+        for(auto& tensor_strides : folded.strides)
+            tensor_strides.push_back(1);
+    }
+
+    folded.lengths = {folded.lengths.rbegin(), folded.lengths.rend()};
+
+    for(auto& tensor_strides : folded.strides)
+        tensor_strides = {tensor_strides.rbegin(), tensor_strides.rend()};
+
+    return folded;
+}
+
+// Widest vector, a power of 2 up to max_vector_size, in which a tensor of a folded problem can be
+// read or written: contiguous in the innermost dimension, which it divides, as it divides the
+// other strides, so no vector crosses a row. 1 for a tensor broadcast along the innermost
+// dimension, whose other tensors keep their own width.
+inline index_t get_elementwise_vector_size(const std::vector<index_t>& lengths,
+                                           const std::vector<index_t>& strides,
+                                           index_t max_vector_size)
+{
+    if(strides.back() != 1)
+        return 1;
+
+    auto is_vector_size = [&](index_t vector_size) {
+        if(lengths.back() % vector_size != 0)
+            return false;
+
+        for(std::size_t d = 0; d + 1 < strides.size(); ++d)
+            if(strides[d] % vector_size != 0)
+                return false;
+
+        return true;
+    };
+
+    index_t vector_size = max_vector_size;
+
+    while(vector_size > 1 && !is_vector_size(vector_size))
+        vector_size /= 2;
+
+    return vector_size;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "config.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// The GEMMs of a grouped GEMM run in one grid, group i on the workgroups
+// [BlockStart_, BlockEnd_) of its descriptor, groups in order. Returns the group of workgroup
+// `block_id` by binary search over the BlockStart_ of the `group_count` descriptors; groups
+// without workgroups are skipped.
+template <typename GroupDesc>
+__host__ __device__ index_t find_grouped_gemm_group(const GroupDesc* p_group_descs,
+                                                    index_t group_count,
+                                                    index_t block_id)
+{
+    index_t left  = 0;
+    index_t right = group_count;
+
+    // the group is in [left, right)
+    while(right - left > 1)
+    {
+        const index_t mid = (left + right) / 2;
+
+        if(p_group_descs[mid].BlockStart_ <= block_id)
+            left = mid;
+        else
+            right = mid;
+    }
+
+    return left;
+}
+
+// Host table of the group descriptors of a grouped GEMM, copied as is into the workspace of the
+// device operator. Update() rebuilds a descriptor only when the shape of its group or its first
+// workgroup changed, so calls that only change tensor pointers cost O(group count) pointer
+// writes.
+template <typename Shape, typename GroupDesc>
+struct GroupedGemmTable
+{
+    /**
+     * @brief      Make the table describe `shapes`.
+     *
+     * @param      make_desc     GroupDesc(index_t group, const Shape&, index_t block_start),
+     *                           BlockEnd_ of the result is the end of the group's workgroups
+     * @param      set_pointers  void(index_t group, GroupDesc&), called for every group
+     *
+     * @return     the number of workgroups of all groups
+     */
+    template <typename MakeDesc, typename SetPointers>
+    index_t
+    Update(const std::vector<Shape>& shapes, MakeDesc&& make_desc, SetPointers&& set_pointers)
+    {
+        descs_.reserve(shapes.size());
+        num_rebuilt_ = 0;
+
+        index_t block_start = 0;
+
+        for(std::size_t i = 0; i < shapes.size(); ++i)
+        {
+            const index_t group = static_cast<index_t>(i);
+
+            const bool reuse = i < descs_.size() && shapes_[i] == shapes[i] &&
+                               descs_[i].BlockStart_ == block_start;
+
+            if(!reuse)
+            {
+                if(i < descs_.size())
+                    descs_[i] = make_desc(group, shapes[i], block_start);
+                else
+                    descs_.push_back(make_desc(group, shapes[i], block_start));
+
+                ++num_rebuilt_;
+            }
+
+            set_pointers(group, descs_[i]);
+
+            block_start = descs_[i].BlockEnd_;
+        }
+
+        descs_.erase(descs_.begin() + shapes.size(), descs_.end());
+        shapes_ = shapes;
+
+        return block_start;
+    }
+
+    const std::vector<GroupDesc>& GetDescs() const { return descs_; }
+
+    index_t GetGroupCount() const { return static_cast<index_t>(descs_.size()); }
+
+    std::size_t GetByteSize() const { return descs_.size() * sizeof(GroupDesc); }
+
+    // descriptors made by the last Update()
+    index_t GetNumRebuilt() const { return num_rebuilt_; }
+
+    private:
+    std::vector<Shape> shapes_;
+    std::vector<GroupDesc> descs_;
+    index_t num_rebuilt_ = 0;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <vector>
+
+#include "config.hpp"
+#include "reduction_enums.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// The device reduction methods, fastest for small reductions first.
+//   ThreadWise: a thread reduces a whole row
+//   BlockWise: a workgroup reduces a whole row
+//   MultiBlockAtomicAdd: several workgroups reduce a row and add their results into the output
+//   MultiBlockPartialReduce: several workgroups reduce a row into a workspace, which a second
+//                            BlockWise call reduces into the output
+enum struct ReduceMethod
+{
+    ThreadWise,
+    BlockWise,
+    MultiBlockAtomicAdd,
+    MultiBlockPartialReduce,
+};
+
+inline const char* get_reduce_method_name(ReduceMethod method)
+{
+    switch(method)
+    {
+    case ReduceMethod::ThreadWise: return "ThreadWise";
+    case ReduceMethod::BlockWise: return "BlockWise";
+    case ReduceMethod::MultiBlockAtomicAdd: return "MultiBlockAtomicAdd";
+    case ReduceMethod::MultiBlockPartialReduce: return "MultiBlockPartialReduce";
+    }
+
+    return "";
+}
+
+// A reduction as the 2-D problem the device reductions see: the invariant dimensions merged into
+// M rows, the reduced ones into K columns.
+struct ReduceProblem
+{
+    long_index_t invariant_total_length = 1; // M
+    long_index_t reduce_total_length    = 1; // K
+    // the innermost dimension, of stride 1, is reduced, so each row is read along its length;
+    // otherwise neighbouring rows are read together
+    bool reduce_dim_is_innermost = true;
+    index_t in_data_size         = 4; // bytes
+    // no indices, an additive operation (ADD, AVG, NORM1), float or double output and beta == 0
+    bool can_use_atomic_add = false;
+};
+
+// Problem of reducing the tensor of lengths `inLengths` and strides `inStrides` over `reduceDims`.
+// Like the device reductions, the invariant dimensions are kept before the reduced ones, each in
+// increasing order, so the innermost dimension is the last reduced one.
+inline ReduceProblem make_reduce_problem(const std::vector<int>& inLengths,
+                                         const std::vector<int>& inStrides,
+                                         const std::vector<int>& reduceDims,
+                                         index_t in_data_size,
+                                         bool can_use_atomic_add)
+{
+    assert(inLengths.size() == inStrides.size() && inLengths.size() <= 32);
+
+    ReduceProblem problem;
+
+    problem.in_data_size       = in_data_size;
+    problem.can_use_atomic_add = can_use_atomic_add;
+
+    unsigned int reduceFlag = 0;
+
+    for(int dim : reduceDims)
+        reduceFlag |= 1u << dim;
+
+    int innermost_invariant_dim = -1;
+    int innermost_reduce_dim    = -1;
+
+    for(int i = 0; i < static_cast<int>(inLengths.size()); i++)
+    {
+        if((reduceFlag & (1u << i)) > 0)
+        {
+            problem.reduce_total_length *= inLengths[i];
+            innermost_reduce_dim = i;
+        }
+        else
+        {
+            problem.invariant_total_length *= inLengths[i];
+            innermost_invariant_dim = i;
+        }
+    }
+
+    problem.reduce_dim_is_innermost =
+        innermost_invariant_dim < 0 ||
+        (innermost_reduce_dim >= 0 && inStrides[innermost_reduce_dim] == 1);
+
+    return problem;
+}
+
+// Thresholds of select_reduce_method(), which follow the lengths the device reductions are tuned
+// for: 256-thread workgroups, each thread reading up to 8 elements a step.
+struct ReduceMethodHeuristics
+{
+    // a thread reduces a row of up to this many bytes in a few loads
+    long_index_t threadwise_max_row_bytes = 64;
+    // beyond this many columns a thread per row is too slow, even if all threads are busy
+    long_index_t threadwise_max_reduce_length = 128;
+    // rows of up to this many columns fit in one pass of a workgroup; MultiBlockPartialReduce
+    // does not take them
+    long_index_t blockwise_max_reduce_length = 256 * 8;
+    // workgroups per CU which keep the device busy
+    long_index_t min_blocks_per_cu = 2;
+};
+
+// The method that should reduce `problem` fastest on a device of `num_cu` compute units.
+//
+// Short rows go to ThreadWise. So do rows up to threadwise_max_reduce_length long if they are
+// not contiguous or M is large enough to keep every CU busy with workgroups of 256 rows, as
+// neighbouring threads then read neighbouring elements. Rows a workgroup reduces in one pass, or
+// enough rows for a workgroup each to keep the device busy, go to BlockWise. Long rows of few
+// rows are split over several workgroups, added atomically if `problem` allows it, otherwise
+// reduced in two passes.
+inline ReduceMethod select_reduce_method(const ReduceProblem& problem,
+                                         index_t num_cu,
+                                         const ReduceMethodHeuristics& heuristics = {})
+{
+    const long_index_t M        = problem.invariant_total_length;
+    const long_index_t K        = problem.reduce_total_length;
+    const long_index_t min_grid = heuristics.min_blocks_per_cu * (num_cu > 0 ? num_cu : 1);
+
+    if(K * problem.in_data_size <= heuristics.threadwise_max_row_bytes)
+        return ReduceMethod::ThreadWise;
+
+    if(K <= heuristics.threadwise_max_reduce_length &&
+       (!problem.reduce_dim_is_innermost || M >= min_grid * 256))
+        return ReduceMethod::ThreadWise;
+
+    if(K <= heuristics.blockwise_max_reduce_length || M >= min_grid)
+        return ReduceMethod::BlockWise;
+
+    return problem.can_use_atomic_add ? ReduceMethod::MultiBlockAtomicAdd
+                                      : ReduceMethod::MultiBlockPartialReduce;
+}
+
+// Methods to try for `problem`, in order: the one select_reduce_method() picks, then the others
+// from the most to the least parallel, in case no instance of the first supports the problem.
+// MultiBlockAtomicAdd is left out unless `problem` can use it.
+inline std::vector<ReduceMethod> get_reduce_method_candidates(
+    const ReduceProblem& problem, index_t num_cu, const ReduceMethodHeuristics& heuristics = {})
+{
+    std::vector<ReduceMethod> methods{select_reduce_method(problem, num_cu, heuristics)};
+
+    for(auto method : {ReduceMethod::MultiBlockAtomicAdd,
+                       ReduceMethod::MultiBlockPartialReduce,
+                       ReduceMethod::BlockWise,
+                       ReduceMethod::ThreadWise})
+    {
+        if(method == methods.front() ||
+           (method == ReduceMethod::MultiBlockAtomicAdd && !problem.can_use_atomic_add))
+            continue;
+
+        methods.push_back(method);
+    }
+
+    return methods;
+}
+
+// The tile of rows and columns a workgroup of a reduction instance reduces in one step, and the
+// width in elements of its input vectors.
+struct ReduceInstanceTile
+{
+    long_index_t m_tile      = 1; // MThreadClusterSize * MThreadSliceSize
+    long_index_t k_tile      = 1; // KThreadClusterSize * KThreadSliceSize
+    long_index_t vector_size = 1; // InSrcVectorSize
+};
+
+// Estimated fraction of the device's bandwidth an instance of `method` with `tile` reaches on
+// `problem`, to choose between the instances of a method which support it: how much of the
+// device its workgroups keep busy, times the part of its tiles that is not padding, times its
+// input vector width up to 16 bytes. Multi-block methods split each row over up to 256
+// workgroups.
+inline double estimate_reduce_instance_efficiency(const ReduceProblem& problem,
+                                                  ReduceMethod method,
+                                                  const ReduceInstanceTile& tile,
+                                                  index_t num_cu,
+                                                  const ReduceMethodHeuristics& heuristics = {})
+{
+    const long_index_t M = problem.invariant_total_length;
+    const long_index_t K = problem.reduce_total_length;
+
+    const long_index_t num_m_tile = (M + tile.m_tile - 1) / tile.m_tile;
+    const long_index_t num_k_tile = (K + tile.k_tile - 1) / tile.k_tile;
+
+    const bool is_multiblock = method == ReduceMethod::MultiBlockAtomicAdd ||
+                               method == ReduceMethod::MultiBlockPartialReduce;
+
+    const long_index_t grid_size =
+        num_m_tile * (is_multiblock ? std::min<long_index_t>(num_k_tile, 256) : 1);
+    const long_index_t min_grid = heuristics.min_blocks_per_cu * (num_cu > 0 ? num_cu : 1);
+
+    const double busy = static_cast<double>(std::min(grid_size, min_grid)) / min_grid;
+    const double m_use = static_cast<double>(M) / (num_m_tile * tile.m_tile);
+    const double k_use = static_cast<double>(K) / (num_k_tile * tile.k_tile);
+    const double vector_use =
+        static_cast<double>(std::min<long_index_t>(tile.vector_size * problem.in_data_size, 16)) /
+        16;
+
+    return busy * m_use * k_use * vector_use;
+}
+
+// How a reduction whose workgroups may split rows divides each row: over block_group_size
+// workgroups, of num_k_block_tile_iteration K tiles each.
+struct ReduceBlockGroup
+{
+    index_t block_group_size           = 1;
+    index_t num_k_block_tile_iteration = 1;
+};
+
+// Division of the rows of `problem` into groups of workgroups with `tile`: a row is split only
+// when there are too few rows for the device to have min_blocks_per_cu workgroups per CU, and
+// then over just enough workgroups, at most max_block_group_size. A group of 1 reduces each row
+// in one pass. Every workgroup of a group has at least one tile of the row.
+inline ReduceBlockGroup get_reduce_block_group(const ReduceProblem& problem,
+                                               const ReduceInstanceTile& tile,
+                                               index_t num_cu,
+                                               index_t max_block_group_size = 256,
+                                               const ReduceMethodHeuristics& heuristics = {})
+{
+    const long_index_t M = problem.invariant_total_length;
+    const long_index_t K = problem.reduce_total_length;
+
+    const long_index_t num_m_tile = (M + tile.m_tile - 1) / tile.m_tile;
+    const long_index_t num_k_tile = std::max<long_index_t>((K + tile.k_tile - 1) / tile.k_tile, 1);
+    const long_index_t min_grid   = heuristics.min_blocks_per_cu * (num_cu > 0 ? num_cu : 1);
+
+    long_index_t block_group_size = 1;
+
+    if(num_m_tile < min_grid)
+        block_group_size = std::min({(min_grid + num_m_tile - 1) / num_m_tile,
+                                     num_k_tile,
+                                     static_cast<long_index_t>(max_block_group_size)});
+
+    const long_index_t iterations = (num_k_tile + block_group_size - 1) / block_group_size;
+
+    // drop the workgroups the iterations leave without a tile
+    block_group_size = (num_k_tile + iterations - 1) / iterations;
+
+    ReduceBlockGroup group;
+
+    group.block_group_size           = static_cast<index_t>(block_group_size);
+    group.num_k_block_tile_iteration = static_cast<index_t>(iterations);
+
+    return group;
+}
+
+// Whether a reduction of `ReduceOpId` into `OutDataType` with or without indices can add the
+// results of several workgroups atomically; beta must also be 0.
+template <typename OutDataType>
+constexpr bool reduce_supports_atomic_add(ReduceTensorOp ReduceOpId, bool need_indices)
+{
+    constexpr bool out_supports_atomic_add =
+        std::is_same<OutDataType, float>::value || std::is_same<OutDataType, double>::value;
+
+    return out_supports_atomic_add && !need_indices &&
+           (ReduceOpId == ReduceTensorOp::ADD || ReduceOpId == ReduceTensorOp::AVG ||
+            ReduceOpId == ReduceTensorOp::NORM1);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -329,6 +329,25 @@ struct UnarySqrt<double, double>
     __host__ __device__ void operator()(double& y, const double& x) const { y = sqrt(x); };
 };
 
+template <typename Y, typename X>
+struct UnaryExp;
+
+template <>
+struct UnaryExp<float, float>
+{
+    __host__ __device__ UnaryExp(const int32_t divider = 1) { (void)divider; };
+
+    __host__ __device__ void operator()(float& y, const float& x) const { y = expf(x); };
+};
+
+template <>
+struct UnaryExp<double, double>
+{
+    __host__ __device__ UnaryExp(const int32_t divider = 1) { (void)divider; };
+
+    __host__ __device__ void operator()(double& y, const double& x) const { y = exp(x); };
+};
+
 } // namespace element_wise
 } // namespace tensor_operation
 } // namespace ck
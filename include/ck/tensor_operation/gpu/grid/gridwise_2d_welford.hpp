@@ -0,0 +1,477 @@
+#pragma once
+
+#include "reduction_common.hpp"
+#include "reduction_operator.hpp"
+#include "reduction_functions_accumulate.hpp"
+#include "reduction_functions_blockwise.hpp"
+#include "reduction_functions_threadwise.hpp"
+#include "threadwise_tensor_slice_transfer.hpp"
+#include "cluster_descriptor.hpp"
+#include "element_wise_operation.hpp"
+
+namespace ck {
+
+template <typename GridwiseWelford,
+          typename InDataType,
+          typename OutDataType,
+          typename AccDataType,
+          typename InGridDesc_M_K,
+          typename OutGridDesc_M,
+          typename WorkspaceDesc_M_K>
+__global__ void kernel_welford_multiblock(const InGridDesc_M_K in_grid_desc_m_k,
+                                          const OutGridDesc_M out_grid_desc_m,
+                                          const WorkspaceDesc_M_K workspace_desc_m_k,
+                                          index_t reduce_length,
+                                          index_t block_group_size,
+                                          index_t num_k_block_tile_iteration,
+                                          const InDataType* const __restrict__ p_in_global,
+                                          OutDataType* const __restrict__ p_mean_global,
+                                          OutDataType* const __restrict__ p_var_global,
+                                          AccDataType* const __restrict__ p_ws_mean_global,
+                                          AccDataType* const __restrict__ p_ws_m2_global,
+                                          index_t* const __restrict__ p_ws_count_global)
+{
+    GridwiseWelford::Run(in_grid_desc_m_k,
+                         out_grid_desc_m,
+                         workspace_desc_m_k,
+                         reduce_length,
+                         block_group_size,
+                         num_k_block_tile_iteration,
+                         p_in_global,
+                         p_mean_global,
+                         p_var_global,
+                         p_ws_mean_global,
+                         p_ws_m2_global,
+                         p_ws_count_global);
+};
+
+template <typename GridwiseWelfordMerge,
+          typename AccDataType,
+          typename OutDataType,
+          typename WorkspaceDesc_M_K,
+          typename OutGridDesc_M>
+__global__ void kernel_welford_merge(const WorkspaceDesc_M_K workspace_desc_m_k,
+                                     const OutGridDesc_M out_grid_desc_m,
+                                     const AccDataType* const __restrict__ p_ws_mean_global,
+                                     const AccDataType* const __restrict__ p_ws_m2_global,
+                                     const index_t* const __restrict__ p_ws_count_global,
+                                     OutDataType* const __restrict__ p_mean_global,
+                                     OutDataType* const __restrict__ p_var_global)
+{
+    GridwiseWelfordMerge::Run(workspace_desc_m_k,
+                              out_grid_desc_m,
+                              p_ws_mean_global,
+                              p_ws_m2_global,
+                              p_ws_count_global,
+                              p_mean_global,
+                              p_var_global);
+};
+
+// Mean and (population) variance of the K elements of each of the M rows, read once, with
+// Welford's algorithm. Each thread accumulates a Welford triple of its part of a tile and the
+// KThreadClusterSize threads of a row merge theirs in LDS, so the same kernel is threadwise for
+// KThreadClusterSize == 1 and blockwise otherwise. Rows may also be split over block_group_size
+// workgroups, each reducing num_k_block_tile_iteration tiles: with a single workgroup per row it
+// writes the mean and variance, otherwise each workgroup writes its triple into the workspace,
+// which GridwiseWelfordMerge_mk_to_m merges.
+template <typename InDataType,
+          typename OutDataType,
+          typename AccDataType,
+          typename InGridDesc_M_K,
+          typename OutGridDesc_M,
+          typename WorkspaceDesc_M_K,
+          index_t BlockSize,
+          index_t MThreadClusterSize,
+          index_t KThreadClusterSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t InSrcVectorDim,
+          index_t InSrcVectorSize,
+          index_t OutDstVectorSize>
+struct GridwiseWelford_mk_to_m_multiblock
+{
+    static_assert(((InSrcVectorDim == 0 && MThreadSliceSize % InSrcVectorSize == 0) ||
+                   (InSrcVectorDim == 1 && KThreadSliceSize % InSrcVectorSize == 0)) &&
+                      (MThreadSliceSize % OutDstVectorSize == 0),
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    static constexpr bool reorder_thread_cluster = (InSrcVectorDim == 0);
+
+    using ThreadClusterLengths_M_K = Sequence<MThreadClusterSize, KThreadClusterSize>;
+
+    using ThreadBufferDimAccessOrder =
+        typename conditional<reorder_thread_cluster, Sequence<1, 0>, Sequence<0, 1>>::type;
+
+    using ThreadClusterArrangeOrder =
+        typename conditional<reorder_thread_cluster, Sequence<1, 0>, Sequence<0, 1>>::type;
+
+    static constexpr auto thread_cluster_desc =
+        make_cluster_descriptor(ThreadClusterLengths_M_K{}, ThreadClusterArrangeOrder{});
+
+    using ThreadReduceSrcDesc_M_K = decltype(make_naive_tensor_descriptor_packed(
+        make_tuple(Number<MThreadSliceSize>{}, Number<KThreadSliceSize>{})));
+    using ThreadReduceDstDesc_M =
+        decltype(make_naive_tensor_descriptor_packed(make_tuple(Number<MThreadSliceSize>{})));
+
+    using PassThroughOp = tensor_operation::element_wise::PassThrough;
+
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    static constexpr index_t M_BlockTileSize = MThreadClusterSize * MThreadSliceSize;
+    static constexpr index_t K_BlockTileSize = KThreadClusterSize * KThreadSliceSize;
+
+    __device__ static void Run(const InGridDesc_M_K& in_grid_desc_m_k,
+                               const OutGridDesc_M& out_grid_desc_m,
+                               const WorkspaceDesc_M_K& workspace_desc_m_k,
+                               index_t reduce_length,
+                               index_t block_group_size,
+                               index_t num_k_block_tile_iteration,
+                               const InDataType* const __restrict__ p_in_global,
+                               OutDataType* const __restrict__ p_mean_global,
+                               OutDataType* const __restrict__ p_var_global,
+                               AccDataType* const __restrict__ p_ws_mean_global,
+                               AccDataType* const __restrict__ p_ws_m2_global,
+                               index_t* const __restrict__ p_ws_count_global)
+    {
+        using ThreadwiseWelfordReduce =
+            ThreadwiseWelford<AccDataType, ThreadReduceSrcDesc_M_K, ThreadReduceDstDesc_M>;
+
+        const auto in_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_in_global, in_grid_desc_m_k.GetElementSpaceSize(), type_convert<InDataType>(0.0f));
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            in_thread_buf;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> mean_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> m2_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, index_t, MThreadSliceSize, true> count_thread_buf;
+
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            reduce::Welford<AccDataType>::Init(
+                mean_thread_buf(I), m2_thread_buf(I), count_thread_buf(I));
+        });
+
+        const index_t thread_local_id = get_thread_local_1d_id();
+        const index_t block_global_id = get_block_1d_id();
+        const index_t blkgroup_id     = block_global_id / block_group_size;
+        const index_t block_local_id  = block_global_id % block_group_size;
+
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(thread_local_id));
+
+        const auto thread_m_cluster_id = thread_cluster_idx[I0];
+        const auto thread_k_cluster_id = thread_cluster_idx[I1];
+
+        const index_t reduceSizePerBlock = K_BlockTileSize * num_k_block_tile_iteration;
+
+        using ThreadBufferLengths         = Sequence<MThreadSliceSize, KThreadSliceSize>;
+        constexpr auto thread_buffer_desc = make_naive_tensor_descriptor_packed(
+            make_tuple(Number<MThreadSliceSize>{}, Number<KThreadSliceSize>{}));
+
+        const index_t thread_m_begin =
+            blkgroup_id * M_BlockTileSize + thread_m_cluster_id * MThreadSliceSize;
+
+        index_t thread_k_begin =
+            block_local_id * reduceSizePerBlock + thread_k_cluster_id * KThreadSliceSize;
+
+        auto threadwise_src_load = ThreadwiseTensorSliceTransfer_v2<InDataType,
+                                                                    AccDataType,
+                                                                    InGridDesc_M_K,
+                                                                    decltype(thread_buffer_desc),
+                                                                    ThreadBufferLengths,
+                                                                    ThreadBufferDimAccessOrder,
+                                                                    InSrcVectorDim,
+                                                                    InSrcVectorSize,
+                                                                    1,
+                                                                    false>(
+            in_grid_desc_m_k, make_multi_index(thread_m_begin, thread_k_begin));
+
+        constexpr auto in_thread_copy_step = make_multi_index(0, K_BlockTileSize);
+
+        index_t reducedTiles = 0;
+        do
+        {
+            threadwise_src_load.Run(in_grid_desc_m_k,
+                                    in_global_buf,
+                                    thread_buffer_desc,
+                                    make_tuple(I0, I0),
+                                    in_thread_buf);
+
+            // the padding of the last tile does not count
+            ThreadwiseWelfordReduce::Reduce(in_thread_buf,
+                                            reduce_length - thread_k_begin,
+                                            mean_thread_buf,
+                                            m2_thread_buf,
+                                            count_thread_buf);
+
+            threadwise_src_load.MoveSrcSliceWindow(in_grid_desc_m_k, in_thread_copy_step);
+
+            thread_k_begin += K_BlockTileSize;
+            reducedTiles++;
+        } while(reducedTiles < num_k_block_tile_iteration);
+
+        if constexpr(KThreadClusterSize > 1)
+        {
+            using BlockwiseWelfordReduce = PartitionedBlockwiseWelford<AccDataType,
+                                                                       BlockSize,
+                                                                       ThreadClusterLengths_M_K,
+                                                                       ThreadClusterArrangeOrder>;
+
+            // LDS
+            __shared__ AccDataType p_mean_work_buffer[BlockSize];
+            __shared__ AccDataType p_m2_work_buffer[BlockSize];
+            __shared__ index_t p_count_work_buffer[BlockSize];
+
+            auto mean_work_buf =
+                make_dynamic_buffer<AddressSpaceEnum::Lds>(p_mean_work_buffer, BlockSize);
+            auto m2_work_buf =
+                make_dynamic_buffer<AddressSpaceEnum::Lds>(p_m2_work_buffer, BlockSize);
+            auto count_work_buf =
+                make_dynamic_buffer<AddressSpaceEnum::Lds>(p_count_work_buffer, BlockSize);
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+                BlockwiseWelfordReduce::Reduce(mean_work_buf,
+                                               m2_work_buf,
+                                               count_work_buf,
+                                               mean_thread_buf(I),
+                                               m2_thread_buf(I),
+                                               count_thread_buf(I));
+            });
+        };
+
+        if(thread_k_cluster_id != 0)
+            return;
+
+        if(block_group_size == 1)
+        {
+            auto mean_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+                p_mean_global, out_grid_desc_m.GetElementSpaceSize());
+            auto var_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+                p_var_global, out_grid_desc_m.GetElementSpaceSize());
+
+            // m2 becomes the variance
+            static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+                m2_thread_buf(I) =
+                    m2_thread_buf[I] / type_convert<AccDataType>(count_thread_buf[I]);
+            });
+
+            constexpr auto reduced_data_desc = ThreadReduceDstDesc_M{};
+
+            auto threadwise_dst_store =
+                ThreadwiseTensorSliceTransfer_v1r3<AccDataType,
+                                                   OutDataType,
+                                                   decltype(reduced_data_desc),
+                                                   OutGridDesc_M,
+                                                   PassThroughOp,
+                                                   Sequence<MThreadSliceSize>,
+                                                   Sequence<0>,
+                                                   0,
+                                                   OutDstVectorSize,
+                                                   InMemoryDataOperationEnum::Set,
+                                                   1,
+                                                   true>(
+                    out_grid_desc_m, make_multi_index(thread_m_begin), PassThroughOp{});
+
+            threadwise_dst_store.Run(reduced_data_desc,
+                                     make_tuple(I0),
+                                     mean_thread_buf,
+                                     out_grid_desc_m,
+                                     mean_global_buf);
+            threadwise_dst_store.Run(
+                reduced_data_desc, make_tuple(I0), m2_thread_buf, out_grid_desc_m, var_global_buf);
+        }
+        else
+        {
+            auto ws_mean_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+                p_ws_mean_global, workspace_desc_m_k.GetElementSpaceSize());
+            auto ws_m2_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+                p_ws_m2_global, workspace_desc_m_k.GetElementSpaceSize());
+            auto ws_count_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+                p_ws_count_global, workspace_desc_m_k.GetElementSpaceSize());
+
+            constexpr auto reduced_data_desc = make_naive_tensor_descriptor_packed(
+                make_tuple(Number<MThreadSliceSize>{}, Number<1>{}));
+
+            auto store_workspace = [&](auto src_type, const auto& src_buf, auto& dst_buf) {
+                using DataType = decltype(src_type);
+
+                auto threadwise_workspace_store =
+                    ThreadwiseTensorSliceTransfer_v1r3<DataType,
+                                                       DataType,
+                                                       decltype(reduced_data_desc),
+                                                       WorkspaceDesc_M_K,
+                                                       PassThroughOp,
+                                                       Sequence<MThreadSliceSize, 1>,
+                                                       Sequence<0, 1>,
+                                                       1,
+                                                       1,
+                                                       InMemoryDataOperationEnum::Set,
+                                                       1,
+                                                       true>(
+                        workspace_desc_m_k,
+                        make_multi_index(thread_m_begin, block_local_id),
+                        PassThroughOp{});
+
+                threadwise_workspace_store.Run(
+                    reduced_data_desc, make_tuple(I0, I0), src_buf, workspace_desc_m_k, dst_buf);
+            };
+
+            store_workspace(AccDataType{}, mean_thread_buf, ws_mean_global_buf);
+            store_workspace(AccDataType{}, m2_thread_buf, ws_m2_global_buf);
+            store_workspace(index_t{}, count_thread_buf, ws_count_global_buf);
+        }
+    };
+};
+
+// Merges the block_group_size Welford triples of each of the M rows the first call of a
+// multiblock GridwiseWelford_mk_to_m_multiblock wrote into the workspace, and writes the mean and
+// (population) variance. Each thread merges MThreadSliceSize rows.
+template <typename AccDataType,
+          typename OutDataType,
+          typename WorkspaceDesc_M_K,
+          typename OutGridDesc_M,
+          index_t BlockSize,
+          index_t MThreadSliceSize,
+          index_t OutDstVectorSize>
+struct GridwiseWelfordMerge_mk_to_m
+{
+    static_assert(MThreadSliceSize % OutDstVectorSize == 0,
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    using ThreadReduceDstDesc_M =
+        decltype(make_naive_tensor_descriptor_packed(make_tuple(Number<MThreadSliceSize>{})));
+
+    using PassThroughOp = tensor_operation::element_wise::PassThrough;
+
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    static constexpr index_t M_BlockTileSize = BlockSize * MThreadSliceSize;
+
+    __device__ static void Run(const WorkspaceDesc_M_K& workspace_desc_m_k,
+                               const OutGridDesc_M& out_grid_desc_m,
+                               const AccDataType* const __restrict__ p_ws_mean_global,
+                               const AccDataType* const __restrict__ p_ws_m2_global,
+                               const index_t* const __restrict__ p_ws_count_global,
+                               OutDataType* const __restrict__ p_mean_global,
+                               OutDataType* const __restrict__ p_var_global)
+    {
+        using Accumulation = detail::AccumulateWelford<AccDataType>;
+
+        const auto ws_mean_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_ws_mean_global, workspace_desc_m_k.GetElementSpaceSize());
+        const auto ws_m2_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_ws_m2_global, workspace_desc_m_k.GetElementSpaceSize());
+        const auto ws_count_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_ws_count_global, workspace_desc_m_k.GetElementSpaceSize());
+        auto mean_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_mean_global, out_grid_desc_m.GetElementSpaceSize());
+        auto var_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_var_global, out_grid_desc_m.GetElementSpaceSize());
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> mean_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> m2_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, index_t, MThreadSliceSize, true> count_thread_buf;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> in_mean_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> in_m2_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, index_t, MThreadSliceSize, true> in_count_buf;
+
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            reduce::Welford<AccDataType>::Init(
+                mean_thread_buf(I), m2_thread_buf(I), count_thread_buf(I));
+        });
+
+        const index_t thread_m_begin =
+            (get_block_1d_id() * BlockSize + get_thread_local_1d_id()) * MThreadSliceSize;
+
+        const index_t block_group_size = workspace_desc_m_k.GetLength(I1);
+
+        constexpr auto ws_thread_buffer_desc = make_naive_tensor_descriptor_packed(
+            make_tuple(Number<MThreadSliceSize>{}, Number<1>{}));
+
+        auto make_workspace_load = [&](auto data_type) {
+            using DataType = decltype(data_type);
+
+            return ThreadwiseTensorSliceTransfer_v2<DataType,
+                                                    DataType,
+                                                    WorkspaceDesc_M_K,
+                                                    decltype(ws_thread_buffer_desc),
+                                                    Sequence<MThreadSliceSize, 1>,
+                                                    Sequence<0, 1>,
+                                                    1,
+                                                    1,
+                                                    1,
+                                                    false>(workspace_desc_m_k,
+                                                           make_multi_index(thread_m_begin, 0));
+        };
+
+        auto threadwise_mean_load  = make_workspace_load(AccDataType{});
+        auto threadwise_m2_load    = make_workspace_load(AccDataType{});
+        auto threadwise_count_load = make_workspace_load(index_t{});
+
+        constexpr auto ws_copy_step = make_multi_index(0, 1);
+
+        for(index_t g = 0; g < block_group_size; g++)
+        {
+            threadwise_mean_load.Run(workspace_desc_m_k,
+                                     ws_mean_global_buf,
+                                     ws_thread_buffer_desc,
+                                     make_tuple(I0, I0),
+                                     in_mean_buf);
+            threadwise_m2_load.Run(workspace_desc_m_k,
+                                   ws_m2_global_buf,
+                                   ws_thread_buffer_desc,
+                                   make_tuple(I0, I0),
+                                   in_m2_buf);
+            threadwise_count_load.Run(workspace_desc_m_k,
+                                      ws_count_global_buf,
+                                      ws_thread_buffer_desc,
+                                      make_tuple(I0, I0),
+                                      in_count_buf);
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+                Accumulation::Merge(mean_thread_buf(I),
+                                    m2_thread_buf(I),
+                                    count_thread_buf(I),
+                                    in_mean_buf[I],
+                                    in_m2_buf[I],
+                                    in_count_buf[I]);
+            });
+
+            threadwise_mean_load.MoveSrcSliceWindow(workspace_desc_m_k, ws_copy_step);
+            threadwise_m2_load.MoveSrcSliceWindow(workspace_desc_m_k, ws_copy_step);
+            threadwise_count_load.MoveSrcSliceWindow(workspace_desc_m_k, ws_copy_step);
+        }
+
+        // m2 becomes the variance
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            m2_thread_buf(I) = m2_thread_buf[I] / type_convert<AccDataType>(count_thread_buf[I]);
+        });
+
+        constexpr auto reduced_data_desc = ThreadReduceDstDesc_M{};
+
+        auto threadwise_dst_store =
+            ThreadwiseTensorSliceTransfer_v1r3<AccDataType,
+                                               OutDataType,
+                                               decltype(reduced_data_desc),
+                                               OutGridDesc_M,
+                                               PassThroughOp,
+                                               Sequence<MThreadSliceSize>,
+                                               Sequence<0>,
+                                               0,
+                                               OutDstVectorSize,
+                                               InMemoryDataOperationEnum::Set,
+                                               1,
+                                               true>(
+                out_grid_desc_m, make_multi_index(thread_m_begin), PassThroughOp{});
+
+        threadwise_dst_store.Run(
+            reduced_data_desc, make_tuple(I0), mean_thread_buf, out_grid_desc_m, mean_global_buf);
+        threadwise_dst_store.Run(
+            reduced_data_desc, make_tuple(I0), m2_thread_buf, out_grid_desc_m, var_global_buf);
+    };
+};
+
+} // namespace ck
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "cluster_descriptor.hpp"
+#include "data_type.hpp"
+#include "element_wise_operation.hpp"
+#include "threadwise_tensor_slice_transfer.hpp"
+
+namespace ck {
+
+template <typename GridwiseElementwise1d,
+          typename InDataTypePointerTuple,
+          typename OutDataTypePointerTuple,
+          typename InGridDescTuple,
+          typename OutGridDescTuple,
+          typename ElementwiseOperation>
+__global__ void kernel_elementwise_1d(const InDataTypePointerTuple p_in_global_tuple,
+                                      const OutDataTypePointerTuple p_out_global_tuple,
+                                      const InGridDescTuple in_grid_desc_m_tuple,
+                                      const OutGridDescTuple out_grid_desc_m_tuple,
+                                      const ElementwiseOperation elementwise_op)
+{
+    GridwiseElementwise1d::Run(p_in_global_tuple,
+                               p_out_global_tuple,
+                               in_grid_desc_m_tuple,
+                               out_grid_desc_m_tuple,
+                               elementwise_op);
+}
+
+// Each thread computes MPerThread consecutive elements of the 1-D problem per iteration. Tensor i
+// is read or written in vectors of its own ScalarPerVector elements, so a tensor that cannot be
+// accessed in vectors (broadcast in its innermost dimension, odd strides) does not make the
+// others access element by element.
+template <typename InDataTypeTuple,
+          typename OutDataTypeTuple,
+          typename ComputeDataType,
+          typename GridDesc_M,
+          typename ElementwiseOperation,
+          index_t MPerThread,
+          typename InScalarPerVectorSeq,
+          typename OutScalarPerVectorSeq>
+struct GridwiseElementwise_1D
+{
+    static constexpr index_t NumInput  = InDataTypeTuple::Size();
+    static constexpr index_t NumOutput = OutDataTypeTuple::Size();
+
+    static_assert(NumInput == InScalarPerVectorSeq::Size() &&
+                      NumOutput == OutScalarPerVectorSeq::Size(),
+                  "wrong! one ScalarPerVector per tensor");
+
+    static constexpr auto I0 = Number<0>{};
+
+    static constexpr auto thread_desc_m =
+        make_naive_tensor_descriptor_packed(make_tuple(Number<MPerThread>{}));
+
+    using PassThrough = tensor_operation::element_wise::PassThrough;
+
+    static __device__ auto CalculateElementwiseIndex()
+    {
+        const index_t global_thread_id = get_thread_global_1d_id();
+        return make_multi_index(global_thread_id * MPerThread);
+    }
+
+    template <typename InDataTypePointerTuple,
+              typename OutDataTypePointerTuple,
+              typename InGridDescTuple,
+              typename OutGridDescTuple>
+    __device__ static void Run(const InDataTypePointerTuple& p_in_global_tuple,
+                               const OutDataTypePointerTuple& p_out_global_tuple,
+                               const InGridDescTuple& in_grid_desc_m_tuple,
+                               const OutGridDescTuple& out_grid_desc_m_tuple,
+                               const ElementwiseOperation& elementwise_op)
+    {
+        const auto in_global_buf_tuple = generate_tuple(
+            [&](auto I) {
+                return make_dynamic_buffer<AddressSpaceEnum::Global>(
+                    p_in_global_tuple[I], in_grid_desc_m_tuple[I].GetElementSpaceSize());
+            },
+            Number<NumInput>{});
+
+        auto out_global_buf_tuple = generate_tuple(
+            [&](auto I) {
+                return make_dynamic_buffer<AddressSpaceEnum::Global>(
+                    p_out_global_tuple[I], out_grid_desc_m_tuple[I].GetElementSpaceSize());
+            },
+            Number<NumOutput>{});
+
+        auto in_thread_buf_tuple = generate_tuple(
+            [&](auto) {
+                return StaticBuffer<AddressSpaceEnum::Vgpr, ComputeDataType, MPerThread, true>{};
+            },
+            Number<NumInput>{});
+
+        auto out_thread_buf_tuple = generate_tuple(
+            [&](auto) {
+                return StaticBuffer<AddressSpaceEnum::Vgpr, ComputeDataType, MPerThread, true>{};
+            },
+            Number<NumOutput>{});
+
+        const auto thread_global_offset = CalculateElementwiseIndex();
+
+        auto in_global_load_tuple = generate_tuple(
+            [&](auto I) {
+                using DataType = remove_cvref_t<decltype(InDataTypeTuple{}[I])>;
+
+                return ThreadwiseTensorSliceTransfer_v2<DataType,
+                                                        ComputeDataType,
+                                                        GridDesc_M,
+                                                        decltype(thread_desc_m),
+                                                        Sequence<MPerThread>, // SliceLengths
+                                                        Sequence<0>,          // DimAccessOrder
+                                                        0,                    // SrcVectorDim
+                                                        InScalarPerVectorSeq::At(I),
+                                                        1, // SrcScalarStrideInVector
+                                                        false>{in_grid_desc_m_tuple[I],
+                                                               thread_global_offset};
+            },
+            Number<NumInput>{});
+
+        auto out_global_store_tuple = generate_tuple(
+            [&](auto I) {
+                using DataType = remove_cvref_t<decltype(OutDataTypeTuple{}[I])>;
+
+                return ThreadwiseTensorSliceTransfer_v1r3<ComputeDataType,
+                                                          DataType,
+                                                          decltype(thread_desc_m),
+                                                          GridDesc_M,
+                                                          PassThrough,
+                                                          Sequence<MPerThread>, // SliceLengths
+                                                          Sequence<0>,          // DimAccessOrder
+                                                          0,                    // DstVectorDim
+                                                          OutScalarPerVectorSeq::At(I),
+                                                          InMemoryDataOperationEnum::Set,
+                                                          1, // DstScalarStrideInVector
+                                                          false>{
+                    out_grid_desc_m_tuple[I], thread_global_offset, PassThrough{}};
+            },
+            Number<NumOutput>{});
+
+        const index_t blockSize    = get_block_size();
+        const index_t blockPerGrid = get_grid_size();
+        const auto m               = out_grid_desc_m_tuple[I0].GetLength(I0);
+        const index_t loop_step    = blockPerGrid * blockSize * MPerThread;
+        const auto loop_step_index = make_multi_index(loop_step);
+
+        index_t num_iter = m / (loop_step);
+        do
+        {
+            static_for<0, NumInput, 1>{}([&](auto I) {
+                in_global_load_tuple(I).Run(in_grid_desc_m_tuple[I],
+                                            in_global_buf_tuple[I],
+                                            thread_desc_m,
+                                            make_tuple(I0),
+                                            in_thread_buf_tuple(I));
+
+                in_global_load_tuple(I).MoveSrcSliceWindow(in_grid_desc_m_tuple[I],
+                                                           loop_step_index);
+            });
+
+            static_for<0, MPerThread, 1>{}([&](auto iM) {
+                // out_0, out_1, ..., in_0, in_1, ...
+                const auto in_data_refs = generate_tie(
+                    [&](auto I) -> const ComputeDataType& { return in_thread_buf_tuple[I][iM]; },
+                    Number<NumInput>{});
+
+                auto out_data_refs = generate_tie(
+                    [&](auto I) -> ComputeDataType& { return out_thread_buf_tuple(I)(iM); },
+                    Number<NumOutput>{});
+
+                unpack2(elementwise_op, out_data_refs, in_data_refs);
+            });
+
+            static_for<0, NumOutput, 1>{}([&](auto I) {
+                out_global_store_tuple(I).Run(thread_desc_m,
+                                              make_tuple(I0), // SrcSliceOriginIdx
+                                              out_thread_buf_tuple[I],
+                                              out_grid_desc_m_tuple[I],
+                                              out_global_buf_tuple(I));
+
+                out_global_store_tuple(I).MoveDstSliceWindow(out_grid_desc_m_tuple[I],
+                                                             loop_step_index);
+            });
+        } while(--num_iter);
+    }
+};
+
+} // namespace ck
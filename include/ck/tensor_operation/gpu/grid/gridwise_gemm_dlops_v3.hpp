@@ -618,10 +618,14 @@ struct GridwiseGemmDlops_km_kn_mn_v3
             {
                 FloatAcc x = 1.0 + exp(-c_thread_buf[i]);
 
+#if CK_HOST_BACKEND
+                x = 1 / x;
+#else
                 asm volatile("\n \
                         v_rcp_f32 %0, %1 \n"
                              : "=v"(x)
                              : "0"(x));
+#endif
 
                 c_thread_buf(i) = x;
             }
@@ -0,0 +1,340 @@
+#pragma once
+
+#include "data_type.hpp"
+#include "reduction_common.hpp"
+#include "reduction_operator.hpp"
+#include "reduction_functions_accumulate.hpp"
+#include "reduction_functions_blockwise.hpp"
+#include "reduction_functions_threadwise.hpp"
+#include "threadwise_tensor_slice_transfer.hpp"
+#include "cluster_descriptor.hpp"
+#include "element_wise_operation.hpp"
+
+namespace ck {
+
+template <typename GridwiseLayernorm,
+          typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename AccDataType,
+          typename GridDesc_M_K>
+__global__ void kernel_layernorm(const GridDesc_M_K x_grid_desc_m_k,
+                                 const GridDesc_M_K gamma_grid_desc_m_k,
+                                 const GridDesc_M_K beta_grid_desc_m_k,
+                                 const GridDesc_M_K y_grid_desc_m_k,
+                                 index_t reduce_length,
+                                 index_t num_k_block_tile_iteration,
+                                 AccDataType epsilon,
+                                 const XDataType* const __restrict__ p_x_global,
+                                 const GammaDataType* const __restrict__ p_gamma_global,
+                                 const BetaDataType* const __restrict__ p_beta_global,
+                                 YDataType* const __restrict__ p_y_global)
+{
+    GridwiseLayernorm::Run(x_grid_desc_m_k,
+                           gamma_grid_desc_m_k,
+                           beta_grid_desc_m_k,
+                           y_grid_desc_m_k,
+                           reduce_length,
+                           num_k_block_tile_iteration,
+                           epsilon,
+                           p_x_global,
+                           p_gamma_global,
+                           p_beta_global,
+                           p_y_global);
+};
+
+// y = (x - mean) / sqrt(var + epsilon) * gamma + beta over the K elements of each of the M rows,
+// a workgroup per MThreadClusterSize x MThreadSliceSize rows. gamma and beta are broadcast over
+// M, i.e. their descriptors have stride 0 along it.
+//
+// The first sweep over a row computes its mean and variance with Welford's algorithm, so the row
+// is read once, and the threads of a row then merge their partial results in LDS. The second
+// sweep writes the output. A row of one tile, i.e. no longer than KThreadClusterSize x
+// KThreadSliceSize, stays in VGPRs in between and is read only once; a longer row is read again.
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename AccDataType,
+          typename GridDesc_M_K,
+          index_t BlockSize,
+          index_t MThreadClusterSize,
+          index_t KThreadClusterSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t XSrcVectorDim,
+          index_t XSrcVectorSize,
+          index_t YDstVectorSize>
+struct GridwiseLayernorm_mk_to_mk
+{
+    static_assert(((XSrcVectorDim == 0 && MThreadSliceSize % XSrcVectorSize == 0 &&
+                    MThreadSliceSize % YDstVectorSize == 0) ||
+                   (XSrcVectorDim == 1 && KThreadSliceSize % XSrcVectorSize == 0 &&
+                    KThreadSliceSize % YDstVectorSize == 0)),
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    static constexpr bool reorder_thread_cluster = (XSrcVectorDim == 0);
+
+    // gamma and beta are only contiguous along K
+    static constexpr index_t GammaBetaSrcVectorSize = XSrcVectorDim == 1 ? XSrcVectorSize : 1;
+
+    using ThreadClusterLengths_M_K = Sequence<MThreadClusterSize, KThreadClusterSize>;
+
+    using ThreadBufferDimAccessOrder =
+        typename conditional<reorder_thread_cluster, Sequence<1, 0>, Sequence<0, 1>>::type;
+
+    using ThreadClusterArrangeOrder =
+        typename conditional<reorder_thread_cluster, Sequence<1, 0>, Sequence<0, 1>>::type;
+
+    static constexpr auto thread_cluster_desc =
+        make_cluster_descriptor(ThreadClusterLengths_M_K{}, ThreadClusterArrangeOrder{});
+
+    using ThreadReduceSrcDesc_M_K = decltype(make_naive_tensor_descriptor_packed(
+        make_tuple(Number<MThreadSliceSize>{}, Number<KThreadSliceSize>{})));
+    using ThreadReduceDstDesc_M =
+        decltype(make_naive_tensor_descriptor_packed(make_tuple(Number<MThreadSliceSize>{})));
+
+    using PassThroughOp = tensor_operation::element_wise::PassThrough;
+    using SqrtOp        = tensor_operation::element_wise::UnarySqrt<AccDataType, AccDataType>;
+
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    static constexpr index_t M_BlockTileSize = MThreadClusterSize * MThreadSliceSize;
+    static constexpr index_t K_BlockTileSize = KThreadClusterSize * KThreadSliceSize;
+
+    __device__ static void Run(const GridDesc_M_K& x_grid_desc_m_k,
+                               const GridDesc_M_K& gamma_grid_desc_m_k,
+                               const GridDesc_M_K& beta_grid_desc_m_k,
+                               const GridDesc_M_K& y_grid_desc_m_k,
+                               index_t reduce_length,
+                               index_t num_k_block_tile_iteration,
+                               AccDataType epsilon,
+                               const XDataType* const __restrict__ p_x_global,
+                               const GammaDataType* const __restrict__ p_gamma_global,
+                               const BetaDataType* const __restrict__ p_beta_global,
+                               YDataType* const __restrict__ p_y_global)
+    {
+        using ThreadwiseWelfordReduce =
+            ThreadwiseWelford<AccDataType, ThreadReduceSrcDesc_M_K, ThreadReduceDstDesc_M>;
+
+        const auto x_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_x_global, x_grid_desc_m_k.GetElementSpaceSize(), type_convert<XDataType>(0.0f));
+        const auto gamma_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_gamma_global, gamma_grid_desc_m_k.GetElementSpaceSize());
+        const auto beta_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_beta_global, beta_grid_desc_m_k.GetElementSpaceSize());
+        auto y_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_y_global, y_grid_desc_m_k.GetElementSpaceSize());
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            x_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            gamma_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            beta_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            y_thread_buf;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> mean_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> m2_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, index_t, MThreadSliceSize, true> count_thread_buf;
+
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            reduce::Welford<AccDataType>::Init(
+                mean_thread_buf(I), m2_thread_buf(I), count_thread_buf(I));
+        });
+
+        const index_t thread_local_id = get_thread_local_1d_id();
+        const index_t block_global_id = get_block_1d_id();
+
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(thread_local_id));
+
+        const auto thread_m_cluster_id = thread_cluster_idx[I0];
+        const auto thread_k_cluster_id = thread_cluster_idx[I1];
+
+        using ThreadBufferLengths         = Sequence<MThreadSliceSize, KThreadSliceSize>;
+        constexpr auto thread_buffer_desc = make_naive_tensor_descriptor_packed(
+            make_tuple(Number<MThreadSliceSize>{}, Number<KThreadSliceSize>{}));
+
+        const index_t thread_m_begin =
+            block_global_id * M_BlockTileSize + thread_m_cluster_id * MThreadSliceSize;
+        const index_t thread_k_begin = thread_k_cluster_id * KThreadSliceSize;
+
+        const auto thread_slice_origin = make_multi_index(thread_m_begin, thread_k_begin);
+
+        auto threadwise_x_load = ThreadwiseTensorSliceTransfer_v2<XDataType,
+                                                                  AccDataType,
+                                                                  GridDesc_M_K,
+                                                                  decltype(thread_buffer_desc),
+                                                                  ThreadBufferLengths,
+                                                                  ThreadBufferDimAccessOrder,
+                                                                  XSrcVectorDim,
+                                                                  XSrcVectorSize,
+                                                                  1,
+                                                                  false>(x_grid_desc_m_k,
+                                                                         thread_slice_origin);
+
+        auto threadwise_gamma_load =
+            ThreadwiseTensorSliceTransfer_v2<GammaDataType,
+                                             AccDataType,
+                                             GridDesc_M_K,
+                                             decltype(thread_buffer_desc),
+                                             ThreadBufferLengths,
+                                             ThreadBufferDimAccessOrder,
+                                             1,
+                                             GammaBetaSrcVectorSize,
+                                             1,
+                                             false>(gamma_grid_desc_m_k, thread_slice_origin);
+
+        auto threadwise_beta_load =
+            ThreadwiseTensorSliceTransfer_v2<BetaDataType,
+                                             AccDataType,
+                                             GridDesc_M_K,
+                                             decltype(thread_buffer_desc),
+                                             ThreadBufferLengths,
+                                             ThreadBufferDimAccessOrder,
+                                             1,
+                                             GammaBetaSrcVectorSize,
+                                             1,
+                                             false>(beta_grid_desc_m_k, thread_slice_origin);
+
+        auto threadwise_y_store =
+            ThreadwiseTensorSliceTransfer_v1r3<AccDataType,
+                                               YDataType,
+                                               decltype(thread_buffer_desc),
+                                               GridDesc_M_K,
+                                               PassThroughOp,
+                                               ThreadBufferLengths,
+                                               ThreadBufferDimAccessOrder,
+                                               XSrcVectorDim,
+                                               YDstVectorSize,
+                                               InMemoryDataOperationEnum::Set,
+                                               1,
+                                               false>(
+                y_grid_desc_m_k, thread_slice_origin, PassThroughOp{});
+
+        constexpr auto thread_copy_step = make_multi_index(0, K_BlockTileSize);
+
+        // first sweep: the Welford triple of the part of each row the thread reads
+        index_t tile_k_begin = thread_k_begin;
+        index_t reducedTiles = 0;
+        do
+        {
+            threadwise_x_load.Run(x_grid_desc_m_k,
+                                  x_global_buf,
+                                  thread_buffer_desc,
+                                  make_tuple(I0, I0),
+                                  x_thread_buf);
+
+            // the padding of the last tile does not count
+            ThreadwiseWelfordReduce::Reduce(x_thread_buf,
+                                            reduce_length - tile_k_begin,
+                                            mean_thread_buf,
+                                            m2_thread_buf,
+                                            count_thread_buf);
+
+            threadwise_x_load.MoveSrcSliceWindow(x_grid_desc_m_k, thread_copy_step);
+
+            tile_k_begin += K_BlockTileSize;
+            reducedTiles++;
+        } while(reducedTiles < num_k_block_tile_iteration);
+
+        if constexpr(KThreadClusterSize > 1)
+        {
+            using BlockwiseWelfordReduce = PartitionedBlockwiseWelford<AccDataType,
+                                                                       BlockSize,
+                                                                       ThreadClusterLengths_M_K,
+                                                                       ThreadClusterArrangeOrder>;
+
+            // LDS
+            __shared__ AccDataType p_mean_work_buffer[BlockSize];
+            __shared__ AccDataType p_m2_work_buffer[BlockSize];
+            __shared__ index_t p_count_work_buffer[BlockSize];
+
+            auto mean_work_buf =
+                make_dynamic_buffer<AddressSpaceEnum::Lds>(p_mean_work_buffer, BlockSize);
+            auto m2_work_buf =
+                make_dynamic_buffer<AddressSpaceEnum::Lds>(p_m2_work_buffer, BlockSize);
+            auto count_work_buf =
+                make_dynamic_buffer<AddressSpaceEnum::Lds>(p_count_work_buffer, BlockSize);
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+                BlockwiseWelfordReduce::Reduce(mean_work_buf,
+                                               m2_work_buf,
+                                               count_work_buf,
+                                               mean_thread_buf(I),
+                                               m2_thread_buf(I),
+                                               count_thread_buf(I));
+            });
+        };
+
+        // m2 becomes 1 / sqrt(var + epsilon)
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            AccDataType std_dev;
+
+            SqrtOp{}(std_dev,
+                     m2_thread_buf[I] / type_convert<AccDataType>(count_thread_buf[I]) + epsilon);
+
+            m2_thread_buf(I) = type_convert<AccDataType>(1.0f) / std_dev;
+        });
+
+        // second sweep: the output, from the VGPRs if the row is a single tile
+        if(num_k_block_tile_iteration > 1)
+            threadwise_x_load.SetSrcSliceOrigin(x_grid_desc_m_k, thread_slice_origin);
+
+        reducedTiles = 0;
+        do
+        {
+            if(num_k_block_tile_iteration > 1)
+            {
+                threadwise_x_load.Run(x_grid_desc_m_k,
+                                      x_global_buf,
+                                      thread_buffer_desc,
+                                      make_tuple(I0, I0),
+                                      x_thread_buf);
+
+                threadwise_x_load.MoveSrcSliceWindow(x_grid_desc_m_k, thread_copy_step);
+            }
+
+            threadwise_gamma_load.Run(gamma_grid_desc_m_k,
+                                      gamma_global_buf,
+                                      thread_buffer_desc,
+                                      make_tuple(I0, I0),
+                                      gamma_thread_buf);
+            threadwise_beta_load.Run(beta_grid_desc_m_k,
+                                     beta_global_buf,
+                                     thread_buffer_desc,
+                                     make_tuple(I0, I0),
+                                     beta_thread_buf);
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto iM) {
+                static_for<0, KThreadSliceSize, 1>{}([&](auto iK) {
+                    constexpr auto offset =
+                        thread_buffer_desc.CalculateOffset(make_tuple(iM, iK));
+
+                    y_thread_buf(Number<offset>{}) =
+                        (x_thread_buf[Number<offset>{}] - mean_thread_buf[iM]) *
+                            m2_thread_buf[iM] * gamma_thread_buf[Number<offset>{}] +
+                        beta_thread_buf[Number<offset>{}];
+                });
+            });
+
+            threadwise_y_store.Run(thread_buffer_desc,
+                                   make_tuple(I0, I0),
+                                   y_thread_buf,
+                                   y_grid_desc_m_k,
+                                   y_global_buf);
+
+            threadwise_gamma_load.MoveSrcSliceWindow(gamma_grid_desc_m_k, thread_copy_step);
+            threadwise_beta_load.MoveSrcSliceWindow(beta_grid_desc_m_k, thread_copy_step);
+            threadwise_y_store.MoveDstSliceWindow(y_grid_desc_m_k, thread_copy_step);
+
+            reducedTiles++;
+        } while(reducedTiles < num_k_block_tile_iteration);
+    };
+};
+
+} // namespace ck
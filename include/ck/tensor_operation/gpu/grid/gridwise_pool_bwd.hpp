@@ -0,0 +1,202 @@
+#pragma once
+
+#include "array.hpp"
+#include "data_type.hpp"
+#include "dynamic_buffer.hpp"
+#include "get_id.hpp"
+#include "math.hpp"
+#include "reduction_enums.hpp"
+#include "static_buffer.hpp"
+
+namespace ck {
+
+// Shape of an N-D pooling of a packed [N, Xi..., C] input into a packed [N, Xo..., C] output
+template <index_t NumDimSpatial>
+struct PoolProblem
+{
+    index_t N;
+    index_t C;
+    Array<index_t, NumDimSpatial> input_spatial_lengths;
+    Array<index_t, NumDimSpatial> window_spatial_lengths;
+    Array<index_t, NumDimSpatial> output_spatial_lengths;
+    Array<index_t, NumDimSpatial> window_strides;
+    Array<index_t, NumDimSpatial> input_left_pads;
+};
+
+template <typename GridwisePoolBwd,
+          typename DOutDataType,
+          typename IndexDataType,
+          typename DInDataType,
+          typename Problem>
+__global__ void kernel_pool_bwd(const DOutDataType* __restrict__ p_dout_global,
+                                const IndexDataType* __restrict__ p_out_indices_global,
+                                DInDataType* __restrict__ p_din_global,
+                                const Problem problem,
+                                const bool count_include_pad)
+{
+    GridwisePoolBwd::Run(
+        p_dout_global, p_out_indices_global, p_din_global, problem, count_include_pad);
+}
+
+// Each thread gathers ScalarPerVector consecutive channels of one input pixel from the outputs
+// whose windows hold it, so every element of din is written once, without atomics, and windows
+// may overlap. The workgroups loop over the pixels if the grid is smaller than the problem.
+//
+// MAX/MIN/AMAX take dout where the forward pass selected the pixel, i.e. where out_indices holds
+// its index in the window; AVG takes dout divided by the element count of the window.
+template <index_t NumDimSpatial,
+          typename DOutDataType,
+          typename IndexDataType,
+          typename DInDataType,
+          typename AccDataType,
+          ReduceTensorOp ReduceOpId,
+          index_t ScalarPerVector>
+struct GridwisePoolBwd_1D
+{
+    static_assert(ReduceOpId == ReduceTensorOp::AVG || ReduceOpId == ReduceTensorOp::MAX ||
+                      ReduceOpId == ReduceTensorOp::MIN || ReduceOpId == ReduceTensorOp::AMAX,
+                  "wrong! pooling is AVG, MAX, MIN or AMAX");
+
+    static constexpr bool UseIndices = ReduceOpId != ReduceTensorOp::AVG;
+
+    using dout_vector_t  = typename vector_type<DOutDataType, ScalarPerVector>::type;
+    using index_vector_t = typename vector_type<IndexDataType, ScalarPerVector>::type;
+    using din_vector_t   = typename vector_type<DInDataType, ScalarPerVector>::type;
+
+    __device__ static void Run(const DOutDataType* __restrict__ p_dout_global,
+                               const IndexDataType* __restrict__ p_out_indices_global,
+                               DInDataType* __restrict__ p_din_global,
+                               const PoolProblem<NumDimSpatial>& problem,
+                               bool count_include_pad)
+    {
+        const auto& Xi = problem.input_spatial_lengths;
+        const auto& Y  = problem.window_spatial_lengths;
+        const auto& Xo = problem.output_spatial_lengths;
+        const auto& S  = problem.window_strides;
+        const auto& P  = problem.input_left_pads;
+
+        index_t num_input_pixel  = problem.N;
+        index_t num_output_pixel = problem.N;
+        index_t window_size      = 1;
+
+        static_for<0, NumDimSpatial, 1>{}([&](auto d) {
+            num_input_pixel *= Xi[d];
+            num_output_pixel *= Xo[d];
+            window_size *= Y[d];
+        });
+
+        const auto dout_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_dout_global, num_output_pixel * problem.C);
+        const auto out_indices_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_out_indices_global, num_output_pixel * problem.C);
+        auto din_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_din_global, num_input_pixel * problem.C);
+
+        const index_t num_c_vector = problem.C / ScalarPerVector;
+        const index_t num_work     = num_input_pixel * num_c_vector;
+        const index_t loop_step    = get_grid_size() * get_block_size();
+
+        for(index_t i = get_thread_global_1d_id(); i < num_work; i += loop_step)
+        {
+            // i -> [n, xi..., c], row-major
+            index_t tmp = i;
+
+            const index_t c = (tmp % num_c_vector) * ScalarPerVector;
+            tmp /= num_c_vector;
+
+            Array<index_t, NumDimSpatial> xi;
+
+            static_for<0, NumDimSpatial, 1>{}([&](auto r) {
+                constexpr index_t d = NumDimSpatial - 1 - r;
+
+                xi(d) = tmp % Xi[d];
+                tmp /= Xi[d];
+            });
+
+            const index_t n = tmp;
+
+            StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, ScalarPerVector, true> acc_buf;
+
+            static_for<0, ScalarPerVector, 1>{}([&](auto j) { acc_buf(j) = 0; });
+
+            for(index_t k = 0; k < window_size; ++k)
+            {
+                // k -> [y...], row-major; the output whose window holds xi at y, if any
+                index_t k_tmp = k;
+
+                Array<index_t, NumDimSpatial> y;
+
+                static_for<0, NumDimSpatial, 1>{}([&](auto r) {
+                    constexpr index_t d = NumDimSpatial - 1 - r;
+
+                    y(d) = k_tmp % Y[d];
+                    k_tmp /= Y[d];
+                });
+
+                bool is_valid          = true;
+                index_t out_offset     = n;
+                index_t num_in_element = 1;
+
+                static_for<0, NumDimSpatial, 1>{}([&](auto d) {
+                    const index_t xo_strided = xi[d] + P[d] - y[d];
+                    const index_t xo         = xo_strided / S[d];
+
+                    is_valid = is_valid && xo_strided >= 0 && xo_strided % S[d] == 0 && xo < Xo[d];
+
+                    out_offset = out_offset * Xo[d] + xo;
+
+                    // elements of the window of xo inside the input
+                    const index_t x_begin = xo * S[d] - P[d];
+
+                    num_in_element *= math::min(x_begin + Y[d], Xi[d]) - math::max(x_begin, 0);
+                });
+
+                if(!is_valid)
+                    continue;
+
+                out_offset = out_offset * problem.C + c;
+
+                vector_type<DOutDataType, ScalarPerVector> dout;
+
+                dout.template AsType<dout_vector_t>()(Number<0>{}) =
+                    dout_global_buf.template Get<dout_vector_t>(out_offset, true);
+
+                if constexpr(UseIndices)
+                {
+                    vector_type<IndexDataType, ScalarPerVector> out_indices;
+
+                    out_indices.template AsType<index_vector_t>()(Number<0>{}) =
+                        out_indices_global_buf.template Get<index_vector_t>(out_offset, true);
+
+                    static_for<0, ScalarPerVector, 1>{}([&](auto j) {
+                        if(out_indices.template AsType<IndexDataType>()[j] == k)
+                            acc_buf(j) += type_convert<AccDataType>(
+                                dout.template AsType<DOutDataType>()[j]);
+                    });
+                }
+                else
+                {
+                    const auto divider = type_convert<AccDataType>(
+                        static_cast<float>(count_include_pad ? window_size : num_in_element));
+
+                    static_for<0, ScalarPerVector, 1>{}([&](auto j) {
+                        acc_buf(j) +=
+                            type_convert<AccDataType>(dout.template AsType<DOutDataType>()[j]) /
+                            divider;
+                    });
+                }
+            }
+
+            vector_type<DInDataType, ScalarPerVector> din;
+
+            static_for<0, ScalarPerVector, 1>{}([&](auto j) {
+                din.template AsType<DInDataType>()(j) = type_convert<DInDataType>(acc_buf[j]);
+            });
+
+            din_global_buf.template Set<din_vector_t>(
+                i * ScalarPerVector, true, din.template AsType<din_vector_t>()[Number<0>{}]);
+        }
+    }
+};
+
+} // namespace ck
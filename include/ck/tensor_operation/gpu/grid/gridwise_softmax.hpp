@@ -0,0 +1,299 @@
+#pragma once
+
+#include "data_type.hpp"
+#include "reduction_common.hpp"
+#include "reduction_operator.hpp"
+#include "reduction_functions_accumulate.hpp"
+#include "reduction_functions_blockwise.hpp"
+#include "threadwise_tensor_slice_transfer.hpp"
+#include "cluster_descriptor.hpp"
+#include "element_wise_operation.hpp"
+#include "synchronization.hpp"
+
+namespace ck {
+
+template <typename GridwiseSoftmax,
+          typename InDataType,
+          typename OutDataType,
+          typename GridDesc_M_K>
+__global__ void kernel_softmax(const GridDesc_M_K in_grid_desc_m_k,
+                               const GridDesc_M_K out_grid_desc_m_k,
+                               index_t reduce_length,
+                               index_t num_k_block_tile_iteration,
+                               const InDataType* const __restrict__ p_in_global,
+                               OutDataType* const __restrict__ p_out_global)
+{
+    GridwiseSoftmax::Run(in_grid_desc_m_k,
+                         out_grid_desc_m_k,
+                         reduce_length,
+                         num_k_block_tile_iteration,
+                         p_in_global,
+                         p_out_global);
+};
+
+// out = exp(in - max) / sum(exp(in - max)) over the K elements of each of the M rows, a
+// workgroup per MThreadClusterSize x MThreadSliceSize rows.
+//
+// The first sweep over a row computes its max and sum online: each tile rescales the running sum
+// of a thread to the new max, so the row is read once, and the threads of a row then merge their
+// (max, sum) pairs in LDS. The second sweep writes the output. A row of one tile, i.e. no longer
+// than KThreadClusterSize x KThreadSliceSize, stays in VGPRs in between and is read only once;
+// a longer row is read again.
+template <typename InDataType,
+          typename OutDataType,
+          typename AccDataType,
+          typename GridDesc_M_K,
+          index_t BlockSize,
+          index_t MThreadClusterSize,
+          index_t KThreadClusterSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t InSrcVectorDim,
+          index_t InSrcVectorSize,
+          index_t OutDstVectorSize>
+struct GridwiseSoftmax_mk_to_mk
+{
+    static_assert(((InSrcVectorDim == 0 && MThreadSliceSize % InSrcVectorSize == 0 &&
+                    MThreadSliceSize % OutDstVectorSize == 0) ||
+                   (InSrcVectorDim == 1 && KThreadSliceSize % InSrcVectorSize == 0 &&
+                    KThreadSliceSize % OutDstVectorSize == 0)),
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    static constexpr bool reorder_thread_cluster = (InSrcVectorDim == 0);
+
+    using ThreadClusterLengths_M_K = Sequence<MThreadClusterSize, KThreadClusterSize>;
+
+    using ThreadBufferDimAccessOrder =
+        typename conditional<reorder_thread_cluster, Sequence<1, 0>, Sequence<0, 1>>::type;
+
+    using ThreadClusterArrangeOrder =
+        typename conditional<reorder_thread_cluster, Sequence<1, 0>, Sequence<0, 1>>::type;
+
+    static constexpr auto thread_cluster_desc =
+        make_cluster_descriptor(ThreadClusterLengths_M_K{}, ThreadClusterArrangeOrder{});
+
+    using PassThroughOp = tensor_operation::element_wise::PassThrough;
+    using ExpOp         = tensor_operation::element_wise::UnaryExp<AccDataType, AccDataType>;
+
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    static constexpr index_t M_BlockTileSize = MThreadClusterSize * MThreadSliceSize;
+    static constexpr index_t K_BlockTileSize = KThreadClusterSize * KThreadSliceSize;
+
+    __device__ static void Run(const GridDesc_M_K& in_grid_desc_m_k,
+                               const GridDesc_M_K& out_grid_desc_m_k,
+                               index_t reduce_length,
+                               index_t num_k_block_tile_iteration,
+                               const InDataType* const __restrict__ p_in_global,
+                               OutDataType* const __restrict__ p_out_global)
+    {
+        const auto in_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_in_global, in_grid_desc_m_k.GetElementSpaceSize(), type_convert<InDataType>(0.0f));
+        auto out_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_out_global, out_grid_desc_m_k.GetElementSpaceSize());
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            in_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            out_thread_buf;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> max_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> sum_thread_buf;
+
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            max_thread_buf(I) = NumericLimits<AccDataType>::Lowest();
+            sum_thread_buf(I) = type_convert<AccDataType>(0.0f);
+        });
+
+        const ExpOp exp_op{};
+
+        const index_t thread_local_id = get_thread_local_1d_id();
+        const index_t block_global_id = get_block_1d_id();
+
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(thread_local_id));
+
+        const auto thread_m_cluster_id = thread_cluster_idx[I0];
+        const auto thread_k_cluster_id = thread_cluster_idx[I1];
+
+        using ThreadBufferLengths         = Sequence<MThreadSliceSize, KThreadSliceSize>;
+        constexpr auto thread_buffer_desc = make_naive_tensor_descriptor_packed(
+            make_tuple(Number<MThreadSliceSize>{}, Number<KThreadSliceSize>{}));
+
+        const index_t thread_m_begin =
+            block_global_id * M_BlockTileSize + thread_m_cluster_id * MThreadSliceSize;
+        const index_t thread_k_begin = thread_k_cluster_id * KThreadSliceSize;
+
+        auto threadwise_src_load = ThreadwiseTensorSliceTransfer_v2<InDataType,
+                                                                    AccDataType,
+                                                                    GridDesc_M_K,
+                                                                    decltype(thread_buffer_desc),
+                                                                    ThreadBufferLengths,
+                                                                    ThreadBufferDimAccessOrder,
+                                                                    InSrcVectorDim,
+                                                                    InSrcVectorSize,
+                                                                    1,
+                                                                    false>(
+            in_grid_desc_m_k, make_multi_index(thread_m_begin, thread_k_begin));
+
+        auto threadwise_dst_store =
+            ThreadwiseTensorSliceTransfer_v1r3<AccDataType,
+                                               OutDataType,
+                                               decltype(thread_buffer_desc),
+                                               GridDesc_M_K,
+                                               PassThroughOp,
+                                               ThreadBufferLengths,
+                                               ThreadBufferDimAccessOrder,
+                                               InSrcVectorDim,
+                                               OutDstVectorSize,
+                                               InMemoryDataOperationEnum::Set,
+                                               1,
+                                               false>(out_grid_desc_m_k,
+                                                      make_multi_index(thread_m_begin,
+                                                                       thread_k_begin),
+                                                      PassThroughOp{});
+
+        constexpr auto thread_copy_step = make_multi_index(0, K_BlockTileSize);
+
+        // first sweep: the running max and sum of the part of each row the thread reads
+        index_t tile_k_begin = thread_k_begin;
+        index_t reducedTiles = 0;
+        do
+        {
+            threadwise_src_load.Run(in_grid_desc_m_k,
+                                    in_global_buf,
+                                    thread_buffer_desc,
+                                    make_tuple(I0, I0),
+                                    in_thread_buf);
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto iM) {
+                AccDataType tile_max = max_thread_buf[iM];
+
+                // the padding of the last tile is left out
+                static_for<0, KThreadSliceSize, 1>{}([&](auto iK) {
+                    constexpr auto offset =
+                        thread_buffer_desc.CalculateOffset(make_tuple(iM, iK));
+
+                    if(tile_k_begin + iK() < reduce_length)
+                        reduce::Max<AccDataType>{}(tile_max, in_thread_buf[Number<offset>{}]);
+                });
+
+                AccDataType scale;
+
+                exp_op(scale, max_thread_buf[iM] - tile_max);
+
+                sum_thread_buf(iM) *= scale;
+
+                static_for<0, KThreadSliceSize, 1>{}([&](auto iK) {
+                    constexpr auto offset =
+                        thread_buffer_desc.CalculateOffset(make_tuple(iM, iK));
+
+                    if(tile_k_begin + iK() < reduce_length)
+                    {
+                        AccDataType e;
+
+                        exp_op(e, in_thread_buf[Number<offset>{}] - tile_max);
+
+                        sum_thread_buf(iM) += e;
+                    }
+                });
+
+                max_thread_buf(iM) = tile_max;
+            });
+
+            threadwise_src_load.MoveSrcSliceWindow(in_grid_desc_m_k, thread_copy_step);
+
+            tile_k_begin += K_BlockTileSize;
+            reducedTiles++;
+        } while(reducedTiles < num_k_block_tile_iteration);
+
+        if constexpr(KThreadClusterSize > 1)
+        {
+            using BlockwiseMaxReduce = PartitionedBlockwiseReduction<AccDataType,
+                                                                     BlockSize,
+                                                                     ThreadClusterLengths_M_K,
+                                                                     ThreadClusterArrangeOrder,
+                                                                     reduce::Max<AccDataType>,
+                                                                     false>;
+            using BlockwiseSumReduce = PartitionedBlockwiseReduction<AccDataType,
+                                                                     BlockSize,
+                                                                     ThreadClusterLengths_M_K,
+                                                                     ThreadClusterArrangeOrder,
+                                                                     reduce::Add<AccDataType>,
+                                                                     false>;
+
+            // LDS
+            __shared__ AccDataType p_reduce_work_buffer[BlockSize];
+
+            auto reduce_work_buf =
+                make_dynamic_buffer<AddressSpaceEnum::Lds>(p_reduce_work_buffer, BlockSize);
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+                AccDataType row_max = max_thread_buf[I];
+
+                BlockwiseMaxReduce::Reduce(reduce_work_buf, row_max);
+
+                // the blockwise reductions do not wait for the threads reading their results
+                block_sync_lds();
+
+                AccDataType scale;
+
+                exp_op(scale, max_thread_buf[I] - row_max);
+
+                max_thread_buf(I) = row_max;
+                sum_thread_buf(I) *= scale;
+
+                BlockwiseSumReduce::Reduce(reduce_work_buf, sum_thread_buf(I));
+
+                block_sync_lds();
+            });
+        };
+
+        // second sweep: the output, from the VGPRs if the row is a single tile
+        if(num_k_block_tile_iteration > 1)
+            threadwise_src_load.SetSrcSliceOrigin(in_grid_desc_m_k,
+                                                  make_multi_index(thread_m_begin, thread_k_begin));
+
+        reducedTiles = 0;
+        do
+        {
+            if(num_k_block_tile_iteration > 1)
+            {
+                threadwise_src_load.Run(in_grid_desc_m_k,
+                                        in_global_buf,
+                                        thread_buffer_desc,
+                                        make_tuple(I0, I0),
+                                        in_thread_buf);
+
+                threadwise_src_load.MoveSrcSliceWindow(in_grid_desc_m_k, thread_copy_step);
+            }
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto iM) {
+                const AccDataType inv_sum = type_convert<AccDataType>(1.0f) / sum_thread_buf[iM];
+
+                static_for<0, KThreadSliceSize, 1>{}([&](auto iK) {
+                    constexpr auto offset =
+                        thread_buffer_desc.CalculateOffset(make_tuple(iM, iK));
+
+                    exp_op(out_thread_buf(Number<offset>{}),
+                           in_thread_buf[Number<offset>{}] - max_thread_buf[iM]);
+
+                    out_thread_buf(Number<offset>{}) *= inv_sum;
+                });
+            });
+
+            threadwise_dst_store.Run(thread_buffer_desc,
+                                     make_tuple(I0, I0),
+                                     out_thread_buf,
+                                     out_grid_desc_m_k,
+                                     out_global_buf);
+
+            threadwise_dst_store.MoveDstSliceWindow(out_grid_desc_m_k, thread_copy_step);
+
+            reducedTiles++;
+        } while(reducedTiles < num_k_block_tile_iteration);
+    };
+};
+
+} // namespace ck
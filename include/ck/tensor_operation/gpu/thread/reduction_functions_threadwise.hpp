@@ -117,6 +117,50 @@ struct ThreadwiseReductionWithIndex
     };
 };
 
+// Assume
+//  1) SrcDesc is known at compile-time
+//  2) DstDesc is known at compile-time
+//  3) SrcBuffer is static buffer
+//  4) DstBuffer is static buffer
+//  5) only the first num_valid_k columns of SrcBuffer are elements, the others are padding, which
+//     unlike the identity value of a reduction would change the Welford count
+template <typename AccDataType, typename SrcThreadDesc_M_K, typename DstThreadDesc_M>
+struct ThreadwiseWelford
+{
+    static constexpr auto src_thread_desc_m_k = SrcThreadDesc_M_K{};
+    static constexpr auto dst_thread_desc_m   = DstThreadDesc_M{};
+
+    static constexpr auto src_length_m = src_thread_desc_m_k.GetLength(Number<0>{});
+    static constexpr auto src_length_k = src_thread_desc_m_k.GetLength(Number<1>{});
+    static constexpr auto dst_length_m = dst_thread_desc_m.GetLength(Number<0>{});
+
+    static_assert(src_length_m == dst_length_m, "lengths of source and dst buffer must match!");
+
+    using Accumulation = detail::AccumulateWelford<AccDataType>;
+
+    template <typename SrcBufferType, typename DstBufferType, typename DstCountBufferType>
+    __device__ static void Reduce(const SrcBufferType& src_buf,
+                                  index_t num_valid_k,
+                                  DstBufferType& dst_mean_buf,
+                                  DstBufferType& dst_m2_buf,
+                                  DstCountBufferType& dst_count_buf)
+    {
+        static_for<0, src_length_m, 1>{}([&](auto iM) {
+            constexpr index_t out_offset = dst_thread_desc_m.CalculateOffset(make_tuple(iM));
+
+            static_for<0, src_length_k, 1>{}([&](auto iK) {
+                constexpr auto offset = src_thread_desc_m_k.CalculateOffset(make_tuple(iM, iK));
+
+                if(iK() < num_valid_k)
+                    Accumulation::Calculate(dst_mean_buf(Number<out_offset>{}),
+                                            dst_m2_buf(Number<out_offset>{}),
+                                            dst_count_buf(Number<out_offset>{}),
+                                            src_buf[Number<offset>{}]);
+            });
+        });
+    };
+};
+
 }; // end of namespace ck
 
 #endif
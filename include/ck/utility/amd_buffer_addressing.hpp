@@ -29,6 +29,399 @@ __device__ int32x4_t make_wave_buffer_resource(T* p_wave, index_t element_space_
     return wave_buffer_resource.content;
 }
 
+#if CK_HOST_BACKEND
+// The host backend emulates the buffer instructions on host memory. As on the GPU, each scalar
+// of an access is checked against the range of the buffer resource: out-of-range scalars load
+// zero, and stores and atomics to them are dropped.
+
+template <typename T>
+__device__ bool host_buffer_in_range(int32x4_t rsrc, index_t voffset, index_t soffset, index_t i)
+{
+    BufferResource<char> resource;
+    resource.content = rsrc;
+
+    const uint64_t offset = uint64_t{static_cast<uint32_t>(voffset)} +
+                            static_cast<uint32_t>(soffset) + i * sizeof(T);
+
+    return offset + sizeof(T) <= static_cast<uint32_t>(resource.range[Number<2>{}]);
+}
+
+template <typename T>
+__device__ T* host_buffer_address(int32x4_t rsrc, index_t voffset, index_t soffset, index_t i)
+{
+    BufferResource<char> resource;
+    resource.content = rsrc;
+
+    return reinterpret_cast<T*>(resource.address[Number<0>{}] +
+                                static_cast<uint32_t>(voffset) + static_cast<uint32_t>(soffset) +
+                                i * sizeof(T));
+}
+
+template <typename T>
+__device__ T host_raw_buffer_load(int32x4_t rsrc, index_t voffset, index_t soffset)
+{
+    using S = typename scalar_type<T>::type;
+
+    S data[scalar_type<T>::vector_size];
+
+    for(index_t i = 0; i < scalar_type<T>::vector_size; ++i)
+    {
+        data[i] = S{0};
+
+        if(host_buffer_in_range<S>(rsrc, voffset, soffset, i))
+            data[i] = *host_buffer_address<S>(rsrc, voffset, soffset, i);
+    }
+
+    T result;
+    __builtin_memcpy(&result, data, sizeof(T));
+
+    return result;
+}
+
+template <typename T>
+__device__ void host_raw_buffer_store(T vdata, int32x4_t rsrc, index_t voffset, index_t soffset)
+{
+    using S = typename scalar_type<T>::type;
+
+    S data[scalar_type<T>::vector_size];
+    __builtin_memcpy(data, &vdata, sizeof(T));
+
+    for(index_t i = 0; i < scalar_type<T>::vector_size; ++i)
+    {
+        if(host_buffer_in_range<S>(rsrc, voffset, soffset, i))
+            *host_buffer_address<S>(rsrc, voffset, soffset, i) = data[i];
+    }
+}
+
+// returns the previous values, zero for out-of-range scalars
+template <typename T, typename F>
+__device__ T host_raw_buffer_atomic(T vdata, int32x4_t rsrc, index_t voffset, index_t soffset, F f)
+{
+    using S = typename scalar_type<T>::type;
+
+    S data[scalar_type<T>::vector_size];
+    __builtin_memcpy(data, &vdata, sizeof(T));
+
+    for(index_t i = 0; i < scalar_type<T>::vector_size; ++i)
+    {
+        const S x = data[i];
+
+        data[i] = S{0};
+
+        if(host_buffer_in_range<S>(rsrc, voffset, soffset, i))
+            data[i] = f(host_buffer_address<S>(rsrc, voffset, soffset, i), x);
+    }
+
+    T result;
+    __builtin_memcpy(&result, data, sizeof(T));
+
+    return result;
+}
+
+template <typename T>
+__device__ T host_raw_buffer_atomic_add(T vdata, int32x4_t rsrc, index_t voffset, index_t soffset)
+{
+    return host_raw_buffer_atomic(
+        vdata, rsrc, voffset, soffset, [](auto* p, auto x) { return atomicAdd(p, x); });
+}
+
+template <typename T>
+__device__ T host_raw_buffer_atomic_max(T vdata, int32x4_t rsrc, index_t voffset, index_t soffset)
+{
+    return host_raw_buffer_atomic(
+        vdata, rsrc, voffset, soffset, [](auto* p, auto x) { return atomicMax(p, x); });
+}
+
+// buffer load i8
+__device__ int8_t
+llvm_amdgcn_raw_buffer_load_i8(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<int8_t>(srsrc, voffset, soffset);
+}
+
+__device__ int8x2_t
+llvm_amdgcn_raw_buffer_load_i8x2(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<int8x2_t>(srsrc, voffset, soffset);
+}
+
+__device__ int8x4_t
+llvm_amdgcn_raw_buffer_load_i8x4(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<int8x4_t>(srsrc, voffset, soffset);
+}
+
+// buffer load i16
+__device__ bhalf_t
+llvm_amdgcn_raw_buffer_load_i16(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<bhalf_t>(srsrc, voffset, soffset);
+}
+
+__device__ bhalf2_t
+llvm_amdgcn_raw_buffer_load_i16x2(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<bhalf2_t>(srsrc, voffset, soffset);
+}
+
+__device__ bhalf4_t
+llvm_amdgcn_raw_buffer_load_i16x4(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<bhalf4_t>(srsrc, voffset, soffset);
+}
+
+// buffer load i32
+__device__ int32_t
+llvm_amdgcn_raw_buffer_load_i32(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<int32_t>(srsrc, voffset, soffset);
+}
+
+__device__ int32x2_t
+llvm_amdgcn_raw_buffer_load_i32x2(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<int32x2_t>(srsrc, voffset, soffset);
+}
+
+__device__ int32x4_t
+llvm_amdgcn_raw_buffer_load_i32x4(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<int32x4_t>(srsrc, voffset, soffset);
+}
+
+// buffer load fp16
+__device__ half_t
+llvm_amdgcn_raw_buffer_load_fp16(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<half_t>(srsrc, voffset, soffset);
+}
+
+__device__ half2_t
+llvm_amdgcn_raw_buffer_load_fp16x2(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<half2_t>(srsrc, voffset, soffset);
+}
+
+__device__ half4_t
+llvm_amdgcn_raw_buffer_load_fp16x4(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<half4_t>(srsrc, voffset, soffset);
+}
+
+// buffer load fp32
+__device__ float
+llvm_amdgcn_raw_buffer_load_fp32(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<float>(srsrc, voffset, soffset);
+}
+
+__device__ float2_t
+llvm_amdgcn_raw_buffer_load_fp32x2(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<float2_t>(srsrc, voffset, soffset);
+}
+
+__device__ float4_t
+llvm_amdgcn_raw_buffer_load_fp32x4(int32x4_t srsrc, index_t voffset, index_t soffset, index_t)
+{
+    return host_raw_buffer_load<float4_t>(srsrc, voffset, soffset);
+}
+
+// buffer store i8
+__device__ void
+llvm_amdgcn_raw_buffer_store_i8(int8_t vdata,
+                                int32x4_t rsrc,
+                                index_t voffset,
+                                index_t soffset,
+                                index_t)
+{
+    host_raw_buffer_store<int8_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_i8x2(int8x2_t vdata,
+                                  int32x4_t rsrc,
+                                  index_t voffset,
+                                  index_t soffset,
+                                  index_t)
+{
+    host_raw_buffer_store<int8x2_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_i8x4(int8x4_t vdata,
+                                  int32x4_t rsrc,
+                                  index_t voffset,
+                                  index_t soffset,
+                                  index_t)
+{
+    host_raw_buffer_store<int8x4_t>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer store i16
+__device__ void
+llvm_amdgcn_raw_buffer_store_i16(bhalf_t vdata,
+                                 int32x4_t rsrc,
+                                 index_t voffset,
+                                 index_t soffset,
+                                 index_t)
+{
+    host_raw_buffer_store<bhalf_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_i16x2(bhalf2_t vdata,
+                                   int32x4_t rsrc,
+                                   index_t voffset,
+                                   index_t soffset,
+                                   index_t)
+{
+    host_raw_buffer_store<bhalf2_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_i16x4(bhalf4_t vdata,
+                                   int32x4_t rsrc,
+                                   index_t voffset,
+                                   index_t soffset,
+                                   index_t)
+{
+    host_raw_buffer_store<bhalf4_t>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer store i32
+__device__ void
+llvm_amdgcn_raw_buffer_store_i32(int32_t vdata,
+                                 int32x4_t rsrc,
+                                 index_t voffset,
+                                 index_t soffset,
+                                 index_t)
+{
+    host_raw_buffer_store<int32_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_i32x2(int32x2_t vdata,
+                                   int32x4_t rsrc,
+                                   index_t voffset,
+                                   index_t soffset,
+                                   index_t)
+{
+    host_raw_buffer_store<int32x2_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_i32x4(int32x4_t vdata,
+                                   int32x4_t rsrc,
+                                   index_t voffset,
+                                   index_t soffset,
+                                   index_t)
+{
+    host_raw_buffer_store<int32x4_t>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer store fp16
+__device__ void
+llvm_amdgcn_raw_buffer_store_fp16(half_t vdata,
+                                  int32x4_t rsrc,
+                                  index_t voffset,
+                                  index_t soffset,
+                                  index_t)
+{
+    host_raw_buffer_store<half_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_fp16x2(half2_t vdata,
+                                    int32x4_t rsrc,
+                                    index_t voffset,
+                                    index_t soffset,
+                                    index_t)
+{
+    host_raw_buffer_store<half2_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_fp16x4(half4_t vdata,
+                                    int32x4_t rsrc,
+                                    index_t voffset,
+                                    index_t soffset,
+                                    index_t)
+{
+    host_raw_buffer_store<half4_t>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer store fp32
+__device__ void
+llvm_amdgcn_raw_buffer_store_fp32(float vdata,
+                                  int32x4_t rsrc,
+                                  index_t voffset,
+                                  index_t soffset,
+                                  index_t)
+{
+    host_raw_buffer_store<float>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_fp32x2(float2_t vdata,
+                                    int32x4_t rsrc,
+                                    index_t voffset,
+                                    index_t soffset,
+                                    index_t)
+{
+    host_raw_buffer_store<float2_t>(vdata, rsrc, voffset, soffset);
+}
+
+__device__ void
+llvm_amdgcn_raw_buffer_store_fp32x4(float4_t vdata,
+                                    int32x4_t rsrc,
+                                    index_t voffset,
+                                    index_t soffset,
+                                    index_t)
+{
+    host_raw_buffer_store<float4_t>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer atomic-add fp16
+__device__ half2_t
+llvm_amdgcn_raw_buffer_atomic_add_fp16x2(half2_t vdata,
+                                         int32x4_t rsrc,
+                                         index_t voffset,
+                                         index_t soffset,
+                                         index_t)
+{
+    return host_raw_buffer_atomic_add<half2_t>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer atomic-add i32
+__device__ int32_t
+llvm_amdgcn_raw_buffer_atomic_add_i32(int32_t vdata,
+                                      int32x4_t rsrc,
+                                      index_t voffset,
+                                      index_t soffset,
+                                      index_t)
+{
+    return host_raw_buffer_atomic_add<int32_t>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer atomic-add fp32
+__device__ float
+llvm_amdgcn_raw_buffer_atomic_add_fp32(float vdata,
+                                       int32x4_t rsrc,
+                                       index_t voffset,
+                                       index_t soffset,
+                                       index_t)
+{
+    return host_raw_buffer_atomic_add<float>(vdata, rsrc, voffset, soffset);
+}
+
+// buffer atomic-max fp64
+__device__ double
+llvm_amdgcn_raw_buffer_atomic_max_fp64(double vdata, int32x4_t rsrc, int voffset, int soffset, int)
+{
+    return host_raw_buffer_atomic_max<double>(vdata, rsrc, voffset, soffset);
+}
+#else
 // buffer load i8
 __device__ int8_t
 llvm_amdgcn_raw_buffer_load_i8(int32x4_t srsrc,
@@ -265,6 +658,7 @@ llvm_amdgcn_raw_buffer_atomic_max_fp64(double vdata,
                                        int voffset,    // dst_thread_addr_offset
                                        int soffset,    // dst_wave_addr_offset
                                        int glc_slc) __asm("llvm.amdgcn.raw.buffer.atomic.fmax.f64");
+#endif
 
 template <typename T, index_t N>
 __device__ typename vector_type<T, N>::type amd_buffer_load_impl(int32x4_t src_wave_buffer_resource,
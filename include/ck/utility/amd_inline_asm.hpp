@@ -3,6 +3,7 @@
 
 #include "data_type.hpp"
 #include "c_style_pointer_cast.hpp"
+#include "inner_product.hpp"
 
 // TODO: deprecate all amd_assembly_outer_product_xxx
 
@@ -12,12 +13,17 @@ namespace ck {
 // c1 += inner_product(a, b1)
 __device__ void amd_assembly_outer_product_1x2(float a, float b0, float b1, float& c0, float& c1)
 {
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+#else
     asm volatile("\n \
             v_fmac_f32 %0, %2, %3 \n \
             v_fmac_f32 %1, %2, %4 \n \
             "
                  : "=v"(c0), "=v"(c1)
                  : "v"(a), "v"(b0), "v"(b1), "0"(c0), "1"(c1));
+#endif
 }
 
 // c0 += inner_product(a, b0)
@@ -27,6 +33,12 @@ __device__ void amd_assembly_outer_product_1x2(float a, float b0, float b1, floa
 __device__ void amd_assembly_outer_product_1x4(
     float a, float b0, float b1, float b2, float b3, float& c0, float& c1, float& c2, float& c3)
 {
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+    inner_product(a, b2, c2);
+    inner_product(a, b3, c3);
+#else
     asm volatile("\n \
             v_fmac_f32 %0, %4, %5 \n \
             v_fmac_f32 %1, %4, %6 \n \
@@ -35,6 +47,7 @@ __device__ void amd_assembly_outer_product_1x4(
             "
                  : "=v"(c0), "=v"(c1), "=v"(c2), "=v"(c3)
                  : "v"(a), "v"(b0), "v"(b1), "v"(b2), "v"(b3), "0"(c0), "1"(c1), "2"(c2), "3"(c3));
+#endif
 }
 
 // c0 += inner_product(a, b0)
@@ -42,12 +55,17 @@ __device__ void amd_assembly_outer_product_1x4(
 __device__ void
 amd_assembly_outer_product_1x2(half2_t a, half2_t b0, half2_t b1, float& c0, float& c1)
 {
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+#else
     asm volatile("\n \
             v_dot2_f32_f16 %0, %2, %3, %0\n \
             v_dot2_f32_f16 %1, %2, %4, %1\n \
             "
                  : "=v"(c0), "=v"(c1)
                  : "v"(a), "v"(b0), "v"(b1), "0"(c0), "1"(c1));
+#endif
 }
 
 // c0 += inner_product(a, b0)
@@ -55,6 +73,10 @@ amd_assembly_outer_product_1x2(half2_t a, half2_t b0, half2_t b1, float& c0, flo
 __device__ void
 amd_assembly_outer_product_1x2(half4_t a, half4_t b0, half4_t b1, float& c0, float& c1)
 {
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+#else
     // TODO remove pointer casting
     const half2_t* p_a_half2  = c_style_pointer_cast<const half2_t*>(&a);
     const half2_t* p_b0_half2 = c_style_pointer_cast<const half2_t*>(&b0);
@@ -76,6 +98,7 @@ amd_assembly_outer_product_1x2(half4_t a, half4_t b0, half4_t b1, float& c0, flo
                    "v"(p_b1_half2[1]),
                    "0"(c0),
                    "1"(c1));
+#endif
 }
 
 // c0 += inner_product(a, b0)
@@ -92,6 +115,12 @@ __device__ void amd_assembly_outer_product_1x4(half2_t a,
                                                float& c2,
                                                float& c3)
 {
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+    inner_product(a, b2, c2);
+    inner_product(a, b3, c3);
+#else
     asm volatile("\n \
             v_dot2_f32_f16 %0, %4, %5, %0\n \
             v_dot2_f32_f16 %1, %4, %6, %1\n \
@@ -100,6 +129,7 @@ __device__ void amd_assembly_outer_product_1x4(half2_t a,
             "
                  : "=v"(c0), "=v"(c1), "=v"(c2), "=v"(c3)
                  : "v"(a), "v"(b0), "v"(b1), "v"(b2), "v"(b3), "0"(c0), "1"(c1), "2"(c2), "3"(c3));
+#endif
 }
 
 // c0 += inner_product(a, b0)
@@ -116,6 +146,12 @@ __device__ void amd_assembly_outer_product_1x4(half4_t a,
                                                float& c2,
                                                float& c3)
 {
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+    inner_product(a, b2, c2);
+    inner_product(a, b3, c3);
+#else
     // TODO remove pointer casting
     const half2_t* p_a_half2  = c_style_pointer_cast<const half2_t*>(&a);
     const half2_t* p_b0_half2 = c_style_pointer_cast<const half2_t*>(&b0);
@@ -149,6 +185,7 @@ __device__ void amd_assembly_outer_product_1x4(half4_t a,
                    "1"(c1),
                    "2"(c2),
                    "3"(c3));
+#endif
 }
 
 __device__ void amd_assembly_outer_product_1x4(half8_t a,
@@ -205,7 +242,10 @@ __device__ void amd_assembly_outer_product_1x4(half16_t a,
 __device__ void
 amd_assembly_outer_product_1x2(int8x4_t a, int8x4_t b0, int8x4_t b1, int32_t& c0, int32_t& c1)
 {
-#if 1
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+#elif 1
     asm volatile("\n \
             v_dot4_i32_i8 %0, %2, %3, %0\n \
             v_dot4_i32_i8 %1, %2, %4, %1\n \
@@ -236,7 +276,12 @@ __device__ void amd_assembly_outer_product_1x4(int8x4_t a,
                                                int32_t& c2,
                                                int32_t& c3)
 {
-#if 1
+#if CK_HOST_BACKEND
+    inner_product(a, b0, c0);
+    inner_product(a, b1, c1);
+    inner_product(a, b2, c2);
+    inner_product(a, b3, c3);
+#elif 1
     asm volatile("\n \
             v_dot4_i32_i8 %0, %4, %5, %0\n \
             v_dot4_i32_i8 %1, %4, %6, %1\n \
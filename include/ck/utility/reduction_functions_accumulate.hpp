@@ -123,6 +123,30 @@ struct AccumulateWithIndexAndNanCheck<true, ReduceOperation, AccDataType, IndexD
     };
 };
 
+// Welford accumulation of the mean, m2 and count of the elements. A NaN needs no check, it
+// propagates through the mean and m2 by itself.
+template <typename AccDataType>
+struct AccumulateWelford
+{
+    using Welford = reduce::Welford<AccDataType>;
+
+    __device__ static inline void
+    Calculate(AccDataType& mean, AccDataType& m2, index_t& count, AccDataType currVal)
+    {
+        Welford::Update(mean, m2, count, currVal);
+    };
+
+    __device__ static inline void Merge(AccDataType& mean,
+                                        AccDataType& m2,
+                                        index_t& count,
+                                        AccDataType currMean,
+                                        AccDataType currM2,
+                                        index_t currCount)
+    {
+        Welford::Merge(mean, m2, count, currMean, currM2, currCount);
+    };
+};
+
 }; // namespace detail
 }; // end of namespace ck
 
@@ -150,6 +150,52 @@ struct AMax
     }
 };
 
+// Welford's online mean and variance. Unlike the functors above its accumulated result is a
+// triple: the number of elements `count`, their `mean` and `m2`, the sum of their squared
+// differences from the mean, so that m2 / count is their (population) variance. It does not lose
+// the precision the sum of squares minus the squared sum does when the mean is large compared to
+// the deviation.
+// 1) Update() -- accumulates one element
+// 2) Merge() -- accumulates the triple of another, disjoint set of elements (Chan et al.), so
+//               partial results of threads, workgroups and workgroup groups combine in any order
+template <class T>
+struct Welford
+{
+    using dataType = T;
+
+    __host__ __device__ static constexpr void Init(T& mean, T& m2, index_t& count)
+    {
+        mean  = static_cast<T>(0.0f);
+        m2    = static_cast<T>(0.0f);
+        count = 0;
+    };
+
+    __host__ __device__ static inline void Update(T& mean, T& m2, index_t& count, T x)
+    {
+        count++;
+
+        const T delta = x - mean;
+
+        mean += delta / static_cast<T>(count);
+        m2 += delta * (x - mean);
+    };
+
+    __host__ __device__ static inline void
+    Merge(T& mean, T& m2, index_t& count, T mean_b, T m2_b, index_t count_b)
+    {
+        if(count_b == 0)
+            return;
+
+        const index_t n = count + count_b;
+        const T delta   = mean_b - mean;
+        const T ratio_b = static_cast<T>(count_b) / static_cast<T>(n);
+
+        mean += delta * ratio_b;
+        m2 += m2_b + delta * delta * static_cast<T>(count) * ratio_b;
+        count = n;
+    };
+};
+
 }; // end of namespace reduce
 
 } // end of namespace ck
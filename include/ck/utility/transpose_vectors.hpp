@@ -16,7 +16,7 @@ struct transpose_vectors;
 // transpose fp16 2x2
 __device__ void transpose_fp16_2x2(const half2_t& x0, const half2_t& x1, half2_t& y0, half2_t& y1)
 {
-#if 0
+#if CK_HOST_BACKEND
     static constexpr auto I0 = Number<0>{};
     static constexpr auto I1 = Number<1>{};
 
@@ -93,6 +93,16 @@ __device__ void transpose_int8_4x4(const int8x4_t& x0,
                                    int8x4_t& y2,
                                    int8x4_t& y3)
 {
+#if CK_HOST_BACKEND
+    const int8x4_t x[4]  = {x0, x1, x2, x3};
+    int8x4_t* const y[4] = {&y0, &y1, &y2, &y3};
+
+    for(index_t i = 0; i < 4; ++i)
+    {
+        for(index_t j = 0; j < 4; ++j)
+            (*y[i])[j] = x[j][i];
+    }
+#else
     int32_t t0, t1;
     int32_t z0, z1, z2, z3;
     constexpr int32_t m0 = 0x05010400;
@@ -119,6 +129,7 @@ __device__ void transpose_int8_4x4(const int8x4_t& x0,
     y1 = bit_cast<int8x4_t>(z1);
     y2 = bit_cast<int8x4_t>(z2);
     y3 = bit_cast<int8x4_t>(z3);
+#endif
 }
 
 template <index_t NX, index_t NY>
@@ -0,0 +1,7 @@
+#pragma once
+
+// half precision helpers of HIP for the host backend, on the _Float16 of the host compiler
+
+inline _Float16 __habs(_Float16 x) { return x < _Float16(0) ? -x : x; }
+
+inline bool __hisnan(_Float16 x) { return x != x; }
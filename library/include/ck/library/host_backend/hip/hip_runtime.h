@@ -0,0 +1,332 @@
+#pragma once
+
+// The subset of the HIP runtime used by composable kernel, implemented on the CPU for the host
+// backend (cmake -DCK_HOST_BACKEND=ON). This directory is searched before ROCm's, so kernels and
+// device operators build unchanged with a host compiler (clang, for the vector extensions).
+//
+// A kernel launch runs the grid before it returns. Blocks are spread over the host thread pool
+// (see host_thread_pool.hpp); a host thread runs the threads of one block at a time, each thread
+// as a fiber that runs until it reaches __syncthreads() or returns. Once every thread of the block
+// has done so, the threads at the barrier continue. Streams and events only order host calls.
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <math.h>
+#include <thread>
+#include <type_traits>
+
+#define __host__
+// kernels and device functions are defined in headers, inline keeps one definition of each
+#define __device__ inline
+#define __global__ inline
+#define __forceinline__ inline __attribute__((always_inline))
+#define __launch_bounds__(...)
+// A __shared__ variable is kept per host thread. As a host thread runs one block at a time, it
+// is the LDS of that block.
+#define __shared__ static thread_local
+
+// warp-level scheduling hints have no meaning on the CPU; values passed to readfirstlane are
+// uniform across the warp by contract
+#define __builtin_amdgcn_readfirstlane(x) (x)
+#define __builtin_amdgcn_sched_barrier(...) static_cast<void>(0)
+#define __builtin_amdgcn_s_setprio(...) static_cast<void>(0)
+
+struct dim3
+{
+    constexpr dim3(uint32_t x_ = 1, uint32_t y_ = 1, uint32_t z_ = 1) : x{x_}, y{y_}, z{z_} {}
+
+    uint32_t x;
+    uint32_t y;
+    uint32_t z;
+};
+
+static constexpr int warpSize = 64;
+
+namespace ck {
+namespace host_backend {
+
+// indices and sizes of the thread a host thread currently runs
+struct KernelContext
+{
+    dim3 thread_idx;
+    dim3 block_idx;
+    dim3 block_dim;
+    dim3 grid_dim;
+};
+
+inline thread_local KernelContext kernel_context;
+
+// Run `kernel` for every thread of the grid and return when all of them are done.
+void run_grid(dim3 grid_dim, dim3 block_dim, const std::function<void()>& kernel);
+
+// barrier of the threads of the running block, nothing outside of a kernel
+void sync_threads();
+
+template <typename F, typename... Args>
+void launch_kernel(F kernel, dim3 grid_dim, dim3 block_dim, std::size_t, Args... args)
+{
+    run_grid(grid_dim, block_dim, [=] { kernel(args...); });
+}
+
+// Atomically replace *p by f(*p) and return the previous value.
+template <typename T, typename F>
+T atomic_update(T* p, F f)
+{
+    static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "wrong! not implemented");
+
+    using Bits = std::conditional_t<sizeof(T) == 2,
+                                    uint16_t,
+                                    std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+
+    Bits* p_bits  = reinterpret_cast<Bits*>(p);
+    Bits expected = __atomic_load_n(p_bits, __ATOMIC_RELAXED);
+
+    for(;;)
+    {
+        T old;
+        std::memcpy(&old, &expected, sizeof(T));
+
+        const T updated = f(old);
+
+        Bits desired;
+        std::memcpy(&desired, &updated, sizeof(T));
+
+        if(__atomic_compare_exchange_n(
+               p_bits, &expected, desired, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return old;
+    }
+}
+
+} // namespace host_backend
+} // namespace ck
+
+#define threadIdx (::ck::host_backend::kernel_context.thread_idx)
+#define blockIdx (::ck::host_backend::kernel_context.block_idx)
+#define blockDim (::ck::host_backend::kernel_context.block_dim)
+#define gridDim (::ck::host_backend::kernel_context.grid_dim)
+
+#define hipLaunchKernelGGL(kernel, grid_dim, block_dim, lds_byte, stream, ...) \
+    ::ck::host_backend::launch_kernel(                                       \
+        kernel, dim3(grid_dim), dim3(block_dim), lds_byte, ##__VA_ARGS__)
+
+inline void __syncthreads() { ck::host_backend::sync_threads(); }
+
+inline uint32_t __umulhi(uint32_t a, uint32_t b)
+{
+    return static_cast<uint32_t>((uint64_t{a} * b) >> 32);
+}
+
+template <typename T>
+T atomicAdd(T* address, typename std::decay<T>::type val)
+{
+    return ck::host_backend::atomic_update(address, [&](T old) { return T(old + val); });
+}
+
+template <typename T>
+T atomicMax(T* address, typename std::decay<T>::type val)
+{
+    return ck::host_backend::atomic_update(address, [&](T old) { return old < val ? val : old; });
+}
+
+// runtime API
+
+enum hipError_t
+{
+    hipSuccess           = 0,
+    hipErrorInvalidValue = 1,
+    hipErrorOutOfMemory  = 2,
+};
+
+enum hipMemcpyKind
+{
+    hipMemcpyHostToHost     = 0,
+    hipMemcpyHostToDevice   = 1,
+    hipMemcpyDeviceToHost   = 2,
+    hipMemcpyDeviceToDevice = 3,
+    hipMemcpyDefault        = 4,
+};
+
+struct ihipStream_t
+{
+};
+
+struct ihipEvent_t
+{
+    std::chrono::steady_clock::time_point time;
+};
+
+using hipStream_t = ihipStream_t*;
+using hipEvent_t  = ihipEvent_t*;
+
+struct hipDeviceProp_t
+{
+    char name[256];
+    int multiProcessorCount;
+    int l2CacheSize;
+    std::size_t sharedMemPerBlock;
+    int warpSize;
+    int maxThreadsPerBlock;
+    int maxThreadsPerMultiProcessor;
+    std::size_t maxSharedMemoryPerMultiProcessor;
+    int clockRate; // kHz
+};
+
+inline const char* hipGetErrorString(hipError_t error)
+{
+    switch(error)
+    {
+    case hipSuccess: return "hipSuccess";
+    case hipErrorInvalidValue: return "hipErrorInvalidValue";
+    case hipErrorOutOfMemory: return "hipErrorOutOfMemory";
+    }
+
+    return "unknown error";
+}
+
+inline hipError_t hipGetLastError() { return hipSuccess; }
+
+inline hipError_t hipMalloc(void** p, std::size_t size)
+{
+    // as aligned as the widest vector a kernel loads, sizes rounded up as aligned_alloc requires
+    constexpr std::size_t alignment = 256;
+
+    *p = size == 0 ? nullptr
+                   : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+
+    return size == 0 || *p != nullptr ? hipSuccess : hipErrorOutOfMemory;
+}
+
+inline hipError_t hipFree(void* p)
+{
+    std::free(p);
+
+    return hipSuccess;
+}
+
+inline hipError_t hipMemcpy(void* dst, const void* src, std::size_t size, hipMemcpyKind)
+{
+    std::memcpy(dst, src, size);
+
+    return hipSuccess;
+}
+
+inline hipError_t hipMemcpyAsync(
+    void* dst, const void* src, std::size_t size, hipMemcpyKind kind, hipStream_t = nullptr)
+{
+    return hipMemcpy(dst, src, size, kind);
+}
+
+inline hipError_t hipMemset(void* p, int value, std::size_t size)
+{
+    std::memset(p, value, size);
+
+    return hipSuccess;
+}
+
+inline hipError_t hipMemsetAsync(void* p, int value, std::size_t size, hipStream_t = nullptr)
+{
+    return hipMemset(p, value, size);
+}
+
+inline hipError_t hipDeviceSynchronize() { return hipSuccess; }
+
+inline hipError_t hipStreamCreate(hipStream_t* stream)
+{
+    *stream = new ihipStream_t;
+
+    return hipSuccess;
+}
+
+inline hipError_t hipStreamDestroy(hipStream_t stream)
+{
+    delete stream;
+
+    return hipSuccess;
+}
+
+inline hipError_t hipStreamSynchronize(hipStream_t) { return hipSuccess; }
+
+inline hipError_t hipEventCreate(hipEvent_t* event)
+{
+    *event = new ihipEvent_t;
+
+    return hipSuccess;
+}
+
+inline hipError_t hipEventDestroy(hipEvent_t event)
+{
+    delete event;
+
+    return hipSuccess;
+}
+
+// launches return when their grid is done, so the host clock times them
+inline hipError_t hipEventRecord(hipEvent_t event, hipStream_t = nullptr)
+{
+    event->time = std::chrono::steady_clock::now();
+
+    return hipSuccess;
+}
+
+inline hipError_t hipEventSynchronize(hipEvent_t) { return hipSuccess; }
+
+inline hipError_t hipEventElapsedTime(float* ms, hipEvent_t start, hipEvent_t stop)
+{
+    *ms = std::chrono::duration<float, std::milli>(stop->time - start->time).count();
+
+    return hipSuccess;
+}
+
+inline hipError_t hipGetDevice(int* device)
+{
+    *device = 0;
+
+    return hipSuccess;
+}
+
+inline hipError_t hipSetDevice(int device)
+{
+    return device == 0 ? hipSuccess : hipErrorInvalidValue;
+}
+
+inline hipError_t hipGetDeviceCount(int* count)
+{
+    *count = 1;
+
+    return hipSuccess;
+}
+
+inline hipError_t hipGetDeviceProperties(hipDeviceProp_t* props, int device)
+{
+    if(device != 0)
+        return hipErrorInvalidValue;
+
+    *props = hipDeviceProp_t{};
+
+    std::strcpy(props->name, "host");
+
+    props->multiProcessorCount = static_cast<int>(std::thread::hardware_concurrency());
+    props->l2CacheSize         = 0;
+    props->sharedMemPerBlock   = 64 * 1024;
+    props->warpSize            = warpSize;
+    props->maxThreadsPerBlock  = 1024;
+    props->clockRate           = 0;
+
+    // a host thread runs one block at a time
+    props->maxThreadsPerMultiProcessor      = props->maxThreadsPerBlock;
+    props->maxSharedMemoryPerMultiProcessor = props->sharedMemPerBlock;
+
+    return hipSuccess;
+}
+
+inline hipError_t hipDriverGetVersion(int* version)
+{
+    *version = 0;
+
+    return hipSuccess;
+}
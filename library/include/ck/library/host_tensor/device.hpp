@@ -9,6 +9,7 @@
 
 #include "stream_config.hpp"
 #include "ck/options.hpp"
+#include "kernel_timing.hpp"
 
 template <typename T>
 __global__ void set_buffer_value(T* p, T x, uint64_t buffer_element_size)
@@ -30,6 +31,33 @@ inline void hip_check_error(hipError_t x)
     }
 }
 
+// While a DeviceMemArena::Scope is alive, released device buffers are cached and handed out again
+// to later DeviceMem objects of at most their size. When no cached buffer is large enough, the
+// largest one is freed and replaced by one of the requested size, so buffers only grow: a series
+// of problems of different shapes ends up with as many buffers as it uses at a time, each as large
+// as the largest use, instead of allocating and freeing device memory for every problem.
+struct DeviceMemArena
+{
+    // keeps released device buffers for reuse while alive, scopes may nest
+    struct Scope
+    {
+        Scope();
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    // bytes currently cached for reuse
+    static std::size_t GetNumCachedBytes();
+
+    // number of allocations served from the cache since the process started
+    static std::size_t GetNumReusedAllocations();
+
+    // free every cached buffer
+    static void Release();
+};
+
 struct DeviceMem
 {
     DeviceMem() = delete;
@@ -47,12 +75,21 @@ struct DeviceMem
             throw std::runtime_error("wrong! not entire DeviceMem will be set");
         }
 
-        set_buffer_value<T><<<1, 1024>>>(static_cast<T*>(mpDeviceBuf), x, mMemSize / sizeof(T));
+        hipLaunchKernelGGL(set_buffer_value<T>,
+                           dim3(1),
+                           dim3(1024),
+                           0,
+                           nullptr,
+                           static_cast<T*>(mpDeviceBuf),
+                           x,
+                           mMemSize / sizeof(T));
     }
     ~DeviceMem();
 
     void* mpDeviceBuf;
     std::size_t mMemSize;
+    // size of the allocation behind mpDeviceBuf, larger than mMemSize for a reused buffer
+    std::size_t mCapacity;
 };
 
 struct KernelTimerImpl;
@@ -68,6 +105,26 @@ struct KernelTimer
     std::unique_ptr<KernelTimerImpl> impl;
 };
 
+struct KernelEventTimerImpl;
+
+// Times each of a series of kernel runs on a stream with a pair of HIP events, for
+// run_timed_repetitions().
+struct KernelEventTimer
+{
+    explicit KernelEventTimer(hipStream_t stream);
+    ~KernelEventTimer();
+    void Start();
+    void Stop();
+    // wait for the last run and return the time of each run, in ms
+    std::vector<float> GetSamples();
+
+    std::unique_ptr<KernelEventTimerImpl> impl;
+};
+
+// Evict the L2 cache by writing a device buffer of twice its size on `stream`, so the next kernel
+// reads its inputs from DRAM as it does in an application.
+void flush_device_cache(hipStream_t stream);
+
 template <typename... Args, typename F>
 float launch_and_time_kernel(const StreamConfig& stream_config,
                              F kernel,
@@ -88,35 +145,36 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
                block_dim.y,
                block_dim.z);
 
-        const int nrepeat = 10;
+        printf("Warm up %d times, then run %d times%s...\n",
+               stream_config.n_warmup_,
+               stream_config.n_repeat_,
+               stream_config.flush_cache_ ? " with L2 cache flushes" : "");
 
-        printf("Warm up 1 time\n");
+        KernelEventTimer timer(stream_config.stream_id_);
 
-        // warm up
-        kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
-
-        printf("Start running %d times...\n", nrepeat);
-
-        KernelTimer timer;
-        timer.Start();
-
-        for(int i = 0; i < nrepeat; ++i)
-        {
-            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
-        }
+        const auto samples = run_timed_repetitions(
+            stream_config,
+            timer,
+            [&] {
+                hipLaunchKernelGGL(
+                    kernel, grid_dim, block_dim, lds_byte, stream_config.stream_id_, args...);
+            },
+            [&] { flush_device_cache(stream_config.stream_id_); });
 
-        timer.End();
+        if(stream_config.timing_result_ != nullptr)
+            add_kernel_timing_samples(*stream_config.timing_result_, samples);
 
-        return timer.GetElapsedTime() / nrepeat;
+        return get_kernel_timing_result(samples).mean;
     }
     else
     {
-        kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+        hipLaunchKernelGGL(
+            kernel, grid_dim, block_dim, lds_byte, stream_config.stream_id_, args...);
 
         return 0;
     }
 #else
-    kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+    hipLaunchKernelGGL(kernel, grid_dim, block_dim, lds_byte, stream_config.stream_id_, args...);
 
     return 0;
 #endif
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+// What launch geometry depends on, of one device.
+struct DeviceProperties
+{
+    std::string name;
+    int num_cu                    = 0;
+    int warp_size                 = 0;
+    int max_threads_per_block     = 0;
+    int max_waves_per_cu          = 0;
+    std::size_t lds_per_cu        = 0; // bytes
+    std::size_t max_lds_per_block = 0; // bytes
+    std::size_t l2_size           = 0; // bytes, 0 if the runtime does not report it
+};
+
+// Where device properties come from: the HIP runtime, or a fake one in tests.
+struct DevicePropertiesProvider
+{
+    virtual ~DevicePropertiesProvider() = default;
+
+    virtual int GetCurrentDevice() const = 0;
+
+    virtual DeviceProperties GetDeviceProperties(int device) const = 0;
+};
+
+// Returns the same properties for every device, the current one being 0.
+struct FakeDevicePropertiesProvider : public DevicePropertiesProvider
+{
+    explicit FakeDevicePropertiesProvider(DeviceProperties props) : props_(std::move(props)) {}
+
+    int GetCurrentDevice() const override { return 0; }
+
+    DeviceProperties GetDeviceProperties(int) const override { return props_; }
+
+    DeviceProperties props_;
+};
+
+// Properties of `device`, queried from the provider the first time and cached until the provider
+// is replaced, which also ends the life of the returned reference. Thread safe.
+const DeviceProperties& get_device_properties(int device);
+
+// of the current device
+const DeviceProperties& get_device_properties();
+
+// Use `provider` from now on, nullptr for the HIP runtime, and drop the cached properties. Returns
+// the previous provider, nullptr for the HIP runtime.
+std::shared_ptr<DevicePropertiesProvider>
+set_device_properties_provider(std::shared_ptr<DevicePropertiesProvider> provider);
+
+// Installs a provider while alive, e.g. a FakeDevicePropertiesProvider in a test.
+struct ScopedDevicePropertiesProvider
+{
+    explicit ScopedDevicePropertiesProvider(std::shared_ptr<DevicePropertiesProvider> provider)
+        : previous_(set_device_properties_provider(std::move(provider)))
+    {
+    }
+
+    ~ScopedDevicePropertiesProvider() { set_device_properties_provider(std::move(previous_)); }
+
+    ScopedDevicePropertiesProvider(const ScopedDevicePropertiesProvider&) = delete;
+    ScopedDevicePropertiesProvider& operator=(const ScopedDevicePropertiesProvider&) = delete;
+
+    std::shared_ptr<DevicePropertiesProvider> previous_;
+};
+
+// Workgroups of `block_size` threads using `lds_bytes` of LDS each that a CU keeps resident at
+// once, limited by its waves and its LDS. 0 if one does not fit. Register use is not known on the
+// host; it is assumed to allow the wave limit.
+int get_max_active_blocks_per_cu(const DeviceProperties& props,
+                                 int block_size,
+                                 std::size_t lds_bytes);
+
+// Grid of a persistent kernel, whose workgroups loop over `num_work` work items (tiles, vectors,
+// ...): as many workgroups as the device runs at once, but no more than there are work items,
+// and at least one.
+int64_t get_persistent_grid_size(const DeviceProperties& props,
+                                 int block_size,
+                                 std::size_t lds_bytes,
+                                 int64_t num_work);
+
+// of the current device
+int64_t get_persistent_grid_size(int block_size, std::size_t lds_bytes, int64_t num_work);
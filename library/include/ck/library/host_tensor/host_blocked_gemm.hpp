@@ -0,0 +1,430 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#include <immintrin.h>
+#define CK_HOST_GEMM_X86 1
+#else
+#define CK_HOST_GEMM_X86 0
+#endif
+
+#include "host_tensor.hpp"
+
+namespace ck {
+namespace host_gemm {
+
+// Blocked CPU GEMM used by the host reference operators:
+//
+//   C[m, n] = c_op(sum_k a_op(A[m, k]) * b_op(B[k, n]))
+//
+// A and B are converted to float, run through their elementwise op and packed into MR x K and
+// K x NR micro-panels, so any A/B strides (row- or column-major) are resolved by the pack step and
+// the microkernel only streams contiguous float data. The iteration space is blocked as
+// NC (L3, B block) x KC (L2/L1, A block and B micro-panel) x MC (L2, A block).
+//
+// The microkernel seeds its accumulators from the running sum and walks k in ascending order, so
+// every C element is accumulated in exactly the same order as the naive reference loop. The only
+// numerical difference is that the AVX2/AVX-512 kernels use fused multiply-add: the result differs
+// from the unfused float sum by at most 2 * K * 2^-24 * sum_k |a_k * b_k|. The generic kernel
+// does not fuse and reproduces the naive loop bit for bit, unless the compiler contracts a * b + c
+// on its own.
+//
+// The ISA is detected once per process. Setting CK_HOST_GEMM_ISA to "generic", "avx2" or "avx512"
+// caps it, e.g. to compare kernels or to reproduce results from an older host.
+
+enum struct HostGemmIsa
+{
+    Generic = 0,
+    Avx2    = 1,
+    Avx512  = 2,
+};
+
+inline HostGemmIsa DetectHostGemmIsa()
+{
+#if CK_HOST_GEMM_X86
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx512f"))
+        return HostGemmIsa::Avx512;
+
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return HostGemmIsa::Avx2;
+#endif
+    return HostGemmIsa::Generic;
+}
+
+inline HostGemmIsa GetHostGemmIsa()
+{
+    static const HostGemmIsa isa = [] {
+        HostGemmIsa detected = DetectHostGemmIsa();
+
+        if(const char* env = std::getenv("CK_HOST_GEMM_ISA"))
+        {
+            const std::string name{env};
+
+            HostGemmIsa requested = detected;
+
+            if(name == "generic")
+                requested = HostGemmIsa::Generic;
+            else if(name == "avx2")
+                requested = HostGemmIsa::Avx2;
+            else if(name == "avx512")
+                requested = HostGemmIsa::Avx512;
+
+            // never pick an ISA the host cannot execute
+            detected = std::min(detected, requested);
+        }
+
+        return detected;
+    }();
+
+    return isa;
+}
+
+inline const char* GetHostGemmIsaString(HostGemmIsa isa)
+{
+    switch(isa)
+    {
+    case HostGemmIsa::Avx512: return "avx512";
+    case HostGemmIsa::Avx2: return "avx2";
+    default: return "generic";
+    }
+}
+
+// Microkernels: c[MR][NR] (leading dimension ldc) += a_panel[kc][MR] * b_panel[kc][NR]
+struct GenericKernel
+{
+    static constexpr std::size_t MR = 4;
+    static constexpr std::size_t NR = 8;
+
+    static void Run(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc)
+    {
+        float acc[MR][NR];
+
+        for(std::size_t i = 0; i < MR; ++i)
+            for(std::size_t j = 0; j < NR; ++j)
+                acc[i][j] = c[i * ldc + j];
+
+        for(std::size_t k = 0; k < kc; ++k)
+        {
+            for(std::size_t i = 0; i < MR; ++i)
+                for(std::size_t j = 0; j < NR; ++j)
+                    acc[i][j] += a[i] * b[j];
+
+            a += MR;
+            b += NR;
+        }
+
+        for(std::size_t i = 0; i < MR; ++i)
+            for(std::size_t j = 0; j < NR; ++j)
+                c[i * ldc + j] = acc[i][j];
+    }
+};
+
+#if CK_HOST_GEMM_X86
+struct Avx2Kernel
+{
+    static constexpr std::size_t MR = 6;
+    static constexpr std::size_t NR = 16;
+
+    __attribute__((target("avx2,fma"))) static void
+    Run(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc)
+    {
+        __m256 acc[MR][2];
+
+        for(std::size_t i = 0; i < MR; ++i)
+        {
+            acc[i][0] = _mm256_loadu_ps(c + i * ldc);
+            acc[i][1] = _mm256_loadu_ps(c + i * ldc + 8);
+        }
+
+        for(std::size_t k = 0; k < kc; ++k)
+        {
+            const __m256 b0 = _mm256_loadu_ps(b);
+            const __m256 b1 = _mm256_loadu_ps(b + 8);
+
+            for(std::size_t i = 0; i < MR; ++i)
+            {
+                const __m256 ai = _mm256_broadcast_ss(a + i);
+
+                acc[i][0] = _mm256_fmadd_ps(ai, b0, acc[i][0]);
+                acc[i][1] = _mm256_fmadd_ps(ai, b1, acc[i][1]);
+            }
+
+            a += MR;
+            b += NR;
+        }
+
+        for(std::size_t i = 0; i < MR; ++i)
+        {
+            _mm256_storeu_ps(c + i * ldc, acc[i][0]);
+            _mm256_storeu_ps(c + i * ldc + 8, acc[i][1]);
+        }
+    }
+};
+
+struct Avx512Kernel
+{
+    static constexpr std::size_t MR = 12;
+    static constexpr std::size_t NR = 32;
+
+    __attribute__((target("avx512f"))) static void
+    Run(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc)
+    {
+        __m512 acc[MR][2];
+
+        for(std::size_t i = 0; i < MR; ++i)
+        {
+            acc[i][0] = _mm512_loadu_ps(c + i * ldc);
+            acc[i][1] = _mm512_loadu_ps(c + i * ldc + 16);
+        }
+
+        for(std::size_t k = 0; k < kc; ++k)
+        {
+            const __m512 b0 = _mm512_loadu_ps(b);
+            const __m512 b1 = _mm512_loadu_ps(b + 16);
+
+            for(std::size_t i = 0; i < MR; ++i)
+            {
+                const __m512 ai = _mm512_set1_ps(a[i]);
+
+                acc[i][0] = _mm512_fmadd_ps(ai, b0, acc[i][0]);
+                acc[i][1] = _mm512_fmadd_ps(ai, b1, acc[i][1]);
+            }
+
+            a += MR;
+            b += NR;
+        }
+
+        for(std::size_t i = 0; i < MR; ++i)
+        {
+            _mm512_storeu_ps(c + i * ldc, acc[i][0]);
+            _mm512_storeu_ps(c + i * ldc + 16, acc[i][1]);
+        }
+    }
+};
+#endif
+
+// cache blocking, in elements; MC must be a multiple of every kernel's MR and NC of every NR
+constexpr std::size_t BlockMC = 96;
+constexpr std::size_t BlockKC = 256;
+constexpr std::size_t BlockNC = 1024;
+
+inline std::size_t integer_divide_ceil(std::size_t x, std::size_t y) { return (x + y - 1) / y; }
+
+// Operands are described by callbacks rather than tensors, so that lowered problems (e.g. an
+// implicit im2col) can feed the engine without materialising the full GEMM operand:
+//
+//   fill_a(i_begin, i_count, dst, ld): dst[k * ld + i] = a_op(A[i_begin + i, k]), i < i_count
+//   fill_b(j_begin, j_count, dst, ld): dst[k * ld + j] = b_op(B[k, j_begin + j]), j < j_count
+//   store_c(i, j_begin, j_count, src):  C[i, j_begin + j] = c_op(src[j]), j < j_count
+//
+// for all k in [0, K). Panels past the end of the problem are zero-filled by the engine.
+template <std::size_t P, typename FillPanel>
+void pack_panel(
+    const FillPanel& fill, std::size_t i_begin, std::size_t i_count, std::size_t K, float* dst)
+{
+    fill(i_begin, i_count, dst, P);
+
+    if(i_count < P)
+        for(std::size_t k = 0; k < K; ++k)
+            for(std::size_t i = i_count; i < P; ++i)
+                dst[k * P + i] = 0;
+}
+
+template <typename Kernel, typename FillA, typename FillB, typename StoreC>
+void run_blocked_gemm(std::size_t M,
+                      std::size_t N,
+                      std::size_t K,
+                      const FillA& fill_a,
+                      const FillB& fill_b,
+                      const StoreC& store_c,
+                      std::size_t num_thread)
+{
+    constexpr std::size_t MR = Kernel::MR;
+    constexpr std::size_t NR = Kernel::NR;
+
+    static_assert(BlockMC % MR == 0 && BlockNC % NR == 0, "wrong! blocking vs microkernel tile");
+
+    if(M == 0 || N == 0)
+        return;
+
+    num_thread = std::max<std::size_t>(num_thread, 1);
+
+    // B is packed once, as N/NR panels of K x NR
+    const std::size_t num_b_panel = integer_divide_ceil(N, NR);
+
+    std::vector<float> b_pack(num_b_panel * K * NR);
+
+    auto f_pack_b = [&](auto jp) {
+        pack_panel<NR>(fill_b, jp * NR, std::min(NR, N - jp * NR), K, b_pack.data() + jp * K * NR);
+    };
+
+    make_ParallelTensorFunctor(f_pack_b, num_b_panel)(std::min(num_thread, num_b_panel));
+
+    // shrink NC when there are too few MC x NC tiles to keep every thread busy
+    const std::size_t num_mc = integer_divide_ceil(M, BlockMC);
+    const std::size_t nc     = std::min(
+        BlockNC,
+        integer_divide_ceil(integer_divide_ceil(N, integer_divide_ceil(num_thread, num_mc)), NR) *
+            NR);
+    const std::size_t num_nc = integer_divide_ceil(N, nc);
+
+    // A is packed per MC x K block, so that the full (possibly implicit) A is never materialised
+    auto f_tile = [&](auto imc, auto inc) {
+        const std::size_t ic = imc * BlockMC;
+        const std::size_t jc = inc * nc;
+
+        const std::size_t mc = std::min(BlockMC, M - ic);
+        const std::size_t nb = std::min(nc, N - jc);
+
+        const std::size_t mc_pad = integer_divide_ceil(mc, MR) * MR;
+        const std::size_t ldc    = integer_divide_ceil(nb, NR) * NR;
+
+        std::vector<float> a_pack(mc_pad * K);
+        std::vector<float> c_acc(mc_pad * ldc, 0.f);
+
+        for(std::size_t ir = 0; ir < mc_pad; ir += MR)
+            pack_panel<MR>(fill_a, ic + ir, std::min(MR, mc - ir), K, a_pack.data() + ir * K);
+
+        for(std::size_t pc = 0; pc < K; pc += BlockKC)
+        {
+            const std::size_t kc = std::min(BlockKC, K - pc);
+
+            for(std::size_t jr = 0; jr < ldc; jr += NR)
+            {
+                const float* p_b = b_pack.data() + (jc + jr) / NR * K * NR + pc * NR;
+
+                for(std::size_t ir = 0; ir < mc_pad; ir += MR)
+                {
+                    const float* p_a = a_pack.data() + ir * K + pc * MR;
+
+                    Kernel::Run(kc, p_a, p_b, c_acc.data() + ir * ldc + jr, ldc);
+                }
+            }
+        }
+
+        for(std::size_t i = 0; i < mc; ++i)
+            store_c(ic + i, jc, nb, c_acc.data() + i * ldc);
+    };
+
+    make_ParallelTensorFunctor(f_tile, num_mc, num_nc)(std::min(num_thread, num_mc * num_nc));
+}
+
+// C[M, N] = c_op(A[M, K] * B[K, N]), with operands supplied through fill_a/fill_b/store_c
+template <typename FillA, typename FillB, typename StoreC>
+void blocked_gemm(std::size_t M,
+                  std::size_t N,
+                  std::size_t K,
+                  const FillA& fill_a,
+                  const FillB& fill_b,
+                  const StoreC& store_c,
+                  std::size_t num_thread = std::thread::hardware_concurrency(),
+                  HostGemmIsa isa        = GetHostGemmIsa())
+{
+    isa = std::min(isa, GetHostGemmIsa());
+
+#if CK_HOST_GEMM_X86
+    if(isa == HostGemmIsa::Avx512)
+    {
+        run_blocked_gemm<Avx512Kernel>(M, N, K, fill_a, fill_b, store_c, num_thread);
+        return;
+    }
+
+    if(isa == HostGemmIsa::Avx2)
+    {
+        run_blocked_gemm<Avx2Kernel>(M, N, K, fill_a, fill_b, store_c, num_thread);
+        return;
+    }
+#endif
+
+    run_blocked_gemm<GenericKernel>(M, N, K, fill_a, fill_b, store_c, num_thread);
+}
+
+// Fill callback reading x(i, k) from a 2-D tensor (x(k, i) if transposed), converting to float
+// and applying element_op
+template <typename DataType, typename ElementwiseOperation>
+auto make_tensor_panel_filler(const Tensor<DataType>& x,
+                              bool transposed,
+                              std::size_t K,
+                              const ElementwiseOperation& element_op)
+{
+    const auto& strides  = x.mDesc.GetStrides();
+    const std::size_t si = transposed ? strides[1] : strides[0];
+    const std::size_t sk = transposed ? strides[0] : strides[1];
+
+    return [=, p_src = x.mData.data(), &element_op](
+               std::size_t i_begin, std::size_t i_count, float* dst, std::size_t ld) {
+        auto pack_one = [&](std::size_t i, std::size_t k) {
+            float v;
+            element_op(v, ck::type_convert<float>(p_src[(i_begin + i) * si + k * sk]));
+            dst[k * ld + i] = v;
+        };
+
+        // walk the source along its unit-stride dimension
+        if(sk == 1)
+        {
+            for(std::size_t i = 0; i < i_count; ++i)
+                for(std::size_t k = 0; k < K; ++k)
+                    pack_one(i, k);
+        }
+        else
+        {
+            for(std::size_t k = 0; k < K; ++k)
+                for(std::size_t i = 0; i < i_count; ++i)
+                    pack_one(i, k);
+        }
+    };
+}
+
+// C[M, N] = c_op(a_op(A[M, K]) * b_op(B[K, N])), for any A/B/C strides
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+void blocked_gemm(const Tensor<ADataType>& a_m_k,
+                  const Tensor<BDataType>& b_k_n,
+                  Tensor<CDataType>& c_m_n,
+                  const AElementwiseOperation& a_element_op,
+                  const BElementwiseOperation& b_element_op,
+                  const CElementwiseOperation& c_element_op,
+                  std::size_t num_thread = std::thread::hardware_concurrency(),
+                  HostGemmIsa isa        = GetHostGemmIsa())
+{
+    const std::size_t M = c_m_n.mDesc.GetLengths()[0];
+    const std::size_t N = c_m_n.mDesc.GetLengths()[1];
+    const std::size_t K = a_m_k.mDesc.GetLengths()[1];
+
+    const auto& c_strides = c_m_n.mDesc.GetStrides();
+
+    auto store_c = [&, p_c = c_m_n.mData.data()](
+                       std::size_t i, std::size_t j_begin, std::size_t j_count, const float* src) {
+        for(std::size_t j = 0; j < j_count; ++j)
+        {
+            float v_c;
+
+            c_element_op(v_c, src[j]);
+
+            p_c[i * c_strides[0] + (j_begin + j) * c_strides[1]] = ck::type_convert<CDataType>(v_c);
+        }
+    };
+
+    blocked_gemm(M,
+                 N,
+                 K,
+                 make_tensor_panel_filler(a_m_k, false, K, a_element_op),
+                 make_tensor_panel_filler(b_k_n, true, K, b_element_op),
+                 store_c,
+                 num_thread,
+                 isa);
+}
+
+} // namespace host_gemm
+} // namespace ck
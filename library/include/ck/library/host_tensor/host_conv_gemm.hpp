@@ -0,0 +1,702 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "host_tensor.hpp"
+#include "host_blocked_gemm.hpp"
+
+namespace ck {
+namespace host_conv {
+
+// Convolutions lowered to the blocked CPU GEMM in host_blocked_gemm.hpp.
+//
+// Tensors follow the reference operator convention: lengths are always ordered N, C (K), spatial
+// and the strides give the actual memory layout, so NCHW and NHWC (and the 1-D/3-D variants) go
+// through the same code. 1-D and 2-D problems are padded to 3 spatial dimensions with leading
+// dimensions of length 1.
+struct ConvGemmShape
+{
+    static constexpr std::size_t NumDimSpatial = 3;
+
+    using SpatialLengths = std::array<std::size_t, NumDimSpatial>;
+    using SpatialOffsets = std::array<ck::long_index_t, NumDimSpatial>;
+
+    std::size_t N_;
+    std::size_t C_;
+    std::size_t K_;
+
+    SpatialLengths in_lengths_;
+    SpatialLengths wei_lengths_;
+    SpatialLengths out_lengths_;
+
+    // strides of the (N, C, spatial) / (K, C, spatial) / (N, K, spatial) tensors
+    std::size_t in_n_stride_, in_c_stride_;
+    std::size_t wei_k_stride_, wei_c_stride_;
+    std::size_t out_n_stride_, out_k_stride_;
+
+    SpatialLengths in_strides_;
+    SpatialLengths wei_strides_;
+    SpatialLengths out_strides_;
+
+    SpatialOffsets conv_strides_;
+    SpatialOffsets conv_dilations_;
+    SpatialOffsets in_left_pads_;
+
+    ConvGemmShape(const HostTensorDescriptor& in_desc,
+                  const HostTensorDescriptor& wei_desc,
+                  const HostTensorDescriptor& out_desc,
+                  const std::vector<ck::index_t>& conv_strides,
+                  const std::vector<ck::index_t>& conv_dilations,
+                  const std::vector<ck::index_t>& in_left_pads)
+        : N_{in_desc.GetLengths()[0]}, C_{in_desc.GetLengths()[1]}, K_{wei_desc.GetLengths()[0]}
+    {
+        const std::size_t ndim = in_desc.GetNumOfDimension() - 2;
+        const std::size_t skip = NumDimSpatial - ndim;
+
+        in_n_stride_  = in_desc.GetStrides()[0];
+        in_c_stride_  = in_desc.GetStrides()[1];
+        wei_k_stride_ = wei_desc.GetStrides()[0];
+        wei_c_stride_ = wei_desc.GetStrides()[1];
+        out_n_stride_ = out_desc.GetStrides()[0];
+        out_k_stride_ = out_desc.GetStrides()[1];
+
+        for(std::size_t i = 0; i < NumDimSpatial; ++i)
+        {
+            const bool padded   = i < skip;
+            const std::size_t d = padded ? 0 : i - skip;
+
+            in_lengths_[i]  = padded ? 1 : in_desc.GetLengths()[d + 2];
+            wei_lengths_[i] = padded ? 1 : wei_desc.GetLengths()[d + 2];
+            out_lengths_[i] = padded ? 1 : out_desc.GetLengths()[d + 2];
+
+            in_strides_[i]  = padded ? 0 : in_desc.GetStrides()[d + 2];
+            wei_strides_[i] = padded ? 0 : wei_desc.GetStrides()[d + 2];
+            out_strides_[i] = padded ? 0 : out_desc.GetStrides()[d + 2];
+
+            conv_strides_[i]   = padded ? 1 : conv_strides[d];
+            conv_dilations_[i] = padded ? 1 : conv_dilations[d];
+            in_left_pads_[i]   = padded ? 0 : in_left_pads[d];
+        }
+    }
+
+    std::size_t GetOutputSpatialSize() const
+    {
+        return out_lengths_[0] * out_lengths_[1] * out_lengths_[2];
+    }
+
+    std::size_t GetFilterSpatialSize() const
+    {
+        return wei_lengths_[0] * wei_lengths_[1] * wei_lengths_[2];
+    }
+
+    // flattened (n, do, ho, wo) -> n and output spatial index
+    std::size_t DecodeOutputIndex(std::size_t m, SpatialLengths& o) const
+    {
+        o[2] = m % out_lengths_[2];
+        m /= out_lengths_[2];
+        o[1] = m % out_lengths_[1];
+        m /= out_lengths_[1];
+        o[0] = m % out_lengths_[0];
+
+        return m / out_lengths_[0];
+    }
+
+    std::size_t GetOutputOffset(std::size_t n, std::size_t k, const SpatialLengths& o) const
+    {
+        return n * out_n_stride_ + k * out_k_stride_ + o[0] * out_strides_[0] +
+               o[1] * out_strides_[1] + o[2] * out_strides_[2];
+    }
+
+    std::size_t GetInputOffset(std::size_t n, std::size_t c, const SpatialLengths& i) const
+    {
+        return n * in_n_stride_ + c * in_c_stride_ + i[0] * in_strides_[0] +
+               i[1] * in_strides_[1] + i[2] * in_strides_[2];
+    }
+
+    // flattened (c, z, y, x) -> c and filter spatial index
+    std::size_t DecodeFilterIndex(std::size_t j, SpatialLengths& t) const
+    {
+        t[2] = j % wei_lengths_[2];
+        j /= wei_lengths_[2];
+        t[1] = j % wei_lengths_[1];
+        j /= wei_lengths_[1];
+        t[0] = j % wei_lengths_[0];
+
+        return j / wei_lengths_[0];
+    }
+
+    std::size_t GetWeightOffset(std::size_t k, std::size_t c, const SpatialLengths& t) const
+    {
+        return k * wei_k_stride_ + c * wei_c_stride_ + t[0] * wei_strides_[0] +
+               t[1] * wei_strides_[1] + t[2] * wei_strides_[2];
+    }
+
+    // Visit every (c, z, y, x) tap of output point o in GEMM-K order, i.e. in the same order as
+    // the naive reference loops, passing the input offset relative to (n, 0, 0, 0, 0) or -1 for
+    // taps that fall into the padding.
+    template <typename F>
+    void ForEachInputTap(const SpatialLengths& o, F f) const
+    {
+        SpatialOffsets i0;
+
+        for(std::size_t d = 0; d < NumDimSpatial; ++d)
+            i0[d] = static_cast<ck::long_index_t>(o[d]) * conv_strides_[d] - in_left_pads_[d];
+
+        // input coordinate of filter tap t along spatial dimension d, -1 if it is in the padding
+        auto input_index = [&](std::size_t d, std::size_t t) {
+            const ck::long_index_t i =
+                i0[d] + static_cast<ck::long_index_t>(t) * conv_dilations_[d];
+
+            return i < static_cast<ck::long_index_t>(in_lengths_[d]) ? i : ck::long_index_t{-1};
+        };
+
+        for(std::size_t c = 0; c < C_; ++c)
+        {
+            for(std::size_t z = 0; z < wei_lengths_[0]; ++z)
+            {
+                const ck::long_index_t di = input_index(0, z);
+
+                for(std::size_t y = 0; y < wei_lengths_[1]; ++y)
+                {
+                    const ck::long_index_t hi = input_index(1, y);
+
+                    for(std::size_t x = 0; x < wei_lengths_[2]; ++x)
+                    {
+                        const ck::long_index_t wi = input_index(2, x);
+
+                        if(di >= 0 && hi >= 0 && wi >= 0)
+                        {
+                            f(static_cast<ck::long_index_t>(c * in_c_stride_) +
+                              di * static_cast<ck::long_index_t>(in_strides_[0]) +
+                              hi * static_cast<ck::long_index_t>(in_strides_[1]) +
+                              wi * static_cast<ck::long_index_t>(in_strides_[2]));
+                        }
+                        else
+                        {
+                            f(ck::long_index_t{-1});
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Visit every (c, z, y, x) tap of output channel k in GEMM-K order, passing the weight offset
+    template <typename F>
+    void ForEachWeightTap(std::size_t k, F f) const
+    {
+        for(std::size_t c = 0; c < C_; ++c)
+            for(std::size_t z = 0; z < wei_lengths_[0]; ++z)
+                for(std::size_t y = 0; y < wei_lengths_[1]; ++y)
+                    for(std::size_t x = 0; x < wei_lengths_[2]; ++x)
+                        f(k * wei_k_stride_ + c * wei_c_stride_ + z * wei_strides_[0] +
+                          y * wei_strides_[1] + x * wei_strides_[2]);
+    }
+
+    // Visit every output point of one image in (do, ho, wo) order, passing its offset relative to
+    // (n, k) = (0, 0)
+    template <typename F>
+    void ForEachOutputPoint(F f) const
+    {
+        for(std::size_t d_o = 0; d_o < out_lengths_[0]; ++d_o)
+            for(std::size_t ho = 0; ho < out_lengths_[1]; ++ho)
+                for(std::size_t wo = 0; wo < out_lengths_[2]; ++wo)
+                    f(d_o * out_strides_[0] + ho * out_strides_[1] + wo * out_strides_[2]);
+    }
+
+    // Visit every output point of one image in (do, ho, wo) order, passing the offset of the
+    // input point that filter tap t reads for it, relative to (n, c) = (0, 0), or -1 if the tap
+    // falls into the padding
+    template <typename F>
+    void ForEachOutputPointInputTap(const SpatialLengths& t, F f) const
+    {
+        // input coordinate read at output coordinate o along spatial dimension d, -1 if padding
+        auto input_index = [&](std::size_t d, std::size_t o) {
+            const ck::long_index_t i = static_cast<ck::long_index_t>(o) * conv_strides_[d] +
+                                       static_cast<ck::long_index_t>(t[d]) * conv_dilations_[d] -
+                                       in_left_pads_[d];
+
+            return i >= 0 && i < static_cast<ck::long_index_t>(in_lengths_[d])
+                       ? i
+                       : ck::long_index_t{-1};
+        };
+
+        for(std::size_t d_o = 0; d_o < out_lengths_[0]; ++d_o)
+        {
+            const ck::long_index_t di = input_index(0, d_o);
+
+            for(std::size_t ho = 0; ho < out_lengths_[1]; ++ho)
+            {
+                const ck::long_index_t hi = input_index(1, ho);
+
+                for(std::size_t wo = 0; wo < out_lengths_[2]; ++wo)
+                {
+                    const ck::long_index_t wi = input_index(2, wo);
+
+                    if(di >= 0 && hi >= 0 && wi >= 0)
+                    {
+                        f(di * static_cast<ck::long_index_t>(in_strides_[0]) +
+                          hi * static_cast<ck::long_index_t>(in_strides_[1]) +
+                          wi * static_cast<ck::long_index_t>(in_strides_[2]));
+                    }
+                    else
+                    {
+                        f(ck::long_index_t{-1});
+                    }
+                }
+            }
+        }
+    }
+};
+
+// Forward convolution as an implicit-im2col GEMM:
+//
+//   out[N * Do * Ho * Wo, K] = in_im2col[N * Do * Ho * Wo, C * Z * Y * X] * wei[K, C * Z * Y * X]^T
+//
+// The im2col rows are generated straight into the GEMM's packed MC x K blocks, so no im2col
+// buffer larger than one block is ever allocated. in_element_op is applied to every in-bounds tap
+// and padding contributes an exact zero, exactly like the naive reference. The GEMM-K order
+// matches the reference loop order, so results only differ from it by FMA rounding (see
+// host_blocked_gemm.hpp).
+template <typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation>
+void conv_fwd_gemm(const Tensor<InDataType>& in,
+                   const Tensor<WeiDataType>& wei,
+                   Tensor<OutDataType>& out,
+                   const std::vector<ck::index_t>& conv_strides,
+                   const std::vector<ck::index_t>& conv_dilations,
+                   const std::vector<ck::index_t>& in_left_pads,
+                   const InElementwiseOperation& in_element_op,
+                   const WeiElementwiseOperation& wei_element_op,
+                   const OutElementwiseOperation& out_element_op,
+                   std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    const ConvGemmShape shape{
+        in.mDesc, wei.mDesc, out.mDesc, conv_strides, conv_dilations, in_left_pads};
+
+    const std::size_t M = shape.N_ * shape.GetOutputSpatialSize();
+    const std::size_t N = shape.K_;
+    const std::size_t K = shape.C_ * shape.GetFilterSpatialSize();
+
+    const InDataType* p_in   = in.mData.data();
+    const WeiDataType* p_wei = wei.mData.data();
+    OutDataType* p_out       = out.mData.data();
+
+    auto fill_a = [&](std::size_t i_begin, std::size_t i_count, float* dst, std::size_t ld) {
+        for(std::size_t i = 0; i < i_count; ++i)
+        {
+            ConvGemmShape::SpatialLengths o;
+
+            const std::size_t n      = shape.DecodeOutputIndex(i_begin + i, o);
+            const InDataType* p_in_n = p_in + n * shape.in_n_stride_;
+
+            float* p_dst = dst + i;
+
+            shape.ForEachInputTap(o, [&](ck::long_index_t offset) {
+                float v_in = 0;
+
+                if(offset >= 0)
+                    in_element_op(v_in, ck::type_convert<float>(p_in_n[offset]));
+
+                *p_dst = v_in;
+                p_dst += ld;
+            });
+        }
+    };
+
+    auto fill_b = [&](std::size_t j_begin, std::size_t j_count, float* dst, std::size_t ld) {
+        for(std::size_t j = 0; j < j_count; ++j)
+        {
+            float* p_dst = dst + j;
+
+            shape.ForEachWeightTap(j_begin + j, [&](std::size_t offset) {
+                float v_wei;
+
+                wei_element_op(v_wei, ck::type_convert<float>(p_wei[offset]));
+
+                *p_dst = v_wei;
+                p_dst += ld;
+            });
+        }
+    };
+
+    auto store_c = [&](std::size_t i, std::size_t j_begin, std::size_t j_count, const float* src) {
+        ConvGemmShape::SpatialLengths o;
+
+        const std::size_t n = shape.DecodeOutputIndex(i, o);
+
+        for(std::size_t j = 0; j < j_count; ++j)
+        {
+            float v_out;
+
+            out_element_op(v_out, src[j]);
+
+            p_out[shape.GetOutputOffset(n, j_begin + j, o)] = ck::type_convert<OutDataType>(v_out);
+        }
+    };
+
+    ck::host_gemm::blocked_gemm(M, N, K, fill_a, fill_b, store_c, num_thread);
+}
+
+// Backward-data convolution, decomposed by stride phase into dense GEMMs.
+//
+// Input point i receives filter tap t along a spatial dimension iff i + pad - t * dilation is a
+// multiple of the stride, i.e. the set of contributing taps only depends on the phase
+// (i + pad) % stride. For every phase (one per combination of per-dimension phases) the input
+// points of that phase are computed as
+//
+//   in[N * Di * Hi * Wi (phase), C] = out_gather[.., taps(phase) * K] * wei[taps(phase) * K, C]
+//
+// so no stride-divisibility test runs inside the GEMM and every input element is written by
+// exactly one GEMM, without a col2im scatter. The GEMM-K order (taps outer, k inner) matches the
+// naive reference loops; taps whose output point lies outside the output contribute an exact
+// zero.
+template <typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation>
+void conv_bwd_data_gemm(Tensor<InDataType>& in,
+                        const Tensor<WeiDataType>& wei,
+                        const Tensor<OutDataType>& out,
+                        const std::vector<ck::index_t>& conv_strides,
+                        const std::vector<ck::index_t>& conv_dilations,
+                        const std::vector<ck::index_t>& in_left_pads,
+                        const InElementwiseOperation& in_element_op,
+                        const WeiElementwiseOperation& wei_element_op,
+                        const OutElementwiseOperation& out_element_op,
+                        std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    using SpatialLengths = ConvGemmShape::SpatialLengths;
+    using SpatialOffsets = ConvGemmShape::SpatialOffsets;
+
+    constexpr std::size_t NumDimSpatial = ConvGemmShape::NumDimSpatial;
+
+    const ConvGemmShape shape{
+        in.mDesc, wei.mDesc, out.mDesc, conv_strides, conv_dilations, in_left_pads};
+
+    InDataType* p_in         = in.mData.data();
+    const WeiDataType* p_wei = wei.mData.data();
+    const OutDataType* p_out = out.mData.data();
+
+    const ck::long_index_t num_phase =
+        shape.conv_strides_[0] * shape.conv_strides_[1] * shape.conv_strides_[2];
+
+    for(ck::long_index_t ip = 0; ip < num_phase; ++ip)
+    {
+        // (i + pad) % stride of the input points of this phase, along every spatial dimension
+        SpatialOffsets phase;
+
+        ck::long_index_t r = ip;
+
+        for(std::size_t d = NumDimSpatial; d-- > 0;)
+        {
+            phase[d] = r % shape.conv_strides_[d];
+            r /= shape.conv_strides_[d];
+        }
+
+        // input points of this phase are first_i + stride * m, m < num_i
+        SpatialLengths first_i, num_i;
+
+        // filter taps reaching them
+        std::array<std::vector<std::size_t>, NumDimSpatial> taps;
+
+        for(std::size_t d = 0; d < NumDimSpatial; ++d)
+        {
+            const ck::long_index_t s = shape.conv_strides_[d];
+            const std::size_t stride = static_cast<std::size_t>(s);
+
+            const ck::long_index_t first = ((phase[d] - shape.in_left_pads_[d]) % s + s) % s;
+
+            first_i[d] = static_cast<std::size_t>(first);
+            num_i[d]   = first_i[d] < shape.in_lengths_[d]
+                             ? (shape.in_lengths_[d] - first_i[d] + stride - 1) / stride
+                             : 0;
+
+            for(std::size_t t = 0; t < shape.wei_lengths_[d]; ++t)
+            {
+                const ck::long_index_t offset =
+                    phase[d] - static_cast<ck::long_index_t>(t) * shape.conv_dilations_[d];
+
+                if(offset % s == 0)
+                    taps[d].push_back(t);
+            }
+        }
+
+        const std::size_t num_point = num_i[0] * num_i[1] * num_i[2];
+        const std::size_t num_tap   = taps[0].size() * taps[1].size() * taps[2].size();
+
+        if(num_point == 0)
+            continue;
+
+        const std::size_t M = shape.N_ * num_point;
+        const std::size_t N = shape.C_;
+        const std::size_t K = num_tap * shape.K_;
+
+        // flattened (n, m) -> n and input point
+        auto decode_row = [&](std::size_t r, SpatialLengths& i) {
+            for(std::size_t d = NumDimSpatial; d-- > 0;)
+            {
+                const std::size_t stride = static_cast<std::size_t>(shape.conv_strides_[d]);
+
+                i[d] = first_i[d] + stride * (r % num_i[d]);
+                r /= num_i[d];
+            }
+
+            return r;
+        };
+
+        auto fill_a = [&](std::size_t i_begin, std::size_t i_count, float* dst, std::size_t ld) {
+            for(std::size_t i = 0; i < i_count; ++i)
+            {
+                SpatialLengths in_idx;
+
+                const std::size_t n = decode_row(i_begin + i, in_idx);
+
+                // output coordinate reached through tap t along dimension d, -1 if outside
+                auto output_index = [&](std::size_t d, std::size_t t) {
+                    const ck::long_index_t o =
+                        (static_cast<ck::long_index_t>(in_idx[d]) + shape.in_left_pads_[d] -
+                         static_cast<ck::long_index_t>(t) * shape.conv_dilations_[d]) /
+                        shape.conv_strides_[d];
+
+                    return o >= 0 && o < static_cast<ck::long_index_t>(shape.out_lengths_[d])
+                               ? o
+                               : ck::long_index_t{-1};
+                };
+
+                float* p_dst = dst + i;
+
+                for(std::size_t z : taps[0])
+                {
+                    const ck::long_index_t d_o = output_index(0, z);
+
+                    for(std::size_t y : taps[1])
+                    {
+                        const ck::long_index_t ho = output_index(1, y);
+
+                        for(std::size_t x : taps[2])
+                        {
+                            const ck::long_index_t wo = output_index(2, x);
+
+                            const bool valid = d_o >= 0 && ho >= 0 && wo >= 0;
+
+                            const SpatialLengths o{static_cast<std::size_t>(d_o),
+                                                   static_cast<std::size_t>(ho),
+                                                   static_cast<std::size_t>(wo)};
+
+                            for(std::size_t k = 0; k < shape.K_; ++k)
+                            {
+                                float v_out = 0;
+
+                                if(valid)
+                                    out_element_op(v_out,
+                                                   ck::type_convert<float>(
+                                                       p_out[shape.GetOutputOffset(n, k, o)]));
+
+                                *p_dst = v_out;
+                                p_dst += ld;
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        auto fill_b = [&](std::size_t j_begin, std::size_t j_count, float* dst, std::size_t ld) {
+            for(std::size_t j = 0; j < j_count; ++j)
+            {
+                float* p_dst = dst + j;
+
+                for(std::size_t z : taps[0])
+                    for(std::size_t y : taps[1])
+                        for(std::size_t x : taps[2])
+                            for(std::size_t k = 0; k < shape.K_; ++k)
+                            {
+                                float v_wei;
+
+                                wei_element_op(v_wei,
+                                               ck::type_convert<float>(p_wei[shape.GetWeightOffset(
+                                                   k, j_begin + j, {z, y, x})]));
+
+                                *p_dst = v_wei;
+                                p_dst += ld;
+                            }
+            }
+        };
+
+        auto store_c =
+            [&](std::size_t i, std::size_t j_begin, std::size_t j_count, const float* src) {
+                SpatialLengths in_idx;
+
+                const std::size_t n = decode_row(i, in_idx);
+
+                for(std::size_t j = 0; j < j_count; ++j)
+                {
+                    float v_in;
+
+                    in_element_op(v_in, src[j]);
+
+                    p_in[shape.GetInputOffset(n, j_begin + j, in_idx)] =
+                        ck::type_convert<InDataType>(v_in);
+                }
+            };
+
+        ck::host_gemm::blocked_gemm(M, N, K, fill_a, fill_b, store_c, num_thread);
+    }
+}
+
+// Backward-weight convolution as an im2col^T GEMM per image:
+//
+//   wei[K, C * Z * Y * X] = sum_n out_n[K, Do * Ho * Wo] * in_im2col_n[Do * Ho * Wo, C * Z * Y * X]
+//
+// With at least as many images as threads, the reduction over N is split into one group of
+// images per thread, each reduced into its own float partial sum; the partial sums are added up
+// in group order afterwards. With fewer, the images are reduced one after the other into a single
+// partial sum, and all threads split the K x (C * Z * Y * X) tiles of each image's GEMM, since a
+// GEMM inside a parallel region would run on one thread. Padding taps contribute an exact zero,
+// like in the naive reference.
+template <typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation>
+void conv_bwd_weight_gemm(const Tensor<InDataType>& in,
+                          Tensor<WeiDataType>& wei,
+                          const Tensor<OutDataType>& out,
+                          const std::vector<ck::index_t>& conv_strides,
+                          const std::vector<ck::index_t>& conv_dilations,
+                          const std::vector<ck::index_t>& in_left_pads,
+                          const InElementwiseOperation& in_element_op,
+                          const WeiElementwiseOperation& wei_element_op,
+                          const OutElementwiseOperation& out_element_op,
+                          std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    // upper bound on the memory taken by the partial sums
+    constexpr std::size_t max_partial_bytes = std::size_t{1} << 28;
+
+    const ConvGemmShape shape{
+        in.mDesc, wei.mDesc, out.mDesc, conv_strides, conv_dilations, in_left_pads};
+
+    const std::size_t M = shape.K_;
+    const std::size_t N = shape.C_ * shape.GetFilterSpatialSize();
+    const std::size_t K = shape.GetOutputSpatialSize();
+
+    const InDataType* p_in   = in.mData.data();
+    WeiDataType* p_wei       = wei.mData.data();
+    const OutDataType* p_out = out.mData.data();
+
+    std::size_t num_group = std::max<std::size_t>(
+        std::min({shape.N_, num_thread, max_partial_bytes / (sizeof(float) * M * N + 1)}), 1);
+
+    if(num_group < num_thread)
+        num_group = 1;
+
+    // a single group runs outside any parallel region, so its GEMMs can use all threads
+    const std::size_t num_gemm_thread = num_group == 1 ? num_thread : 1;
+
+    std::vector<float> partial(num_group * M * N, 0.f);
+
+    auto f_group = [&](std::size_t g) {
+        float* p_partial = partial.data() + g * M * N;
+
+        for(std::size_t n = shape.N_ * g / num_group; n < shape.N_ * (g + 1) / num_group; ++n)
+        {
+            const InDataType* p_in_n   = p_in + n * shape.in_n_stride_;
+            const OutDataType* p_out_n = p_out + n * shape.out_n_stride_;
+
+            auto fill_a =
+                [&](std::size_t i_begin, std::size_t i_count, float* dst, std::size_t ld) {
+                    for(std::size_t i = 0; i < i_count; ++i)
+                    {
+                        const OutDataType* p_out_k = p_out_n + (i_begin + i) * shape.out_k_stride_;
+
+                        float* p_dst = dst + i;
+
+                        shape.ForEachOutputPoint([&](std::size_t offset) {
+                            float v_out;
+
+                            out_element_op(v_out, ck::type_convert<float>(p_out_k[offset]));
+
+                            *p_dst = v_out;
+                            p_dst += ld;
+                        });
+                    }
+                };
+
+            auto fill_b =
+                [&](std::size_t j_begin, std::size_t j_count, float* dst, std::size_t ld) {
+                    for(std::size_t j = 0; j < j_count; ++j)
+                    {
+                        ConvGemmShape::SpatialLengths t;
+
+                        const std::size_t c = shape.DecodeFilterIndex(j_begin + j, t);
+
+                        const InDataType* p_in_c = p_in_n + c * shape.in_c_stride_;
+
+                        float* p_dst = dst + j;
+
+                        shape.ForEachOutputPointInputTap(t, [&](ck::long_index_t offset) {
+                            float v_in = 0;
+
+                            if(offset >= 0)
+                                in_element_op(v_in, ck::type_convert<float>(p_in_c[offset]));
+
+                            *p_dst = v_in;
+                            p_dst += ld;
+                        });
+                    }
+                };
+
+            auto store_c =
+                [&](std::size_t i, std::size_t j_begin, std::size_t j_count, const float* src) {
+                    float* p_dst = p_partial + i * N + j_begin;
+
+                    for(std::size_t j = 0; j < j_count; ++j)
+                        p_dst[j] += src[j];
+                };
+
+            // every element of the partial sum is stored by one tile, so threads never race
+            ck::host_gemm::blocked_gemm(M, N, K, fill_a, fill_b, store_c, num_gemm_thread);
+        }
+    };
+
+    if(num_group == 1)
+        f_group(0);
+    else
+        make_ParallelTensorFunctor(f_group, num_group)(num_group);
+
+    auto f_store = [&](auto k) {
+        for(std::size_t j = 0; j < N; ++j)
+        {
+            ConvGemmShape::SpatialLengths t;
+
+            const std::size_t c = shape.DecodeFilterIndex(j, t);
+
+            float v_acc = 0;
+
+            for(std::size_t g = 0; g < num_group; ++g)
+                v_acc += partial[(g * M + k) * N + j];
+
+            float v_wei;
+
+            wei_element_op(v_wei, v_acc);
+
+            p_wei[shape.GetWeightOffset(k, c, t)] = ck::type_convert<WeiDataType>(v_wei);
+        }
+    };
+
+    make_ParallelTensorFunctor(f_store, M)(num_thread);
+}
+
+} // namespace host_conv
+} // namespace ck
@@ -1,5 +1,6 @@
 #pragma once
 #include "host_tensor.hpp"
+#include "host_blocked_gemm.hpp"
 
 template <typename AType,
           typename BType,
@@ -14,30 +15,5 @@ void host_gemm_mk_kn_mn(const Tensor<AType>& a_m_k,
                         const BElementwiseOperation& b_element_op,
                         const CElementwiseOperation& c_element_op)
 {
-    auto f_mk_kn_mn = [&](auto m, auto n) {
-        const int K = a_m_k.mDesc.GetLengths()[1];
-
-        float v_acc = 0;
-
-        for(int k = 0; k < K; ++k)
-        {
-            float v_a;
-            float v_b;
-
-            a_element_op(v_a, static_cast<const float>(a_m_k(m, k)));
-            b_element_op(v_b, static_cast<const float>(b_k_n(k, n)));
-
-            v_acc += v_a * v_b;
-        }
-
-        float v_c;
-
-        c_element_op(v_c, v_acc);
-
-        c_m_n(m, n) = v_c;
-    };
-
-    make_ParallelTensorFunctor(f_mk_kn_mn,
-                               c_m_n.mDesc.GetLengths()[0],
-                               c_m_n.mDesc.GetLengths()[1])(std::thread::hardware_concurrency());
+    ck::host_gemm::blocked_gemm(a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op);
 }
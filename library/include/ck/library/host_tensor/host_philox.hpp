@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Counter-based random numbers for host tensor initialisation.
+//
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11) maps a
+// 64-bit key and a 128-bit counter to four random 32-bit words. Keying every value on
+// (seed, index) instead of drawing it from a sequential engine makes the generated data
+// independent of how the work is split between threads.
+struct Philox4x32
+{
+    using Counter = std::array<uint32_t, 4>;
+
+    static constexpr int NumRound = 10;
+
+    static constexpr uint32_t M0 = 0xD2511F53;
+    static constexpr uint32_t M1 = 0xCD9E8D57;
+    static constexpr uint32_t W0 = 0x9E3779B9;
+    static constexpr uint32_t W1 = 0xBB67AE85;
+
+    static Counter Generate(uint64_t key, Counter ctr)
+    {
+        uint32_t k0 = static_cast<uint32_t>(key);
+        uint32_t k1 = static_cast<uint32_t>(key >> 32);
+
+        for(int r = 0; r < NumRound; ++r)
+        {
+            const uint64_t p0 = uint64_t{M0} * ctr[0];
+            const uint64_t p1 = uint64_t{M1} * ctr[2];
+
+            ctr = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ k0,
+                   static_cast<uint32_t>(p1),
+                   static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ k1,
+                   static_cast<uint32_t>(p0)};
+
+            k0 += W0;
+            k1 += W1;
+        }
+
+        return ctr;
+    }
+
+    // Words [word_begin, word_begin + num_word) of the random stream (seed, stream): word i is
+    // lane i % 4 of the block generated for counter (i / 4, stream). word_begin and num_word must
+    // be multiples of 4. The blocks are computed lane-wise over all counters at once, so the
+    // rounds vectorise.
+    static void GenerateWords(uint64_t seed,
+                              uint32_t stream,
+                              std::size_t word_begin,
+                              std::size_t num_word,
+                              uint32_t* words)
+    {
+        constexpr std::size_t max_num_block = 64;
+
+        uint32_t x0[max_num_block], x1[max_num_block], x2[max_num_block], x3[max_num_block];
+
+        for(std::size_t b_begin = 0; b_begin < num_word / 4; b_begin += max_num_block)
+        {
+            const std::size_t num_block = std::min(max_num_block, num_word / 4 - b_begin);
+
+            for(std::size_t b = 0; b < num_block; ++b)
+            {
+                const uint64_t block = word_begin / 4 + b_begin + b;
+
+                x0[b] = static_cast<uint32_t>(block);
+                x1[b] = static_cast<uint32_t>(block >> 32);
+                x2[b] = stream;
+                x3[b] = 0;
+            }
+
+            uint32_t k0 = static_cast<uint32_t>(seed);
+            uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+
+            for(int r = 0; r < NumRound; ++r)
+            {
+                for(std::size_t b = 0; b < num_block; ++b)
+                {
+                    const uint64_t p0 = uint64_t{M0} * x0[b];
+                    const uint64_t p1 = uint64_t{M1} * x2[b];
+
+                    x0[b] = static_cast<uint32_t>(p1 >> 32) ^ x1[b] ^ k0;
+                    x1[b] = static_cast<uint32_t>(p1);
+                    x2[b] = static_cast<uint32_t>(p0 >> 32) ^ x3[b] ^ k1;
+                    x3[b] = static_cast<uint32_t>(p0);
+                }
+
+                k0 += W0;
+                k1 += W1;
+            }
+
+            uint32_t* p = words + 4 * b_begin;
+
+            for(std::size_t b = 0; b < num_block; ++b)
+            {
+                p[4 * b + 0] = x0[b];
+                p[4 * b + 1] = x1[b];
+                p[4 * b + 2] = x2[b];
+                p[4 * b + 3] = x3[b];
+            }
+        }
+    }
+
+    // Random block for a tensor element, keyed on its multi-index. Up to 4 indices form the
+    // counter directly, longer indices are chained through the key.
+    template <typename... Is>
+    static Counter GenerateFromIndex(uint64_t seed, Is... is)
+    {
+        const std::array<uint64_t, sizeof...(Is)> idx{{static_cast<uint64_t>(is)...}};
+
+        Counter ctr{0, 0, 0, 0};
+
+        for(std::size_t d = 0; d < idx.size(); ++d)
+        {
+            if(d > 0 && d % 4 == 0)
+            {
+                const Counter r = Generate(seed, ctr);
+
+                seed = (uint64_t{r[1]} << 32) | r[0];
+                ctr  = {0, 0, 0, 0};
+            }
+
+            ctr[d % 4] = static_cast<uint32_t>(idx[d]);
+        }
+
+        return Generate(seed, ctr);
+    }
+};
+
+// uniform in [0, 1), with 24 random bits so every value is exact in float
+inline float philox_to_uniform(uint32_t x) { return static_cast<float>(x >> 8) * 0x1p-24f; }
+
+// uniform in (0, 1], safe to take the logarithm of
+inline float philox_to_uniform_nonzero(uint32_t x)
+{
+    return static_cast<float>((x >> 8) + 1) * 0x1p-24f;
+}
+
+// uniform integer in [0, range), by multiply-shift
+inline uint32_t philox_to_integer(uint32_t x, uint32_t range)
+{
+    return static_cast<uint32_t>((uint64_t{x} * range) >> 32);
+}
+
+// Box-Muller transform of two words into two independent standard normal values
+inline void philox_to_normal(uint32_t x0, uint32_t x1, float& y0, float& y1)
+{
+    constexpr float two_pi = 6.283185307179586f;
+
+    const float r     = std::sqrt(-2.f * std::log(philox_to_uniform_nonzero(x0)));
+    const float theta = two_pi * philox_to_uniform(x1);
+
+    y0 = r * std::cos(theta);
+    y1 = r * std::sin(theta);
+}
+
+// Seeds handed out to generators that are not given one, so that tensors initialised with the
+// same kind of generator still differ from each other. The sequence only depends on the order in
+// which generators are created.
+inline uint64_t get_next_philox_seed()
+{
+    static std::atomic<uint64_t> seed{11939};
+
+    return seed++;
+}
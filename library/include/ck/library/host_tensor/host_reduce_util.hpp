@@ -26,15 +26,20 @@
 #ifndef GUARD_HOST_REDUCE_UTIL_HPP
 #define GUARD_HOST_REDUCE_UTIL_HPP
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <cmath>
 #include <cassert>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "reduction_enums.hpp"
 #include "data_type.hpp"
 #include "math_v2.hpp"
+#include "host_tensor.hpp"
 
 namespace ck {
 
@@ -252,6 +257,181 @@ binop_with_nan_check2(std::function<void(AccDataType&, AccDataType, bool&)> opRe
     };
 };
 
+// Compile-time counterpart of the helpers above, so that reduction loops can be inlined and
+// vectorised instead of calling through std::function for every element
+template <typename AccDataType, ReduceTensorOp ReduceOpId, bool PropagateNan>
+struct HostReduceOp
+{
+    static constexpr bool IsMinMax = ReduceOpId == ReduceTensorOp::MIN ||
+                                     ReduceOpId == ReduceTensorOp::MAX ||
+                                     ReduceOpId == ReduceTensorOp::AMAX;
+
+    static AccDataType GetIdentityValue() { return ReduceOpZeroVal<AccDataType, ReduceOpId>(); }
+
+    static void PreUnaryOp(AccDataType& a)
+    {
+        if constexpr(ReduceOpId == ReduceTensorOp::NORM1 || ReduceOpId == ReduceTensorOp::AMAX)
+            a = ck::math::abs(a);
+        else if constexpr(ReduceOpId == ReduceTensorOp::NORM2)
+            a = a * a;
+    }
+
+    static void PosUnaryOp(AccDataType& a, int32_t divider)
+    {
+        if constexpr(ReduceOpId == ReduceTensorOp::NORM2)
+            a = std::sqrt(a);
+        else if constexpr(ReduceOpId == ReduceTensorOp::AVG)
+            a = a / static_cast<AccDataType>(static_cast<float>(divider));
+    }
+
+    // a = op(a, b). Additions and multiplications propagate nan by themselves, min/max written as
+    // selects so that they vectorise.
+    static void Reduce(AccDataType& a, AccDataType b)
+    {
+        if constexpr(ReduceOpId == ReduceTensorOp::MUL)
+        {
+            a = a * b;
+        }
+        else if constexpr(IsMinMax)
+        {
+            AccDataType r;
+
+            if constexpr(ReduceOpId == ReduceTensorOp::MIN)
+                r = a > b ? b : a;
+            else
+                r = a < b ? b : a;
+
+            if constexpr(PropagateNan)
+                r = ck::math::isnan(b) ? b : r;
+
+            a = r;
+        }
+        else
+        {
+            a = a + b;
+        }
+    }
+
+    // a = op(a, b), also moving index ia to ib when b is selected; only min/max track indices
+    static void Reduce(AccDataType& a, AccDataType b, int32_t& ia, int32_t ib)
+    {
+        if constexpr(IsMinMax)
+        {
+            bool changed;
+
+            if constexpr(ReduceOpId == ReduceTensorOp::MIN)
+                changed = a > b;
+            else
+                changed = a < b;
+
+            if constexpr(PropagateNan)
+                changed = changed || ck::math::isnan(b);
+
+            if(changed)
+            {
+                a  = b;
+                ia = ib;
+            }
+        }
+        else
+        {
+            Reduce(a, b);
+        }
+    }
+};
+
+// Host counterpart of ck::reduce::Welford: the count, mean and m2 (sum of squared differences
+// from the mean) of the elements accumulated so far
+template <typename AccDataType>
+struct HostWelford
+{
+    AccDataType mean = 0;
+    AccDataType m2   = 0;
+    int64_t count    = 0;
+
+    void Update(AccDataType x)
+    {
+        count++;
+
+        const AccDataType delta = x - mean;
+
+        mean += delta / static_cast<AccDataType>(count);
+        m2 += delta * (x - mean);
+    }
+
+    // accumulates the elements of b, a disjoint set (Chan et al.)
+    void Merge(const HostWelford& b)
+    {
+        if(b.count == 0)
+            return;
+
+        const int64_t n           = count + b.count;
+        const AccDataType delta   = b.mean - mean;
+        const AccDataType ratio_b = static_cast<AccDataType>(b.count) / static_cast<AccDataType>(n);
+
+        mean += delta * ratio_b;
+        m2 += b.m2 + delta * delta * static_cast<AccDataType>(count) * ratio_b;
+        count = n;
+    }
+
+    // population variance
+    AccDataType GetVariance() const { return m2 / static_cast<AccDataType>(count); }
+};
+
+// Calls row(for_each_in_row) for each row of the reduction of `desc` over reduceDims, i.e. each
+// multi-index of its other dimensions, over at most num_thread threads. for_each_in_row(g) calls
+// g(idx) for the multi-index idx of each element of the row, in row-major order of reduceDims,
+// and may be called several times for several passes over the row.
+template <std::size_t Rank, typename Row>
+void for_each_reduce_row(const HostTensorDescriptor& desc,
+                         const std::vector<int>& reduceDims,
+                         Row row,
+                         std::size_t num_thread)
+{
+    using MultiIndex = std::array<std::size_t, Rank>;
+
+    MultiIndex invariant_lengths;
+    MultiIndex reduce_lengths;
+
+    std::size_t reduce_total_length = 1;
+
+    for(std::size_t d = 0; d < Rank; ++d)
+    {
+        const bool is_reduced = std::find(reduceDims.begin(), reduceDims.end(),
+                                          static_cast<int>(d)) != reduceDims.end();
+
+        invariant_lengths[d] = is_reduced ? 1 : desc.GetLengths()[d];
+        reduce_lengths[d]    = is_reduced ? desc.GetLengths()[d] : 1;
+
+        reduce_total_length *= reduce_lengths[d];
+    }
+
+    // the two multi-indices of an element add up to its multi-index in desc
+    const StaticHostTensorDescriptor<Rank> invariant_desc{invariant_lengths};
+    const StaticHostTensorDescriptor<Rank> reduce_desc{reduce_lengths};
+
+    auto f_invariant = [&](const MultiIndex& invariant_idx, std::size_t) {
+        row([&](auto g) {
+            MultiIndex reduce_idx{};
+            std::size_t reduce_offset = 0;
+
+            for(std::size_t i = 0; i < reduce_total_length; ++i)
+            {
+                MultiIndex idx;
+
+                for(std::size_t d = 0; d < Rank; ++d)
+                    idx[d] = invariant_idx[d] + reduce_idx[d];
+
+                g(static_cast<const MultiIndex&>(idx));
+
+                reduce_desc.MoveToNextMultiIndex(reduce_idx, reduce_offset);
+            }
+        });
+    };
+
+    invariant_desc.ForEachIndex(f_invariant, num_thread);
+}
+
 }; // namespace host_reduce
 
 static inline std::vector<int> to_int_vector(const std::vector<size_t>& inData)
@@ -27,9 +27,12 @@
 #ifndef HOST_REDUCTION_HPP_
 #define HOST_REDUCTION_HPP_
 
-#include <vector>
+#include <algorithm>
 #include <array>
-#include <functional>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 #include "reduction_enums.hpp"
 #include "reduction_common.hpp"
@@ -37,71 +40,186 @@
 #include "host_tensor.hpp"
 #include "data_type.hpp"
 
-template <int NDim>
-static void get_all_indexes(const std::array<size_t, NDim>& dimLengths,
-                            std::vector<std::array<size_t, NDim>>& indexes)
+// The invariant and reduced dimensions of a host reduction of the reduceDims of a strided tensor,
+// and the strided loops over them, with running offsets. Unless the order of the reduced elements
+// matters, the reduced dimensions are reordered so that the one with the smallest stride is
+// innermost.
+template <int Rank, int NumReduceDim>
+struct HostReductionLoops
 {
-    static_assert(NDim >= 1, "NDim >= 1 is required to use this function!");
+    static constexpr int NumInvariantDim = Rank - NumReduceDim;
+
+    std::vector<size_t> outStrides;
+    std::vector<int> invariantDims;
+    std::vector<int> reduceDims;
 
-    if constexpr(NDim == 1)
+    int32_t divider;
+    std::array<size_t, NumReduceDim> reduceLengths;
+    std::array<size_t, NumReduceDim> reduceStrides;
+    std::array<size_t, NumInvariantDim> invariantLengths;
+    std::array<size_t, NumInvariantDim> invariantStrides;
+
+    HostReductionLoops(HostTensorDescriptor& inDesc,
+                       HostTensorDescriptor& outDesc,
+                       const std::vector<int>& invariantDims_,
+                       const std::vector<int>& reduceDims_,
+                       bool keepReduceOrder)
     {
-        for(size_t i = 0; i < dimLengths[0]; i++)
+        this->outStrides = outDesc.GetStrides();
+
+        this->invariantDims = invariantDims_;
+        this->reduceDims    = reduceDims_;
+
+        int product = 1;
+
+        for(int i = 0; i < NumReduceDim; i++)
         {
-            std::array<size_t, 1> index{i};
+            reduceLengths[i] = inDesc.GetLengths()[reduceDims[i]];
+            reduceStrides[i] = inDesc.GetStrides()[reduceDims[i]];
+            product *= inDesc.GetLengths()[reduceDims[i]];
+        };
+
+        divider = product;
 
-            indexes.push_back(index);
+        for(int i = 0; i < NumInvariantDim; i++)
+        {
+            invariantLengths[i] = inDesc.GetLengths()[invariantDims[i]];
+            invariantStrides[i] = inDesc.GetStrides()[invariantDims[i]];
         };
+
+        if(!keepReduceOrder)
+        {
+            std::array<int, NumReduceDim> order;
+
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+                return reduceStrides[a] > reduceStrides[b];
+            });
+
+            const auto lengths = reduceLengths;
+            const auto strides = reduceStrides;
+
+            for(int i = 0; i < NumReduceDim; i++)
+            {
+                reduceLengths[i] = lengths[order[i]];
+                reduceStrides[i] = strides[order[i]];
+            }
+        }
+    };
+
+    size_t GetInvariantTotalLength() const
+    {
+        size_t num_invariant = 1;
+
+        for(int i = 0; i < NumInvariantDim; i++)
+            num_invariant *= invariantLengths[i];
+
+        return num_invariant;
     }
-    else
+
+    // Calls f(in_offset, out_offset) for the invariant indices [iw_begin, iw_end), flattened
+    template <typename Function>
+    void ForEachInvariant(size_t iw_begin, size_t iw_end, Function f) const
     {
-        std::array<size_t, NDim - 1> partial_dim_lengths;
+        std::array<size_t, NumInvariantDim> idx;
 
-        for(int i = 0; i < NDim - 1; i++)
-            partial_dim_lengths[i] = dimLengths[i + 1];
+        size_t in_offset  = 0;
+        size_t out_offset = 0;
 
-        std::vector<std::array<size_t, NDim - 1>> partial_indexes;
+        size_t iw_rest = iw_begin;
 
-        get_all_indexes<NDim - 1>(partial_dim_lengths, partial_indexes);
+        for(int i = NumInvariantDim - 1; i >= 0; i--)
+        {
+            idx[i] = iw_rest % invariantLengths[i];
+            iw_rest /= invariantLengths[i];
+
+            in_offset += idx[i] * invariantStrides[i];
+            out_offset += idx[i] * outStrides[i];
+        }
 
-        for(size_t i = 0; i < dimLengths[0]; i++)
-            for(const auto& index : partial_indexes)
+        for(size_t iw = iw_begin; iw < iw_end; ++iw)
+        {
+            f(in_offset, out_offset);
+
+            // move to the next invariant index
+            for(int i = NumInvariantDim - 1; i >= 0; i--)
             {
-                std::array<size_t, NDim> extIndex;
+                in_offset += invariantStrides[i];
+                out_offset += outStrides[i];
 
-                extIndex[0] = i;
+                if(++idx[i] < invariantLengths[i])
+                    break;
 
-                for(int k = 0; k < NDim - 1; k++)
-                    extIndex[k + 1] = index[k];
+                in_offset -= invariantLengths[i] * invariantStrides[i];
+                out_offset -= invariantLengths[i] * outStrides[i];
+                idx[i] = 0;
+            }
+        }
+    }
 
-                indexes.push_back(extIndex);
-            };
-    };
-};
+    // Calls row(offset, n, i_first) for the rows of the innermost reduced dimension holding the
+    // reduced elements [i_begin, i_end) (flattened, innermost reduced dimension fastest): the n
+    // elements at offset with stride reduceStrides[NumReduceDim - 1], the first being i_first
+    template <typename RowFunction>
+    void ForEachReduceRow(size_t i_begin, size_t i_end, RowFunction row) const
+    {
+        constexpr int Inner = NumReduceDim - 1;
 
-template <int NDim>
-static size_t get_offset_from_index(const std::array<size_t, NDim>& strides,
-                                    const std::array<size_t, NDim>& index)
-{
-    size_t offset = 0;
+        std::array<size_t, NumReduceDim> idx;
 
-    for(int i = 0; i < NDim; i++)
-        offset += strides[i] * index[i];
+        size_t offset = 0;
 
-    return (offset);
-};
+        size_t r = i_begin;
 
-template <int NDim>
-static size_t get_offset_from_index(const std::vector<size_t>& strides,
-                                    const std::array<size_t, NDim>& index)
-{
-    size_t offset = 0;
+        for(int i = Inner; i >= 0; i--)
+        {
+            idx[i] = r % reduceLengths[i];
+            r /= reduceLengths[i];
 
-    for(int i = 0; i < NDim; i++)
-        offset += strides[i] * index[i];
+            offset += idx[i] * reduceStrides[i];
+        }
+
+        for(size_t i = i_begin; i < i_end;)
+        {
+            const size_t n = std::min(reduceLengths[Inner] - idx[Inner], i_end - i);
 
-    return (offset);
+            row(offset, n, i);
+
+            i += n;
+
+            // move to the start of the next row
+            offset -= idx[Inner] * reduceStrides[Inner];
+            idx[Inner] = 0;
+
+            for(int d = Inner - 1; d >= 0; d--)
+            {
+                offset += reduceStrides[d];
+
+                if(++idx[d] < reduceLengths[d])
+                    break;
+
+                offset -= reduceLengths[d] * reduceStrides[d];
+                idx[d] = 0;
+            }
+        }
+    }
 };
 
+// Host reduction of the reduceDims of a strided tensor, e.g. the reference for the device
+// reductions.
+//
+// The reduced dimensions are walked as nested strided loops with running offsets, so no index
+// lists are materialised and no offset is recomputed per element. The innermost loop runs over
+// one contiguous row of the innermost reduced dimension; without index output it uses
+// independent partial results per lane so that it vectorises, and the reduced dimensions are
+// reordered so that the one with the smallest stride is innermost. With index output the
+// elements are visited in the original order, so the index is the flattened position in the
+// reduced dimensions (in reduceDims order) of the first min/max, or of the last NaN when NaN is
+// propagated.
+//
+// Output elements are computed in parallel. A reduction without invariant dimensions is split
+// into fixed-size chunks that are reduced in parallel and combined in chunk order, so the result
+// does not depend on the number of threads.
 template <typename InDataType,
           typename AccDataType,
           typename OutDataType,
@@ -110,297 +228,293 @@ template <typename InDataType,
           int NumReduceDim,
           bool PropagateNan,
           bool NeedIndices>
-struct ReductionHost
+struct ReductionHost : public HostReductionLoops<Rank, NumReduceDim>
 {
+    using Loops = HostReductionLoops<Rank, NumReduceDim>;
+
     using IndexDataType = int32_t;
 
-    static constexpr int NumInvariantDim = Rank - NumReduceDim;
+    using ReduceOp = ck::host_reduce::HostReduceOp<AccDataType, ReduceOpId, PropagateNan>;
 
-    std::vector<size_t> outStrides;
-    std::vector<int> invariantDims;
-    std::vector<int> reduceDims;
+    static constexpr int NumInvariantDim = Rank - NumReduceDim;
 
-    IndexDataType divider;
-    std::function<void(AccDataType&)> preUnaryOp;
-    std::function<void(AccDataType&)> posUnaryOp;
-    std::array<size_t, NumReduceDim> reduceLengths;
-    std::array<size_t, NumReduceDim> reduceStrides;
-    std::array<size_t, NumInvariantDim> invariantLengths;
-    std::array<size_t, NumInvariantDim> invariantStrides;
+    // lanes of the partial results in the innermost loop
+    static constexpr std::size_t NumLane = 8;
 
-    std::vector<std::array<size_t, NumReduceDim>> reduce_dim_indexes;
-    std::vector<std::array<size_t, NumInvariantDim>> invariant_dim_indexes;
+    // elements per chunk of a reduction without invariant dimensions
+    static constexpr std::size_t ChunkSize = std::size_t{1} << 16;
 
+    // the order of the reduced elements only matters for the index output
     ReductionHost(HostTensorDescriptor& inDesc,
                   HostTensorDescriptor& outDesc,
                   const std::vector<int>& invariantDims_,
                   const std::vector<int>& reduceDims_)
+        : Loops(inDesc, outDesc, invariantDims_, reduceDims_, NeedIndices)
     {
-        using ck::host_reduce::PosUnaryOpFn;
-        using ck::host_reduce::PreUnaryOpFn;
+    }
 
-        // this->outLengths = to_int_vector(outDesc.GetLengths());
-        this->outStrides = outDesc.GetStrides();
+    void Run(float alpha,
+             const InDataType* in_data,
+             float beta,
+             OutDataType* out_data,
+             [[maybe_unused]] IndexDataType* out_indices)
+    {
+        const IndexDataType divider = this->divider;
+        const size_t reduce_size    = static_cast<size_t>(divider);
 
-        this->invariantDims = invariantDims_;
-        this->reduceDims    = reduceDims_;
+        auto store = [&](AccDataType accuVal, IndexDataType accuIndex, size_t dst_offset) {
+            using ck::float_equal_one;
+            using ck::float_equal_zero;
+            using ck::type_convert;
 
-        int product = 1;
+            ReduceOp::PosUnaryOp(accuVal, divider);
 
-        for(int i = 0; i < NumReduceDim; i++)
-        {
-            reduceLengths[i] = inDesc.GetLengths()[reduceDims[i]];
-            reduceStrides[i] = inDesc.GetStrides()[reduceDims[i]];
-            product *= inDesc.GetLengths()[reduceDims[i]];
-        };
+            if(!float_equal_one{}(alpha))
+                accuVal *= type_convert<AccDataType>(alpha);
 
-        divider = product;
+            if(!float_equal_zero{}(beta))
+                accuVal += type_convert<AccDataType>(out_data[dst_offset]) *
+                           type_convert<AccDataType>(beta);
 
-        for(int i = 0; i < NumInvariantDim; i++)
-        {
-            invariantLengths[i] = inDesc.GetLengths()[invariantDims[i]];
-            invariantStrides[i] = inDesc.GetStrides()[invariantDims[i]];
-        };
+            out_data[dst_offset] = type_convert<OutDataType>(accuVal);
 
-        reduce_dim_indexes.clear();
-        get_all_indexes<NumReduceDim>(reduceLengths, reduce_dim_indexes);
+            if constexpr(NeedIndices)
+                out_indices[dst_offset] = accuIndex;
+        };
 
-        if constexpr(NumInvariantDim > 0)
+        if constexpr(NumInvariantDim == 0)
         {
-            invariant_dim_indexes.clear();
-            get_all_indexes<NumInvariantDim>(invariantLengths, invariant_dim_indexes);
-        };
+            const size_t num_chunk = (reduce_size + ChunkSize - 1) / ChunkSize;
+
+            std::vector<AccDataType> chunk_vals(num_chunk, ReduceOp::GetIdentityValue());
+            std::vector<IndexDataType> chunk_indices(num_chunk, 0);
+
+            host_parallel_for(num_chunk,
+                              std::thread::hardware_concurrency(),
+                              [&](size_t ic_begin, size_t ic_end) {
+                                  for(size_t ic = ic_begin; ic < ic_end; ++ic)
+                                      ReduceRange(in_data,
+                                                  ic * ChunkSize,
+                                                  std::min((ic + 1) * ChunkSize, reduce_size),
+                                                  chunk_vals[ic],
+                                                  chunk_indices[ic]);
+                              });
+
+            AccDataType accuVal     = ReduceOp::GetIdentityValue();
+            IndexDataType accuIndex = 0;
 
-        preUnaryOp = PreUnaryOpFn<AccDataType, ReduceOpId>(divider);
-        posUnaryOp = PosUnaryOpFn<AccDataType, ReduceOpId>(divider);
-    };
+            for(size_t ic = 0; ic < num_chunk; ++ic)
+            {
+                if constexpr(NeedIndices)
+                    ReduceOp::Reduce(accuVal, chunk_vals[ic], accuIndex, chunk_indices[ic]);
+                else
+                    ReduceOp::Reduce(accuVal, chunk_vals[ic]);
+            }
 
-    void Run(float alpha,
-             const InDataType* in_data,
-             float beta,
-             OutDataType* out_data,
-             IndexDataType* out_indices)
-    {
-        if constexpr(NeedIndices)
-        {
-            RunImpl_with_index(alpha, in_data, beta, out_data, out_indices);
+            store(accuVal, accuIndex, 0);
         }
         else
         {
-            RunImpl_no_index(alpha, in_data, beta, out_data);
+            auto reduce_one = [&](size_t in_offset, size_t out_offset) {
+                AccDataType accuVal     = ReduceOp::GetIdentityValue();
+                IndexDataType accuIndex = 0;
+
+                ReduceRange(in_data + in_offset, 0, reduce_size, accuVal, accuIndex);
+
+                store(accuVal, accuIndex, out_offset);
+            };
+
+            host_parallel_for(this->GetInvariantTotalLength(),
+                              std::thread::hardware_concurrency(),
+                              [&](size_t iw_begin, size_t iw_end) {
+                                  this->ForEachInvariant(iw_begin, iw_end, reduce_one);
+                              });
         };
     };
 
-    void RunImpl_with_index(float alpha,
-                            const InDataType* in_data,
-                            float beta,
-                            OutDataType* out_data,
-                            IndexDataType* out_indices)
+    // Reduce the reduced elements [i_begin, i_end) (flattened, innermost reduced dimension
+    // fastest) at in_data into accuVal/accuIndex
+    void ReduceRange(const InDataType* in_data,
+                     size_t i_begin,
+                     size_t i_end,
+                     AccDataType& accuVal,
+                     IndexDataType& accuIndex) const
     {
-        using ck::float_equal_one;
-        using ck::float_equal_zero;
-        using ck::type_convert;
-        using ck::host_reduce::binop_with_nan_check2;
-        using ck::host_reduce::ReduceOpFn2;
-        using ck::host_reduce::ReduceOpZeroVal;
+        const size_t stride = this->reduceStrides[NumReduceDim - 1];
 
-        auto opReduce2 = ReduceOpFn2<AccDataType, ReduceOpId>();
+        this->ForEachReduceRow(i_begin, i_end, [&](size_t offset, size_t n, size_t i_first) {
+            ReduceRow(in_data + offset, n, stride, i_first, accuVal, accuIndex);
+        });
+    }
 
-        if constexpr(NumInvariantDim == 0)
-        {
-            AccDataType accuVal     = ReduceOpZeroVal<AccDataType, ReduceOpId>();
-            IndexDataType accuIndex = 0;
+    static void ReduceRow(const InDataType* in_data,
+                          size_t n,
+                          size_t stride,
+                          size_t i_first,
+                          AccDataType& accuVal,
+                          IndexDataType& accuIndex)
+    {
+        using ck::type_convert;
 
-            for(IndexDataType i = 0; i < ck::type_convert<IndexDataType>(reduce_dim_indexes.size());
-                i++)
+        if constexpr(NeedIndices)
+        {
+            for(size_t i = 0; i < n; i++)
             {
-                auto offset_reduce =
-                    get_offset_from_index<NumReduceDim>(reduceStrides, reduce_dim_indexes[i]);
+                auto currVal = type_convert<AccDataType>(in_data[i * stride]);
 
-                auto currVal = type_convert<AccDataType>(in_data[offset_reduce]);
+                ReduceOp::PreUnaryOp(currVal);
 
-                preUnaryOp(currVal);
-
-                auto currIndex = i;
-
-                binop_with_nan_check2<AccDataType, PropagateNan>(
-                    opReduce2, accuVal, currVal, accuIndex, currIndex);
-            };
-
-            posUnaryOp(accuVal);
-
-            if(!float_equal_one{}(alpha))
-                accuVal *= type_convert<AccDataType>(alpha);
-
-            if(!float_equal_zero{}(beta))
-                accuVal += type_convert<AccDataType>(out_data[0]) * type_convert<AccDataType>(beta);
-
-            out_data[0]    = type_convert<OutDataType>(accuVal);
-            out_indices[0] = accuIndex;
+                ReduceOp::Reduce(
+                    accuVal, currVal, accuIndex, static_cast<IndexDataType>(i_first + i));
+            }
         }
         else
         {
-            auto thread_reduce_func = [&](auto invariant_index) {
-                AccDataType accuVal     = ReduceOpZeroVal<AccDataType, ReduceOpId>();
-                IndexDataType accuIndex = 0;
-
-                auto offset_invariant =
-                    get_offset_from_index<NumInvariantDim>(invariantStrides, invariant_index);
-
-                for(IndexDataType i = 0;
-                    i < ck::type_convert<IndexDataType>(reduce_dim_indexes.size());
-                    i++)
-                {
-                    auto offset_reduce =
-                        get_offset_from_index<NumReduceDim>(reduceStrides, reduce_dim_indexes[i]);
+            AccDataType lanes[NumLane];
 
-                    auto currVal =
-                        type_convert<AccDataType>(in_data[offset_invariant + offset_reduce]);
+            for(size_t l = 0; l < NumLane; l++)
+                lanes[l] = ReduceOp::GetIdentityValue();
 
-                    preUnaryOp(currVal);
+            size_t i = 0;
 
-                    auto currIndex = i;
+            for(; i + NumLane <= n; i += NumLane)
+            {
+                for(size_t l = 0; l < NumLane; l++)
+                {
+                    auto currVal = type_convert<AccDataType>(in_data[(i + l) * stride]);
 
-                    binop_with_nan_check2<AccDataType, PropagateNan>(
-                        opReduce2, accuVal, currVal, accuIndex, currIndex);
-                };
+                    ReduceOp::PreUnaryOp(currVal);
+                    ReduceOp::Reduce(lanes[l], currVal);
+                }
+            }
 
-                posUnaryOp(accuVal);
+            for(; i < n; i++)
+            {
+                auto currVal = type_convert<AccDataType>(in_data[i * stride]);
 
-                if(!float_equal_one{}(alpha))
-                    accuVal *= type_convert<AccDataType>(alpha);
+                ReduceOp::PreUnaryOp(currVal);
+                ReduceOp::Reduce(lanes[0], currVal);
+            }
 
-                auto dst_offset =
-                    get_offset_from_index<NumInvariantDim>(outStrides, invariant_index);
+            for(size_t l = 0; l < NumLane; l++)
+                ReduceOp::Reduce(accuVal, lanes[l]);
+        }
+    }
+};
 
-                if(!float_equal_zero{}(beta))
-                    accuVal += type_convert<AccDataType>(out_data[dst_offset]) *
-                               type_convert<AccDataType>(beta);
+// Host mean and (population) variance of the reduceDims of a strided tensor with Welford's
+// algorithm, e.g. the reference for DeviceWelford. Like ReductionHost it runs the innermost loop
+// over independent lanes and splits a reduction without invariant dimensions into chunks merged in
+// chunk order.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          int Rank,
+          int NumReduceDim>
+struct ReductionHostWelford : public HostReductionLoops<Rank, NumReduceDim>
+{
+    using Loops   = HostReductionLoops<Rank, NumReduceDim>;
+    using Welford = ck::host_reduce::HostWelford<AccDataType>;
 
-                out_data[dst_offset]    = type_convert<OutDataType>(accuVal);
-                out_indices[dst_offset] = accuIndex;
-            };
+    static constexpr int NumInvariantDim = Rank - NumReduceDim;
 
-            std::size_t num_thread = 1;
-            std::size_t work_per_thread =
-                (invariant_dim_indexes.size() + num_thread - 1) / num_thread;
+    // lanes of the partial results in the innermost loop
+    static constexpr std::size_t NumLane = 8;
 
-            std::vector<joinable_thread> threads(num_thread);
+    // elements per chunk of a reduction without invariant dimensions
+    static constexpr std::size_t ChunkSize = std::size_t{1} << 16;
 
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t iw_begin = it * work_per_thread;
-                std::size_t iw_end =
-                    std::min((it + 1) * work_per_thread, invariant_dim_indexes.size());
-
-                auto f = [=] {
-                    for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
-                    {
-                        thread_reduce_func(invariant_dim_indexes[iw]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
-        };
-    };
+    ReductionHostWelford(HostTensorDescriptor& inDesc,
+                         HostTensorDescriptor& outDesc,
+                         const std::vector<int>& invariantDims_,
+                         const std::vector<int>& reduceDims_)
+        : Loops(inDesc, outDesc, invariantDims_, reduceDims_, false)
+    {
+    }
 
-    void RunImpl_no_index(float alpha, const InDataType* in_data, float beta, OutDataType* out_data)
+    void Run(const InDataType* in_data, OutDataType* mean_data, OutDataType* var_data)
     {
-        using ck::float_equal_one;
-        using ck::float_equal_zero;
         using ck::type_convert;
-        using ck::host_reduce::binop_with_nan_check;
-        using ck::host_reduce::ReduceOpFn;
-        using ck::host_reduce::ReduceOpZeroVal;
 
-        auto opReduce = ReduceOpFn<AccDataType, ReduceOpId>();
+        const size_t reduce_size = static_cast<size_t>(this->divider);
+
+        auto store = [&](const Welford& accu, size_t dst_offset) {
+            mean_data[dst_offset] = type_convert<OutDataType>(accu.mean);
+            var_data[dst_offset]  = type_convert<OutDataType>(accu.GetVariance());
+        };
 
         if constexpr(NumInvariantDim == 0)
         {
-            AccDataType accuVal = ReduceOpZeroVal<AccDataType, ReduceOpId>();
-
-            for(const auto& reduce_index : reduce_dim_indexes)
-            {
-                auto offset_reduce =
-                    get_offset_from_index<NumReduceDim>(reduceStrides, reduce_index);
-
-                auto currVal = type_convert<AccDataType>(in_data[offset_reduce]);
+            const size_t num_chunk = (reduce_size + ChunkSize - 1) / ChunkSize;
 
-                preUnaryOp(currVal);
+            std::vector<Welford> chunk_accus(num_chunk);
 
-                binop_with_nan_check<AccDataType, PropagateNan>(opReduce, accuVal, currVal);
-            };
+            host_parallel_for(num_chunk,
+                              std::thread::hardware_concurrency(),
+                              [&](size_t ic_begin, size_t ic_end) {
+                                  for(size_t ic = ic_begin; ic < ic_end; ++ic)
+                                      ReduceRange(in_data,
+                                                  ic * ChunkSize,
+                                                  std::min((ic + 1) * ChunkSize, reduce_size),
+                                                  chunk_accus[ic]);
+                              });
 
-            posUnaryOp(accuVal);
+            Welford accu;
 
-            if(!float_equal_one{}(alpha))
-                accuVal *= type_convert<AccDataType>(alpha);
-
-            if(!float_equal_zero{}(beta))
-                accuVal += type_convert<AccDataType>(out_data[0]) * type_convert<AccDataType>(beta);
+            for(size_t ic = 0; ic < num_chunk; ++ic)
+                accu.Merge(chunk_accus[ic]);
 
-            out_data[0] = type_convert<OutDataType>(accuVal);
+            store(accu, 0);
         }
         else
         {
-            auto thread_reduce_func = [&](auto invariant_index) {
-                AccDataType accuVal = ReduceOpZeroVal<AccDataType, ReduceOpId>();
+            auto reduce_one = [&](size_t in_offset, size_t out_offset) {
+                Welford accu;
 
-                auto offset_invariant =
-                    get_offset_from_index<NumInvariantDim>(invariantStrides, invariant_index);
+                ReduceRange(in_data + in_offset, 0, reduce_size, accu);
 
-                for(const auto& reduce_index : reduce_dim_indexes)
-                {
-                    auto offset_reduce =
-                        get_offset_from_index<NumReduceDim>(reduceStrides, reduce_index);
-
-                    auto currVal =
-                        type_convert<AccDataType>(in_data[offset_invariant + offset_reduce]);
-
-                    preUnaryOp(currVal);
+                store(accu, out_offset);
+            };
 
-                    binop_with_nan_check<AccDataType, PropagateNan>(opReduce, accuVal, currVal);
-                };
+            host_parallel_for(this->GetInvariantTotalLength(),
+                              std::thread::hardware_concurrency(),
+                              [&](size_t iw_begin, size_t iw_end) {
+                                  this->ForEachInvariant(iw_begin, iw_end, reduce_one);
+                              });
+        };
+    };
 
-                posUnaryOp(accuVal);
+    // Accumulate the reduced elements [i_begin, i_end) (flattened, innermost reduced dimension
+    // fastest) at in_data into accu
+    void ReduceRange(const InDataType* in_data, size_t i_begin, size_t i_end, Welford& accu) const
+    {
+        const size_t stride = this->reduceStrides[NumReduceDim - 1];
 
-                if(!float_equal_one{}(alpha))
-                    accuVal *= type_convert<AccDataType>(alpha);
+        this->ForEachReduceRow(i_begin, i_end, [&](size_t offset, size_t n, size_t) {
+            ReduceRow(in_data + offset, n, stride, accu);
+        });
+    }
 
-                auto dst_offset =
-                    get_offset_from_index<NumInvariantDim>(outStrides, invariant_index);
+    static void ReduceRow(const InDataType* in_data, size_t n, size_t stride, Welford& accu)
+    {
+        using ck::type_convert;
 
-                if(!float_equal_zero{}(beta))
-                    accuVal += type_convert<AccDataType>(out_data[dst_offset]) *
-                               type_convert<AccDataType>(beta);
+        Welford lanes[NumLane];
 
-                out_data[dst_offset] = type_convert<OutDataType>(accuVal);
-            };
+        size_t i = 0;
 
-            std::size_t num_thread = 1;
-            std::size_t work_per_thread =
-                (invariant_dim_indexes.size() + num_thread - 1) / num_thread;
+        for(; i + NumLane <= n; i += NumLane)
+        {
+            for(size_t l = 0; l < NumLane; l++)
+                lanes[l].Update(type_convert<AccDataType>(in_data[(i + l) * stride]));
+        }
 
-            std::vector<joinable_thread> threads(num_thread);
+        for(; i < n; i++)
+            lanes[0].Update(type_convert<AccDataType>(in_data[i * stride]));
 
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t iw_begin = it * work_per_thread;
-                std::size_t iw_end =
-                    std::min((it + 1) * work_per_thread, invariant_dim_indexes.size());
-
-                auto f = [=] {
-                    for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
-                    {
-                        thread_reduce_func(invariant_dim_indexes[iw]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
-        };
-    };
+        for(size_t l = 0; l < NumLane; l++)
+            accu.Merge(lanes[l]);
+    }
 };
 
 #endif
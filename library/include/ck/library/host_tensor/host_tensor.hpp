@@ -3,12 +3,16 @@
 
 #include <thread>
 #include <vector>
+#include <array>
 #include <numeric>
 #include <algorithm>
 #include <utility>
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 #include "data_type.hpp"
+#include "host_tensor_allocator.hpp"
+#include "host_thread_pool.hpp"
 
 template <typename Range>
 std::ostream& LogRange(std::ostream& os, Range&& range, std::string delim)
@@ -68,6 +72,9 @@ auto construct_f_unpack_args(F, T args)
     return construct_f_unpack_args_impl<F>(args, std::make_index_sequence<N>{});
 }
 
+template <std::size_t Rank>
+struct StaticHostTensorDescriptor;
+
 struct HostTensorDescriptor
 {
     HostTensorDescriptor() = delete;
@@ -92,6 +99,12 @@ struct HostTensorDescriptor
     {
     }
 
+    template <std::size_t Rank>
+    HostTensorDescriptor(const StaticHostTensorDescriptor<Rank>& desc)
+        : HostTensorDescriptor(desc.GetLengths(), desc.GetStrides())
+    {
+    }
+
     std::size_t GetNumOfDimension() const;
     std::size_t GetElementSize() const;
     std::size_t GetElementSpace() const;
@@ -103,17 +116,195 @@ struct HostTensorDescriptor
     std::size_t GetOffsetFromMultiIndex(Is... is) const
     {
         assert(sizeof...(Is) == this->GetNumOfDimension());
-        std::initializer_list<std::size_t> iss{static_cast<std::size_t>(is)...};
-        return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
+        return GetOffsetFromMultiIndexImpl(std::index_sequence_for<Is...>{}, is...);
     }
 
     friend std::ostream& operator<<(std::ostream& os, const HostTensorDescriptor& desc);
 
     private:
+    template <std::size_t... Ids, typename... Is>
+    std::size_t GetOffsetFromMultiIndexImpl(std::index_sequence<Ids...>, Is... is) const
+    {
+        const std::size_t* strides = mStrides.data();
+
+        return (std::size_t{0} + ... + (static_cast<std::size_t>(is) * strides[Ids]));
+    }
+
     std::vector<std::size_t> mLens;
     std::vector<std::size_t> mStrides;
 };
 
+// Step a row-major multi-index to the next element of a tensor with the given lengths
+template <std::size_t NDim>
+void MoveToNextMultiIndex(std::array<std::size_t, NDim>& idx,
+                          const std::array<std::size_t, NDim>& lens)
+{
+    for(std::size_t i = NDim; i-- > 0;)
+    {
+        if(++idx[i] < lens[i])
+            return;
+
+        idx[i] = 0;
+    }
+}
+
+// Static-rank counterpart of HostTensorDescriptor with inline storage. The rank is part of the
+// type, so offset computation and multi-index stepping unroll completely. It converts to and from
+// HostTensorDescriptor, which lets code holding a dynamic-rank Tensor<T> opt in locally, e.g.
+//
+//   const StaticHostTensorDescriptor<4> desc{tensor.mDesc};
+//   tensor.mData[desc.GetOffsetFromMultiIndex(n, c, h, w)];
+template <std::size_t Rank>
+struct StaticHostTensorDescriptor
+{
+    static_assert(Rank > 0, "wrong! rank should be positive");
+
+    using MultiIndex = std::array<std::size_t, Rank>;
+
+    StaticHostTensorDescriptor() = delete;
+
+    template <typename X>
+    StaticHostTensorDescriptor(const std::vector<X>& lens)
+    {
+        if(lens.size() != Rank)
+            throw std::runtime_error("wrong! number of lengths does not match rank");
+
+        std::copy(lens.begin(), lens.end(), mLens.begin());
+
+        this->CalculateStrides();
+    }
+
+    template <typename X, typename Y>
+    StaticHostTensorDescriptor(const std::vector<X>& lens, const std::vector<Y>& strides)
+    {
+        if(lens.size() != Rank || strides.size() != Rank)
+            throw std::runtime_error("wrong! number of lengths/strides does not match rank");
+
+        std::copy(lens.begin(), lens.end(), mLens.begin());
+        std::copy(strides.begin(), strides.end(), mStrides.begin());
+    }
+
+    StaticHostTensorDescriptor(const MultiIndex& lens) : mLens(lens) { this->CalculateStrides(); }
+
+    StaticHostTensorDescriptor(const MultiIndex& lens, const MultiIndex& strides)
+        : mLens(lens), mStrides(strides)
+    {
+    }
+
+    explicit StaticHostTensorDescriptor(const HostTensorDescriptor& desc)
+        : StaticHostTensorDescriptor(desc.GetLengths(), desc.GetStrides())
+    {
+    }
+
+    void CalculateStrides()
+    {
+        mStrides.back() = 1;
+        std::partial_sum(mLens.rbegin(),
+                         mLens.rend() - 1,
+                         mStrides.rbegin() + 1,
+                         std::multiplies<std::size_t>());
+    }
+
+    static constexpr std::size_t GetNumOfDimension() { return Rank; }
+
+    std::size_t GetElementSize() const
+    {
+        return std::accumulate(
+            mLens.begin(), mLens.end(), std::size_t{1}, std::multiplies<std::size_t>());
+    }
+
+    std::size_t GetElementSpace() const
+    {
+        std::size_t space = 1;
+
+        for(std::size_t i = 0; i < Rank; ++i)
+            space += (mLens[i] - 1) * mStrides[i];
+
+        return space;
+    }
+
+    const MultiIndex& GetLengths() const { return mLens; }
+    const MultiIndex& GetStrides() const { return mStrides; }
+
+    template <typename... Is>
+    std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        static_assert(sizeof...(Is) == Rank, "wrong! number of indices does not match rank");
+
+        return GetOffsetFromMultiIndexImpl(std::make_index_sequence<Rank>{},
+                                           static_cast<std::size_t>(is)...);
+    }
+
+    std::size_t GetOffsetFromMultiIndex(const MultiIndex& idx) const
+    {
+        return call_f_unpack_args(
+            [&](auto... is) { return this->GetOffsetFromMultiIndex(is...); }, idx);
+    }
+
+    // row-major multi-index of the i-th element
+    MultiIndex GetMultiIndex(std::size_t i) const
+    {
+        MultiIndex idx;
+
+        for(std::size_t d = Rank; d-- > 0;)
+        {
+            idx[d] = i % mLens[d];
+            i /= mLens[d];
+        }
+
+        return idx;
+    }
+
+    // Step idx to the next element in row-major order and update its offset by carrying, instead
+    // of recomputing the offset from scratch
+    void MoveToNextMultiIndex(MultiIndex& idx, std::size_t& offset) const
+    {
+        for(std::size_t d = Rank; d-- > 0;)
+        {
+            offset += mStrides[d];
+
+            if(++idx[d] < mLens[d])
+                return;
+
+            offset -= idx[d] * mStrides[d];
+            idx[d] = 0;
+        }
+    }
+
+    // Call f(idx, offset) for every element, splitting the elements over at most num_thread threads
+    template <typename F>
+    void ForEachIndex(F f, std::size_t num_thread = 1) const
+    {
+        host_parallel_for(
+            this->GetElementSize(), num_thread, [&](std::size_t i_begin, std::size_t i_end) {
+                MultiIndex idx     = this->GetMultiIndex(i_begin);
+                std::size_t offset = this->GetOffsetFromMultiIndex(idx);
+
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                {
+                    f(static_cast<const MultiIndex&>(idx), offset);
+
+                    this->MoveToNextMultiIndex(idx, offset);
+                }
+            });
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const StaticHostTensorDescriptor& desc)
+    {
+        return os << HostTensorDescriptor{desc};
+    }
+
+    private:
+    template <std::size_t... Ids, typename... Is>
+    std::size_t GetOffsetFromMultiIndexImpl(std::index_sequence<Ids...>, Is... is) const
+    {
+        return (std::size_t{0} + ... + (is * mStrides[Ids]));
+    }
+
+    MultiIndex mLens;
+    MultiIndex mStrides;
+};
+
 struct joinable_thread : std::thread
 {
     template <typename... Xs>
@@ -163,25 +354,18 @@ struct ParallelTensorFunctor
         return indices;
     }
 
+    // runs on the persistent HostThreadPool; num_thread is an upper bound on the threads used
     void operator()(std::size_t num_thread = 1) const
     {
-        std::size_t work_per_thread = (mN1d + num_thread - 1) / num_thread;
-
-        std::vector<joinable_thread> threads(num_thread);
-
-        for(std::size_t it = 0; it < num_thread; ++it)
-        {
-            std::size_t iw_begin = it * work_per_thread;
-            std::size_t iw_end   = std::min((it + 1) * work_per_thread, mN1d);
-
-            auto f = [=] {
-                for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
-                {
-                    call_f_unpack_args(mF, GetNdIndices(iw));
-                }
-            };
-            threads[it] = joinable_thread(f);
-        }
+        host_parallel_for(mN1d, num_thread, [&](std::size_t iw_begin, std::size_t iw_end) {
+            auto indices = GetNdIndices(iw_begin);
+
+            for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+            {
+                call_f_unpack_args(mF, indices);
+                MoveToNextMultiIndex(indices, mLens);
+            }
+        });
     }
 };
 
@@ -191,26 +375,132 @@ auto make_ParallelTensorFunctor(F f, Xs... xs)
     return ParallelTensorFunctor<F, Xs...>(f, xs...);
 }
 
-template <typename T>
+// rank of Tensor<T>, whose rank is only known at run time
+inline constexpr std::size_t DynamicRank = static_cast<std::size_t>(-1);
+
+// Tensor<T, Rank> stores its shape in a StaticHostTensorDescriptor<Rank>; plain Tensor<T> keeps the
+// dynamic-rank HostTensorDescriptor
+template <typename T, std::size_t Rank = DynamicRank>
 struct Tensor
+{
+    using Descriptor = StaticHostTensorDescriptor<Rank>;
+    using MultiIndex = typename Descriptor::MultiIndex;
+
+    template <typename X>
+    Tensor(std::initializer_list<X> lens)
+        : mDesc(std::vector<X>(lens)), mData(mDesc.GetElementSpace())
+    {
+        host_tensor_value_init(mData);
+    }
+
+    template <typename X>
+    Tensor(const std::vector<X>& lens) : mDesc(lens), mData(mDesc.GetElementSpace())
+    {
+        host_tensor_value_init(mData);
+    }
+
+    template <typename X, typename Y>
+    Tensor(const std::vector<X>& lens, const std::vector<Y>& strides)
+        : mDesc(lens, strides), mData(mDesc.GetElementSpace())
+    {
+        host_tensor_value_init(mData);
+    }
+
+    Tensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpace())
+    {
+        host_tensor_value_init(mData);
+    }
+
+    // leaves the data uninitialised, for tensors that are fully overwritten right away
+    Tensor(const Descriptor& desc, HostTensorNoInit) : mDesc(desc), mData(mDesc.GetElementSpace())
+    {
+    }
+
+    explicit Tensor(const HostTensorDescriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpace())
+    {
+        host_tensor_value_init(mData);
+    }
+
+    explicit Tensor(const Tensor<T>& other) : mDesc(other.mDesc), mData(other.mData) {}
+
+    template <typename G>
+    void GenerateTensorValue(G g, std::size_t num_thread = 1)
+    {
+        mDesc.ForEachIndex(
+            [&](const MultiIndex& idx, std::size_t offset) {
+                mData[offset] = call_f_unpack_args(g, idx);
+            },
+            num_thread);
+    }
+
+    template <typename... Is>
+    T& operator()(Is... is)
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    template <typename... Is>
+    const T& operator()(Is... is) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    T& operator()(const MultiIndex& idx) { return mData[mDesc.GetOffsetFromMultiIndex(idx)]; }
+
+    const T& operator()(const MultiIndex& idx) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    typename HostTensorBuffer<T>::iterator begin() { return mData.begin(); }
+
+    typename HostTensorBuffer<T>::iterator end() { return mData.end(); }
+
+    typename HostTensorBuffer<T>::const_iterator begin() const { return mData.begin(); }
+
+    typename HostTensorBuffer<T>::const_iterator end() const { return mData.end(); }
+
+    Descriptor mDesc;
+    HostTensorBuffer<T> mData;
+};
+
+template <typename T>
+struct Tensor<T, DynamicRank>
 {
     template <typename X>
     Tensor(std::initializer_list<X> lens) : mDesc(lens), mData(mDesc.GetElementSpace())
     {
+        host_tensor_value_init(mData);
     }
 
     template <typename X>
     Tensor(std::vector<X> lens) : mDesc(lens), mData(mDesc.GetElementSpace())
     {
+        host_tensor_value_init(mData);
     }
 
     template <typename X, typename Y>
     Tensor(std::vector<X> lens, std::vector<Y> strides)
         : mDesc(lens, strides), mData(mDesc.GetElementSpace())
     {
+        host_tensor_value_init(mData);
+    }
+
+    Tensor(const HostTensorDescriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpace())
+    {
+        host_tensor_value_init(mData);
     }
 
-    Tensor(const HostTensorDescriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpace()) {}
+    // leaves the data uninitialised, for tensors that are fully overwritten right away
+    Tensor(const HostTensorDescriptor& desc, HostTensorNoInit)
+        : mDesc(desc), mData(mDesc.GetElementSpace())
+    {
+    }
+
+    template <std::size_t Rank>
+    explicit Tensor(const Tensor<T, Rank>& other) : mDesc(other.mDesc), mData(other.mData)
+    {
+    }
 
     template <typename G>
     void GenerateTensorValue(G g, std::size_t num_thread = 1)
@@ -272,16 +562,16 @@ struct Tensor
         return mData[mDesc.GetOffsetFromMultiIndex(is...)];
     }
 
-    typename std::vector<T>::iterator begin() { return mData.begin(); }
+    typename HostTensorBuffer<T>::iterator begin() { return mData.begin(); }
 
-    typename std::vector<T>::iterator end() { return mData.end(); }
+    typename HostTensorBuffer<T>::iterator end() { return mData.end(); }
 
-    typename std::vector<T>::const_iterator begin() const { return mData.begin(); }
+    typename HostTensorBuffer<T>::const_iterator begin() const { return mData.begin(); }
 
-    typename std::vector<T>::const_iterator end() const { return mData.end(); }
+    typename HostTensorBuffer<T>::const_iterator end() const { return mData.end(); }
 
     HostTensorDescriptor mDesc;
-    std::vector<T> mData;
+    HostTensorBuffer<T> mData;
 };
 
 template <typename X>
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "host_thread_pool.hpp"
+
+// Storage behind Tensor::mData.
+//
+// Buffers are 64-byte aligned. Buffers of at least HostTensorMemory::HugePageSize bytes are
+// aligned to that size and advised to use transparent huge pages (MADV_HUGEPAGE), unless the
+// CK_HOST_TENSOR_HUGEPAGE environment variable is set to 0.
+//
+// While a HostTensorArena::Scope is alive, released buffers are cached and handed out again to
+// later tensors of the same rounded size instead of going back to the system. This helps when
+// same-shaped tensors are created over and over, as the profiler does for every instance and
+// problem. The cache holds at most HostTensorArena::GetMaxCachedBytes() bytes, set by the
+// CK_HOST_TENSOR_CACHE_MB environment variable (default 2048), and releases the buffers cached
+// longest ago first, so sweeps over many shapes do not grow without bound.
+struct HostTensorMemory
+{
+    static constexpr std::size_t Alignment    = 64;
+    static constexpr std::size_t HugePageSize = std::size_t{2} << 20;
+
+    static void* Allocate(std::size_t num_bytes);
+    static void Deallocate(void* p, std::size_t num_bytes);
+};
+
+struct HostTensorArena
+{
+    // keeps released tensor buffers for reuse while alive, scopes may nest
+    struct Scope
+    {
+        Scope();
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    // bytes currently cached for reuse
+    static std::size_t GetNumCachedBytes();
+
+    // the most bytes the cache holds, releasing the buffers cached longest ago to stay below
+    static std::size_t GetMaxCachedBytes();
+    static void SetMaxCachedBytes(std::size_t max_num_bytes);
+
+    // number of allocations served from the cache since the process started
+    static std::size_t GetNumReusedAllocations();
+
+    // return every cached buffer to the system
+    static void Release();
+};
+
+// std::vector allocator for tensor data. Elements constructed without arguments are
+// default-initialised, so resizing a vector of arithmetic values leaves them uninitialised;
+// Tensor value-initialises its data explicitly unless it is constructed with HostTensorNoInit.
+template <typename T>
+struct HostTensorAllocator
+{
+    using value_type = T;
+
+    HostTensorAllocator() = default;
+
+    template <typename U>
+    HostTensorAllocator(const HostTensorAllocator<U>&)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        static_assert(alignof(T) <= HostTensorMemory::Alignment, "wrong! over-aligned type");
+
+        return static_cast<T*>(HostTensorMemory::Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) { HostTensorMemory::Deallocate(p, n * sizeof(T)); }
+
+    template <typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new(static_cast<void*>(p)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    bool operator==(const HostTensorAllocator<U>&) const
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const HostTensorAllocator<U>&) const
+    {
+        return false;
+    }
+};
+
+template <typename T>
+using HostTensorBuffer = std::vector<T, HostTensorAllocator<T>>;
+
+// tag selecting the constructors of Tensor that leave the data uninitialised
+struct HostTensorNoInit
+{
+};
+
+// Value-initialise freshly allocated tensor data. Zeroing is done in parallel, so on NUMA systems
+// the pages are also first touched by the threads that later generate and consume the data.
+template <typename T>
+void host_tensor_value_init(HostTensorBuffer<T>& data)
+{
+    if constexpr(std::is_trivially_default_constructible<T>::value)
+    {
+        // below this size zeroing is cheaper than waking up the pool
+        constexpr std::size_t parallel_min_bytes = std::size_t{1} << 20;
+        constexpr std::size_t chunk_bytes        = HostTensorMemory::HugePageSize;
+
+        const std::size_t num_bytes = data.size() * sizeof(T);
+        char* p                     = reinterpret_cast<char*>(data.data());
+
+        if(num_bytes < parallel_min_bytes)
+        {
+            std::memset(p, 0, num_bytes);
+            return;
+        }
+
+        const std::size_t num_chunk = (num_bytes + chunk_bytes - 1) / chunk_bytes;
+
+        host_parallel_for(num_chunk,
+                          std::thread::hardware_concurrency(),
+                          [&](std::size_t ic_begin, std::size_t ic_end) {
+                              const std::size_t begin = ic_begin * chunk_bytes;
+                              const std::size_t end   = std::min(ic_end * chunk_bytes, num_bytes);
+
+                              std::memset(p + begin, 0, end - begin);
+                          });
+    }
+    else
+    {
+        for(auto& v : data)
+            v = T{};
+    }
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_type.hpp"
+#include "host_tensor.hpp"
+
+// Self-describing binary tensor files.
+//
+// A file starts with a HostTensorFileHeader, followed by the lengths and strides of the tensor
+// (num_dim 64-bit values each) and a free-form tag string. The payload holds the whole element
+// space of the tensor and starts at an offset aligned to HostTensorFileHeader::PayloadAlignment,
+// so a read-only mapping of the file can be used as tensor data in place. All values are stored
+// in the byte order of the host that wrote the file.
+struct HostTensorFileHeader
+{
+    static constexpr char Magic[8]                = {'C', 'K', 'T', 'E', 'N', 'S', 'O', 'R'};
+    static constexpr uint32_t Version             = 1;
+    static constexpr std::size_t PayloadAlignment = 4096;
+    static constexpr std::size_t MaxNumDim        = 64;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t data_type;
+    uint32_t element_size;
+    uint32_t num_dim;
+    uint64_t tag_size;
+    uint64_t payload_offset;
+    uint64_t payload_size;
+};
+
+enum struct HostTensorDataType : uint32_t
+{
+    Float  = 1,
+    Double = 2,
+    Half   = 3,
+    BHalf  = 4,
+    Int8   = 5,
+    Int32  = 6,
+};
+
+template <typename T>
+struct HostTensorDataTypeOf;
+
+template <>
+struct HostTensorDataTypeOf<float>
+{
+    static constexpr HostTensorDataType value = HostTensorDataType::Float;
+};
+
+template <>
+struct HostTensorDataTypeOf<double>
+{
+    static constexpr HostTensorDataType value = HostTensorDataType::Double;
+};
+
+template <>
+struct HostTensorDataTypeOf<ck::half_t>
+{
+    static constexpr HostTensorDataType value = HostTensorDataType::Half;
+};
+
+template <>
+struct HostTensorDataTypeOf<ck::bhalf_t>
+{
+    static constexpr HostTensorDataType value = HostTensorDataType::BHalf;
+};
+
+template <>
+struct HostTensorDataTypeOf<int8_t>
+{
+    static constexpr HostTensorDataType value = HostTensorDataType::Int8;
+};
+
+template <>
+struct HostTensorDataTypeOf<int32_t>
+{
+    static constexpr HostTensorDataType value = HostTensorDataType::Int32;
+};
+
+const char* get_host_tensor_data_type_name(HostTensorDataType data_type);
+
+// Write the element space of a tensor to `path`. The file is written under a temporary name and
+// renamed into place, so concurrent readers see either the old or the complete new file. Throws
+// std::runtime_error if the file cannot be written.
+void write_host_tensor_file(const std::string& path,
+                            const HostTensorDescriptor& desc,
+                            HostTensorDataType data_type,
+                            std::size_t element_size,
+                            const void* data,
+                            const std::string& tag = "");
+
+template <typename T, std::size_t Rank>
+void write_host_tensor_file(const std::string& path,
+                            const Tensor<T, Rank>& tensor,
+                            const std::string& tag = "")
+{
+    write_host_tensor_file(path,
+                           HostTensorDescriptor(tensor.mDesc),
+                           HostTensorDataTypeOf<T>::value,
+                           sizeof(T),
+                           tensor.mData.data(),
+                           tag);
+}
+
+// Read-only mapping of a tensor file. The header is validated when the file is opened, a file
+// that is truncated or not a tensor file raises std::runtime_error.
+struct HostTensorFileMapping
+{
+    static std::shared_ptr<const HostTensorFileMapping> Open(const std::string& path);
+
+    const HostTensorDescriptor& GetDescriptor() const { return desc_; }
+    HostTensorDataType GetDataType() const { return data_type_; }
+    const std::string& GetTag() const { return tag_; }
+    const void* GetPayload() const { return static_cast<const char*>(address_) + payload_offset_; }
+
+    HostTensorFileMapping(const HostTensorFileMapping&) = delete;
+    HostTensorFileMapping& operator=(const HostTensorFileMapping&) = delete;
+
+    ~HostTensorFileMapping();
+
+    private:
+    HostTensorFileMapping(void* address,
+                          std::size_t num_byte,
+                          std::size_t payload_offset,
+                          HostTensorDescriptor desc,
+                          HostTensorDataType data_type,
+                          std::string tag);
+
+    void* address_;
+    std::size_t num_byte_;
+    std::size_t payload_offset_;
+    HostTensorDescriptor desc_;
+    HostTensorDataType data_type_;
+    std::string tag_;
+};
+
+// Read-only tensor that does not own its data, e.g. a tensor file mapped in place. mOwner keeps
+// the memory behind mData alive, it is empty for views of a Tensor.
+template <typename T>
+struct HostTensorView
+{
+    HostTensorView(const HostTensorDescriptor& desc,
+                   const T* data,
+                   std::shared_ptr<const void> owner = nullptr)
+        : mDesc(desc), mData(data), mOwner(std::move(owner))
+    {
+    }
+
+    template <std::size_t Rank>
+    explicit HostTensorView(const Tensor<T, Rank>& tensor)
+        : mDesc(tensor.mDesc), mData(tensor.mData.data())
+    {
+    }
+
+    template <typename... Is>
+    const T& operator()(Is... is) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    const T* begin() const { return mData; }
+    const T* end() const { return mData + mDesc.GetElementSpace(); }
+
+    HostTensorDescriptor mDesc;
+    const T* mData;
+    std::shared_ptr<const void> mOwner;
+};
+
+template <typename T>
+HostTensorView<T> make_host_tensor_view(std::shared_ptr<const HostTensorFileMapping> mapping)
+{
+    if(mapping->GetDataType() != HostTensorDataTypeOf<T>::value)
+    {
+        throw std::runtime_error(
+            std::string("wrong! tensor file holds ") +
+            get_host_tensor_data_type_name(mapping->GetDataType()) + " data, not " +
+            get_host_tensor_data_type_name(HostTensorDataTypeOf<T>::value));
+    }
+
+    const HostTensorDescriptor& desc = mapping->GetDescriptor();
+    const T* data                    = static_cast<const T*>(mapping->GetPayload());
+
+    return HostTensorView<T>(desc, data, mapping);
+}
+
+// map the tensor file at `path` without copying its payload
+template <typename T>
+HostTensorView<T> map_host_tensor_file(const std::string& path)
+{
+    return make_host_tensor_view<T>(HostTensorFileMapping::Open(path));
+}
+
+// 64-bit digest of a byte range. Chunks of the range are hashed in parallel and combined in
+// order, so the digest does not depend on the number of threads.
+uint64_t get_host_tensor_digest(const void* data, std::size_t num_byte);
+
+template <typename T, std::size_t Rank>
+uint64_t get_host_tensor_digest(const Tensor<T, Rank>& tensor)
+{
+    return get_host_tensor_digest(tensor.mData.data(), tensor.mData.size() * sizeof(T));
+}
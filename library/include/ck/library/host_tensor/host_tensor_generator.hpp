@@ -4,6 +4,7 @@
 #include <numeric>
 
 #include "config.hpp"
+#include "host_philox.hpp"
 
 template <typename T>
 struct GeneratorTensor_0
@@ -51,16 +52,22 @@ struct GeneratorTensor_1<int8_t>
     }
 };
 
+// GeneratorTensor_2/3 draw each value from Philox keyed on (seed, multi-index), so the values do
+// not depend on the number of threads generating them (see host_philox.hpp)
 template <typename T>
 struct GeneratorTensor_2
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = get_next_philox_seed();
 
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is... is)
     {
-        return static_cast<T>((std::rand() % (max_value - min_value)) + min_value);
+        const uint32_t x = Philox4x32::GenerateFromIndex(seed, is...)[0];
+
+        return static_cast<T>(static_cast<int>(philox_to_integer(x, max_value - min_value)) +
+                              min_value);
     }
 };
 
@@ -69,11 +76,14 @@ struct GeneratorTensor_2<ck::bhalf_t>
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = get_next_philox_seed();
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is... is)
     {
-        float tmp = (std::rand() % (max_value - min_value)) + min_value;
+        const uint32_t x = Philox4x32::GenerateFromIndex(seed, is...)[0];
+
+        float tmp = static_cast<int>(philox_to_integer(x, max_value - min_value)) + min_value;
         return ck::type_convert<ck::bhalf_t>(tmp);
     }
 };
@@ -83,11 +93,14 @@ struct GeneratorTensor_2<int8_t>
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = get_next_philox_seed();
 
     template <typename... Is>
-    int8_t operator()(Is...)
+    int8_t operator()(Is... is)
     {
-        return (std::rand() % (max_value - min_value)) + min_value;
+        const uint32_t x = Philox4x32::GenerateFromIndex(seed, is...)[0];
+
+        return static_cast<int>(philox_to_integer(x, max_value - min_value)) + min_value;
     }
 };
 
@@ -96,11 +109,12 @@ struct GeneratorTensor_3
 {
     float min_value = 0;
     float max_value = 1;
+    uint64_t seed   = get_next_philox_seed();
 
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is... is)
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
+        float tmp = philox_to_uniform(Philox4x32::GenerateFromIndex(seed, is...)[0]);
 
         return static_cast<T>(min_value + tmp * (max_value - min_value));
     }
@@ -111,11 +125,12 @@ struct GeneratorTensor_3<ck::bhalf_t>
 {
     float min_value = 0;
     float max_value = 1;
+    uint64_t seed   = get_next_philox_seed();
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is... is)
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
+        float tmp = philox_to_uniform(Philox4x32::GenerateFromIndex(seed, is...)[0]);
 
         float fp32_tmp = min_value + tmp * (max_value - min_value);
 
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+// Process-wide pool of persistent worker threads behind ParallelTensorFunctor and the other host
+// helpers (reference operators, tensor generators, host reductions).
+//
+// A parallel region splits [0, n) into one contiguous range per participating thread. Each thread
+// consumes its own range in chunks and, once it runs dry, steals the upper half of another
+// thread's remaining range, so unbalanced work (e.g. padded convolution borders) does not leave
+// threads idle. The calling thread takes part in the region.
+//
+// Parallel regions started from inside a parallel region run serially on the calling thread, so
+// nested helpers never oversubscribe or deadlock the pool. Regions started concurrently from
+// different external threads are serialised.
+//
+// The pool size defaults to std::thread::hardware_concurrency() and can be overridden with the
+// CK_HOST_NUM_THREADS environment variable, which is read once, when the pool is first used.
+struct HostThreadPool
+{
+    using RangeFunction = std::function<void(std::size_t, std::size_t)>;
+
+    static HostThreadPool& GetInstance();
+
+    // number of threads a parallel region can use, including the calling thread
+    std::size_t GetMaxNumThreads() const;
+
+    // Call f(begin, end) on disjoint ranges covering [0, n), using at most num_thread threads.
+    // The first exception thrown by f is rethrown on the calling thread.
+    void ParallelFor(std::size_t n, std::size_t num_thread, const RangeFunction& f);
+
+    static bool IsInParallelRegion();
+
+    HostThreadPool(const HostThreadPool&) = delete;
+    HostThreadPool& operator=(const HostThreadPool&) = delete;
+
+    ~HostThreadPool();
+
+    private:
+    explicit HostThreadPool(std::size_t max_num_thread);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+template <typename F>
+void host_parallel_for(std::size_t n, std::size_t num_thread, F&& f)
+{
+    HostThreadPool::GetInstance().ParallelFor(n, num_thread, std::forward<F>(f));
+}
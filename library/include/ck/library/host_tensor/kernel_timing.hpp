@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+#include "stream_config.hpp"
+
+// Statistics of the per-run times of a timed kernel, all times in ms.
+struct KernelTimingResult
+{
+    std::vector<float> samples; // in run order
+
+    float mean   = 0;
+    float min    = 0;
+    float median = 0;
+    float p90    = 0;
+    float p99    = 0;
+    float stddev = 0;
+
+    // samples further than 1.5 interquartile ranges outside the quartiles
+    int num_outlier = 0;
+};
+
+// The `p`-th percentile, 0 <= p <= 100, of ascending `sorted_samples`, interpolated linearly
+// between neighbouring ranks.
+float get_sorted_percentile(const std::vector<float>& sorted_samples, float p);
+
+KernelTimingResult get_kernel_timing_result(std::vector<float> samples);
+
+// Add the samples of a kernel to `result`, run by run, and update its statistics. Invokers that
+// launch several kernels with one StreamConfig thus report the times of the whole operation.
+// Samples of a different number of runs replace the previous ones.
+void add_kernel_timing_samples(KernelTimingResult& result, const std::vector<float>& samples);
+
+// The timing settings of StreamConfig taken from the environment: CK_TIMING_WARMUP,
+// CK_TIMING_REPEAT and CK_TIMING_FLUSH_CACHE. Unset variables keep the defaults.
+StreamConfig get_timing_stream_config(bool time_kernel, KernelTimingResult* result = nullptr);
+
+/**
+ * @brief      Run `launch` as the timing settings of `config` say.
+ *
+ *             `n_warmup_` untimed runs are followed by `n_repeat_` runs timed
+ *             one by one with `timer`. With `flush_cache_` set, `flush_cache`
+ *             runs before each timed run, outside of the timed region.
+ *
+ * @param      timer  Measures the runs between its Start() and Stop() calls,
+ *                    GetSamples() returns their times. KernelEventTimer times
+ *                    kernels with HIP events; tests pass a fake clock.
+ */
+template <typename Timer, typename Launch, typename FlushCache>
+std::vector<float> run_timed_repetitions(const StreamConfig& config,
+                                         Timer& timer,
+                                         Launch&& launch,
+                                         FlushCache&& flush_cache)
+{
+    for(int i = 0; i < config.n_warmup_; ++i)
+        launch();
+
+    for(int i = 0; i < config.n_repeat_; ++i)
+    {
+        if(config.flush_cache_)
+            flush_cache();
+
+        timer.Start();
+        launch();
+        timer.Stop();
+    }
+
+    return timer.GetSamples();
+}
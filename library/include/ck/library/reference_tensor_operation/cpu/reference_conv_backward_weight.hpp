@@ -4,12 +4,17 @@
 #include <sstream>
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "host_conv_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
 // out[N, K, Ho, Wo] = in[N, C, Hi, Wi] * wei[K, C, Y, X]
+//
+// Computes wei from in and out. Problems with at least GemmLoweringMinMacs multiply-accumulates
+// are lowered to per-image im2col^T GEMMs on the blocked CPU GEMM engine, reduced over N in
+// parallel (see host_conv_gemm.hpp); smaller ones use the direct loops.
 template <typename InDataType,
           typename WeiDataType,
           typename OutDataType,
@@ -60,12 +65,43 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         OutElementwiseOperation out_element_op_;
     };
 
+    // multiply-accumulate count from which Run() switches to the GEMM-lowered path
+    static constexpr std::size_t GemmLoweringMinMacs = std::size_t{1} << 20;
+
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvBwdWeight::Argument;
 
         float Run(const Argument& arg)
+        {
+            const std::size_t num_out = arg.output_.mDesc.GetElementSize();
+            const std::size_t num_wei = arg.weight_.mDesc.GetElementSize();
+            const std::size_t K       = arg.weight_.mDesc.GetLengths()[0];
+
+            // same number of multiply-accumulates as the forward convolution
+            if(K > 0 && num_out * (num_wei / K) >= GemmLoweringMinMacs)
+                return RunGemm(arg);
+
+            return RunNaive(arg);
+        }
+
+        float RunGemm(const Argument& arg)
+        {
+            ck::host_conv::conv_bwd_weight_gemm(arg.input_,
+                                                arg.weight_,
+                                                arg.output_,
+                                                arg.conv_strides_,
+                                                arg.conv_dilations_,
+                                                arg.in_left_pads_,
+                                                arg.in_element_op_,
+                                                arg.wei_element_op_,
+                                                arg.out_element_op_);
+
+            return 0;
+        }
+
+        float RunNaive(const Argument& arg)
         {
             if constexpr(NumDimSpatial == 1)
             {
@@ -7,6 +7,7 @@
 #include "stream_config.hpp"
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "host_conv_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -19,6 +20,11 @@ namespace host {
 //             counterparts for weight and output) as long as tensor descriptor
 //             lengths is in NCHW.
 //
+// @paragraph  Problems with at least GemmLoweringMinMacs multiply-accumulates
+//             are lowered to an implicit-im2col GEMM on the blocked CPU GEMM
+//             engine (see host_conv_gemm.hpp); smaller ones use the direct
+//             loops, which are cheaper to set up.
+//
 // @tparam     InDataType               Input tensor data type.
 // @tparam     WeiDataType              Weights tensor data type.
 // @tparam     OutDataType              Output tensor data type.
@@ -78,12 +84,60 @@ struct ReferenceConvFwd : public device::BaseOperator
         OutElementwiseOperation out_element_op_;
     };
 
+    // multiply-accumulate count from which Run() switches to the GEMM-lowered path
+    static constexpr std::size_t GemmLoweringMinMacs = std::size_t{1} << 20;
+
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvFwd::Argument;
 
         float Run(const Argument& arg)
         {
+            const std::size_t num_out = arg.output_.mDesc.GetElementSize();
+            const std::size_t num_wei = arg.weight_.mDesc.GetElementSize();
+            const std::size_t K       = arg.weight_.mDesc.GetLengths()[0];
+
+            // every output point accumulates the C * Z * Y * X weights of one output channel
+            if(K > 0 && num_out * (num_wei / K) >= GemmLoweringMinMacs)
+                return RunGemm(arg);
+
+            return RunNaive(arg);
+        }
+
+        float RunGemm(const Argument& arg)
+        {
+            ck::host_conv::conv_fwd_gemm(arg.input_,
+                                         arg.weight_,
+                                         arg.output_,
+                                         arg.conv_strides_,
+                                         arg.conv_dilations_,
+                                         arg.in_left_pads_,
+                                         arg.in_element_op_,
+                                         arg.wei_element_op_,
+                                         arg.out_element_op_);
+
+            return 0;
+        }
+
+        float RunNaive(const Argument& arg)
+        {
+            constexpr std::size_t NDim = NumDimSpatial + 2;
+
+            // rank-specialised views of the tensors, so element offsets are fully unrolled
+            const StaticHostTensorDescriptor<NDim> in_desc{arg.input_.mDesc};
+            const StaticHostTensorDescriptor<NDim> wei_desc{arg.weight_.mDesc};
+            const StaticHostTensorDescriptor<NDim> out_desc{arg.output_.mDesc};
+
+            auto input = [&](auto... is) -> const InDataType& {
+                return arg.input_.mData[in_desc.GetOffsetFromMultiIndex(is...)];
+            };
+            auto weight = [&](auto... is) -> const WeiDataType& {
+                return arg.weight_.mData[wei_desc.GetOffsetFromMultiIndex(is...)];
+            };
+            auto output = [&](auto... is) -> OutDataType& {
+                return arg.output_.mData[out_desc.GetOffsetFromMultiIndex(is...)];
+            };
+
             if constexpr(NumDimSpatial == 1)
             {
                 auto f_ncw = [&](auto n, auto k, auto wo) {
@@ -103,10 +157,9 @@ struct ReferenceConvFwd : public device::BaseOperator
                                 float v_in;
                                 float v_wei;
 
-                                arg.in_element_op_(v_in,
-                                                   ck::type_convert<float>(arg.input_(n, c, wi)));
+                                arg.in_element_op_(v_in, ck::type_convert<float>(input(n, c, wi)));
                                 arg.wei_element_op_(v_wei,
-                                                    ck::type_convert<float>(arg.weight_(k, c, x)));
+                                                    ck::type_convert<float>(weight(k, c, x)));
 
                                 v_acc += v_in * v_wei;
                             }
@@ -116,7 +169,7 @@ struct ReferenceConvFwd : public device::BaseOperator
                     float v_out;
 
                     arg.out_element_op_(v_out, v_acc);
-                    arg.output_(n, k, wo) = ck::type_convert<OutDataType>(v_out);
+                    output(n, k, wo) = ck::type_convert<OutDataType>(v_out);
                 };
 
                 make_ParallelTensorFunctor(f_ncw,
@@ -157,9 +210,9 @@ struct ReferenceConvFwd : public device::BaseOperator
                                     float v_wei;
 
                                     arg.in_element_op_(
-                                        v_in, ck::type_convert<float>(arg.input_(n, c, hi, wi)));
+                                        v_in, ck::type_convert<float>(input(n, c, hi, wi)));
                                     arg.wei_element_op_(
-                                        v_wei, ck::type_convert<float>(arg.weight_(k, c, y, x)));
+                                        v_wei, ck::type_convert<float>(weight(k, c, y, x)));
                                     v_acc += v_in * v_wei;
                                 }
                             }
@@ -169,7 +222,7 @@ struct ReferenceConvFwd : public device::BaseOperator
                     float v_out;
 
                     arg.out_element_op_(v_out, v_acc);
-                    arg.output_(n, k, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                    output(n, k, ho, wo) = ck::type_convert<OutDataType>(v_out);
                 };
 
                 make_ParallelTensorFunctor(f_nchw,
@@ -222,11 +275,10 @@ struct ReferenceConvFwd : public device::BaseOperator
                                         float v_wei;
 
                                         arg.in_element_op_(
-                                            v_in,
-                                            ck::type_convert<float>(arg.input_(n, c, di, hi, wi)));
+                                            v_in, ck::type_convert<float>(input(n, c, di, hi, wi)));
                                         arg.wei_element_op_(
                                             v_wei,
-                                            ck::type_convert<float>(arg.weight_(k, c, z, y, x)));
+                                            ck::type_convert<float>(weight(k, c, z, y, x)));
                                         v_acc += v_in * v_wei;
                                     }
                                 }
@@ -237,7 +289,7 @@ struct ReferenceConvFwd : public device::BaseOperator
                     float v_out;
 
                     arg.out_element_op_(v_out, v_acc);
-                    arg.output_(n, k, d_o, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                    output(n, k, d_o, ho, wo) = ck::type_convert<OutDataType>(v_out);
                 };
 
                 make_ParallelTensorFunctor(f_nchw,
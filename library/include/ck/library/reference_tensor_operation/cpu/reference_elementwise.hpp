@@ -0,0 +1,172 @@
+#pragma once
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "data_type.hpp"
+#include "device_base.hpp"
+#include "functional2.hpp"
+#include "functional4.hpp"
+#include "host_tensor.hpp"
+#include "statically_indexed_array.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Host counterpart of device::DeviceElementwise, on host buffers with the same lengths and
+// per-tensor strides, so it checks the device operation on any layout or broadcast.
+template <typename InDataTypeTuple,
+          typename OutDataTypeTuple,
+          typename ComputeDataType,
+          typename ElementwiseOperation>
+struct ReferenceElementwise : public device::BaseOperator
+{
+    static constexpr index_t NumInput  = InDataTypeTuple::Size();
+    static constexpr index_t NumOutput = OutDataTypeTuple::Size();
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const std::array<const void*, NumInput>& p_in,
+                 const std::array<void*, NumOutput>& p_out,
+                 const std::vector<index_t>& lengths,
+                 const std::array<std::vector<index_t>, NumInput>& in_strides,
+                 const std::array<std::vector<index_t>, NumOutput>& out_strides,
+                 ElementwiseOperation elementwise_op)
+            : p_in_{p_in},
+              p_out_{p_out},
+              lengths_{lengths},
+              in_strides_{in_strides},
+              out_strides_{out_strides},
+              elementwise_op_{elementwise_op}
+        {
+        }
+
+        std::array<const void*, NumInput> p_in_;
+        std::array<void*, NumOutput> p_out_;
+        std::vector<index_t> lengths_;
+        std::array<std::vector<index_t>, NumInput> in_strides_;
+        std::array<std::vector<index_t>, NumOutput> out_strides_;
+
+        ElementwiseOperation elementwise_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceElementwise::Argument;
+
+        static std::size_t GetOffset(const std::vector<index_t>& idx,
+                                     const std::vector<index_t>& strides)
+        {
+            std::size_t offset = 0;
+
+            for(std::size_t d = 0; d < idx.size(); ++d)
+                offset += static_cast<std::size_t>(idx[d]) * strides[d];
+
+            return offset;
+        }
+
+        float Run(const Argument& arg)
+        {
+            const std::size_t num_dim = arg.lengths_.size();
+
+            for(const auto length : arg.lengths_)
+                if(length == 0)
+                    return 0;
+
+            std::vector<index_t> idx(num_dim, 0);
+
+            for(;;)
+            {
+                StaticallyIndexedArray<ComputeDataType, NumInput> in_data;
+                StaticallyIndexedArray<ComputeDataType, NumOutput> out_data;
+
+                static_for<0, NumInput, 1>{}([&](auto I) {
+                    using DataType = remove_cvref_t<decltype(InDataTypeTuple{}[I])>;
+
+                    const auto* p_in = static_cast<const DataType*>(arg.p_in_[I]);
+
+                    in_data(I) = ck::type_convert<ComputeDataType>(
+                        p_in[GetOffset(idx, arg.in_strides_[I])]);
+                });
+
+                // out_0, out_1, ..., in_0, in_1, ...
+                unpack2(arg.elementwise_op_, out_data, in_data);
+
+                static_for<0, NumOutput, 1>{}([&](auto I) {
+                    using DataType = remove_cvref_t<decltype(OutDataTypeTuple{}[I])>;
+
+                    auto* p_out = static_cast<DataType*>(arg.p_out_[I]);
+
+                    p_out[GetOffset(idx, arg.out_strides_[I])] =
+                        ck::type_convert<DataType>(out_data[I]);
+                });
+
+                // next index, row-major
+                std::size_t d = num_dim;
+
+                while(d-- > 0)
+                {
+                    if(++idx[d] < arg.lengths_[d])
+                        break;
+
+                    idx[d] = 0;
+                }
+
+                if(d == static_cast<std::size_t>(-1))
+                    break;
+            }
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const std::array<const void*, NumInput>& p_in,
+                             const std::array<void*, NumOutput>& p_out,
+                             const std::vector<index_t>& lengths,
+                             const std::array<std::vector<index_t>, NumInput>& in_strides,
+                             const std::array<std::vector<index_t>, NumOutput>& out_strides,
+                             ElementwiseOperation elementwise_op)
+    {
+        return Argument{p_in, p_out, lengths, in_strides, out_strides, elementwise_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceElementwise"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -3,6 +3,7 @@
 #include <sstream>
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "host_blocked_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -50,32 +51,12 @@ struct ReferenceGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
-            auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
-
-                float v_acc = 0;
-
-                for(int k = 0; k < K; ++k)
-                {
-                    float v_a;
-                    float v_b;
-
-                    arg.a_element_op_(v_a, static_cast<const float>(arg.a_m_k_(m, k)));
-                    arg.b_element_op_(v_b, static_cast<const float>(arg.b_k_n_(k, n)));
-
-                    v_acc += v_a * v_b;
-                }
-
-                float v_c;
-
-                arg.c_element_op_(v_c, v_acc);
-
-                arg.c_m_n_(m, n) = v_c;
-            };
-
-            make_ParallelTensorFunctor(
-                f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
+            ck::host_gemm::blocked_gemm(arg.a_m_k_,
+                                        arg.b_k_n_,
+                                        arg.c_m_n_,
+                                        arg.a_element_op_,
+                                        arg.b_element_op_,
+                                        arg.c_element_op_);
 
             return 0;
         }
@@ -0,0 +1,155 @@
+#ifndef REFERENCE_LAYERNORM_HPP
+#define REFERENCE_LAYERNORM_HPP
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "device_base.hpp"
+#include "host_tensor.hpp"
+#include "host_reduce_util.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// y = (x - mean) / sqrt(variance + epsilon) * gamma + beta, the mean and (population) variance
+// taken over reduceDims in AccDataType. gamma and beta have the lengths of x, with stride 0 on
+// the dimensions they are broadcast along.
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename YDataType,
+          ck::index_t Rank>
+struct ReferenceLayernorm : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<XDataType>& x,
+                 const Tensor<GammaDataType>& gamma,
+                 const Tensor<BetaDataType>& beta,
+                 Tensor<YDataType>& y,
+                 std::vector<int> reduce_dims,
+                 AccDataType epsilon)
+            : x_{x}, gamma_{gamma}, beta_{beta}, y_{y}, reduce_dims_{reduce_dims}, epsilon_{epsilon}
+        {
+        }
+
+        const Tensor<XDataType>& x_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>& beta_;
+        Tensor<YDataType>& y_;
+
+        std::vector<int> reduce_dims_;
+        AccDataType epsilon_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceLayernorm::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const StaticHostTensorDescriptor<Rank> x_desc{arg.x_.mDesc};
+            const StaticHostTensorDescriptor<Rank> gamma_desc{arg.gamma_.mDesc};
+            const StaticHostTensorDescriptor<Rank> beta_desc{arg.beta_.mDesc};
+            const StaticHostTensorDescriptor<Rank> y_desc{arg.y_.mDesc};
+
+            auto get_x = [&](const auto& idx) {
+                return ck::type_convert<AccDataType>(
+                    arg.x_.mData[x_desc.GetOffsetFromMultiIndex(idx)]);
+            };
+
+            auto f_row = [&](auto for_each_in_row) {
+                AccDataType mean  = 0;
+                AccDataType var   = 0;
+                std::size_t count = 0;
+
+                for_each_in_row([&](const auto& idx) {
+                    mean += get_x(idx);
+                    count++;
+                });
+
+                mean /= static_cast<AccDataType>(count);
+
+                for_each_in_row([&](const auto& idx) {
+                    const AccDataType d = get_x(idx) - mean;
+
+                    var += d * d;
+                });
+
+                var /= static_cast<AccDataType>(count);
+
+                const AccDataType inv_std =
+                    static_cast<AccDataType>(1) / std::sqrt(var + arg.epsilon_);
+
+                for_each_in_row([&](const auto& idx) {
+                    const auto gamma = ck::type_convert<AccDataType>(
+                        arg.gamma_.mData[gamma_desc.GetOffsetFromMultiIndex(idx)]);
+                    const auto beta = ck::type_convert<AccDataType>(
+                        arg.beta_.mData[beta_desc.GetOffsetFromMultiIndex(idx)]);
+
+                    arg.y_.mData[y_desc.GetOffsetFromMultiIndex(idx)] =
+                        ck::type_convert<YDataType>((get_x(idx) - mean) * inv_std * gamma + beta);
+                });
+            };
+
+            host_reduce::for_each_reduce_row<Rank>(
+                arg.x_.mDesc, arg.reduce_dims_, f_row, std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<XDataType>& x,
+                             const Tensor<GammaDataType>& gamma,
+                             const Tensor<BetaDataType>& beta,
+                             Tensor<YDataType>& y,
+                             std::vector<int> reduce_dims,
+                             AccDataType epsilon)
+    {
+        return Argument{x, gamma, beta, y, reduce_dims, epsilon};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceLayernorm"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,270 @@
+#ifndef REFERENCE_POOL_BWD_HPP
+#define REFERENCE_POOL_BWD_HPP
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "device_base.hpp"
+#include "host_tensor.hpp"
+#include "reduction_enums.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// din[N, C, Xi...] = gradient of the pooling ReferencePoolFwd computes, given dout[N, C, Xo...],
+// with NumDimSpatial spatial dimensions and any layout.
+//
+// Each element of dout is scattered over its window: MIN/MAX/AMAX add it to the element the
+// forward pass selected, whose index in the window out_indices holds; AVG adds it, divided as in
+// the forward pass, to every element of the window inside the input. out_indices is not read for
+// AVG.
+template <ck::index_t NumDimSpatial,
+          typename DInDataType,
+          typename DOutDataType,
+          typename AccDataType,
+          ck::ReduceTensorOp ReduceOpId,
+          typename std::enable_if<NumDimSpatial >= 1 && NumDimSpatial <= 3, bool>::type = false>
+struct ReferencePoolBwd : public device::BaseOperator
+{
+    static_assert(ReduceOpId == ReduceTensorOp::AVG || ReduceOpId == ReduceTensorOp::MAX ||
+                      ReduceOpId == ReduceTensorOp::MIN || ReduceOpId == ReduceTensorOp::AMAX,
+                  "wrong! pooling is AVG, MAX, MIN or AMAX");
+
+    static constexpr bool UseIndices = ReduceOpId != ReduceTensorOp::AVG;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(Tensor<DInDataType>& din,
+                 const Tensor<DOutDataType>& dout,
+                 const Tensor<int32_t>& out_indices,
+                 std::vector<ck::index_t> window_spatial_lengths,
+                 std::vector<ck::index_t> window_strides,
+                 std::vector<ck::index_t> input_left_pads,
+                 std::vector<ck::index_t> input_right_pads,
+                 bool count_include_pad = true)
+            : din_{din},
+              dout_{dout},
+              out_indices_{out_indices},
+              window_spatial_lengths_{window_spatial_lengths},
+              window_strides_{window_strides},
+              in_left_pads_{input_left_pads},
+              in_right_pads_{input_right_pads},
+              count_include_pad_{count_include_pad}
+        {
+        }
+
+        Tensor<DInDataType>& din_;
+        const Tensor<DOutDataType>& dout_;
+        const Tensor<int32_t>& out_indices_;
+
+        std::vector<index_t> window_spatial_lengths_;
+        std::vector<index_t> window_strides_;
+        std::vector<index_t> in_left_pads_;
+        std::vector<index_t> in_right_pads_;
+
+        bool count_include_pad_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferencePoolBwd::Argument;
+
+        static constexpr std::size_t NumDim = NumDimSpatial + 2;
+
+        using SpatialIndex = std::array<std::size_t, NumDimSpatial>;
+
+        float Run(const Argument& arg)
+        {
+            const StaticHostTensorDescriptor<NumDim> din_desc{arg.din_.mDesc};
+            const StaticHostTensorDescriptor<NumDim> dout_desc{arg.dout_.mDesc};
+            // out_indices_ is not read for AVG
+            const StaticHostTensorDescriptor<NumDim> indices_desc{
+                UseIndices ? arg.out_indices_.mDesc : arg.dout_.mDesc};
+
+            SpatialIndex in_lengths;
+            SpatialIndex out_lengths;
+            SpatialIndex window_lengths;
+            std::size_t num_in_pixel  = 1;
+            std::size_t num_out_pixel = 1;
+            int32_t window_size       = 1;
+
+            for(std::size_t d = 0; d < NumDimSpatial; ++d)
+            {
+                in_lengths[d]     = din_desc.GetLengths()[d + 2];
+                out_lengths[d]    = dout_desc.GetLengths()[d + 2];
+                window_lengths[d] = arg.window_spatial_lengths_[d];
+
+                num_in_pixel *= in_lengths[d];
+                num_out_pixel *= out_lengths[d];
+                window_size *= arg.window_spatial_lengths_[d];
+            }
+
+            // offsets of the pixels of a [n, c] slice of din
+            const StaticHostTensorDescriptor<NumDimSpatial> in_pixel_desc{in_lengths};
+
+            // input pixel at y in the window of output pixel xo, if it is not padding
+            auto get_in_pixel =
+                [&](const SpatialIndex& xo, const SpatialIndex& y, SpatialIndex& xi) {
+                    for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                    {
+                        const auto x = ck::type_convert<ck::long_index_t>(
+                                           xo[d] * arg.window_strides_[d] + y[d]) -
+                                       arg.in_left_pads_[d];
+
+                        if(x < 0 || static_cast<std::size_t>(x) >= in_lengths[d])
+                            return false;
+
+                        xi[d] = static_cast<std::size_t>(x);
+                    }
+
+                    return true;
+                };
+
+            auto to_nc_index = [](std::size_t n, std::size_t c, const SpatialIndex& x) {
+                std::array<std::size_t, NumDim> idx{n, c};
+
+                std::copy(x.begin(), x.end(), idx.begin() + 2);
+
+                return idx;
+            };
+
+            // one thread per [n, c] slice, so the scatter needs no synchronization
+            auto f_nc = [&](auto n, auto c) {
+                std::vector<AccDataType> din_acc(num_in_pixel, 0);
+
+                SpatialIndex xo{};
+
+                for(std::size_t o = 0; o < num_out_pixel; ++o)
+                {
+                    const auto out_idx = to_nc_index(n, c, xo);
+
+                    const auto dout = ck::type_convert<AccDataType>(
+                        arg.dout_.mData[dout_desc.GetOffsetFromMultiIndex(out_idx)]);
+
+                    SpatialIndex y{};
+                    SpatialIndex xi;
+
+                    if constexpr(UseIndices)
+                    {
+                        // y from its index in the window, row-major
+                        auto k =
+                            arg.out_indices_.mData[indices_desc.GetOffsetFromMultiIndex(out_idx)];
+
+                        for(std::size_t d = NumDimSpatial; d-- > 0;)
+                        {
+                            y[d] = static_cast<std::size_t>(k) % window_lengths[d];
+                            k /= static_cast<int32_t>(window_lengths[d]);
+                        }
+
+                        if(get_in_pixel(xo, y, xi))
+                            din_acc[in_pixel_desc.GetOffsetFromMultiIndex(xi)] += dout;
+                    }
+                    else
+                    {
+                        int32_t num_in_element = 0;
+
+                        for(int32_t k = 0; k < window_size; ++k)
+                        {
+                            num_in_element += get_in_pixel(xo, y, xi) ? 1 : 0;
+
+                            MoveToNextMultiIndex(y, window_lengths);
+                        }
+
+                        const auto divider = ck::type_convert<AccDataType>(static_cast<float>(
+                            arg.count_include_pad_ ? window_size : num_in_element));
+
+                        for(int32_t k = 0; k < window_size; ++k)
+                        {
+                            if(get_in_pixel(xo, y, xi))
+                                din_acc[in_pixel_desc.GetOffsetFromMultiIndex(xi)] +=
+                                    dout / divider;
+
+                            MoveToNextMultiIndex(y, window_lengths);
+                        }
+                    }
+
+                    MoveToNextMultiIndex(xo, out_lengths);
+                }
+
+                SpatialIndex xi{};
+
+                for(std::size_t i = 0; i < num_in_pixel; ++i)
+                {
+                    arg.din_.mData[din_desc.GetOffsetFromMultiIndex(to_nc_index(n, c, xi))] =
+                        ck::type_convert<DInDataType>(din_acc[i]);
+
+                    MoveToNextMultiIndex(xi, in_lengths);
+                }
+            };
+
+            make_ParallelTensorFunctor(f_nc, din_desc.GetLengths()[0], din_desc.GetLengths()[1])(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(Tensor<DInDataType>& din,
+                             const Tensor<DOutDataType>& dout,
+                             const Tensor<int32_t>& out_indices,
+                             std::vector<ck::index_t> window_spatial_lengths,
+                             std::vector<ck::index_t> window_strides,
+                             std::vector<ck::index_t> input_left_pads,
+                             std::vector<ck::index_t> input_right_pads,
+                             bool count_include_pad = true)
+    {
+        return Argument{din,
+                        dout,
+                        out_indices,
+                        window_spatial_lengths,
+                        window_strides,
+                        input_left_pads,
+                        input_right_pads,
+                        count_include_pad};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferencePoolBwd"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
+#endif
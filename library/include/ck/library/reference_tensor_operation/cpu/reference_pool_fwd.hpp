@@ -0,0 +1,211 @@
+#ifndef REFERENCE_POOL_FWD_HPP
+#define REFERENCE_POOL_FWD_HPP
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "device_base.hpp"
+#include "host_reduce_util.hpp"
+#include "host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// out[N, C, Xo...] = reduction of in[N, C, Xi...] over the window of each output, skipping the
+// padding, with NumDimSpatial spatial dimensions and any layout.
+//
+// With NeedIndices, MIN/MAX/AMAX also write the index of the selected element in its window,
+// row-major over the window lengths, the first one among equal elements, as device pooling does.
+// AVG divides by the size of the window if count_include_pad, otherwise by the number of its
+// elements inside the input.
+template <ck::index_t NumDimSpatial,
+          typename InDataType,
+          typename OutDataType,
+          typename AccDataType,
+          ck::ReduceTensorOp ReduceOpId,
+          bool PropagateNan,
+          bool NeedIndices,
+          typename std::enable_if<NumDimSpatial >= 1 && NumDimSpatial <= 3, bool>::type = false>
+struct ReferencePoolFwd : public device::BaseOperator
+{
+    using ReduceOp = ck::host_reduce::HostReduceOp<AccDataType, ReduceOpId, PropagateNan>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& input,
+                 Tensor<OutDataType>& output,
+                 Tensor<int32_t>& output_indices,
+                 std::vector<ck::index_t> window_spatial_lengths,
+                 std::vector<ck::index_t> window_strides,
+                 std::vector<ck::index_t> input_left_pads,
+                 std::vector<ck::index_t> input_right_pads,
+                 bool count_include_pad = true)
+            : input_{input},
+              output_{output},
+              output_indices_{output_indices},
+              window_spatial_lengths_{window_spatial_lengths},
+              window_strides_{window_strides},
+              in_left_pads_{input_left_pads},
+              in_right_pads_{input_right_pads},
+              count_include_pad_{count_include_pad}
+        {
+        }
+
+        const Tensor<InDataType>& input_;
+        Tensor<OutDataType>& output_;
+        Tensor<int32_t>& output_indices_;
+
+        std::vector<index_t> window_spatial_lengths_;
+        std::vector<index_t> window_strides_;
+        std::vector<index_t> in_left_pads_;
+        std::vector<index_t> in_right_pads_;
+
+        bool count_include_pad_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferencePoolFwd::Argument;
+
+        static constexpr std::size_t NumDim = NumDimSpatial + 2;
+
+        float Run(const Argument& arg)
+        {
+            const StaticHostTensorDescriptor<NumDim> in_desc{arg.input_.mDesc};
+            const StaticHostTensorDescriptor<NumDim> out_desc{arg.output_.mDesc};
+            // output_indices_ is left alone without NeedIndices
+            const StaticHostTensorDescriptor<NumDim> indices_desc{
+                NeedIndices ? arg.output_indices_.mDesc : arg.output_.mDesc};
+
+            std::array<std::size_t, NumDimSpatial> window_lengths;
+            int32_t window_size = 1;
+
+            for(std::size_t d = 0; d < NumDimSpatial; ++d)
+            {
+                window_lengths[d] = arg.window_spatial_lengths_[d];
+                window_size *= arg.window_spatial_lengths_[d];
+            }
+
+            auto f_out = [&](const std::array<std::size_t, NumDim>& out_idx,
+                             std::size_t out_offset) {
+                AccDataType acc        = ReduceOp::GetIdentityValue();
+                int32_t acc_index      = 0;
+                int32_t num_in_element = 0;
+                std::array<std::size_t, NumDimSpatial> y{};
+                std::array<std::size_t, NumDim> in_idx = out_idx;
+
+                // k: index of y in the window
+                for(int32_t k = 0; k < window_size; ++k, MoveToNextMultiIndex(y, window_lengths))
+                {
+                    bool is_valid = true;
+
+                    for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                    {
+                        const auto x = ck::type_convert<ck::long_index_t>(
+                                           out_idx[d + 2] * arg.window_strides_[d] + y[d]) -
+                                       arg.in_left_pads_[d];
+
+                        is_valid = is_valid && x >= 0 &&
+                                   static_cast<std::size_t>(x) < in_desc.GetLengths()[d + 2];
+
+                        in_idx[d + 2] = static_cast<std::size_t>(x);
+                    }
+
+                    if(!is_valid)
+                        continue;
+
+                    auto v = ck::type_convert<AccDataType>(
+                        arg.input_.mData[in_desc.GetOffsetFromMultiIndex(in_idx)]);
+
+                    ReduceOp::PreUnaryOp(v);
+
+                    if constexpr(NeedIndices)
+                        ReduceOp::Reduce(acc, v, acc_index, k);
+                    else
+                        ReduceOp::Reduce(acc, v);
+
+                    ++num_in_element;
+                }
+
+                // a window entirely in the padding averages to zero
+                ReduceOp::PosUnaryOp(acc,
+                                     arg.count_include_pad_ ? window_size
+                                                            : std::max(num_in_element, 1));
+
+                arg.output_.mData[out_offset] = ck::type_convert<OutDataType>(acc);
+
+                if constexpr(NeedIndices)
+                    arg.output_indices_.mData[indices_desc.GetOffsetFromMultiIndex(out_idx)] =
+                        acc_index;
+            };
+
+            out_desc.ForEachIndex(f_out, std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& input,
+                             Tensor<OutDataType>& output,
+                             Tensor<int32_t>& output_indices,
+                             std::vector<ck::index_t> window_spatial_lengths,
+                             std::vector<ck::index_t> window_strides,
+                             std::vector<ck::index_t> input_left_pads,
+                             std::vector<ck::index_t> input_right_pads,
+                             bool count_include_pad = true)
+    {
+        return Argument{input,
+                        output,
+                        output_indices,
+                        window_spatial_lengths,
+                        window_strides,
+                        input_left_pads,
+                        input_right_pads,
+                        count_include_pad};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferencePoolFwd"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
+#endif
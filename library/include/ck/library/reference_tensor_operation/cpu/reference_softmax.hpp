@@ -0,0 +1,122 @@
+#ifndef REFERENCE_SOFTMAX_HPP
+#define REFERENCE_SOFTMAX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "device_base.hpp"
+#include "host_tensor.hpp"
+#include "host_reduce_util.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// out = exp(in - max) / sum(exp(in - max)), the max and sum taken over reduceDims in AccDataType,
+// for tensors of Rank dimensions of any layout.
+template <typename InDataType, typename OutDataType, typename AccDataType, ck::index_t Rank>
+struct ReferenceSoftmax : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& input,
+                 Tensor<OutDataType>& output,
+                 std::vector<int> reduce_dims)
+            : input_{input}, output_{output}, reduce_dims_{reduce_dims}
+        {
+        }
+
+        const Tensor<InDataType>& input_;
+        Tensor<OutDataType>& output_;
+
+        std::vector<int> reduce_dims_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceSoftmax::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const StaticHostTensorDescriptor<Rank> in_desc{arg.input_.mDesc};
+            const StaticHostTensorDescriptor<Rank> out_desc{arg.output_.mDesc};
+
+            auto get_in = [&](const auto& idx) {
+                return ck::type_convert<AccDataType>(
+                    arg.input_.mData[in_desc.GetOffsetFromMultiIndex(idx)]);
+            };
+
+            auto f_row = [&](auto for_each_in_row) {
+                AccDataType max = std::numeric_limits<AccDataType>::lowest();
+                AccDataType sum = 0;
+
+                for_each_in_row([&](const auto& idx) { max = std::max(max, get_in(idx)); });
+
+                for_each_in_row([&](const auto& idx) { sum += std::exp(get_in(idx) - max); });
+
+                for_each_in_row([&](const auto& idx) {
+                    arg.output_.mData[out_desc.GetOffsetFromMultiIndex(idx)] =
+                        ck::type_convert<OutDataType>(std::exp(get_in(idx) - max) / sum);
+                });
+            };
+
+            host_reduce::for_each_reduce_row<Rank>(arg.input_.mDesc,
+                                                   arg.reduce_dims_,
+                                                   f_row,
+                                                   std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& input,
+                             Tensor<OutDataType>& output,
+                             std::vector<int> reduce_dims)
+    {
+        return Argument{input, output, reduce_dims};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceSoftmax"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
+#endif
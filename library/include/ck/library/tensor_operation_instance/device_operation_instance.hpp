@@ -1,7 +1,14 @@
 #ifndef CK_DEVICE_OPERATION_INSTANCE_HPP
 #define CK_DEVICE_OPERATION_INSTANCE_HPP
 
+#include <memory>
 #include <stdlib.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "device_base.hpp"
+#include "functional2.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -20,6 +27,75 @@ void add_device_operation_instances(std::vector<std::unique_ptr<OpInstance>>& op
     });
 }
 
+// Constructs one instance of a device operation on request. A factory is a few function pointers,
+// so clients can list and filter the instances of a library without constructing them.
+template <typename OpPtr>
+struct DeviceOperationFactory
+{
+    OpPtr (*make_)();
+    std::string (*get_type_string_)();
+    TuningParams (*get_tuning_params_)();
+
+    OpPtr Make() const { return make_(); }
+
+    std::string GetTypeString() const { return get_type_string_(); }
+
+    TuningParams GetTuningParams() const { return get_tuning_params_(); }
+};
+
+template <typename OpPtr>
+using DeviceOperationFactories = std::vector<DeviceOperationFactory<OpPtr>>;
+
+template <typename OpPtr, typename OpInstance>
+OpPtr make_device_operation_instance()
+{
+    return std::make_unique<OpInstance>();
+}
+
+template <typename OpInstance>
+std::string get_device_operation_type_string()
+{
+    return OpInstance{}.GetTypeString();
+}
+
+template <typename OpInstance>
+TuningParams get_device_operation_tuning_params()
+{
+    return OpInstance{}.GetTuningParams();
+}
+
+template <typename NewOpInstance, typename OpPtr>
+void add_device_operation_factory(DeviceOperationFactories<OpPtr>& op_factories)
+{
+    op_factories.push_back({&make_device_operation_instance<OpPtr, NewOpInstance>,
+                            &get_device_operation_type_string<NewOpInstance>,
+                            &get_device_operation_tuning_params<NewOpInstance>});
+}
+
+template <typename OpPtr, typename NewOpInstances>
+void add_device_operation_instances(DeviceOperationFactories<OpPtr>& op_factories,
+                                    const NewOpInstances&)
+{
+    ck::static_for<0, std::tuple_size_v<NewOpInstances>, 1>{}([&](auto i) {
+        using NewOpInstance = remove_cvref_t<std::tuple_element_t<i, NewOpInstances>>;
+
+        add_device_operation_factory<NewOpInstance>(op_factories);
+    });
+}
+
+// Construct every instance of a group, for clients of the add_*_instances functions.
+template <typename OpPtr>
+void construct_device_operation_instances(std::vector<OpPtr>& op_instances,
+                                          void (*add_factories)(DeviceOperationFactories<OpPtr>&))
+{
+    DeviceOperationFactories<OpPtr> op_factories;
+
+    add_factories(op_factories);
+
+    for(const auto& op_factory : op_factories)
+        op_instances.push_back(op_factory.Make());
+}
+
 } // namespace device
 } // namespace tensor_operation
 } // namespace ck
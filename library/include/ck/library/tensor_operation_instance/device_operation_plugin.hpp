@@ -0,0 +1,132 @@
+#ifndef CK_DEVICE_OPERATION_PLUGIN_HPP
+#define CK_DEVICE_OPERATION_PLUGIN_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "device_operation_registry.hpp"
+
+// Instances can be built as plugins, shared objects loaded at run time, one per operation family
+// and data type (cmake -DCK_INSTANCE_PLUGINS=ON). Plugin "<op>_<data_type>" is the file
+// libck_<op>_<data_type>.so and exports
+//
+//   extern "C" void ck_register_device_operations(DeviceOperationPluginRegistrar&);
+//
+// which adds the plugin's instance groups to the registrar. Plugins have to be built with the
+// same compiler and composable kernel headers as the program loading them.
+#define CK_DEVICE_OPERATION_PLUGIN_ENTRY ck_register_device_operations
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Instance groups of a plugin, of any device operation interface.
+class DeviceOperationPluginRegistrar
+{
+    public:
+    template <typename OpPtr>
+    void Add(DeviceOperationKey key, void (*add_factories)(DeviceOperationFactories<OpPtr>&))
+    {
+        groups_.push_back(
+            {typeid(OpPtr), std::move(key), reinterpret_cast<void (*)()>(add_factories)});
+    }
+
+    template <typename OpPtr>
+    void Add(const DeviceOperationRegistry<OpPtr>& registry)
+    {
+        for(const auto& group : registry.GetGroups())
+            Add(group.first, group.second);
+    }
+
+    // add the groups `add_groups` registers, e.g. the groups of one of several interfaces
+    template <typename OpPtr>
+    void Add(void (*add_groups)(DeviceOperationRegistry<OpPtr>&))
+    {
+        DeviceOperationRegistry<OpPtr> registry;
+
+        add_groups(registry);
+
+        Add(registry);
+    }
+
+    // add the groups of interface OpPtr to `registry`
+    template <typename OpPtr>
+    void AddTo(DeviceOperationRegistry<OpPtr>& registry) const
+    {
+        using AddFactories = typename DeviceOperationRegistry<OpPtr>::AddFactories;
+
+        for(const auto& group : groups_)
+            if(group.interface == typeid(OpPtr))
+                registry.Add(group.key, reinterpret_cast<AddFactories>(group.add_factories));
+    }
+
+    private:
+    struct Group
+    {
+        std::type_index interface;
+        DeviceOperationKey key;
+        void (*add_factories)();
+    };
+
+    std::vector<Group> groups_;
+};
+
+using DeviceOperationPluginEntry = void (*)(DeviceOperationPluginRegistrar&);
+
+// Plugins of a directory. The directory is listed when the loader is made; a plugin is loaded on
+// the first query of its instances and stays loaded for the life of the process, as the
+// factories it registered point into it.
+class DeviceOperationPluginLoader
+{
+    public:
+    explicit DeviceOperationPluginLoader(const std::string& directory);
+
+    // of the plugins found, sorted
+    std::vector<std::string> GetPluginNames() const;
+
+    bool HasPlugin(const std::string& name) const;
+
+    bool IsLoaded(const std::string& name) const;
+
+    // Instances of interface OpPtr in plugin "<op>_<data_type>", loading it if needed. The
+    // registry is empty if there is no such plugin. Throws std::runtime_error if the plugin
+    // cannot be loaded.
+    template <typename OpPtr>
+    DeviceOperationRegistry<OpPtr> GetRegistry(const std::string& op,
+                                               const std::string& data_type)
+    {
+        DeviceOperationRegistry<OpPtr> registry;
+
+        const auto* p_registrar = Load(op + "_" + data_type);
+
+        if(p_registrar != nullptr)
+            p_registrar->AddTo(registry);
+
+        return registry;
+    }
+
+    private:
+    struct Plugin
+    {
+        std::string path;
+        void* handle = nullptr;
+        std::unique_ptr<DeviceOperationPluginRegistrar> registrar;
+    };
+
+    // the registrar of plugin `name`, nullptr if there is no such plugin
+    const DeviceOperationPluginRegistrar* Load(const std::string& name);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Plugin> plugins_;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
@@ -0,0 +1,108 @@
+#ifndef CK_DEVICE_OPERATION_REGISTRY_HPP
+#define CK_DEVICE_OPERATION_REGISTRY_HPP
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Identifies a group of instances of one device operation interface, named as in the instance
+// files, e.g. {"gemm", "xdl_c_shuffle", "f16_f16_f16", "mk_nk_mn", "PassThrough"}. The
+// specialization of each instance (GemmSpec, ConvForwardSpecialization, ...) is an option of its
+// tuning parameters.
+struct DeviceOperationKey
+{
+    std::string op;
+    std::string algorithm;
+    std::string data_type;
+    std::string layout;
+    // of all tensors, if they are the same, otherwise one per tensor joined by '_'
+    std::string element_op;
+};
+
+inline bool operator==(const DeviceOperationKey& a, const DeviceOperationKey& b)
+{
+    return a.op == b.op && a.algorithm == b.algorithm && a.data_type == b.data_type &&
+           a.layout == b.layout && a.element_op == b.element_op;
+}
+
+// Instances of a device operation interface, e.g. DeviceGemmPtr<PassThrough, PassThrough,
+// PassThrough>, registered by group. Registering a group only stores its key and the function
+// that lists its factories; a query lists the factories of the matching groups, and instances are
+// constructed only from the factories the client selects.
+template <typename OpPtr>
+class DeviceOperationRegistry
+{
+    public:
+    using Factory      = DeviceOperationFactory<OpPtr>;
+    using AddFactories = void (*)(DeviceOperationFactories<OpPtr>&);
+
+    DeviceOperationRegistry& Add(DeviceOperationKey key, AddFactories add_factories)
+    {
+        groups_.emplace_back(std::move(key), add_factories);
+        return *this;
+    }
+
+    const std::vector<std::pair<DeviceOperationKey, AddFactories>>& GetGroups() const
+    {
+        return groups_;
+    }
+
+    // factories of the groups whose key satisfies `key_pred`, in the order of registration
+    template <typename KeyPred>
+    DeviceOperationFactories<OpPtr> Find(KeyPred key_pred) const
+    {
+        DeviceOperationFactories<OpPtr> factories;
+
+        for(const auto& group : groups_)
+            if(key_pred(group.first))
+                group.second(factories);
+
+        return factories;
+    }
+
+    // factories of the groups whose key satisfies `key_pred` that satisfy `pred`
+    template <typename KeyPred, typename Pred>
+    DeviceOperationFactories<OpPtr> Find(KeyPred key_pred, Pred pred) const
+    {
+        auto factories = Find(key_pred);
+
+        factories.erase(std::remove_if(factories.begin(),
+                                       factories.end(),
+                                       [&](const Factory& factory) { return !pred(factory); }),
+                        factories.end());
+
+        return factories;
+    }
+
+    template <typename KeyPred>
+    std::vector<OpPtr> Make(KeyPred key_pred) const
+    {
+        return Make(key_pred, [](const Factory&) { return true; });
+    }
+
+    template <typename KeyPred, typename Pred>
+    std::vector<OpPtr> Make(KeyPred key_pred, Pred pred) const
+    {
+        std::vector<OpPtr> op_instances;
+
+        for(const auto& factory : Find(key_pred, pred))
+            op_instances.push_back(factory.Make());
+
+        return op_instances;
+    }
+
+    private:
+    std::vector<std::pair<DeviceOperationKey, AddFactories>> groups_;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
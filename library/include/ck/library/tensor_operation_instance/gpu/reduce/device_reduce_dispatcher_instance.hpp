@@ -0,0 +1,113 @@
+#ifndef DEVICE_REDUCE_DISPATCHER_INSTANCE_HPP
+#define DEVICE_REDUCE_DISPATCHER_INSTANCE_HPP
+
+#include "device_reduce_dispatcher.hpp"
+#include "device_reduce_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_reduce_instance {
+
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          ReduceTensorOp ReduceOpId,
+          ReduceTensorIndices IndicesOpt>
+using DeviceReduceDispatcherType = DeviceReduceDispatcher<
+    InDataType,
+    AccDataType,
+    OutDataType,
+    ReduceOpId,
+    (ReduceOpId == ReduceTensorOp::MIN || ReduceOpId == ReduceTensorOp::MAX ||
+     ReduceOpId == ReduceTensorOp::AMAX) &&
+        IndicesOpt != ReduceTensorIndices::NO_INDICES>;
+
+// A DeviceReduceDispatcher over the instances of every reduction method the library has for
+// these types and this operation, which are those profile_reduce_impl() tries: additive
+// operations with float output have MultiBlockAtomicAdd instances, the other operations
+// MultiBlockPartialReduce ones.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          int Rank,
+          int NumReduceDim,
+          ReduceTensorOp ReduceOpId,
+          NanPropagation NanOpt,
+          ReduceTensorIndices IndicesOpt>
+auto make_device_reduce_dispatcher(
+    ReduceMethodHeuristics heuristics = ReduceMethodHeuristics{})
+{
+    using Dispatcher =
+        DeviceReduceDispatcherType<InDataType, AccDataType, OutDataType, ReduceOpId, IndicesOpt>;
+
+    constexpr bool op_support_indices =
+        (ReduceOpId == ReduceTensorOp::MIN || ReduceOpId == ReduceTensorOp::MAX ||
+         ReduceOpId == ReduceTensorOp::AMAX);
+
+    constexpr bool use_atomic_add = std::is_same<OutDataType, float>::value &&
+                                    !op_support_indices && ReduceOpId != ReduceTensorOp::NORM2;
+
+    typename Dispatcher::Instances instances;
+
+    add_device_reduce_instance_threadwise<InDataType,
+                                          AccDataType,
+                                          OutDataType,
+                                          Rank,
+                                          NumReduceDim,
+                                          ReduceOpId,
+                                          NanOpt,
+                                          IndicesOpt>(instances.threadwise);
+
+    add_device_reduce_instance_blockwise<InDataType,
+                                         AccDataType,
+                                         OutDataType,
+                                         Rank,
+                                         NumReduceDim,
+                                         ReduceOpId,
+                                         NanOpt,
+                                         IndicesOpt>(instances.blockwise);
+
+    if constexpr(use_atomic_add)
+    {
+        add_device_reduce_instance_multiblock_atomic_add<InDataType,
+                                                         AccDataType,
+                                                         OutDataType,
+                                                         Rank,
+                                                         NumReduceDim,
+                                                         ReduceOpId,
+                                                         NanOpt,
+                                                         IndicesOpt>(
+            instances.multiblock_atomic_add);
+    }
+    else
+    {
+        add_device_reduce_instance_multiblock_partial_reduce<InDataType,
+                                                             AccDataType,
+                                                             OutDataType,
+                                                             Rank,
+                                                             NumReduceDim,
+                                                             ReduceOpId,
+                                                             NanOpt,
+                                                             IndicesOpt>(
+            instances.multiblock_partial_reduce);
+
+        add_device_reduce_instance_blockwise_second_call<AccDataType,
+                                                         AccDataType,
+                                                         OutDataType,
+                                                         Rank,
+                                                         NumReduceDim,
+                                                         ReduceOpId,
+                                                         NanOpt,
+                                                         IndicesOpt>(
+            instances.blockwise_second_call);
+    }
+
+    return std::make_unique<Dispatcher>(std::move(instances), heuristics);
+}
+
+} // namespace device_reduce_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+#endif
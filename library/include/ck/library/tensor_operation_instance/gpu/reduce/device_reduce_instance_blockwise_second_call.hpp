@@ -3,6 +3,7 @@
 
 #include "reduction_operator_mapping.hpp"
 #include "device_reduce_instance_impl_common.hpp"
+#include "device_operation_instance.hpp"
 #include "device_reduce_blockwise_second_call.hpp"
 
 namespace ck {
@@ -47,9 +48,9 @@ template <typename InDataType,
           ReduceTensorOp ReduceOpId,
           NanPropagation NanOpt,
           ReduceTensorIndices IndicesOpt>
-void add_device_reduce_instance_blockwise_second_call(
-    std::vector<deviceReduceBlockWiseSecondCallPtrType<AccDataType, ReduceOpId>>&
-        device_op_instances)
+void add_device_reduce_factories_blockwise_second_call(
+    DeviceOperationFactories<deviceReduceBlockWiseSecondCallPtrType<AccDataType, ReduceOpId>>&
+        factories)
 {
     using ReduceOperation = typename reduce_binary_operator<AccDataType, ReduceOpId>::opType;
     using InElementwiseOperation =
@@ -99,22 +100,56 @@ void add_device_reduce_instance_blockwise_second_call(
                                                                      cfg2::InSrcVectorSize_,
                                                                      cfg2::OutDstVectorSize_>;
 
-            device_op_instances.push_back(std::make_unique<ReduceOpInstance>(ReduceOpInstance{}));
+            add_device_operation_factory<ReduceOpInstance>(factories);
         });
     });
 };
 
-#define ADD_BLOCKWISE_SECOND_CALL_INST_BY_TYPE(                                  \
-    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)        \
-    template void add_device_reduce_instance_blockwise_second_call<inT,          \
-                                                                   compT,        \
-                                                                   outT,         \
-                                                                   Rank,         \
-                                                                   NumReduceDim, \
-                                                                   ReduceOpId,   \
-                                                                   NanOpt,       \
-                                                                   IndicesOpt>(  \
-        std::vector<deviceReduceBlockWiseSecondCallPtrType<compT, ReduceOpId>> & \
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          int Rank,
+          int NumReduceDim,
+          ReduceTensorOp ReduceOpId,
+          NanPropagation NanOpt,
+          ReduceTensorIndices IndicesOpt>
+void add_device_reduce_instance_blockwise_second_call(
+    std::vector<deviceReduceBlockWiseSecondCallPtrType<AccDataType, ReduceOpId>>&
+        device_op_instances)
+{
+    construct_device_operation_instances(
+        device_op_instances,
+        add_device_reduce_factories_blockwise_second_call<InDataType,
+                                                          AccDataType,
+                                                          OutDataType,
+                                                          Rank,
+                                                          NumReduceDim,
+                                                          ReduceOpId,
+                                                          NanOpt,
+                                                          IndicesOpt>);
+};
+
+#define ADD_BLOCKWISE_SECOND_CALL_INST_BY_TYPE(                                               \
+    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                     \
+    template void add_device_reduce_factories_blockwise_second_call<inT,                      \
+                                                                    compT,                    \
+                                                                    outT,                     \
+                                                                    Rank,                     \
+                                                                    NumReduceDim,             \
+                                                                    ReduceOpId,               \
+                                                                    NanOpt,                   \
+                                                                    IndicesOpt>(              \
+        DeviceOperationFactories<deviceReduceBlockWiseSecondCallPtrType<compT, ReduceOpId>> & \
+        factories);                                                                           \
+    template void add_device_reduce_instance_blockwise_second_call<inT,                       \
+                                                                   compT,                     \
+                                                                   outT,                      \
+                                                                   Rank,                      \
+                                                                   NumReduceDim,              \
+                                                                   ReduceOpId,                \
+                                                                   NanOpt,                    \
+                                                                   IndicesOpt>(               \
+        std::vector<deviceReduceBlockWiseSecondCallPtrType<compT, ReduceOpId>> &              \
         device_op_instances)
 
 #define ADD_BLOCKWISE_SECOND_CALL_INST_BY_ID(                                            \
@@ -128,21 +163,31 @@ void add_device_reduce_instance_blockwise_second_call(
                                            Rank,                                         \
                                            NumReduceDim)
 
-#define ADD_BLOCKWISE_SECOND_CALL_INST_REF_BY_TYPE(                                          \
-    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                    \
-    extern template void add_device_reduce_instance_blockwise_second_call<inT,               \
-                                                                          compT,             \
-                                                                          outT,              \
-                                                                          Rank,              \
-                                                                          NumReduceDim,      \
-                                                                          ReduceOpId,        \
-                                                                          NanOpt,            \
-                                                                          IndicesOpt>(       \
-        std::vector<                                                                         \
-            DeviceReducePtr<typename reduce_unary_operator<compT, ReduceOpId, false, true>:: \
-                                InElementwiseOperation,                                      \
-                            typename reduce_unary_operator<compT, ReduceOpId, false, true>:: \
-                                AccElementwiseOperation>> &                                  \
+#define ADD_BLOCKWISE_SECOND_CALL_INST_REF_BY_TYPE(                                           \
+    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                     \
+    extern template void add_device_reduce_factories_blockwise_second_call<inT,               \
+                                                                           compT,             \
+                                                                           outT,              \
+                                                                           Rank,              \
+                                                                           NumReduceDim,      \
+                                                                           ReduceOpId,        \
+                                                                           NanOpt,            \
+                                                                           IndicesOpt>(       \
+        DeviceOperationFactories<deviceReduceBlockWiseSecondCallPtrType<compT, ReduceOpId>> & \
+        factories);                                                                           \
+    extern template void add_device_reduce_instance_blockwise_second_call<inT,                \
+                                                                          compT,              \
+                                                                          outT,               \
+                                                                          Rank,               \
+                                                                          NumReduceDim,       \
+                                                                          ReduceOpId,         \
+                                                                          NanOpt,             \
+                                                                          IndicesOpt>(        \
+        std::vector<                                                                          \
+            DeviceReducePtr<typename reduce_unary_operator<compT, ReduceOpId, false, true>::  \
+                                InElementwiseOperation,                                       \
+                            typename reduce_unary_operator<compT, ReduceOpId, false, true>::  \
+                                AccElementwiseOperation>> &                                   \
         device_op_instances)
 
 #define ADD_BLOCKWISE_SECOND_CALL_INST_REF_BY_ID(                                            \
@@ -156,6 +201,22 @@ void add_device_reduce_instance_blockwise_second_call(
                                                Rank,                                         \
                                                NumReduceDim)
 
+// adds the group of the instances to a DeviceOperationPluginRegistrar
+#define ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(                                            \
+    registrar, inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)      \
+    registrar.Add(                                                                        \
+        make_device_reduce_key<inT, compT, outT>(                                         \
+            "blockwise_second_call", Rank, NumReduceDim, ReduceOpId, NanOpt, IndicesOpt), \
+        add_device_reduce_factories_blockwise_second_call<                                \
+            inT,                                                                          \
+            compT,                                                                        \
+            outT,                                                                         \
+            Rank,                                                                         \
+            NumReduceDim,                                                                 \
+            static_cast<ReduceTensorOp>(ReduceOpId),                                      \
+            static_cast<NanPropagation>(NanOpt),                                          \
+            static_cast<ReduceTensorIndices>(IndicesOpt)>)
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
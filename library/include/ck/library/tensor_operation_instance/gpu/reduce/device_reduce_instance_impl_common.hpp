@@ -1,6 +1,11 @@
 #ifndef DEVICE_REDUCE_INSTANCE_IMPL_COMMON_HPP
 #define DEVICE_REDUCE_INSTANCE_IMPL_COMMON_HPP
 
+#include <string>
+
+#include "data_type.hpp"
+#include "device_operation_registry.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -46,6 +51,47 @@ using reduce_configuration_1_instances = std::tuple<
 
 #define QUICK_REDUCE_TEST 1
 
+// named as in the instance files
+template <typename DataType>
+std::string get_reduce_instance_data_type_name()
+{
+    if constexpr(std::is_same<DataType, half_t>::value)
+        return "f16";
+    else if constexpr(std::is_same<DataType, float>::value)
+        return "f32";
+    else if constexpr(std::is_same<DataType, double>::value)
+        return "f64";
+    else if constexpr(std::is_same<DataType, int8_t>::value)
+        return "i8";
+    else if constexpr(std::is_same<DataType, int32_t>::value)
+        return "i32";
+    else if constexpr(std::is_same<DataType, bhalf_t>::value)
+        return "b16";
+    else
+        return "";
+}
+
+// Key of the reduce instances of one kind and template arguments, e.g. {"reduce", "threadwise",
+// "f16_f32_f16", "rank4_reduce3", "op0_nan0_indices0"}, the ids being those of the
+// ADD_*_INST_BY_ID lists.
+template <typename InDataType, typename AccDataType, typename OutDataType>
+DeviceOperationKey make_device_reduce_key(const std::string& kind,
+                                          int Rank,
+                                          int NumReduceDim,
+                                          int ReduceOpId,
+                                          int NanOpt,
+                                          int IndicesOpt)
+{
+    return {"reduce",
+            kind,
+            get_reduce_instance_data_type_name<InDataType>() + "_" +
+                get_reduce_instance_data_type_name<AccDataType>() + "_" +
+                get_reduce_instance_data_type_name<OutDataType>(),
+            "rank" + std::to_string(Rank) + "_reduce" + std::to_string(NumReduceDim),
+            "op" + std::to_string(ReduceOpId) + "_nan" + std::to_string(NanOpt) + "_indices" +
+                std::to_string(IndicesOpt)};
+}
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
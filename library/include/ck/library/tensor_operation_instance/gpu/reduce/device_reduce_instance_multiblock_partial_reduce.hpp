@@ -3,6 +3,7 @@
 
 #include "reduction_operator_mapping.hpp"
 #include "device_reduce_instance_impl_common.hpp"
+#include "device_operation_instance.hpp"
 #include "device_reduce_multiblock_partial_reduce.hpp"
 
 namespace ck {
@@ -59,9 +60,9 @@ template <typename InDataType,
           ReduceTensorOp ReduceOpId,
           NanPropagation NanOpt,
           ReduceTensorIndices IndicesOpt>
-void add_device_reduce_instance_multiblock_partial_reduce(
-    std::vector<deviceReduceMultiBlockPartialReducePtrType<AccDataType, ReduceOpId>>&
-        device_op_instances)
+void add_device_reduce_factories_multiblock_partial_reduce(
+    DeviceOperationFactories<deviceReduceMultiBlockPartialReducePtrType<AccDataType, ReduceOpId>>&
+        factories)
 {
     using ReduceOperation = typename reduce_binary_operator<AccDataType, ReduceOpId>::opType;
     using InElementwiseOperation =
@@ -108,22 +109,56 @@ void add_device_reduce_instance_multiblock_partial_reduce(
                                                                          cfg2::InSrcVectorSize_,
                                                                          cfg2::OutDstVectorSize_>;
 
-            device_op_instances.push_back(std::make_unique<ReduceOpInstance>(ReduceOpInstance{}));
+            add_device_operation_factory<ReduceOpInstance>(factories);
         });
     });
 };
 
-#define ADD_MULTIBLOCK_PARTIAL_REDUCE_INST_BY_TYPE(                                  \
-    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)            \
-    template void add_device_reduce_instance_multiblock_partial_reduce<inT,          \
-                                                                       compT,        \
-                                                                       outT,         \
-                                                                       Rank,         \
-                                                                       NumReduceDim, \
-                                                                       ReduceOpId,   \
-                                                                       NanOpt,       \
-                                                                       IndicesOpt>(  \
-        std::vector<deviceReduceMultiBlockPartialReducePtrType<compT, ReduceOpId>> & \
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          int Rank,
+          int NumReduceDim,
+          ReduceTensorOp ReduceOpId,
+          NanPropagation NanOpt,
+          ReduceTensorIndices IndicesOpt>
+void add_device_reduce_instance_multiblock_partial_reduce(
+    std::vector<deviceReduceMultiBlockPartialReducePtrType<AccDataType, ReduceOpId>>&
+        device_op_instances)
+{
+    construct_device_operation_instances(
+        device_op_instances,
+        add_device_reduce_factories_multiblock_partial_reduce<InDataType,
+                                                              AccDataType,
+                                                              OutDataType,
+                                                              Rank,
+                                                              NumReduceDim,
+                                                              ReduceOpId,
+                                                              NanOpt,
+                                                              IndicesOpt>);
+};
+
+#define ADD_MULTIBLOCK_PARTIAL_REDUCE_INST_BY_TYPE(                                               \
+    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                         \
+    template void add_device_reduce_factories_multiblock_partial_reduce<inT,                      \
+                                                                        compT,                    \
+                                                                        outT,                     \
+                                                                        Rank,                     \
+                                                                        NumReduceDim,             \
+                                                                        ReduceOpId,               \
+                                                                        NanOpt,                   \
+                                                                        IndicesOpt>(              \
+        DeviceOperationFactories<deviceReduceMultiBlockPartialReducePtrType<compT, ReduceOpId>> & \
+        factories);                                                                               \
+    template void add_device_reduce_instance_multiblock_partial_reduce<inT,                       \
+                                                                       compT,                     \
+                                                                       outT,                      \
+                                                                       Rank,                      \
+                                                                       NumReduceDim,              \
+                                                                       ReduceOpId,                \
+                                                                       NanOpt,                    \
+                                                                       IndicesOpt>(               \
+        std::vector<deviceReduceMultiBlockPartialReducePtrType<compT, ReduceOpId>> &              \
         device_op_instances)
 
 #define ADD_MULTIBLOCK_PARTIAL_REDUCE_INST_BY_ID(                                            \
@@ -137,21 +172,31 @@ void add_device_reduce_instance_multiblock_partial_reduce(
                                                Rank,                                         \
                                                NumReduceDim)
 
-#define ADD_MULTIBLOCK_PARTIAL_REDUCE_INST_REF_BY_TYPE(                                      \
-    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                    \
-    extern template void add_device_reduce_instance_multiblock_partial_reduce<inT,           \
-                                                                              compT,         \
-                                                                              outT,          \
-                                                                              Rank,          \
-                                                                              NumReduceDim,  \
-                                                                              ReduceOpId,    \
-                                                                              NanOpt,        \
-                                                                              IndicesOpt>(   \
-        std::vector<                                                                         \
-            DeviceReducePtr<typename reduce_unary_operator<compT, ReduceOpId, true, false>:: \
-                                InElementwiseOperation,                                      \
-                            typename reduce_unary_operator<compT, ReduceOpId, true, false>:: \
-                                AccElementwiseOperation>> &                                  \
+#define ADD_MULTIBLOCK_PARTIAL_REDUCE_INST_REF_BY_TYPE(                                           \
+    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                         \
+    extern template void add_device_reduce_factories_multiblock_partial_reduce<inT,               \
+                                                                               compT,             \
+                                                                               outT,              \
+                                                                               Rank,              \
+                                                                               NumReduceDim,      \
+                                                                               ReduceOpId,        \
+                                                                               NanOpt,            \
+                                                                               IndicesOpt>(       \
+        DeviceOperationFactories<deviceReduceMultiBlockPartialReducePtrType<compT, ReduceOpId>> & \
+        factories);                                                                               \
+    extern template void add_device_reduce_instance_multiblock_partial_reduce<inT,                \
+                                                                              compT,              \
+                                                                              outT,               \
+                                                                              Rank,               \
+                                                                              NumReduceDim,       \
+                                                                              ReduceOpId,         \
+                                                                              NanOpt,             \
+                                                                              IndicesOpt>(        \
+        std::vector<                                                                              \
+            DeviceReducePtr<typename reduce_unary_operator<compT, ReduceOpId, true, false>::      \
+                                InElementwiseOperation,                                           \
+                            typename reduce_unary_operator<compT, ReduceOpId, true, false>::      \
+                                AccElementwiseOperation>> &                                       \
         device_op_instances)
 
 #define ADD_MULTIBLOCK_PARTIAL_REDUCE_INST_REF_BY_ID(                                            \
@@ -165,6 +210,22 @@ void add_device_reduce_instance_multiblock_partial_reduce(
                                                    Rank,                                         \
                                                    NumReduceDim)
 
+// adds the group of the instances to a DeviceOperationPluginRegistrar
+#define ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(                                            \
+    registrar, inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)          \
+    registrar.Add(                                                                            \
+        make_device_reduce_key<inT, compT, outT>(                                             \
+            "multiblock_partial_reduce", Rank, NumReduceDim, ReduceOpId, NanOpt, IndicesOpt), \
+        add_device_reduce_factories_multiblock_partial_reduce<                                \
+            inT,                                                                              \
+            compT,                                                                            \
+            outT,                                                                             \
+            Rank,                                                                             \
+            NumReduceDim,                                                                     \
+            static_cast<ReduceTensorOp>(ReduceOpId),                                          \
+            static_cast<NanPropagation>(NanOpt),                                              \
+            static_cast<ReduceTensorIndices>(IndicesOpt)>)
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
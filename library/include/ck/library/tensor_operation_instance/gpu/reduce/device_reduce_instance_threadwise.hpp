@@ -3,6 +3,7 @@
 
 #include "reduction_operator_mapping.hpp"
 #include "device_reduce_instance_impl_common.hpp"
+#include "device_operation_instance.hpp"
 #include "device_reduce_threadwise.hpp"
 
 namespace ck {
@@ -60,8 +61,8 @@ template <typename InDataType,
           ReduceTensorOp ReduceOpId,
           NanPropagation NanOpt,
           ReduceTensorIndices IndicesOpt>
-void add_device_reduce_instance_threadwise(
-    std::vector<deviceReduceThreadWisePtrType<AccDataType, ReduceOpId>>& device_op_instances)
+void add_device_reduce_factories_threadwise(
+    DeviceOperationFactories<deviceReduceThreadWisePtrType<AccDataType, ReduceOpId>>& factories)
 {
     using ReduceOperation = typename reduce_binary_operator<AccDataType, ReduceOpId>::opType;
     using InElementwiseOperation =
@@ -103,20 +104,52 @@ void add_device_reduce_instance_threadwise(
                                                             cfg2::InSrcVectorSize_,
                                                             cfg2::OutDstVectorSize_>;
 
-            device_op_instances.push_back(std::make_unique<ReduceOpInstance>(ReduceOpInstance{}));
+            add_device_operation_factory<ReduceOpInstance>(factories);
         });
 };
 
-#define ADD_THREADWISE_INST_BY_TYPE(                                      \
-    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim) \
-    template void add_device_reduce_instance_threadwise<inT,              \
-                                                        compT,            \
-                                                        outT,             \
-                                                        Rank,             \
-                                                        NumReduceDim,     \
-                                                        ReduceOpId,       \
-                                                        NanOpt,           \
-                                                        IndicesOpt>(      \
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          int Rank,
+          int NumReduceDim,
+          ReduceTensorOp ReduceOpId,
+          NanPropagation NanOpt,
+          ReduceTensorIndices IndicesOpt>
+void add_device_reduce_instance_threadwise(
+    std::vector<deviceReduceThreadWisePtrType<AccDataType, ReduceOpId>>& device_op_instances)
+{
+    construct_device_operation_instances(
+        device_op_instances,
+        add_device_reduce_factories_threadwise<InDataType,
+                                               AccDataType,
+                                               OutDataType,
+                                               Rank,
+                                               NumReduceDim,
+                                               ReduceOpId,
+                                               NanOpt,
+                                               IndicesOpt>);
+};
+
+#define ADD_THREADWISE_INST_BY_TYPE(                                                             \
+    inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                        \
+    template void add_device_reduce_factories_threadwise<inT,                                    \
+                                                         compT,                                  \
+                                                         outT,                                   \
+                                                         Rank,                                   \
+                                                         NumReduceDim,                           \
+                                                         ReduceOpId,                             \
+                                                         NanOpt,                                 \
+                                                         IndicesOpt>(                            \
+        DeviceOperationFactories<deviceReduceThreadWisePtrType<compT, ReduceOpId>> & factories); \
+    template void add_device_reduce_instance_threadwise<inT,                                     \
+                                                        compT,                                   \
+                                                        outT,                                    \
+                                                        Rank,                                    \
+                                                        NumReduceDim,                            \
+                                                        ReduceOpId,                              \
+                                                        NanOpt,                                  \
+                                                        IndicesOpt>(                             \
         std::vector<deviceReduceThreadWisePtrType<compT, ReduceOpId>> & device_op_instances)
 
 #define ADD_THREADWISE_INST_BY_ID(                                            \
@@ -132,6 +165,15 @@ void add_device_reduce_instance_threadwise(
 
 #define ADD_THREADWISE_INST_REF_BY_TYPE(                                                           \
     inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)                          \
+    extern template void add_device_reduce_factories_threadwise<inT,                               \
+                                                                compT,                             \
+                                                                outT,                              \
+                                                                Rank,                              \
+                                                                NumReduceDim,                      \
+                                                                ReduceOpId,                        \
+                                                                NanOpt,                            \
+                                                                IndicesOpt>(                       \
+        DeviceOperationFactories<deviceReduceThreadWisePtrType<compT, ReduceOpId>> & factories);   \
     extern template void add_device_reduce_instance_threadwise<inT,                                \
                                                                compT,                              \
                                                                outT,                               \
@@ -157,6 +199,21 @@ void add_device_reduce_instance_threadwise(
                                     Rank,                                         \
                                     NumReduceDim)
 
+// adds the group of the instances to a DeviceOperationPluginRegistrar
+#define ADD_THREADWISE_GROUP_BY_ID(                                                     \
+    registrar, inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)    \
+    registrar.Add(                                                                      \
+        make_device_reduce_key<inT, compT, outT>(                                       \
+            "threadwise", Rank, NumReduceDim, ReduceOpId, NanOpt, IndicesOpt),          \
+        add_device_reduce_factories_threadwise<inT,                                     \
+                                               compT,                                   \
+                                               outT,                                    \
+                                               Rank,                                    \
+                                               NumReduceDim,                            \
+                                               static_cast<ReduceTensorOp>(ReduceOpId), \
+                                               static_cast<NanPropagation>(NanOpt),     \
+                                               static_cast<ReduceTensorIndices>(IndicesOpt)>)
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
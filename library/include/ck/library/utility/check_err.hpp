@@ -2,164 +2,544 @@
 #define CHECK_ERR_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <half.hpp>
 #include <iostream>
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
 #include "data_type.hpp"
+#include "host_tensor.hpp"
 
 namespace ck {
 namespace utils {
 
-template <typename T>
-typename std::enable_if<std::is_floating_point<T>::value && !std::is_same<T, half_t>::value,
-                        bool>::type
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-5,
-          double atol            = 1e-8)
+struct CheckErrConfig
 {
-    if(out.size() != ref.size())
+    double rtol = 1e-5;
+    double atol = 1e-8;
+
+    // stop at the first mismatch found, for checks that only need pass/fail
+    bool early_exit = false;
+
+    // number of mismatches (with the lowest indices) recorded in the report
+    std::size_t max_num_recorded_mismatch = 8;
+
+    std::size_t num_thread = std::thread::hardware_concurrency();
+};
+
+struct CheckErrReport
+{
+    // bin 0 counts exact matches, bin i > 0 counts ULP distances in [2^(i-1), 2^i), the last bin
+    // also counts non-finite values
+    static constexpr std::size_t NumUlpBin = 32;
+
+    struct Mismatch
     {
-        std::cout << "out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl
-                  << msg << std::endl;
-        return false;
-    }
+        std::size_t index;
+        // multi-index of the element, only filled in by the Tensor overload of check_err_report
+        std::vector<std::size_t> multi_index;
+        double out;
+        double ref;
+    };
+
+    bool pass                = true;
+    bool exited_early        = false;
+    std::size_t num_checked  = 0;
+    std::size_t num_mismatch = 0;
+
+    double max_abs_err            = 0;
+    std::size_t max_abs_err_index = 0;
+    double max_rel_err            = 0;
+    std::size_t max_rel_err_index = 0;
+    double max_mismatch_abs_err   = 0;
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<double>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    std::vector<Mismatch> mismatches;
+
+    // only collected for floating point types and without early exit
+    std::array<std::size_t, NumUlpBin> ulp_histogram{};
+
+    void Print(std::ostream& os) const
     {
-        err = std::abs(out[i] - ref[i]);
-        if(err > atol + rtol * std::abs(ref[i]) || !std::isfinite(out[i]) || !std::isfinite(ref[i]))
+        os << (pass ? "pass" : "fail") << ", checked " << num_checked << ", mismatches "
+           << num_mismatch << (exited_early ? " (exited early)" : "") << std::endl;
+
+        os << "max abs err " << max_abs_err << " at " << max_abs_err_index << ", max rel err "
+           << max_rel_err << " at " << max_rel_err_index << std::endl;
+
+        for(const auto& mismatch : mismatches)
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            os << "out[" << mismatch.index << "]";
+
+            if(!mismatch.multi_index.empty())
             {
-                std::cout << std::setw(12) << std::setprecision(7) << "out[" << i << "] != ref["
-                          << i << "]: " << out[i] << " != " << ref[i] << std::endl
-                          << msg << std::endl;
+                os << " (";
+                LogRange(os, mismatch.multi_index, ", ") << ")";
             }
-            res = false;
+
+            os << " != ref: " << mismatch.out << " != " << mismatch.ref << std::endl;
+        }
+
+        if(std::any_of(ulp_histogram.begin(), ulp_histogram.end(), [](auto n) { return n > 0; }))
+        {
+            os << "ulp histogram:";
+
+            for(std::size_t i = 0; i < NumUlpBin; ++i)
+            {
+                if(ulp_histogram[i] > 0)
+                {
+                    os << " [" << (i == 0 ? 0 : std::size_t{1} << (i - 1))
+                       << "]=" << ulp_histogram[i];
+                }
+            }
+
+            os << std::endl;
         }
     }
-    if(!res)
+};
+
+namespace detail {
+
+// How check_err compares values of type T: every element is first converted to ComputeType, a
+// block at a time, with branch-free conversions so the conversion loops vectorise. Bits is the
+// storage type used to measure ULP distances of floating point types. Integers are only converted
+// for the error report; they match if they are equal.
+template <typename T, typename Enable = void>
+struct CheckErrTypeTraits
+{
+    static_assert(std::is_integral<T>::value, "wrong! unsupported data type");
+
+    using ComputeType = double;
+
+    static constexpr bool IsFloatingPoint = false;
+
+    static ComputeType Convert(T x) { return static_cast<ComputeType>(x); }
+};
+
+template <>
+struct CheckErrTypeTraits<float>
+{
+    using ComputeType = float;
+    using Bits        = uint32_t;
+
+    static constexpr bool IsFloatingPoint = true;
+
+    static ComputeType Convert(float x) { return x; }
+};
+
+template <>
+struct CheckErrTypeTraits<double>
+{
+    using ComputeType = double;
+    using Bits        = uint64_t;
+
+    static constexpr bool IsFloatingPoint = true;
+
+    static ComputeType Convert(double x) { return x; }
+};
+
+// bhalf_t is the upper half of a float
+template <>
+struct CheckErrTypeTraits<bhalf_t>
+{
+    using ComputeType = float;
+    using Bits        = uint16_t;
+
+    static constexpr bool IsFloatingPoint = true;
+
+    static ComputeType Convert(bhalf_t x)
     {
-        std::cout << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        const uint32_t u = static_cast<uint32_t>(x) << 16;
+
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+
+        return f;
     }
-    return res;
-}
+};
 
+// IEEE half precision, both half_t and half_float::half
 template <typename T>
-typename std::enable_if<std::is_same<T, bhalf_t>::value, bool>::type
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+struct CheckErrTypeTraits<
+    T,
+    typename std::enable_if<std::is_same<T, half_t>::value ||
+                            std::is_same<T, half_float::half>::value>::type>
 {
-    if(out.size() != ref.size())
+    using ComputeType = float;
+    using Bits        = uint16_t;
+
+    static constexpr bool IsFloatingPoint = true;
+
+    // bit-level conversion using masks instead of branches, so it vectorises without F16C
+    static ComputeType Convert(const T& x)
     {
-        std::cout << "out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl
-                  << msg << std::endl;
-        return false;
+        static_assert(sizeof(T) == sizeof(uint16_t), "wrong! not a 16-bit type");
+
+        uint16_t h;
+        std::memcpy(&h, &x, sizeof(h));
+
+        constexpr uint32_t shifted_exp = 0x7c00u << 13;
+
+        uint32_t u         = (h & 0x7fffu) << 13;
+        const uint32_t exp = u & shifted_exp;
+
+        const uint32_t inf_nan_mask   = 0u - static_cast<uint32_t>(exp == shifted_exp);
+        const uint32_t subnormal_mask = 0u - static_cast<uint32_t>(exp == 0);
+
+        // rebias the exponent, inf and nan keep the maximum exponent
+        u += (127u - 15u) << 23;
+        u += inf_nan_mask & ((128u - 16u) << 23);
+
+        // zero and subnormals: renormalise through a float subtraction
+        const uint32_t u_sub = u + (1u << 23);
+
+        float f_sub;
+        std::memcpy(&f_sub, &u_sub, sizeof(f_sub));
+
+        f_sub -= 6.103515625e-05f; // 2^-14
+
+        uint32_t u_renorm;
+        std::memcpy(&u_renorm, &f_sub, sizeof(u_renorm));
+
+        u = (u & ~subnormal_mask) | (u_renorm & subnormal_mask);
+        u |= static_cast<uint32_t>(h & 0x8000u) << 16;
+
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+
+        return f;
     }
+};
+
+// distance between two floating point values in units in the last place of T
+template <typename T>
+uint64_t get_ulp_distance(const T& x, const T& y)
+{
+    using Bits = typename CheckErrTypeTraits<T>::Bits;
+
+    constexpr Bits sign = Bits{1} << (8 * sizeof(Bits) - 1);
+
+    Bits bx, by;
+    std::memcpy(&bx, &x, sizeof(Bits));
+    std::memcpy(&by, &y, sizeof(Bits));
+
+    const uint64_t mx = bx & static_cast<Bits>(~sign);
+    const uint64_t my = by & static_cast<Bits>(~sign);
+
+    // sign-magnitude encoding: magnitudes add up across zero, saturating for doubles
+    if((bx ^ by) & sign)
+        return mx + my < mx ? std::numeric_limits<uint64_t>::max() : mx + my;
+
+    return mx > my ? mx - my : my - mx;
+}
+
+inline std::size_t get_ulp_bin(uint64_t ulp)
+{
+    // number of significant bits of the distance
+    const std::size_t bin = ulp == 0 ? 0 : 64 - __builtin_clzll(ulp);
+
+    return std::min(bin, CheckErrReport::NumUlpBin - 1);
+}
+
+inline void merge_check_err_report(CheckErrReport& dst,
+                                   const CheckErrReport& src,
+                                   std::size_t max_num_recorded_mismatch)
+{
+    dst.pass         = dst.pass && src.pass;
+    dst.exited_early = dst.exited_early || src.exited_early;
+    dst.num_checked += src.num_checked;
+    dst.num_mismatch += src.num_mismatch;
 
-    bool res{true};
-    int err_count = 0;
-    double err    = 0;
-    // TODO: This is a hack. We should have proper specialization for bhalf_t data type.
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    // of equal maxima the one at the smaller index is kept, as in a single pass over the range
+    if(src.max_abs_err > dst.max_abs_err ||
+       (src.max_abs_err == dst.max_abs_err && src.max_abs_err_index < dst.max_abs_err_index))
     {
-        double o = type_convert<float>(out[i]);
-        double r = type_convert<float>(ref[i]);
-        err      = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cout << std::setw(12) << std::setprecision(7) << "out[" << i << "] != ref["
-                          << i << "]: " << o << " != " << r << std::endl
-                          << msg << std::endl;
-            }
-            res = false;
-        }
+        dst.max_abs_err       = src.max_abs_err;
+        dst.max_abs_err_index = src.max_abs_err_index;
     }
-    if(!res)
+
+    if(src.max_rel_err > dst.max_rel_err ||
+       (src.max_rel_err == dst.max_rel_err && src.max_rel_err_index < dst.max_rel_err_index))
     {
-        std::cout << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        dst.max_rel_err       = src.max_rel_err;
+        dst.max_rel_err_index = src.max_rel_err_index;
     }
-    return res;
+
+    dst.max_mismatch_abs_err = std::max(dst.max_mismatch_abs_err, src.max_mismatch_abs_err);
+
+    dst.mismatches.insert(dst.mismatches.end(), src.mismatches.begin(), src.mismatches.end());
+
+    std::sort(dst.mismatches.begin(), dst.mismatches.end(), [](const auto& a, const auto& b) {
+        return a.index < b.index;
+    });
+
+    if(dst.mismatches.size() > max_num_recorded_mismatch)
+        dst.mismatches.resize(max_num_recorded_mismatch);
+
+    for(std::size_t i = 0; i < CheckErrReport::NumUlpBin; ++i)
+        dst.ulp_histogram[i] += src.ulp_histogram[i];
 }
 
+// compare out[i_begin, i_end) against ref, a block of elements at a time
 template <typename T>
-typename std::enable_if<std::is_same<T, half_t>::value || std::is_same<T, half_float::half>::value,
-                        bool>::type
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+void check_err_range(const T* out,
+                     const T* ref,
+                     std::size_t i_begin,
+                     std::size_t i_end,
+                     const CheckErrConfig& config,
+                     std::atomic<bool>& stop,
+                     CheckErrReport& report)
 {
-    if(out.size() != ref.size())
-    {
-        std::cout << "out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl
-                  << msg << std::endl;
-        return false;
-    }
+    using Traits      = CheckErrTypeTraits<T>;
+    using ComputeType = typename Traits::ComputeType;
+
+    constexpr std::size_t BlockSize = 256;
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<T>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    constexpr ComputeType max_finite = std::numeric_limits<ComputeType>::max();
+    constexpr ComputeType min_normal = std::numeric_limits<ComputeType>::min();
+
+    const ComputeType rtol = static_cast<ComputeType>(config.rtol);
+    const ComputeType atol = static_cast<ComputeType>(config.atol);
+
+    ComputeType o[BlockSize];
+    ComputeType r[BlockSize];
+    ComputeType abs_err[BlockSize];
+    ComputeType rel_err[BlockSize];
+    uint8_t bad[BlockSize];
+
+    for(std::size_t b = i_begin; b < i_end; b += BlockSize)
     {
-        double o = type_convert<float>(out[i]);
-        double r = type_convert<float>(ref[i]);
-        err      = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        if(stop.load(std::memory_order_relaxed))
+        {
+            report.exited_early = true;
+            return;
+        }
+
+        const std::size_t len = std::min(BlockSize, i_end - b);
+
+        for(std::size_t i = 0; i < len; ++i)
+            o[i] = Traits::Convert(out[b + i]);
+
+        for(std::size_t i = 0; i < len; ++i)
+            r[i] = Traits::Convert(ref[b + i]);
+
+        uint8_t any_bad = 0;
+
+        ComputeType block_max_abs_err = 0;
+        ComputeType block_max_rel_err = 0;
+
+        // written so that nan and inf compare as mismatches without branching
+        for(std::size_t i = 0; i < len; ++i)
+        {
+            const ComputeType e     = std::abs(o[i] - r[i]);
+            const ComputeType abs_r = std::abs(r[i]);
+
+            // non-finite errors only count as mismatches, not towards the maximum errors
+            const bool finite = e <= max_finite;
+
+            abs_err[i] = finite ? e : ComputeType{0};
+            rel_err[i] = finite ? e / std::max(abs_r, min_normal) : ComputeType{0};
+
+            block_max_abs_err = std::max(block_max_abs_err, abs_err[i]);
+            block_max_rel_err = std::max(block_max_rel_err, rel_err[i]);
+
+            // integers are compared exactly in their own type, as double cannot hold all of
+            // the values of 64-bit integers
+            if constexpr(Traits::IsFloatingPoint)
+                bad[i] = !(e <= atol + rtol * abs_r) | !(std::abs(o[i]) <= max_finite) |
+                         !(abs_r <= max_finite);
+            else
+                bad[i] = out[b + i] != ref[b + i];
+
+            any_bad |= bad[i];
+        }
+
+        // only look up where the maxima are in the few blocks that raise them
+        if(block_max_abs_err > report.max_abs_err)
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            report.max_abs_err = block_max_abs_err;
+            report.max_abs_err_index =
+                b + (std::find(abs_err, abs_err + len, block_max_abs_err) - abs_err);
+        }
+
+        if(block_max_rel_err > report.max_rel_err)
+        {
+            report.max_rel_err = block_max_rel_err;
+            report.max_rel_err_index =
+                b + (std::find(rel_err, rel_err + len, block_max_rel_err) - rel_err);
+        }
+
+        if constexpr(Traits::IsFloatingPoint)
+        {
+            if(!config.early_exit)
             {
-                std::cout << std::setw(12) << std::setprecision(7) << "out[" << i << "] != ref["
-                          << i << "]: " << o << " != " << r << std::endl
-                          << msg << std::endl;
+                for(std::size_t i = 0; i < len; ++i)
+                {
+                    const bool finite =
+                        std::abs(o[i]) <= max_finite && std::abs(r[i]) <= max_finite;
+
+                    const std::size_t bin =
+                        finite ? get_ulp_bin(get_ulp_distance(out[b + i], ref[b + i]))
+                               : CheckErrReport::NumUlpBin - 1;
+
+                    report.ulp_histogram[bin]++;
+                }
             }
-            res = false;
         }
+
+        if(any_bad)
+        {
+            for(std::size_t i = 0; i < len; ++i)
+            {
+                if(!bad[i])
+                    continue;
+
+                report.pass = false;
+                report.num_mismatch++;
+                report.max_mismatch_abs_err =
+                    std::max<double>(report.max_mismatch_abs_err, abs_err[i]);
+
+                if(report.mismatches.size() < config.max_num_recorded_mismatch)
+                    report.mismatches.push_back({b + i, {}, o[i], r[i]});
+
+                if(config.early_exit)
+                {
+                    report.num_checked += i + 1;
+                    report.exited_early = true;
+
+                    stop = true;
+
+                    return;
+                }
+            }
+        }
+
+        report.num_checked += len;
     }
-    if(!res)
+}
+
+// map a memory offset back to a multi-index, assuming the tensor's dimensions do not overlap
+inline std::vector<std::size_t> get_multi_index_from_offset(const HostTensorDescriptor& desc,
+                                                            std::size_t offset)
+{
+    const auto& lens    = desc.GetLengths();
+    const auto& strides = desc.GetStrides();
+
+    std::vector<std::size_t> order(lens.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) {
+        return strides[a] > strides[b];
+    });
+
+    std::vector<std::size_t> idx(lens.size(), 0);
+
+    for(auto d : order)
     {
-        std::cout << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        if(strides[d] == 0 || lens[d] <= 1)
+            continue;
+
+        idx[d] = std::min(offset / strides[d], lens[d] - 1);
+        offset -= idx[d] * strides[d];
     }
-    return res;
+
+    return idx;
 }
 
+} // namespace detail
+
 template <typename T>
-typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bhalf_t>::value, bool>::type
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double                 = 0,
-          double                 = 0)
+CheckErrConfig get_default_check_err_config()
+{
+    CheckErrConfig config;
+
+    if constexpr(std::is_same<T, half_t>::value || std::is_same<T, half_float::half>::value ||
+                 std::is_same<T, bhalf_t>::value)
+    {
+        config.rtol = 1e-3;
+        config.atol = 1e-3;
+    }
+    else if constexpr(std::is_integral<T>::value)
+    {
+        config.rtol = 0;
+        config.atol = 0;
+    }
+
+    return config;
+}
+
+// Compare out against ref on the host thread pool. The result does not depend on the number of
+// threads, except for which mismatches an early exit happens to find.
+template <typename T, typename OutAllocator, typename RefAllocator>
+CheckErrReport check_err_report(const std::vector<T, OutAllocator>& out,
+                                const std::vector<T, RefAllocator>& ref,
+                                const CheckErrConfig& config = get_default_check_err_config<T>())
+{
+    CheckErrReport report;
+
+    if(out.size() != ref.size())
+    {
+        report.pass = false;
+        return report;
+    }
+
+    // below this many elements per thread waking up the pool costs more than it saves
+    constexpr std::size_t min_num_element_per_thread = std::size_t{1} << 16;
+
+    const std::size_t num_thread =
+        std::min(config.num_thread, ref.size() / min_num_element_per_thread + 1);
+
+    std::atomic<bool> stop{false};
+    std::mutex mtx;
+
+    host_parallel_for(ref.size(), num_thread, [&](std::size_t i_begin, std::size_t i_end) {
+        CheckErrReport partial;
+
+        detail::check_err_range(out.data(), ref.data(), i_begin, i_end, config, stop, partial);
+
+        std::lock_guard<std::mutex> lock(mtx);
+
+        detail::merge_check_err_report(report, partial, config.max_num_recorded_mismatch);
+    });
+
+    return report;
+}
+
+// as above, with the mismatches' multi-indices filled in from out's descriptor
+template <typename T, std::size_t Rank>
+CheckErrReport check_err_report(const Tensor<T, Rank>& out,
+                                const Tensor<T, Rank>& ref,
+                                const CheckErrConfig& config = get_default_check_err_config<T>())
+{
+    CheckErrReport report = check_err_report(out.mData, ref.mData, config);
+
+    const HostTensorDescriptor desc{out.mDesc};
+
+    for(auto& mismatch : report.mismatches)
+        mismatch.multi_index = detail::get_multi_index_from_offset(desc, mismatch.index);
+
+    return report;
+}
+
+namespace detail {
+
+// the boolean check_err interface on top of check_err_report
+template <typename T, typename OutAllocator, typename RefAllocator>
+bool check_err_and_log(const std::vector<T, OutAllocator>& out,
+                       const std::vector<T, RefAllocator>& ref,
+                       const std::string& msg,
+                       const CheckErrConfig& config)
 {
     if(out.size() != ref.size())
     {
@@ -169,24 +549,101 @@ check_err(const std::vector<T>& out,
         return false;
     }
 
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    const CheckErrReport report = check_err_report(out, ref, config);
+
+    if(!report.pass)
     {
-        if(out[i] != ref[i])
+        for(const auto& mismatch : report.mismatches)
         {
-            std::cout << "out[" << i << "] != ref[" << i << "]: " << out[i] << " != " << ref[i]
-                      << std::endl
+            std::cout << std::setw(12) << std::setprecision(7) << "out[" << mismatch.index
+                      << "] != ref[" << mismatch.index << "]: " << mismatch.out
+                      << " != " << mismatch.ref << std::endl
                       << msg << std::endl;
-            return false;
+        }
+
+        if(!config.early_exit)
+        {
+            std::cout << std::setw(12) << std::setprecision(7)
+                      << "max err: " << report.max_mismatch_abs_err << std::endl;
         }
     }
-    return true;
+
+    return report.pass;
+}
+
+template <typename T>
+CheckErrConfig make_check_err_config(double rtol, double atol)
+{
+    CheckErrConfig config = get_default_check_err_config<T>();
+
+    config.rtol = rtol;
+    config.atol = atol;
+
+    // matches the number of mismatches the serial implementation used to print
+    config.max_num_recorded_mismatch = 4;
+
+    return config;
+}
+
+} // namespace detail
+
+template <typename T, typename OutAllocator, typename RefAllocator = std::allocator<T>>
+typename std::enable_if<std::is_floating_point<T>::value && !std::is_same<T, half_t>::value,
+                        bool>::type
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-5,
+          double atol            = 1e-8)
+{
+    return detail::check_err_and_log(out, ref, msg, detail::make_check_err_config<T>(rtol, atol));
+}
+
+template <typename T, typename OutAllocator, typename RefAllocator = std::allocator<T>>
+typename std::enable_if<std::is_same<T, bhalf_t>::value, bool>::type
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-3,
+          double atol            = 1e-3)
+{
+    return detail::check_err_and_log(out, ref, msg, detail::make_check_err_config<T>(rtol, atol));
+}
+
+template <typename T, typename OutAllocator, typename RefAllocator = std::allocator<T>>
+typename std::enable_if<std::is_same<T, half_t>::value || std::is_same<T, half_float::half>::value,
+                        bool>::type
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-3,
+          double atol            = 1e-3)
+{
+    return detail::check_err_and_log(out, ref, msg, detail::make_check_err_config<T>(rtol, atol));
+}
+
+template <typename T, typename OutAllocator, typename RefAllocator = std::allocator<T>>
+typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bhalf_t>::value, bool>::type
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double                 = 0,
+          double                 = 0)
+{
+    // integers have to match exactly, report the first mismatch only
+    CheckErrConfig config = detail::make_check_err_config<T>(0, 0);
+
+    config.early_exit                = true;
+    config.max_num_recorded_mismatch = 1;
+
+    return detail::check_err_and_log(out, ref, msg, config);
 }
 
 } // namespace utils
 } // namespace ck
 
-template <typename T>
-std::ostream& operator<<(std::ostream& os, const std::vector<T>& v)
+template <typename T, typename Allocator>
+std::ostream& operator<<(std::ostream& os, const std::vector<T, Allocator>& v)
 {
     std::copy(std::begin(v), std::end(v), std::ostream_iterator<T>(os, " "));
     return os;
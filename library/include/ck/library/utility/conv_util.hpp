@@ -4,22 +4,27 @@
 #include <functional>
 #include <iterator>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <tuple>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 #include "check_err.hpp"
 #include "config.hpp"
 #include "device.hpp"
 #include "device_conv_fwd.hpp"
+#include "device_operation_registry.hpp"
 #include "device_tensor.hpp"
 #include "element_wise_operation.hpp"
 #include "fill.hpp"
 #include "host_tensor.hpp"
 #include "op_instance_engine.hpp"
+#include "reference_cache.hpp"
 #include "reference_conv_fwd.hpp"
 #include "tensor_layout.hpp"
+#include "tuning_db.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -30,28 +35,17 @@ using DeviceConvFwdNoOpPtr = DeviceConvFwdPtr<element_wise::PassThrough,
                                               element_wise::PassThrough>;
 namespace device_conv1d_fwd_instance {
 
-void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_f16_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_f32_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_int8_instances(std::vector<DeviceConvFwdNoOpPtr>&);
+const DeviceOperationRegistry<DeviceConvFwdNoOpPtr>& get_device_conv1d_fwd_registry();
 
 } // namespace device_conv1d_fwd_instance
 namespace device_conv2d_fwd_instance {
 
-void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv2d_fwd_xdl_c_shuffle_nhwc_kyxc_nhwk_f16_instances(
-    std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances(std::vector<DeviceConvFwdNoOpPtr>&);
+const DeviceOperationRegistry<DeviceConvFwdNoOpPtr>& get_device_conv2d_fwd_registry();
 
 } // namespace device_conv2d_fwd_instance
 namespace device_conv3d_fwd_instance {
 
-void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_bf16_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f16_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_instances(std::vector<DeviceConvFwdNoOpPtr>&);
-void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_int8_instances(std::vector<DeviceConvFwdNoOpPtr>&);
+const DeviceOperationRegistry<DeviceConvFwdNoOpPtr>& get_device_conv3d_fwd_registry();
 
 } // namespace device_conv3d_fwd_instance
 
@@ -279,117 +273,84 @@ void run_reference_convolution_forward(const ConvParams& params,
     ref_invoker.Run(ref_argument);
 }
 
-template <typename InDataType, typename WeiDataType, typename OutDataType>
-struct ConvolutionFwdInstances;
-
-template <>
-struct ConvolutionFwdInstances<float, float, float>
+template <typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename InElementwiseOp  = ck::tensor_operation::element_wise::PassThrough,
+          typename WeiElementwiseOp = ck::tensor_operation::element_wise::PassThrough,
+          typename OutElementwiseOp = ck::tensor_operation::element_wise::PassThrough>
+TuningProblem make_conv_fwd_tuning_problem(const ConvParams& params)
 {
-    template <int NumDimSpatial,
-              typename std::enable_if<NumDimSpatial >= 1 && NumDimSpatial <= 3, bool>::type = false>
-    static std::vector<DeviceConvFwdNoOpPtr> Get()
-    {
-        std::vector<DeviceConvFwdNoOpPtr> conv_ptrs;
-        if constexpr(NumDimSpatial == 1)
-        {
-            ck::tensor_operation::device::device_conv1d_fwd_instance::
-                add_device_conv1d_fwd_xdl_nwc_kxc_nwk_f32_instances(conv_ptrs);
-        }
-        else if constexpr(NumDimSpatial == 2)
-        {
-            ck::tensor_operation::device::device_conv2d_fwd_instance::
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances(conv_ptrs);
-        }
-        else if constexpr(NumDimSpatial == 3)
-        {
-            ck::tensor_operation::device::device_conv3d_fwd_instance::
-                add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_instances(conv_ptrs);
-        }
-        return conv_ptrs;
-    }
-};
+    std::ostringstream config;
 
-template <>
-struct ConvolutionFwdInstances<half_t, half_t, half_t>
-{
-    template <int NumDimSpatial,
-              typename std::enable_if<NumDimSpatial >= 1 && NumDimSpatial <= 3, bool>::type = false>
-    static std::vector<DeviceConvFwdNoOpPtr> Get()
-    {
-        std::vector<DeviceConvFwdNoOpPtr> conv_ptrs;
-        if constexpr(NumDimSpatial == 1)
-        {
-            ck::tensor_operation::device::device_conv1d_fwd_instance::
-                add_device_conv1d_fwd_xdl_nwc_kxc_nwk_f16_instances(conv_ptrs);
-            return conv_ptrs;
-        }
-        else if constexpr(NumDimSpatial == 2)
-        {
-            ck::tensor_operation::device::device_conv2d_fwd_instance::
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances(conv_ptrs);
-            ck::tensor_operation::device::device_conv2d_fwd_instance::
-                add_device_conv2d_fwd_xdl_c_shuffle_nhwc_kyxc_nhwk_f16_instances(conv_ptrs);
-        }
-        else if constexpr(NumDimSpatial == 3)
-        {
-            ck::tensor_operation::device::device_conv3d_fwd_instance::
-                add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f16_instances(conv_ptrs);
-        }
-        return conv_ptrs;
-    }
-};
+    config << get_tuning_data_type_name<InDataType>() << " "
+           << get_tuning_data_type_name<WeiDataType>() << " "
+           << get_tuning_data_type_name<OutDataType>() << " " << InLayout::name << " "
+           << WeiLayout::name << " " << OutLayout::name << " " << typeid(InElementwiseOp).name()
+           << " " << typeid(WeiElementwiseOp).name() << " " << typeid(OutElementwiseOp).name();
+
+    TuningProblem problem{"conv_fwd", config.str(), {params.N_, params.K_, params.C_}};
+
+    for(const auto* v : {&params.filter_spatial_lengths_,
+                         &params.input_spatial_lengths_,
+                         &params.conv_filter_strides_,
+                         &params.conv_filter_dilations_,
+                         &params.input_left_pads_,
+                         &params.input_right_pads_})
+        problem.lengths.insert(problem.lengths.end(), v->begin(), v->end());
 
-template <>
-struct ConvolutionFwdInstances<bhalf_t, bhalf_t, bhalf_t>
+    return problem;
+}
+
+// names of the types in the keys of instance registries
+template <typename DataType>
+std::string get_conv_instance_data_type_name()
 {
-    template <int NumDimSpatial,
-              typename std::enable_if<NumDimSpatial >= 1 && NumDimSpatial <= 3, bool>::type = false>
-    static std::vector<DeviceConvFwdNoOpPtr> Get()
-    {
-        std::vector<DeviceConvFwdNoOpPtr> conv_ptrs;
-        if constexpr(NumDimSpatial == 1)
-        {
-            ck::tensor_operation::device::device_conv1d_fwd_instance::
-                add_device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_instances(conv_ptrs);
-        }
-        else if constexpr(NumDimSpatial == 2)
-        {
-            ck::tensor_operation::device::device_conv2d_fwd_instance::
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances(conv_ptrs);
-        }
-        else if constexpr(NumDimSpatial == 3)
-        {
-            ck::tensor_operation::device::device_conv3d_fwd_instance::
-                add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_bf16_instances(conv_ptrs);
-        }
-        return conv_ptrs;
-    }
-};
+    if constexpr(std::is_same<DataType, float>::value)
+        return "f32";
+    else if constexpr(std::is_same<DataType, half_t>::value)
+        return "f16";
+    else if constexpr(std::is_same<DataType, bhalf_t>::value)
+        return "bf16";
+    else if constexpr(std::is_same<DataType, int8_t>::value)
+        return "int8";
+    else
+        return "";
+}
 
-template <>
-struct ConvolutionFwdInstances<int8_t, int8_t, int8_t>
+// Forward convolution instances of the registry of NumDimSpatial, made from the factories of the
+// groups for the data type only when they are asked for.
+template <typename InDataType, typename WeiDataType, typename OutDataType>
+struct ConvolutionFwdInstances
 {
+    static_assert(std::is_same<InDataType, WeiDataType>::value &&
+                      std::is_same<InDataType, OutDataType>::value,
+                  "wrong! there are only forward convolution instances of a single data type");
+
     template <int NumDimSpatial,
               typename std::enable_if<NumDimSpatial >= 1 && NumDimSpatial <= 3, bool>::type = false>
     static std::vector<DeviceConvFwdNoOpPtr> Get()
     {
-        std::vector<DeviceConvFwdNoOpPtr> conv_ptrs;
+        namespace device = ck::tensor_operation::device;
+
+        const std::string data_type = get_conv_instance_data_type_name<InDataType>();
+
+        const auto is_data_type = [&](const device::DeviceOperationKey& key) {
+            return key.data_type == data_type;
+        };
+
         if constexpr(NumDimSpatial == 1)
-        {
-            ck::tensor_operation::device::device_conv1d_fwd_instance::
-                add_device_conv1d_fwd_xdl_nwc_kxc_nwk_int8_instances(conv_ptrs);
-        }
+            return device::device_conv1d_fwd_instance::get_device_conv1d_fwd_registry().Make(
+                is_data_type);
         else if constexpr(NumDimSpatial == 2)
-        {
-            ck::tensor_operation::device::device_conv2d_fwd_instance::
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances(conv_ptrs);
-        }
-        else if constexpr(NumDimSpatial == 3)
-        {
-            ck::tensor_operation::device::device_conv3d_fwd_instance::
-                add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_int8_instances(conv_ptrs);
-        }
-        return conv_ptrs;
+            return device::device_conv2d_fwd_instance::get_device_conv2d_fwd_registry().Make(
+                is_data_type);
+        else
+            return device::device_conv3d_fwd_instance::get_device_conv3d_fwd_registry().Make(
+                is_data_type);
     }
 };
 
@@ -423,13 +384,19 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
     ConvFwdOpInstance(const ConvParams& params,
                       bool do_init                         = true,
                       const InputInitFun& input_init_f     = InputInitFun{},
-                      const WeightsInitFun& weights_init_f = WeightsInitFun{})
+                      const WeightsInitFun& weights_init_f = WeightsInitFun{},
+                      const InElementwiseOp& in_element_op   = InElementwiseOp{},
+                      const WeiElementwiseOp& wei_element_op = WeiElementwiseOp{},
+                      const OutElementwiseOp& out_element_op = OutElementwiseOp{})
         : BaseType(),
           params_{params},
           output_spatial_lengths_{params.GetOutputSpatialLengths()},
           do_init_{do_init},
           input_init_f_{input_init_f},
-          weights_init_f_{weights_init_f}
+          weights_init_f_{weights_init_f},
+          in_element_op_{in_element_op},
+          wei_element_op_{wei_element_op},
+          out_element_op_{out_element_op}
     {
     }
 
@@ -449,16 +416,27 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
                            std::begin(params_.filter_spatial_lengths_),
                            std::end(params_.filter_spatial_lengths_));
 
-        auto input = std::make_unique<Tensor<InDataType>>(
-            get_host_tensor_descriptor(input_dims, InLayout{}));
-        auto weights = std::make_unique<Tensor<WeiDataType>>(
-            get_host_tensor_descriptor(filter_dims, WeiLayout{}));
+        TensorPtr<InDataType> input;
+        TensorPtr<WeiDataType> weights;
 
         if(do_init_)
         {
+            // the init functions overwrite every element, skip zeroing them first
+            input = std::make_unique<Tensor<InDataType>>(
+                get_host_tensor_descriptor(input_dims, InLayout{}), HostTensorNoInit{});
+            weights = std::make_unique<Tensor<WeiDataType>>(
+                get_host_tensor_descriptor(filter_dims, WeiLayout{}), HostTensorNoInit{});
+
             input_init_f_(input->begin(), input->end());
             weights_init_f_(weights->begin(), weights->end());
         }
+        else
+        {
+            input = std::make_unique<Tensor<InDataType>>(
+                get_host_tensor_descriptor(input_dims, InLayout{}));
+            weights = std::make_unique<Tensor<WeiDataType>>(
+                get_host_tensor_descriptor(filter_dims, WeiLayout{}));
+        }
 
         return std::make_tuple(std::move(input), std::move(weights));
     }
@@ -532,9 +510,9 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
             params_.conv_filter_dilations_,
             params_.input_left_pads_,
             params_.input_right_pads_,
-            InElementwiseOp{},
-            WeiElementwiseOp{},
-            OutElementwiseOp{});
+            in_element_op_,
+            wei_element_op_,
+            out_element_op_);
     }
 
     virtual std::size_t GetFlops() const override
@@ -556,12 +534,64 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
                                                                output_spatial_lengths_);
     }
 
+    // the implicit GEMM: one row per output pixel, one column per filter, C * filter taps deep
+    virtual std::optional<GemmCostProblem> GetGemmCostProblem() const override
+    {
+        int64_t M = params_.N_;
+        int64_t K = params_.C_;
+
+        for(const auto length : output_spatial_lengths_)
+            M *= length;
+
+        for(const auto length : params_.filter_spatial_lengths_)
+            K *= length;
+
+        return GemmCostProblem{M,
+                               params_.K_,
+                               K,
+                               1,
+                               static_cast<int64_t>(sizeof(InDataType)),
+                               static_cast<int64_t>(sizeof(WeiDataType)),
+                               static_cast<int64_t>(sizeof(OutDataType))};
+    }
+
+    virtual std::string GetReferenceCacheDescription() const override
+    {
+        // the input contents are added to the key by the run engine, the reference output only
+        // depends on the layouts, element-wise operations and convolution parameters here
+        std::ostringstream os;
+
+        os << "conv_fwd " << InLayout::name << " " << WeiLayout::name << " " << OutLayout::name
+           << " " << typeid(OutDataType).name()
+           << "\nin_element_op " << get_reference_cache_op_state(in_element_op_)
+           << "\nwei_element_op " << get_reference_cache_op_state(wei_element_op_)
+           << "\nout_element_op " << get_reference_cache_op_state(out_element_op_)
+           << "\nN " << params_.N_ << " K " << params_.K_ << " C " << params_.C_;
+
+        auto log_param = [&](const char* name, const std::vector<ck::index_t>& v) {
+            os << "\n" << name << " {";
+            LogRange(os, v, ", ") << "}";
+        };
+
+        log_param("filter_spatial_lengths", params_.filter_spatial_lengths_);
+        log_param("input_spatial_lengths", params_.input_spatial_lengths_);
+        log_param("conv_filter_strides", params_.conv_filter_strides_);
+        log_param("conv_filter_dilations", params_.conv_filter_dilations_);
+        log_param("input_left_pads", params_.input_left_pads_);
+        log_param("input_right_pads", params_.input_right_pads_);
+
+        return os.str();
+    }
+
     private:
     const ConvParams& params_;
     const std::vector<ck::index_t> output_spatial_lengths_;
     const bool do_init_;
-    const InputInitFun& input_init_f_;
-    const WeightsInitFun& weights_init_f_;
+    const InputInitFun input_init_f_;
+    const WeightsInitFun weights_init_f_;
+    const InElementwiseOp in_element_op_;
+    const WeiElementwiseOp wei_element_op_;
+    const OutElementwiseOp out_element_op_;
 };
 
 } // namespace conv
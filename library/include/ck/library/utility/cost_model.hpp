@@ -0,0 +1,478 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "device_base.hpp"
+
+namespace ck {
+namespace utils {
+
+/**
+ * @brief      Resources and throughput of the GPU the cost model predicts for.
+ *
+ *             The defaults describe an MI100 class device (CDNA, 120 compute
+ *             units). Only ratios between predictions are meaningful, so the
+ *             throughput figures need to be right relative to each other, not
+ *             exact.
+ */
+struct GpuCostModelConfig
+{
+    int64_t num_cu                = 120;
+    int64_t num_simd_per_cu       = 4;
+    int64_t wave_size             = 64;
+    int64_t max_waves_per_simd    = 10;
+    int64_t max_workgroups_per_cu = 16;
+    int64_t lds_bytes_per_cu      = 65536;
+    int64_t vgprs_per_simd_lane   = 512;
+    // registers a thread holds besides its accumulator tile (addresses, A/B fragments, ...)
+    int64_t base_vgprs = 64;
+    // waves a SIMD needs in flight to hide the latency of global memory
+    int64_t min_waves_per_simd = 2;
+
+    // matrix core throughput for 4 byte (fp32) and for 1 and 2 byte data types
+    double fp32_flops_per_cu_per_cycle = 256;
+    double fp16_flops_per_cu_per_cycle = 1024;
+
+    // bandwidth of the L2 and of DRAM, shared by all compute units
+    double l2_bytes_per_cycle   = 2048;
+    double dram_bytes_per_cycle = 800;
+    double clock_ghz            = 1.5;
+
+    double GetFlopsPerCuPerCycle(int64_t element_size) const
+    {
+        return element_size >= 4 ? fp32_flops_per_cu_per_cycle : fp16_flops_per_cu_per_cycle;
+    }
+
+    // the defaults, with the number of compute units taken from CK_COST_MODEL_NUM_CU if it is set
+    static GpuCostModelConfig GetDefault()
+    {
+        GpuCostModelConfig config;
+
+        if(const char* env = std::getenv("CK_COST_MODEL_NUM_CU"))
+        {
+            const int64_t num_cu = std::atoll(env);
+
+            if(num_cu > 0)
+                config.num_cu = num_cu;
+        }
+
+        return config;
+    }
+};
+
+// A GEMM, or the implicit GEMM of a convolution: `batch` independent M x N x K products.
+struct GemmCostProblem
+{
+    int64_t M;
+    int64_t N;
+    int64_t K;
+    int64_t batch          = 1;
+    int64_t a_element_size = 2;
+    int64_t b_element_size = 2;
+    int64_t c_element_size = 2;
+};
+
+// The tile parameters of an instance the cost model depends on, see TuningParams.
+struct GemmCostTile
+{
+    int64_t block_size;
+    int64_t m_per_block;
+    int64_t n_per_block;
+    int64_t k_per_block;
+    int64_t lds_bytes = 0;
+    int64_t acc_vgprs = 0;
+
+    // The tile of an instance, nullopt for instances that are not tiled GEMMs. K per block is
+    // KPerBlock for instances that have it and K0PerBlock * K1 otherwise.
+    static std::optional<GemmCostTile>
+    FromTuningParams(const tensor_operation::device::TuningParams& params)
+    {
+        if(!params.Has("BlockSize") || !params.Has("MPerBlock") || !params.Has("NPerBlock"))
+            return std::nullopt;
+
+        int64_t k_per_block = 0;
+
+        if(params.Has("KPerBlock"))
+            k_per_block = params.Get("KPerBlock");
+        else if(params.Has("K0PerBlock") && params.Has("K1"))
+            k_per_block = params.Get("K0PerBlock") * params.Get("K1");
+        else
+            return std::nullopt;
+
+        return GemmCostTile{params.Get("BlockSize"),
+                            params.Get("MPerBlock"),
+                            params.Get("NPerBlock"),
+                            k_per_block,
+                            params.Get("LdsBytes", 0),
+                            params.Get("AccVgprs", 0)};
+    }
+};
+
+struct GemmCostEstimate
+{
+    // predicted run time, infinite if the tile does not fit on a compute unit
+    double time_ms = std::numeric_limits<double>::infinity();
+    // useful fraction of the work of the padded tiles
+    double padding_efficiency = 0;
+    // average fraction of the workgroup slots of the device that are busy
+    double wave_efficiency = 0;
+    // workgroups resident per compute unit, limited by waves, registers and LDS
+    int64_t occupancy = 0;
+    // flops per byte of global memory traffic of a workgroup
+    double arithmetic_intensity = 0;
+    bool compute_bound          = false;
+};
+
+namespace detail {
+
+inline int64_t integer_divide_ceil(int64_t a, int64_t b) { return (a + b - 1) / b; }
+
+} // namespace detail
+
+/**
+ * @brief      Predicts the run time of a tiled GEMM instance.
+ *
+ *             Every workgroup computes a padded MPerBlock x NPerBlock tile over
+ *             the padded K, so partial tiles cost as much as full ones. The
+ *             number of workgroups resident on a compute unit is the smallest
+ *             of its wave, register and LDS limits. Workgroups are spread
+ *             evenly over the compute units and the busiest one determines the
+ *             run time: it runs its workgroups in rounds of `occupancy`, so a
+ *             grid slightly larger than a multiple of the device's workgroup
+ *             slots pays for a whole extra round.
+ *
+ *             A round takes the longest of
+ *             - its math, at a throughput reduced while too few waves are
+ *               resident to hide latency,
+ *             - loading the A and B panels of all workgroups resident on the
+ *               device from L2,
+ *             - the DRAM traffic of all workgroups resident on the device.
+ *               Resident tiles are taken to form a square block of the C
+ *               matrix, whose tiles share their panels in L2.
+ *
+ * @param[in]  grid_size  The workgroups the instance launches, see
+ *                        BaseOperator::GetGridSize(), or 0 for one per tile.
+ *                        A larger grid, e.g. of a split-K instance, divides
+ *                        the work of the tiles among its workgroups.
+ */
+inline GemmCostEstimate estimate_gemm_cost(const GemmCostProblem& problem,
+                                           const GemmCostTile& tile,
+                                           int64_t grid_size                = 0,
+                                           const GpuCostModelConfig& config = GpuCostModelConfig{})
+{
+    using detail::integer_divide_ceil;
+
+    GemmCostEstimate estimate;
+
+    const int64_t m_tiles = integer_divide_ceil(problem.M, tile.m_per_block);
+    const int64_t n_tiles = integer_divide_ceil(problem.N, tile.n_per_block);
+    const int64_t k_loops = integer_divide_ceil(problem.K, tile.k_per_block);
+
+    const int64_t num_tile  = m_tiles * n_tiles * problem.batch;
+    const int64_t num_group = grid_size > 0 ? grid_size : num_tile;
+
+    const double padded_k = double(k_loops) * tile.k_per_block;
+
+    estimate.padding_efficiency = double(problem.M) * problem.N * problem.K /
+                                  (double(m_tiles) * tile.m_per_block * n_tiles *
+                                   tile.n_per_block * padded_k);
+
+    // K extent, math and L2 traffic of one workgroup
+    const double group_k     = padded_k * num_tile / num_group;
+    const double group_flops = 2. * tile.m_per_block * tile.n_per_block * group_k;
+    const double a_panel     = double(tile.m_per_block) * problem.a_element_size * group_k;
+    const double b_panel     = double(tile.n_per_block) * problem.b_element_size * group_k;
+    const double c_tile      = double(tile.m_per_block * tile.n_per_block) * problem.c_element_size;
+    const double group_bytes = a_panel + b_panel + c_tile;
+
+    estimate.arithmetic_intensity = group_flops / group_bytes;
+
+    // occupancy
+    const int64_t waves_per_group = integer_divide_ceil(tile.block_size, config.wave_size);
+    const int64_t vgprs =
+        integer_divide_ceil(tile.acc_vgprs + config.base_vgprs, int64_t{8}) * int64_t{8};
+    const int64_t waves_per_simd =
+        std::min(config.max_waves_per_simd, config.vgprs_per_simd_lane / vgprs);
+
+    int64_t occupancy = std::min(config.max_workgroups_per_cu,
+                                 waves_per_simd * config.num_simd_per_cu / waves_per_group);
+
+    if(tile.lds_bytes > 0)
+        occupancy = std::min(occupancy, config.lds_bytes_per_cu / tile.lds_bytes);
+
+    estimate.occupancy = occupancy;
+
+    if(occupancy <= 0)
+        return estimate;
+
+    const int64_t num_slot = config.num_cu * occupancy;
+
+    estimate.wave_efficiency =
+        double(num_group) / (double(integer_divide_ceil(num_group, num_slot)) * num_slot);
+
+    const double cu_flops = config.GetFlopsPerCuPerCycle(problem.a_element_size);
+
+    // cycles of a round of `num_resident` workgroups per compute unit, and if its math dominates
+    auto get_round_cycles = [&](int64_t num_resident) {
+        const double latency_hiding =
+            std::min(1., double(num_resident * waves_per_group) /
+                             double(config.num_simd_per_cu * config.min_waves_per_simd));
+
+        const int64_t num_device = std::min(num_group, config.num_cu * num_resident);
+
+        const double math = num_resident * group_flops / (cu_flops * latency_hiding);
+        const double l2   = num_device * group_bytes / config.l2_bytes_per_cycle;
+
+        const int64_t side       = static_cast<int64_t>(std::ceil(std::sqrt(double(num_device))));
+        const int64_t num_col    = n_tiles * problem.batch;
+
+        int64_t block_m = std::min(m_tiles, side);
+        int64_t block_n = integer_divide_ceil(num_device, block_m);
+
+        if(block_n > num_col)
+        {
+            block_n = num_col;
+            block_m = integer_divide_ceil(num_device, block_n);
+        }
+
+        const double dram = (block_m * a_panel + block_n * b_panel + num_device * c_tile) /
+                            config.dram_bytes_per_cycle;
+
+        return std::make_pair(std::max({math, l2, dram}), math >= std::max(l2, dram));
+    };
+
+    const int64_t groups_per_cu = integer_divide_ceil(num_group, config.num_cu);
+    const int64_t num_full      = groups_per_cu / occupancy;
+    const int64_t num_rest      = groups_per_cu % occupancy;
+
+    const auto full_round = get_round_cycles(occupancy);
+
+    double cycles          = num_full * full_round.first;
+    estimate.compute_bound = full_round.second;
+
+    if(num_rest > 0)
+    {
+        const auto rest_round = get_round_cycles(num_rest);
+
+        cycles += rest_round.first;
+
+        if(num_full == 0)
+            estimate.compute_bound = rest_round.second;
+    }
+
+    estimate.time_ms = cycles / (config.clock_ghz * 1.E6);
+
+    return estimate;
+}
+
+/**
+ * @brief      Orders the instances that support a problem by predicted time.
+ *
+ *             `make_argument(op)` has to return the argument pointer of the
+ *             problem for instance `op`. Returns the indices of the supported
+ *             instances, those with the lowest predicted time first. Instances
+ *             the model cannot describe (see GemmCostTile::FromTuningParams)
+ *             are never pruned, they come first. With `top_k` > 0 only as many
+ *             predicted instances are returned.
+ */
+template <typename OpPtr, typename MakeArgument>
+std::vector<std::size_t>
+select_best_predicted_instances(const std::vector<OpPtr>& op_ptrs,
+                                const GemmCostProblem& problem,
+                                std::size_t top_k,
+                                MakeArgument&& make_argument,
+                                const GpuCostModelConfig& config = GpuCostModelConfig::GetDefault())
+{
+    std::vector<std::size_t> selected;
+    std::vector<std::pair<double, std::size_t>> predicted;
+
+    for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+    {
+        const auto argument = make_argument(op_ptrs[i].get());
+
+        if(!op_ptrs[i]->IsSupportedArgument(argument.get()))
+            continue;
+
+        const auto tile = GemmCostTile::FromTuningParams(op_ptrs[i]->GetTuningParams());
+
+        if(!tile)
+        {
+            selected.push_back(i);
+            continue;
+        }
+
+        const auto estimate =
+            estimate_gemm_cost(problem, *tile, op_ptrs[i]->GetGridSize(argument.get()), config);
+
+        predicted.emplace_back(estimate.time_ms, i);
+    }
+
+    std::stable_sort(predicted.begin(), predicted.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    if(top_k > 0 && predicted.size() > top_k)
+        predicted.resize(top_k);
+
+    for(const auto& p : predicted)
+        selected.push_back(p.second);
+
+    return selected;
+}
+
+// Spearman's rank correlation of two equally long sequences, tied values get their average rank.
+inline double get_rank_correlation(const std::vector<double>& x, const std::vector<double>& y)
+{
+    if(x.size() != y.size())
+        throw std::invalid_argument("wrong! sequences of different length");
+
+    auto get_ranks = [](const std::vector<double>& v) {
+        std::vector<std::size_t> order(v.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(
+            order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return v[a] < v[b]; });
+
+        std::vector<double> ranks(v.size());
+
+        for(std::size_t i = 0; i < order.size();)
+        {
+            std::size_t j = i + 1;
+
+            while(j < order.size() && v[order[j]] == v[order[i]])
+                ++j;
+
+            for(std::size_t t = i; t < j; ++t)
+                ranks[order[t]] = (i + j - 1) / 2.;
+
+            i = j;
+        }
+
+        return ranks;
+    };
+
+    const auto rx = get_ranks(x);
+    const auto ry = get_ranks(y);
+
+    const double n    = double(x.size());
+    const double mean = (n - 1) / 2;
+    double cov        = 0;
+    double var_x      = 0;
+    double var_y      = 0;
+
+    for(std::size_t i = 0; i < rx.size(); ++i)
+    {
+        cov += (rx[i] - mean) * (ry[i] - mean);
+        var_x += (rx[i] - mean) * (rx[i] - mean);
+        var_y += (ry[i] - mean) * (ry[i] - mean);
+    }
+
+    if(var_x == 0 || var_y == 0)
+        return 0;
+
+    return cov / std::sqrt(var_x * var_y);
+}
+
+/**
+ * @brief      A measured instance run time with everything the model needs.
+ *
+ *             Profilers append one record per timed instance to the file named
+ *             by CK_COST_MODEL_TIMINGS, see append_gemm_timing_record(); the
+ *             tables are used to check and calibrate the model.
+ */
+struct GemmTimingRecord
+{
+    std::string instance;
+    GemmCostProblem problem;
+    GemmCostTile tile;
+    int64_t grid_size;
+    double avg_time; // ms
+};
+
+inline void append_gemm_timing_record(const std::string& path, const GemmTimingRecord& r)
+{
+    std::ofstream file(path, std::ios::app);
+
+    if(file.tellp() == 0)
+    {
+        file << "# M\tN\tK\tbatch\ta_size\tb_size\tc_size\tblock_size\tm_per_block\t"
+                "n_per_block\tk_per_block\tlds_bytes\tacc_vgprs\tgrid_size\tavg_time(ms)\t"
+                "instance\n";
+    }
+
+    file << r.problem.M << '\t' << r.problem.N << '\t' << r.problem.K << '\t' << r.problem.batch
+         << '\t' << r.problem.a_element_size << '\t' << r.problem.b_element_size << '\t'
+         << r.problem.c_element_size << '\t' << r.tile.block_size << '\t' << r.tile.m_per_block
+         << '\t' << r.tile.n_per_block << '\t' << r.tile.k_per_block << '\t' << r.tile.lds_bytes
+         << '\t' << r.tile.acc_vgprs << '\t' << r.grid_size << '\t' << std::setprecision(9)
+         << r.avg_time << '\t' << r.instance << '\n';
+}
+
+// the records in a timing table, lines that do not hold a record are skipped
+inline std::vector<GemmTimingRecord> load_gemm_timing_records(std::istream& is)
+{
+    std::vector<GemmTimingRecord> records;
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        if(line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream fields(line);
+        GemmTimingRecord r;
+
+        fields >> r.problem.M >> r.problem.N >> r.problem.K >> r.problem.batch >>
+            r.problem.a_element_size >> r.problem.b_element_size >> r.problem.c_element_size >>
+            r.tile.block_size >> r.tile.m_per_block >> r.tile.n_per_block >> r.tile.k_per_block >>
+            r.tile.lds_bytes >> r.tile.acc_vgprs >> r.grid_size >> r.avg_time;
+
+        if(!fields || r.tile.block_size <= 0 || r.tile.m_per_block <= 0 ||
+           r.tile.n_per_block <= 0 || r.tile.k_per_block <= 0)
+            continue;
+
+        std::getline(fields >> std::ws, r.instance);
+
+        records.push_back(std::move(r));
+    }
+
+    return records;
+}
+
+// Remove "--top-k <k>" from the command line. Returns k, 0 if the option is not given.
+inline std::size_t extract_top_k_arg(int& argc, char* argv[])
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--top-k") != 0)
+            continue;
+
+        if(i + 1 >= argc || std::atoi(argv[i + 1]) <= 0)
+            throw std::runtime_error("wrong! --top-k needs a positive number of instances");
+
+        const std::size_t top_k = static_cast<std::size_t>(std::atoi(argv[i + 1]));
+
+        std::copy(argv + i + 2, argv + argc + 1, argv + i);
+        argc -= 2;
+
+        return top_k;
+    }
+
+    return 0;
+}
+
+} // namespace utils
+} // namespace ck
@@ -1,50 +1,143 @@
 #pragma once
 
 #include <algorithm>
-#include <random>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <type_traits>
 
 #include "data_type.hpp"
+#include "host_philox.hpp"
+#include "host_thread_pool.hpp"
 
 namespace ck {
 namespace utils {
 
-// template <typename T, class Enable = void>
-// struct FillUniform;
-
-// TODO: what's wrong with this specialization???
-// err: segmentation fault in mt19937 - infinite loop like.
-// template <typename T>
-// struct FillUniform<T, typename std::enable_if<std::is_integral<T>::value &&
-//                                               !std::is_same<T, bhalf_t>::value>::type>
-// {
-//     int a_{0};
-//     int b_{5};
-//     // T a_ = T{0};
-//     // T b_ = T{5};
-
-//     template <typename ForwardIter>
-//     void operator()(ForwardIter first, ForwardIter last) const
-//     {
-//         std::mt19937 gen{11939};
-//         std::uniform_int_distribution<int> dis(a_, b_);
-//         std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
-//     }
-// };
-
-// struct FillUniform<T, typename std::enable_if<std::is_floating_point<T>::value ||
-//                                               std::is_same<T, bhalf_t>::value>::type>
+namespace detail {
+
+// bhalf_t is stored in an integer type, so it has to be converted from float explicitly
+template <typename T, typename V>
+T convert_random_value(V v)
+{
+    if constexpr(std::is_same<T, bhalf_t>::value)
+        return type_convert<bhalf_t>(static_cast<float>(v));
+    else
+        return type_convert<T>(v);
+}
+
+// Fill [first, last) from the Philox stream of seed: element i is generated from stream word i
+// (and its pair partner for the normal distribution), so the result is the same for any
+// number of threads. generate(words, num_word, values) converts a chunk of words to values.
+template <typename T, typename V, typename ForwardIter, typename Generate>
+void philox_fill(ForwardIter first, ForwardIter last, uint64_t seed, Generate generate)
+{
+    constexpr std::size_t chunk_size = 1024;
+
+    const std::size_t n         = std::distance(first, last);
+    const std::size_t num_chunk = (n + chunk_size - 1) / chunk_size;
+
+    auto fill_chunk = [&](std::size_t ic, ForwardIter it) {
+        uint32_t words[chunk_size];
+        V values[chunk_size];
+
+        const std::size_t begin    = ic * chunk_size;
+        const std::size_t count    = std::min(chunk_size, n - begin);
+        const std::size_t num_word = (count + 3) / 4 * 4;
+
+        Philox4x32::GenerateWords(seed, 0, begin, num_word, words);
+
+        generate(words, num_word, values);
+
+        for(std::size_t i = 0; i < count; ++i, ++it)
+            *it = convert_random_value<T>(values[i]);
+    };
+
+    using Category = typename std::iterator_traits<ForwardIter>::iterator_category;
+
+    if constexpr(std::is_base_of<std::random_access_iterator_tag, Category>::value)
+    {
+        host_parallel_for(num_chunk,
+                          std::thread::hardware_concurrency(),
+                          [&](std::size_t ic_begin, std::size_t ic_end) {
+                              for(std::size_t ic = ic_begin; ic < ic_end; ++ic)
+                                  fill_chunk(ic, first + ic * chunk_size);
+                          });
+    }
+    else
+    {
+        for(std::size_t ic = 0; ic < num_chunk; ++ic)
+        {
+            fill_chunk(ic, first);
+
+            // the last chunk may be short, stepping a whole chunk would go past last
+            std::advance(first, std::min(chunk_size, n - ic * chunk_size));
+        }
+    }
+}
+
+} // namespace detail
+
+// uniform real values in [a_, b_)
 template <typename T>
 struct FillUniform
 {
     float a_{0};
     float b_{5};
+    uint64_t seed_{11939};
 
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen{11939};
-        std::uniform_real_distribution<> dis(a_, b_);
-        std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
+        detail::philox_fill<T, float>(
+            first, last, seed_, [&](const uint32_t* words, std::size_t n, float* values) {
+                for(std::size_t i = 0; i < n; ++i)
+                    values[i] = a_ + philox_to_uniform(words[i]) * (b_ - a_);
+            });
+    }
+};
+
+// uniform integer values in [min_, max_)
+template <typename T>
+struct FillUniformInteger
+{
+    int min_{0};
+    int max_{5};
+    uint64_t seed_{11939};
+
+    template <typename ForwardIter>
+    void operator()(ForwardIter first, ForwardIter last) const
+    {
+        const uint32_t range = static_cast<uint32_t>(int64_t{max_} - min_);
+
+        detail::philox_fill<T, int>(
+            first, last, seed_, [&](const uint32_t* words, std::size_t n, int* values) {
+                for(std::size_t i = 0; i < n; ++i)
+                    values[i] = min_ + static_cast<int>(philox_to_integer(words[i], range));
+            });
+    }
+};
+
+// normally distributed values
+template <typename T>
+struct FillNormal
+{
+    float mean_{0};
+    float stddev_{1};
+    uint64_t seed_{11939};
+
+    template <typename ForwardIter>
+    void operator()(ForwardIter first, ForwardIter last) const
+    {
+        detail::philox_fill<T, float>(
+            first, last, seed_, [&](const uint32_t* words, std::size_t n, float* values) {
+                for(std::size_t i = 0; i < n; i += 2)
+                {
+                    philox_to_normal(words[i], words[i + 1], values[i], values[i + 1]);
+
+                    values[i]     = mean_ + stddev_ * values[i];
+                    values[i + 1] = mean_ + stddev_ * values[i + 1];
+                }
+            });
     }
 };
 
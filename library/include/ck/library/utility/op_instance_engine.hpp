@@ -3,14 +3,21 @@
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "check_err.hpp"
+#include "cost_model.hpp"
 #include "device_base.hpp"
 #include "functional2.hpp"
+#include "profile_result.hpp"
+#include "reference_cache.hpp"
+#include "tuning_db.hpp"
 
 namespace ck {
 namespace utils {
@@ -18,9 +25,12 @@ namespace utils {
 struct ProfileBestConfig
 {
     std::string best_op_name;
-    float best_avg_time   = std::numeric_limits<float>::max();
-    float best_tflops     = std::numeric_limits<float>::max();
-    float best_gb_per_sec = std::numeric_limits<float>::max();
+    // get_tuning_instance_key() of the best instance
+    std::string best_op_key;
+    float best_avg_time    = std::numeric_limits<float>::max();
+    float best_tflops      = std::numeric_limits<float>::max();
+    float best_gb_per_sec  = std::numeric_limits<float>::max();
+    float best_median_time = std::numeric_limits<float>::max();
 };
 
 /**
@@ -57,6 +67,14 @@ class OpInstance
                         const DeviceMemPtr&) const = 0;
     virtual std::size_t GetFlops() const           = 0;
     virtual std::size_t GetBtype() const           = 0;
+
+    // Describes the operation and its parameters for keying cached reference outputs, see
+    // ReferenceCacheKey. Reference outputs of instances returning an empty string are not cached.
+    virtual std::string GetReferenceCacheDescription() const { return {}; }
+
+    // The (implicit) GEMM the operation computes, for ranking instances with the cost model, see
+    // estimate_gemm_cost(). All instances of operations without one are profiled.
+    virtual std::optional<GemmCostProblem> GetGemmCostProblem() const { return std::nullopt; }
 };
 
 /**
@@ -89,7 +107,23 @@ class OpInstanceRunEngine
                                          Tensor<OutDataType>&>)
         {
             ref_output_ = op_instance_.GetOutputTensor();
-            CallRefOpUnpackArgs(reference_op, std::make_index_sequence<kNInArgs_>{});
+
+            const ReferenceCache& cache   = ReferenceCache::GetDefault();
+            const std::string description = op_instance_.GetReferenceCacheDescription();
+
+            if(cache.IsEnabled() && !description.empty())
+            {
+                ReferenceCacheKey key{description};
+                AddInputsToKey(key, std::make_index_sequence<kNInArgs_>{});
+
+                cache.LoadOrCompute(key, *ref_output_, [&] {
+                    CallRefOpUnpackArgs(reference_op, std::make_index_sequence<kNInArgs_>{});
+                });
+            }
+            else
+            {
+                CallRefOpUnpackArgs(reference_op, std::make_index_sequence<kNInArgs_>{});
+            }
         }
         AllocateDeviceInputTensors(std::make_index_sequence<kNInArgs_>{});
         out_device_buffer_ =
@@ -119,31 +153,103 @@ class OpInstanceRunEngine
                         " You have to provide reference function.");
                 }
                 // TODO: enable flexible use of custom check_error functions
-                res = res && check_err(out_tensor_->mData, ref_output_->mData);
+                if(res)
+                {
+                    // only pass/fail is needed here, stop at the first mismatch
+                    CheckErrConfig config = get_default_check_err_config<OutDataType>();
+                    config.early_exit     = true;
+
+                    const auto report = check_err_report(*out_tensor_, *ref_output_, config);
+
+                    if(!report.pass)
+                    {
+                        report.Print(std::cout);
+                        res = false;
+                    }
+                }
                 out_device_buffer_->SetZero();
             }
         }
         return res;
     }
 
+    // Profile the instances in `op_ptrs`. With `top_k` > 0 only the `top_k` instances the cost
+    // model predicts to be fastest are run, if the operation describes its GEMM problem. With
+    // CK_TUNING_DB_LOOKUP set, only the instance the tuning database picks for `tuning_problem`
+    // is run, if it has one.
     template <typename OpInstancePtr>
     ProfileBestConfig Profile(const std::vector<OpInstancePtr>& op_ptrs,
-                              bool time_kernel     = false,
-                              bool do_verification = false,
-                              bool do_log          = false)
+                              bool time_kernel                                  = false,
+                              bool do_verification                              = false,
+                              bool do_log                                       = false,
+                              std::size_t top_k                                 = 0,
+                              const std::optional<TuningProblem>& tuning_problem = std::nullopt)
     {
         bool res{true};
         ProfileBestConfig best_config;
 
-        for(auto& op_ptr : op_ptrs)
+        const auto cost_problem = op_instance_.GetGemmCostProblem();
+        const char* timing_path = std::getenv("CK_COST_MODEL_TIMINGS");
+
+        auto make_argument_ptr = [&](tensor_operation::device::BaseOperator* op) {
+            return op_instance_.MakeArgumentPointer(op, in_device_buffers_, out_device_buffer_);
+        };
+
+        std::vector<std::size_t> instance_ids(op_ptrs.size());
+        std::iota(instance_ids.begin(), instance_ids.end(), 0);
+
+        std::optional<std::size_t> tuned_instance_id;
+
+        if(tuning_problem)
+        {
+            tuned_instance_id = find_tuned_instance_id(op_ptrs, *tuning_problem, [&](auto& op) {
+                return op.IsSupportedArgument(make_argument_ptr(&op).get());
+            });
+        }
+
+        if(tuned_instance_id)
         {
+            instance_ids = {*tuned_instance_id};
+
+            std::cout << "Profiling the instance picked by the tuning database" << std::endl;
+        }
+        else if(top_k > 0 && cost_problem)
+        {
+            instance_ids =
+                select_best_predicted_instances(op_ptrs, *cost_problem, top_k, make_argument_ptr);
+
+            std::cout << "Profiling " << instance_ids.size() << " of " << op_ptrs.size()
+                      << " instances, ranked by the cost model" << std::endl;
+        }
+
+        for(std::size_t instance_id : instance_ids)
+        {
+            auto& op_ptr  = op_ptrs[instance_id];
             auto invoker  = op_instance_.MakeInvokerPointer(op_ptr.get());
             auto argument = op_instance_.MakeArgumentPointer(
                 op_ptr.get(), in_device_buffers_, out_device_buffer_);
             if(op_ptr->IsSupportedArgument(argument.get()))
             {
                 std::string op_name = op_ptr->GetTypeString();
-                float avg_time = invoker->Run(argument.get(), StreamConfig{nullptr, time_kernel});
+                KernelTimingResult timing;
+
+                float avg_time =
+                    invoker->Run(argument.get(), get_timing_stream_config(time_kernel, &timing));
+
+                if(time_kernel && timing_path != nullptr && cost_problem)
+                {
+                    const auto tile = GemmCostTile::FromTuningParams(op_ptr->GetTuningParams());
+
+                    if(tile)
+                    {
+                        append_gemm_timing_record(timing_path,
+                                                  {op_name,
+                                                   *cost_problem,
+                                                   *tile,
+                                                   op_ptr->GetGridSize(argument.get()),
+                                                   avg_time});
+                    }
+                }
 
                 std::size_t flops     = op_instance_.GetFlops();
                 std::size_t num_btype = op_instance_.GetBtype();
@@ -153,14 +259,22 @@ class OpInstanceRunEngine
                 std::cout << "Perf: " << avg_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                           << " GB/s, " << op_name << std::endl;
 
-                if(tflops < best_config.best_tflops)
+                print_kernel_timing_result(std::cout, timing);
+
+                // rank by the median run, which the occasional slow run does not skew
+                if(best_config.best_op_name.empty() ||
+                   timing.median < best_config.best_median_time)
                 {
-                    best_config.best_op_name    = op_name;
-                    best_config.best_tflops     = tflops;
-                    best_config.best_gb_per_sec = gb_per_sec;
-                    best_config.best_avg_time   = avg_time;
+                    best_config.best_op_name     = op_name;
+                    best_config.best_op_key      = get_tuning_instance_key(*op_ptr);
+                    best_config.best_tflops      = tflops;
+                    best_config.best_gb_per_sec  = gb_per_sec;
+                    best_config.best_avg_time    = avg_time;
+                    best_config.best_median_time = timing.median;
                 }
 
+                auto verification = ProfileVerification::NotRun;
+
                 if(do_verification)
                 {
                     out_device_buffer_->FromDevice(out_tensor_->mData.data());
@@ -171,10 +285,17 @@ class OpInstanceRunEngine
                             " You have to provide reference function.");
                     }
                     // TODO: enable flexible use of custom check_error functions
-                    res = res && CheckErr(out_tensor_->mData, ref_output_->mData);
+                    const bool pass = CheckErr(out_tensor_->mData, ref_output_->mData);
+
+                    res          = res && pass;
+                    verification = pass ? ProfileVerification::Pass : ProfileVerification::Fail;
 
                     if(do_log) {}
                 }
+
+                report_profile_result(
+                    {op_name, avg_time, tflops, gb_per_sec, verification, timing});
+
                 out_device_buffer_->SetZero();
             }
         }
@@ -191,6 +312,12 @@ class OpInstanceRunEngine
         f(*std::get<Is>(in_tensors_)..., *ref_output_);
     }
 
+    template <std::size_t... Is>
+    void AddInputsToKey(ReferenceCacheKey& key, std::index_sequence<Is...>) const
+    {
+        (key.AddInput(*std::get<Is>(in_tensors_)), ...);
+    }
+
     template <std::size_t... Is>
     void AllocateDeviceInputTensors(std::index_sequence<Is...>)
     {
@@ -220,8 +347,9 @@ class OpInstanceRunEngine
     DeviceBuffers in_device_buffers_;
     DeviceMemPtr out_device_buffer_;
 
-    template <typename T>
-    bool CheckErr(const std::vector<T>& dev_out, const std::vector<T>& ref_out) const
+    template <typename T, typename Allocator>
+    bool CheckErr(const std::vector<T, Allocator>& dev_out,
+                  const std::vector<T, Allocator>& ref_out) const
     {
         return ck::utils::check_err(dev_out, ref_out, "Error: incorrect results!", atol_, rtol_);
     }
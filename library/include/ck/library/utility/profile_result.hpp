@@ -0,0 +1,94 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kernel_timing.hpp"
+
+namespace ck {
+namespace utils {
+
+enum struct ProfileVerification
+{
+    NotRun,
+    Pass,
+    Fail,
+};
+
+inline const char* get_profile_verification_name(ProfileVerification verification)
+{
+    switch(verification)
+    {
+    case ProfileVerification::Pass: return "pass";
+    case ProfileVerification::Fail: return "fail";
+    default: return "none";
+    }
+}
+
+// the measurement of one instance on one problem
+struct ProfileResult
+{
+    std::string instance;
+    float avg_time; // ms
+    float tflops;
+    float gb_per_sec;
+    ProfileVerification verification;
+    // statistics of the timed runs, without samples if the kernels were not timed
+    KernelTimingResult timing;
+};
+
+// print the spread of the run times of an instance below its "Perf:" line
+inline void print_kernel_timing_result(std::ostream& os, const KernelTimingResult& timing)
+{
+    if(timing.samples.empty())
+        return;
+
+    os << "      " << timing.samples.size() << " runs: min " << timing.min << " ms, median "
+       << timing.median << " ms, p90 " << timing.p90 << " ms, p99 " << timing.p99
+       << " ms, stddev " << timing.stddev << " ms, " << timing.num_outlier << " outliers"
+       << std::endl;
+}
+
+/**
+ * @brief      Collects the results profilers report while it is alive.
+ *
+ *             Profilers print their results for humans and also pass them to
+ *             report_profile_result(), which hands them to the innermost live
+ *             collector. A batch run installs one per problem to write the
+ *             results in a machine-readable form.
+ */
+class ProfileResultCollector
+{
+    public:
+    ProfileResultCollector() : outer_(GetCurrent()) { GetCurrent() = this; }
+    ~ProfileResultCollector() { GetCurrent() = outer_; }
+
+    ProfileResultCollector(const ProfileResultCollector&) = delete;
+    ProfileResultCollector& operator=(const ProfileResultCollector&) = delete;
+
+    static ProfileResultCollector*& GetCurrent()
+    {
+        static ProfileResultCollector* current = nullptr;
+
+        return current;
+    }
+
+    void Add(ProfileResult result) { results_.push_back(std::move(result)); }
+
+    const std::vector<ProfileResult>& GetResults() const { return results_; }
+
+    private:
+    ProfileResultCollector* outer_;
+    std::vector<ProfileResult> results_;
+};
+
+inline void report_profile_result(ProfileResult result)
+{
+    if(ProfileResultCollector* collector = ProfileResultCollector::GetCurrent())
+        collector->Add(std::move(result));
+}
+
+} // namespace utils
+} // namespace ck
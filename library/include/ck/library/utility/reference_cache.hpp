@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include <sys/stat.h>
+
+#include "host_tensor.hpp"
+#include "host_tensor_file.hpp"
+#include "host_thread_pool.hpp"
+
+namespace ck {
+namespace utils {
+
+/**
+ * @brief      Identifies the output of a reference computation.
+ *
+ *             The key text holds the cache format version and the description
+ *             of the operation (its kind, problem parameters, layouts and
+ *             element-wise operations with their state, see
+ *             get_reference_cache_op_state()) followed by the data type, shape
+ *             and content digest of every input. Keying on the input contents
+ *             instead of on how they were initialised makes the key valid for
+ *             any init method and seed.
+ */
+class ReferenceCacheKey
+{
+    public:
+    // Bump when a reference implementation or the layout of the key changes, entries stored
+    // with another version are misses.
+    static constexpr int Version = 1;
+
+    explicit ReferenceCacheKey(const std::string& op_description, int version = Version)
+        : text_("ck reference cache v" + std::to_string(version) + "\n" + op_description)
+    {
+    }
+
+    template <typename T, std::size_t Rank>
+    ReferenceCacheKey& AddInput(const Tensor<T, Rank>& input)
+    {
+        std::ostringstream os;
+
+        os << "\ninput " << get_host_tensor_data_type_name(HostTensorDataTypeOf<T>::value)
+           << " lengths {";
+        LogRange(os, input.mDesc.GetLengths(), ", ") << "} strides {";
+        LogRange(os, input.mDesc.GetStrides(), ", ") << "} digest " << std::hex
+                                                      << get_host_tensor_digest(input);
+
+        text_ += os.str();
+
+        return *this;
+    }
+
+    const std::string& GetText() const { return text_; }
+
+    // FNV-1a
+    uint64_t GetHash() const
+    {
+        uint64_t h = 0xCBF29CE484222325ull;
+
+        for(char c : text_)
+        {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001B3ull;
+        }
+
+        return h;
+    }
+
+    private:
+    std::string text_;
+};
+
+// The type of element-wise operation `op` followed by its state, the bytes of its parameters
+// (e.g. the factor of a scale), for describing it in a ReferenceCacheKey.
+template <typename Op>
+std::string get_reference_cache_op_state(const Op& op)
+{
+    static_assert(std::is_trivially_copyable_v<Op>,
+                  "element-wise operations are expected to be plain structs of their parameters");
+
+    std::ostringstream os;
+
+    os << typeid(Op).name();
+
+    // the byte of an empty operation is padding and need not be equal between copies
+    if constexpr(!std::is_empty_v<Op>)
+    {
+        unsigned char bytes[sizeof(Op)];
+
+        std::memcpy(bytes, &op, sizeof(Op));
+
+        os << " {" << std::hex;
+
+        for(unsigned char b : bytes)
+            os << (b >> 4) << (b & 0xF);
+
+        os << "}";
+    }
+
+    return os.str();
+}
+
+/**
+ * @brief      Content-addressed store of reference outputs.
+ *
+ *             Every output is kept in its own tensor file, named after the hash
+ *             of its key; the full key text is stored as the file tag and
+ *             compared on lookup, so hash collisions are misses. Files are
+ *             mapped on lookup instead of read. Write failures only print a
+ *             warning, since the cache never affects results.
+ */
+class ReferenceCache
+{
+    public:
+    // a cache in `directory`, disabled if `directory` is empty
+    explicit ReferenceCache(std::string directory) : directory_(std::move(directory)) {}
+
+    // the cache in the directory named by CK_REFERENCE_CACHE_DIR, disabled if it is not set
+    static const ReferenceCache& GetDefault()
+    {
+        static const ReferenceCache cache = [] {
+            const char* env = std::getenv("CK_REFERENCE_CACHE_DIR");
+
+            return ReferenceCache(env == nullptr ? "" : env);
+        }();
+
+        return cache;
+    }
+
+    bool IsEnabled() const { return !directory_.empty(); }
+
+    std::string GetPath(const ReferenceCacheKey& key) const
+    {
+        char name[32];
+
+        std::snprintf(name, sizeof(name), "%016llx.cktensor",
+                      static_cast<unsigned long long>(key.GetHash()));
+
+        return directory_ + "/" + name;
+    }
+
+    // the cached output for `key`, if there is one with descriptor `desc`
+    template <typename T>
+    std::optional<HostTensorView<T>> Find(const ReferenceCacheKey& key,
+                                          const HostTensorDescriptor& desc) const
+    {
+        if(!IsEnabled())
+            return std::nullopt;
+
+        const std::string path = GetPath(key);
+
+        struct stat st;
+
+        if(stat(path.c_str(), &st) != 0)
+            return std::nullopt;
+
+        try
+        {
+            auto mapping = HostTensorFileMapping::Open(path);
+
+            if(mapping->GetTag() != key.GetText() ||
+               mapping->GetDataType() != HostTensorDataTypeOf<T>::value ||
+               mapping->GetDescriptor().GetLengths() != desc.GetLengths() ||
+               mapping->GetDescriptor().GetStrides() != desc.GetStrides())
+                return std::nullopt;
+
+            return make_host_tensor_view<T>(std::move(mapping));
+        }
+        catch(const std::runtime_error&)
+        {
+            // a damaged entry is a miss, it is replaced by the next Store
+            return std::nullopt;
+        }
+    }
+
+    template <typename T, std::size_t Rank>
+    void Store(const ReferenceCacheKey& key, const Tensor<T, Rank>& output) const
+    {
+        if(!IsEnabled())
+            return;
+
+        try
+        {
+            if(mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST)
+                throw std::runtime_error("failed to create " + directory_ + ": " +
+                                         std::strerror(errno));
+
+            write_host_tensor_file(GetPath(key), output, key.GetText());
+        }
+        catch(const std::runtime_error& e)
+        {
+            std::cerr << "Warning: reference output not cached: " << e.what() << std::endl;
+        }
+    }
+
+    // Fill `output` from the cache, or call `compute()` to fill it and store the result. Returns
+    // whether the output was found in the cache.
+    template <typename T, std::size_t Rank, typename Compute>
+    bool LoadOrCompute(const ReferenceCacheKey& key,
+                       Tensor<T, Rank>& output,
+                       Compute&& compute) const
+    {
+        const HostTensorDescriptor desc(output.mDesc);
+
+        if(const auto cached = Find<T>(key, desc))
+        {
+            constexpr std::size_t chunk_size = std::size_t{1} << 18;
+
+            const std::size_t n         = output.mData.size();
+            const std::size_t num_chunk = (n + chunk_size - 1) / chunk_size;
+
+            host_parallel_for(num_chunk,
+                              std::thread::hardware_concurrency(),
+                              [&](std::size_t ic_begin, std::size_t ic_end) {
+                                  const std::size_t begin = ic_begin * chunk_size;
+                                  const std::size_t end   = std::min(ic_end * chunk_size, n);
+
+                                  std::copy(cached->mData + begin,
+                                            cached->mData + end,
+                                            output.mData.begin() + begin);
+                              });
+
+            return true;
+        }
+
+        compute();
+
+        Store(key, output);
+
+        return false;
+    }
+
+    private:
+    std::string directory_;
+};
+
+} // namespace utils
+} // namespace ck
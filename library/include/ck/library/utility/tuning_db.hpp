@@ -0,0 +1,494 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include "device_base.hpp"
+#include "host_tensor_file.hpp"
+
+namespace ck {
+namespace utils {
+
+/**
+ * @brief      Signature of a problem in the tuning database.
+ *
+ *             `op` and `config` (data types, layouts, element-wise operations
+ *             and other settings that select the instance set) have to match
+ *             exactly. `lengths` holds the problem shape, e.g. M, N, K and the
+ *             strides of a GEMM; it is matched exactly for a hit and compared
+ *             numerically to find the nearest recorded shape otherwise.
+ */
+struct TuningProblem
+{
+    std::string op;
+    std::string config;
+    std::vector<int64_t> lengths;
+
+    std::string GetGroupKey() const { return op + '\t' + config; }
+
+    std::string GetKey() const
+    {
+        std::ostringstream os;
+
+        os << GetGroupKey() << '\t';
+        LogRange(os, lengths, ",");
+
+        return os.str();
+    }
+};
+
+struct TuningRecord
+{
+    std::string instance; // get_tuning_instance_key() of the fastest instance
+    float median_time;    // ms, median of the timed runs
+};
+
+/**
+ * @brief      Key of an instance in the tuning database.
+ *
+ *             GetTypeString() leaves out parameters such as the GEMM
+ *             specialization and vector widths, so instances of one list may
+ *             share it. The key lists every value and option of
+ *             GetTuningParams() instead: "<name><key=value,...>", or just the
+ *             name for an instance without parameters.
+ */
+template <typename Op>
+std::string get_tuning_instance_key(const Op& op)
+{
+    const tensor_operation::device::TuningParams params = op.GetTuningParams();
+
+    if(params.GetValues().empty() && params.GetOptions().empty())
+        return params.GetName();
+
+    std::ostringstream os;
+
+    os << params.GetName() << '<';
+
+    const char* sep = "";
+
+    for(const auto& value : params.GetValues())
+    {
+        os << sep << value.first << '=' << value.second;
+        sep = ",";
+    }
+
+    for(const auto& option : params.GetOptions())
+    {
+        os << sep << option.first << '=' << option.second;
+        sep = ",";
+    }
+
+    os << '>';
+
+    return os.str();
+}
+
+/**
+ * @brief      Persistent map from problem signatures to the fastest instance.
+ *
+ *             The database is a text file with one tab separated record per
+ *             line: op, config, lengths, median time and instance. Updates
+ *             take an exclusive lock on "<path>.lock", merge in the records
+ *             other processes wrote in the meantime and replace the file with
+ *             a rename, so readers never see a partial file and concurrent
+ *             profiler runs do not lose each other's results. Only records
+ *             with a smaller median time replace existing ones; delete the
+ *             file to re-tune from scratch.
+ */
+class TuningDb
+{
+    public:
+    // a database backed by the file at `path`, or an in-memory one if `path` is empty
+    explicit TuningDb(std::string path = "") : path_(std::move(path))
+    {
+        if(IsPersistent())
+            Load();
+    }
+
+    // the database in the file named by CK_TUNING_DB, in memory only if it is not set
+    static TuningDb& GetDefault()
+    {
+        static TuningDb db = [] {
+            const char* env = std::getenv("CK_TUNING_DB");
+
+            return TuningDb(env == nullptr ? "" : env);
+        }();
+
+        return db;
+    }
+
+    TuningDb(const TuningDb&) = delete;
+    TuningDb& operator=(const TuningDb&) = delete;
+
+    bool IsPersistent() const { return !path_.empty(); }
+
+    const std::string& GetPath() const { return path_; }
+
+    std::size_t GetNumRecords() const
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        return records_.size();
+    }
+
+    std::optional<TuningRecord> Find(const TuningProblem& problem) const
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        const auto it = records_.find(problem.GetKey());
+
+        if(it == records_.end())
+            return std::nullopt;
+
+        return it->second;
+    }
+
+    // Records of problems with the same op and config and as many lengths, nearest shape first.
+    // Shapes are compared by the summed difference of the logarithms of their lengths, so a
+    // record for 2x as large a dimension is as near as one for half as large.
+    std::vector<TuningRecord> FindNearest(const TuningProblem& problem) const
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        const auto group = groups_.find(problem.GetGroupKey());
+
+        if(group == groups_.end())
+            return {};
+
+        std::vector<std::pair<double, const TuningRecord*>> candidates;
+
+        for(const auto& entry : group->second)
+        {
+            if(entry.first.size() != problem.lengths.size())
+                continue;
+
+            double distance = 0;
+
+            for(std::size_t i = 0; i < entry.first.size(); ++i)
+            {
+                distance += std::abs(std::log2(1. + std::abs(double(entry.first[i]))) -
+                                     std::log2(1. + std::abs(double(problem.lengths[i]))));
+            }
+
+            candidates.emplace_back(distance, &records_.at(entry.second));
+        }
+
+        std::stable_sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+        std::vector<TuningRecord> nearest;
+
+        for(const auto& candidate : candidates)
+            nearest.push_back(*candidate.second);
+
+        return nearest;
+    }
+
+    // Record `record` for `problem` unless a faster one is known. Returns whether it was stored.
+    // Failures to write the file are reported on std::cerr, the record is still kept in memory.
+    bool Update(const TuningProblem& problem, const TuningRecord& record)
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        if(!IsPersistent())
+            return UpdateLocked(problem.GetKey(), record);
+
+        const std::string lock_path = path_ + ".lock";
+
+        const int lock_fd = open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+        if(lock_fd < 0 || flock(lock_fd, LOCK_EX) != 0)
+        {
+            std::cerr << "Warning: failed to lock " << lock_path << ": " << std::strerror(errno)
+                      << std::endl;
+
+            if(lock_fd >= 0)
+                close(lock_fd);
+
+            return UpdateLocked(problem.GetKey(), record);
+        }
+
+        LoadLocked();
+
+        const bool stored = UpdateLocked(problem.GetKey(), record);
+
+        if(stored)
+            StoreLocked();
+
+        // closing the descriptor releases the lock
+        close(lock_fd);
+
+        return stored;
+    }
+
+    private:
+    void Load()
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        LoadLocked();
+    }
+
+    // merge the records in the file into memory, malformed lines are skipped
+    void LoadLocked()
+    {
+        std::ifstream file(path_);
+        std::string line;
+
+        while(std::getline(file, line))
+        {
+            if(line.empty() || line[0] == '#')
+                continue;
+
+            std::vector<std::string> fields;
+            std::size_t begin = 0;
+
+            for(std::size_t end; (end = line.find('\t', begin)) != std::string::npos;
+                begin = end + 1)
+                fields.push_back(line.substr(begin, end - begin));
+
+            fields.push_back(line.substr(begin));
+
+            if(fields.size() != 5)
+                continue;
+
+            char* end = nullptr;
+            const float median_time = std::strtof(fields[3].c_str(), &end);
+
+            if(end == fields[3].c_str() || !(median_time >= 0))
+                continue;
+
+            try
+            {
+                UpdateLocked(fields[0] + '\t' + fields[1] + '\t' + fields[2],
+                             TuningRecord{fields[4], median_time});
+            }
+            catch(const std::logic_error&)
+            {
+                // lengths that are not integers
+            }
+        }
+    }
+
+    void StoreLocked() const
+    {
+        static std::atomic<uint64_t> num_written{0};
+
+        const std::string tmp_path =
+            path_ + ".tmp." + std::to_string(getpid()) + "." + std::to_string(num_written++);
+
+        {
+            std::ofstream file(tmp_path, std::ios::trunc);
+
+            file << "# op\tconfig\tlengths\tmedian_time(ms)\tinstance\n";
+
+            for(const auto& r : records_)
+            {
+                file << r.first << '\t' << std::setprecision(9) << r.second.median_time << '\t'
+                     << r.second.instance << '\n';
+            }
+
+            file.close();
+
+            if(!file)
+            {
+                std::cerr << "Warning: failed to write " << tmp_path << std::endl;
+                std::remove(tmp_path.c_str());
+                return;
+            }
+        }
+
+        if(std::rename(tmp_path.c_str(), path_.c_str()) != 0)
+        {
+            std::cerr << "Warning: failed to replace " << path_ << ": " << std::strerror(errno)
+                      << std::endl;
+            std::remove(tmp_path.c_str());
+        }
+    }
+
+    bool UpdateLocked(const std::string& key, const TuningRecord& record)
+    {
+        const auto it = records_.find(key);
+
+        if(it != records_.end())
+        {
+            if(!(record.median_time < it->second.median_time))
+                return false;
+
+            it->second = record;
+
+            return true;
+        }
+
+        // key is "<op>\t<config>\t<lengths>"
+        const std::size_t split = key.rfind('\t');
+
+        std::vector<int64_t> lengths;
+        std::istringstream is(key.substr(split + 1));
+
+        for(std::string length; std::getline(is, length, ',');)
+            lengths.push_back(std::stoll(length));
+
+        records_.emplace(key, record);
+        groups_[key.substr(0, split)].emplace_back(std::move(lengths), key);
+
+        return true;
+    }
+
+    std::string path_;
+
+    mutable std::mutex mtx_;
+
+    std::unordered_map<std::string, TuningRecord> records_;
+
+    // "<op>\t<config>" -> lengths and key of every record of the group
+    std::unordered_map<std::string, std::vector<std::pair<std::vector<int64_t>, std::string>>>
+        groups_;
+};
+
+/**
+ * @brief      Instance vector indexed by get_tuning_instance_key().
+ *
+ *             Building the index throws std::invalid_argument if two
+ *             instances have the same key, since the tuning database could not
+ *             tell which of them was timed.
+ */
+template <typename OpPtr>
+class TuningInstanceIndex
+{
+    public:
+    using Op = std::remove_reference_t<decltype(*std::declval<const OpPtr&>())>;
+
+    explicit TuningInstanceIndex(const std::vector<OpPtr>& op_ptrs)
+    {
+        for(const auto& op_ptr : op_ptrs)
+        {
+            std::string key = get_tuning_instance_key(*op_ptr);
+
+            if(!ids_.emplace(key, instances_.size()).second)
+                throw std::invalid_argument("wrong! instances with equal tuning key " + key);
+
+            instances_.push_back(op_ptr.get());
+        }
+    }
+
+    // The fastest instance recorded for `problem`. For a problem that is not in the database,
+    // the instance recorded for the nearest shape is returned, which is not necessarily
+    // applicable: check it with IsSupportedArgument(). nullptr if no recorded instance is in the
+    // indexed vector.
+    Op* FindBestInstance(const TuningDb& db, const TuningProblem& problem) const
+    {
+        const auto id = FindBestInstanceId(db, problem, [](const Op&) { return true; });
+
+        return id ? instances_[*id] : nullptr;
+    }
+
+    // Position in the indexed vector of the first recorded instance for `problem`, or for the
+    // nearest shapes after it, that `is_supported(Op&)` accepts.
+    template <typename IsSupported>
+    std::optional<std::size_t> FindBestInstanceId(const TuningDb& db,
+                                                  const TuningProblem& problem,
+                                                  IsSupported is_supported) const
+    {
+        auto find = [&](const TuningRecord& record) -> std::optional<std::size_t> {
+            const auto it = ids_.find(record.instance);
+
+            if(it == ids_.end() || !is_supported(*instances_[it->second]))
+                return std::nullopt;
+
+            return it->second;
+        };
+
+        if(const auto record = db.Find(problem))
+        {
+            if(const auto id = find(*record))
+                return id;
+        }
+
+        for(const auto& record : db.FindNearest(problem))
+        {
+            if(const auto id = find(record))
+                return id;
+        }
+
+        return std::nullopt;
+    }
+
+    private:
+    std::unordered_map<std::string, std::size_t> ids_;
+    std::vector<Op*> instances_;
+};
+
+// Position in `op_ptrs` of the instance the default tuning database picks for `problem` among
+// the ones `is_supported(Op&)` accepts, if CK_TUNING_DB_LOOKUP is set to a nonzero value.
+// The profilers then run only that instance instead of all of them.
+template <typename OpPtr, typename IsSupported>
+std::optional<std::size_t> find_tuned_instance_id(const std::vector<OpPtr>& op_ptrs,
+                                                  const TuningProblem& problem,
+                                                  IsSupported is_supported)
+{
+    const char* env = std::getenv("CK_TUNING_DB_LOOKUP");
+
+    if(env == nullptr || std::atoi(env) == 0)
+        return std::nullopt;
+
+    return TuningInstanceIndex<OpPtr>(op_ptrs).FindBestInstanceId(
+        TuningDb::GetDefault(), problem, is_supported);
+}
+
+template <typename T>
+const char* get_tuning_data_type_name()
+{
+    return get_host_tensor_data_type_name(HostTensorDataTypeOf<T>::value);
+}
+
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename AElementOp,
+          typename BElementOp,
+          typename CElementOp>
+TuningProblem make_gemm_tuning_problem(
+    int64_t M, int64_t N, int64_t K, int64_t StrideA, int64_t StrideB, int64_t StrideC, int KBatch)
+{
+    std::ostringstream config;
+
+    config << get_tuning_data_type_name<ADataType>() << " "
+           << get_tuning_data_type_name<BDataType>() << " "
+           << get_tuning_data_type_name<CDataType>() << " " << ALayout::name << " "
+           << BLayout::name << " " << CLayout::name << " " << typeid(AElementOp).name() << " "
+           << typeid(BElementOp).name() << " " << typeid(CElementOp).name() << " KBatch "
+           << KBatch;
+
+    return TuningProblem{"gemm", config.str(), {M, N, K, StrideA, StrideB, StrideC}};
+}
+
+} // namespace utils
+} // namespace ck
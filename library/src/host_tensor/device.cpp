@@ -1,8 +1,138 @@
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "device.hpp"
+#include "device_properties.hpp"
+
+namespace {
 
-DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size)
+struct DeviceArena
 {
-    hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
+    std::mutex mtx;
+    std::size_t num_scope        = 0;
+    std::size_t num_cached_bytes = 0;
+    std::atomic<std::size_t> num_reused{0};
+
+    // capacity -> cached buffers of that capacity
+    std::multimap<std::size_t, void*> free_buffers;
+
+    void ReleaseLocked()
+    {
+        for(auto& buffer : free_buffers)
+            hip_check_error(hipFree(buffer.second));
+
+        free_buffers.clear();
+        num_cached_bytes = 0;
+    }
+};
+
+DeviceArena& get_device_arena()
+{
+    static DeviceArena arena;
+
+    return arena;
+}
+
+// Take the smallest cached buffer of at least `mem_size` bytes. If there is none, the largest
+// cached buffer is freed to make room for a larger one and nullptr is returned.
+void* take_cached_buffer(std::size_t mem_size, std::size_t& capacity)
+{
+    DeviceArena& arena = get_device_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    if(arena.free_buffers.empty())
+        return nullptr;
+
+    auto it = arena.free_buffers.lower_bound(mem_size);
+
+    if(it == arena.free_buffers.end())
+    {
+        --it;
+
+        hip_check_error(hipFree(it->second));
+        arena.num_cached_bytes -= it->first;
+        arena.free_buffers.erase(it);
+
+        return nullptr;
+    }
+
+    void* p  = it->second;
+    capacity = it->first;
+
+    arena.num_cached_bytes -= it->first;
+    arena.free_buffers.erase(it);
+    arena.num_reused++;
+
+    return p;
+}
+
+// keep a released buffer for reuse if an arena scope is alive
+bool cache_buffer(void* p, std::size_t capacity)
+{
+    DeviceArena& arena = get_device_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    if(p == nullptr || arena.num_scope == 0)
+        return false;
+
+    arena.free_buffers.emplace(capacity, p);
+    arena.num_cached_bytes += capacity;
+
+    return true;
+}
+
+} // namespace
+
+DeviceMemArena::Scope::Scope()
+{
+    DeviceArena& arena = get_device_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    arena.num_scope++;
+}
+
+DeviceMemArena::Scope::~Scope()
+{
+    DeviceArena& arena = get_device_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    if(--arena.num_scope == 0)
+        arena.ReleaseLocked();
+}
+
+std::size_t DeviceMemArena::GetNumCachedBytes()
+{
+    DeviceArena& arena = get_device_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    return arena.num_cached_bytes;
+}
+
+std::size_t DeviceMemArena::GetNumReusedAllocations() { return get_device_arena().num_reused; }
+
+void DeviceMemArena::Release()
+{
+    DeviceArena& arena = get_device_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    arena.ReleaseLocked();
+}
+
+DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size), mCapacity(mem_size)
+{
+    mpDeviceBuf = take_cached_buffer(mem_size, mCapacity);
+
+    if(mpDeviceBuf == nullptr)
+        hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
 }
 
 void* DeviceMem::GetDeviceBuffer() { return mpDeviceBuf; }
@@ -21,7 +151,11 @@ void DeviceMem::FromDevice(void* p)
 
 void DeviceMem::SetZero() { hip_check_error(hipMemset(mpDeviceBuf, 0, mMemSize)); }
 
-DeviceMem::~DeviceMem() { hip_check_error(hipFree(mpDeviceBuf)); }
+DeviceMem::~DeviceMem()
+{
+    if(!cache_buffer(mpDeviceBuf, mCapacity))
+        hip_check_error(hipFree(mpDeviceBuf));
+}
 
 struct KernelTimerImpl
 {
@@ -68,3 +202,85 @@ void KernelTimer::Start() { impl->Start(); }
 void KernelTimer::End() { impl->End(); }
 
 float KernelTimer::GetElapsedTime() const { return impl->GetElapsedTime(); }
+
+struct KernelEventTimerImpl
+{
+    explicit KernelEventTimerImpl(hipStream_t stream) : mStream(stream) {}
+
+    ~KernelEventTimerImpl()
+    {
+        for(auto event : mEvents)
+            hip_check_error(hipEventDestroy(event));
+    }
+
+    // events are created on first use and reused by later series
+    hipEvent_t GetEvent(std::size_t i)
+    {
+        while(mEvents.size() <= i)
+        {
+            hipEvent_t event;
+            hip_check_error(hipEventCreate(&event));
+            mEvents.push_back(event);
+        }
+
+        return mEvents[i];
+    }
+
+    hipStream_t mStream;
+    std::vector<hipEvent_t> mEvents;
+    // events recorded so far, a start and a stop event per run
+    std::size_t mNumRecorded = 0;
+};
+
+KernelEventTimer::KernelEventTimer(hipStream_t stream) : impl(new KernelEventTimerImpl(stream)) {}
+
+KernelEventTimer::~KernelEventTimer() {}
+
+void KernelEventTimer::Start()
+{
+    hip_check_error(hipEventRecord(impl->GetEvent(impl->mNumRecorded++), impl->mStream));
+}
+
+void KernelEventTimer::Stop()
+{
+    hip_check_error(hipEventRecord(impl->GetEvent(impl->mNumRecorded++), impl->mStream));
+}
+
+std::vector<float> KernelEventTimer::GetSamples()
+{
+    std::vector<float> samples;
+
+    if(impl->mNumRecorded == 0)
+        return samples;
+
+    hip_check_error(hipEventSynchronize(impl->mEvents[impl->mNumRecorded - 1]));
+
+    for(std::size_t i = 0; i + 1 < impl->mNumRecorded; i += 2)
+    {
+        float time;
+        hip_check_error(hipEventElapsedTime(&time, impl->mEvents[i], impl->mEvents[i + 1]));
+        samples.push_back(time);
+    }
+
+    impl->mNumRecorded = 0;
+
+    return samples;
+}
+
+void flush_device_cache(hipStream_t stream)
+{
+    // allocated once per process and kept, like the L2 it flushes
+    static const std::pair<void*, std::size_t> buffer = [] {
+        const std::size_t l2_size = get_device_properties().l2_size;
+
+        // some runtimes do not report the L2 size, assume a large one
+        const std::size_t size = 2 * (l2_size > 0 ? l2_size : 8 << 20);
+
+        void* p;
+        hip_check_error(hipMalloc(&p, size));
+
+        return std::make_pair(p, size);
+    }();
+
+    hip_check_error(hipMemsetAsync(buffer.first, 0, buffer.second, stream));
+}
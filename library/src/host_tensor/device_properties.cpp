@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "device.hpp"
+#include "device_properties.hpp"
+
+namespace {
+
+struct HipDevicePropertiesProvider : public DevicePropertiesProvider
+{
+    int GetCurrentDevice() const override
+    {
+        int device;
+        hip_check_error(hipGetDevice(&device));
+
+        return device;
+    }
+
+    DeviceProperties GetDeviceProperties(int device) const override
+    {
+        hipDeviceProp_t hip_props;
+        hip_check_error(hipGetDeviceProperties(&hip_props, device));
+
+        DeviceProperties props;
+
+        props.name                  = hip_props.name;
+        props.num_cu                = hip_props.multiProcessorCount;
+        props.warp_size             = hip_props.warpSize;
+        props.max_threads_per_block = hip_props.maxThreadsPerBlock;
+        props.max_waves_per_cu      = hip_props.maxThreadsPerMultiProcessor / hip_props.warpSize;
+        props.lds_per_cu            = hip_props.maxSharedMemoryPerMultiProcessor;
+        props.max_lds_per_block     = hip_props.sharedMemPerBlock;
+        props.l2_size = hip_props.l2CacheSize > 0 ? static_cast<std::size_t>(hip_props.l2CacheSize)
+                                                  : 0;
+
+        return props;
+    }
+};
+
+struct DevicePropertiesCache
+{
+    std::mutex mtx;
+    // nullptr for the HIP runtime
+    std::shared_ptr<DevicePropertiesProvider> provider;
+    // device -> properties, node based so references stay valid as devices are added
+    std::map<int, DeviceProperties> props;
+
+    const DevicePropertiesProvider& GetProvider() const
+    {
+        static const HipDevicePropertiesProvider hip_provider;
+
+        if(provider != nullptr)
+            return *provider;
+
+        return hip_provider;
+    }
+};
+
+DevicePropertiesCache& get_device_properties_cache()
+{
+    static DevicePropertiesCache cache;
+
+    return cache;
+}
+
+} // namespace
+
+const DeviceProperties& get_device_properties(int device)
+{
+    DevicePropertiesCache& cache = get_device_properties_cache();
+
+    std::lock_guard<std::mutex> lock(cache.mtx);
+
+    auto it = cache.props.find(device);
+
+    if(it == cache.props.end())
+        it = cache.props.emplace(device, cache.GetProvider().GetDeviceProperties(device)).first;
+
+    return it->second;
+}
+
+const DeviceProperties& get_device_properties()
+{
+    int device;
+
+    {
+        DevicePropertiesCache& cache = get_device_properties_cache();
+
+        std::lock_guard<std::mutex> lock(cache.mtx);
+
+        device = cache.GetProvider().GetCurrentDevice();
+    }
+
+    return get_device_properties(device);
+}
+
+std::shared_ptr<DevicePropertiesProvider>
+set_device_properties_provider(std::shared_ptr<DevicePropertiesProvider> provider)
+{
+    DevicePropertiesCache& cache = get_device_properties_cache();
+
+    std::lock_guard<std::mutex> lock(cache.mtx);
+
+    cache.props.clear();
+
+    std::swap(cache.provider, provider);
+
+    return provider;
+}
+
+int get_max_active_blocks_per_cu(const DeviceProperties& props,
+                                 int block_size,
+                                 std::size_t lds_bytes)
+{
+    if(block_size <= 0 || block_size > props.max_threads_per_block || props.warp_size <= 0 ||
+       lds_bytes > props.max_lds_per_block)
+        return 0;
+
+    const int waves_per_block = (block_size + props.warp_size - 1) / props.warp_size;
+
+    int num_block = props.max_waves_per_cu / waves_per_block;
+
+    if(lds_bytes > 0)
+        num_block = std::min(num_block, static_cast<int>(props.lds_per_cu / lds_bytes));
+
+    return num_block;
+}
+
+int64_t get_persistent_grid_size(const DeviceProperties& props,
+                                 int block_size,
+                                 std::size_t lds_bytes,
+                                 int64_t num_work)
+{
+    const int64_t num_resident_block =
+        static_cast<int64_t>(props.num_cu) *
+        std::max(get_max_active_blocks_per_cu(props, block_size, lds_bytes), 1);
+
+    return std::max(std::min(num_resident_block, num_work), int64_t{1});
+}
+
+int64_t get_persistent_grid_size(int block_size, std::size_t lds_bytes, int64_t num_work)
+{
+    return get_persistent_grid_size(get_device_properties(), block_size, lds_bytes, num_work);
+}
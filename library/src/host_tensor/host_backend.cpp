@@ -0,0 +1,213 @@
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "host_thread_pool.hpp"
+
+namespace {
+
+// stack of each thread of a block; kernels keep their per-thread data in registers, which live
+// on this stack here
+constexpr std::size_t fiber_stack_size = 256 * 1024;
+
+enum struct FiberState
+{
+    Ready,
+    AtBarrier,
+    Done,
+};
+
+struct FiberStack
+{
+    FiberStack()
+    {
+        p_ = mmap(nullptr,
+                  fiber_stack_size,
+                  PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK,
+                  -1,
+                  0);
+
+        if(p_ == MAP_FAILED)
+            throw std::runtime_error("failed to allocate the stack of a host backend thread");
+    }
+
+    ~FiberStack() { munmap(p_, fiber_stack_size); }
+
+    FiberStack(const FiberStack&) = delete;
+    FiberStack& operator=(const FiberStack&) = delete;
+
+    void* p_;
+};
+
+struct Fiber
+{
+    ucontext_t context;
+    FiberState state;
+    dim3 thread_idx;
+};
+
+// Runs the threads of a block as fibers on the calling host thread. Stacks are kept for the
+// next block the host thread runs.
+struct BlockRunner
+{
+    void Run(dim3 block_dim, const std::function<void()>& kernel)
+    {
+        const std::size_t block_size =
+            std::size_t{block_dim.x} * std::size_t{block_dim.y} * std::size_t{block_dim.z};
+
+        while(stacks_.size() < block_size)
+            stacks_.push_back(std::make_unique<FiberStack>());
+
+        fibers_.resize(block_size);
+        p_kernel_  = &kernel;
+        exception_ = nullptr;
+
+        for(std::size_t i = 0; i < block_size; ++i)
+        {
+            Fiber& fiber = fibers_[i];
+
+            fiber.state      = FiberState::Ready;
+            fiber.thread_idx = dim3(static_cast<uint32_t>(i % block_dim.x),
+                                    static_cast<uint32_t>(i / block_dim.x % block_dim.y),
+                                    static_cast<uint32_t>(i / block_dim.x / block_dim.y));
+
+            getcontext(&fiber.context);
+
+            fiber.context.uc_stack.ss_sp   = stacks_[i]->p_;
+            fiber.context.uc_stack.ss_size = fiber_stack_size;
+            fiber.context.uc_link          = &scheduler_context_;
+
+            makecontext(&fiber.context, &BlockRunner::FiberMain, 0);
+        }
+
+        // Run every ready thread until it reaches the barrier or returns, then release the
+        // barrier. As on the GPU, threads that returned do not take part in later barriers.
+        for(;;)
+        {
+            bool any_at_barrier = false;
+
+            for(std::size_t i = 0; i < block_size; ++i)
+            {
+                if(fibers_[i].state != FiberState::Ready)
+                    continue;
+
+                current_ = i;
+
+                ck::host_backend::kernel_context.thread_idx = fibers_[i].thread_idx;
+
+                swapcontext(&scheduler_context_, &fibers_[i].context);
+
+                if(fibers_[i].state == FiberState::AtBarrier)
+                    any_at_barrier = true;
+            }
+
+            if(!any_at_barrier)
+                break;
+
+            for(auto& fiber : fibers_)
+            {
+                if(fiber.state == FiberState::AtBarrier)
+                    fiber.state = FiberState::Ready;
+            }
+        }
+
+        p_kernel_ = nullptr;
+
+        if(exception_)
+            std::rethrow_exception(exception_);
+    }
+
+    void Barrier()
+    {
+        Fiber& fiber = fibers_[current_];
+
+        fiber.state = FiberState::AtBarrier;
+
+        swapcontext(&fiber.context, &scheduler_context_);
+    }
+
+    bool IsRunning() const { return p_kernel_ != nullptr; }
+
+    private:
+    static void FiberMain();
+
+    std::vector<std::unique_ptr<FiberStack>> stacks_;
+    std::vector<Fiber> fibers_;
+    ucontext_t scheduler_context_;
+    std::size_t current_                   = 0;
+    const std::function<void()>* p_kernel_ = nullptr;
+    std::exception_ptr exception_;
+};
+
+thread_local BlockRunner block_runner;
+
+void BlockRunner::FiberMain()
+{
+    BlockRunner& runner = block_runner;
+
+    // exceptions cannot unwind past the entry of a fiber; the first one is rethrown by Run()
+    try
+    {
+        (*runner.p_kernel_)();
+    }
+    catch(...)
+    {
+        if(!runner.exception_)
+            runner.exception_ = std::current_exception();
+    }
+
+    runner.fibers_[runner.current_].state = FiberState::Done;
+
+    // returning resumes the scheduler through uc_link
+}
+
+} // namespace
+
+namespace ck {
+namespace host_backend {
+
+void run_grid(dim3 grid_dim, dim3 block_dim, const std::function<void()>& kernel)
+{
+    const std::size_t num_block =
+        std::size_t{grid_dim.x} * std::size_t{grid_dim.y} * std::size_t{grid_dim.z};
+
+    if(num_block == 0 || std::size_t{block_dim.x} * block_dim.y * block_dim.z == 0)
+        return;
+
+    host_parallel_for(
+        num_block,
+        HostThreadPool::GetInstance().GetMaxNumThreads(),
+        [&](std::size_t begin, std::size_t end) {
+            const KernelContext saved_context = kernel_context;
+
+            kernel_context.block_dim = block_dim;
+            kernel_context.grid_dim  = grid_dim;
+
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                kernel_context.block_idx = dim3(static_cast<uint32_t>(i % grid_dim.x),
+                                                static_cast<uint32_t>(i / grid_dim.x % grid_dim.y),
+                                                static_cast<uint32_t>(i / grid_dim.x / grid_dim.y));
+
+                block_runner.Run(block_dim, kernel);
+            }
+
+            kernel_context = saved_context;
+        });
+}
+
+void sync_threads()
+{
+    if(block_runner.IsRunning())
+        block_runner.Barrier();
+}
+
+} // namespace host_backend
+} // namespace ck
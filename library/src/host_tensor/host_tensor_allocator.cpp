@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <list>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <new>
+
+#include <sys/mman.h>
+
+#include "host_tensor_allocator.hpp"
+
+namespace {
+
+bool use_huge_pages()
+{
+    static const bool use = [] {
+        const char* env = std::getenv("CK_HOST_TENSOR_HUGEPAGE");
+
+        return env == nullptr || std::atoi(env) != 0;
+    }();
+
+    return use;
+}
+
+// the size a request is served with, also the key of the arena's free lists
+std::size_t get_rounded_size(std::size_t num_bytes)
+{
+    const std::size_t granularity = num_bytes >= HostTensorMemory::HugePageSize
+                                        ? HostTensorMemory::HugePageSize
+                                        : HostTensorMemory::Alignment;
+
+    return (std::max<std::size_t>(num_bytes, 1) + granularity - 1) / granularity * granularity;
+}
+
+void* system_allocate(std::size_t rounded_size)
+{
+    const bool huge = rounded_size >= HostTensorMemory::HugePageSize && use_huge_pages();
+
+    const std::size_t alignment =
+        huge ? HostTensorMemory::HugePageSize : HostTensorMemory::Alignment;
+
+    void* p = std::aligned_alloc(alignment, rounded_size);
+
+    if(p == nullptr)
+        throw std::bad_alloc{};
+
+#ifdef MADV_HUGEPAGE
+    // only a hint, the buffer is still usable if the kernel does not support it
+    if(huge)
+        madvise(p, rounded_size, MADV_HUGEPAGE);
+#endif
+
+    return p;
+}
+
+std::size_t get_default_max_cached_bytes()
+{
+    const char* env = std::getenv("CK_HOST_TENSOR_CACHE_MB");
+
+    const std::size_t num_mb = env == nullptr ? 2048 : std::strtoull(env, nullptr, 10);
+
+    return num_mb << 20;
+}
+
+struct Arena
+{
+    struct CachedBuffer
+    {
+        std::size_t rounded_size;
+        void* p;
+    };
+
+    using CachedBufferList = std::list<CachedBuffer>;
+
+    std::mutex mtx;
+    std::size_t num_scope        = 0;
+    std::size_t num_cached_bytes = 0;
+    std::size_t max_cached_bytes = get_default_max_cached_bytes();
+    std::atomic<std::size_t> num_reused{0};
+
+    // cached buffers, those cached longest ago first
+    CachedBufferList cached_buffers;
+
+    // rounded size -> cached buffers of that size
+    std::multimap<std::size_t, CachedBufferList::iterator> free_buffers;
+
+    void* TakeLocked(std::size_t rounded_size)
+    {
+        auto it = free_buffers.find(rounded_size);
+
+        if(it == free_buffers.end())
+            return nullptr;
+
+        void* p = it->second->p;
+
+        cached_buffers.erase(it->second);
+        free_buffers.erase(it);
+        num_cached_bytes -= rounded_size;
+
+        return p;
+    }
+
+    // release the buffers cached longest ago until at most max_num_bytes are left
+    void TrimLocked(std::size_t max_num_bytes)
+    {
+        while(num_cached_bytes > max_num_bytes)
+        {
+            const CachedBuffer oldest = cached_buffers.front();
+
+            auto range = free_buffers.equal_range(oldest.rounded_size);
+
+            for(auto it = range.first; it != range.second; ++it)
+            {
+                if(it->second == cached_buffers.begin())
+                {
+                    free_buffers.erase(it);
+                    break;
+                }
+            }
+
+            cached_buffers.pop_front();
+            num_cached_bytes -= oldest.rounded_size;
+
+            std::free(oldest.p);
+        }
+    }
+
+    void ReleaseLocked() { TrimLocked(0); }
+};
+
+Arena& get_arena()
+{
+    static Arena arena;
+
+    return arena;
+}
+
+} // namespace
+
+void* HostTensorMemory::Allocate(std::size_t num_bytes)
+{
+    const std::size_t rounded_size = get_rounded_size(num_bytes);
+
+    Arena& arena = get_arena();
+
+    {
+        std::lock_guard<std::mutex> lock(arena.mtx);
+
+        if(void* p = arena.TakeLocked(rounded_size))
+        {
+            arena.num_reused++;
+
+            return p;
+        }
+    }
+
+    return system_allocate(rounded_size);
+}
+
+void HostTensorMemory::Deallocate(void* p, std::size_t num_bytes)
+{
+    if(p == nullptr)
+        return;
+
+    Arena& arena = get_arena();
+
+    {
+        std::lock_guard<std::mutex> lock(arena.mtx);
+
+        const std::size_t rounded_size = get_rounded_size(num_bytes);
+
+        if(arena.num_scope > 0 && rounded_size <= arena.max_cached_bytes)
+        {
+            arena.cached_buffers.push_back({rounded_size, p});
+            arena.free_buffers.emplace(rounded_size, std::prev(arena.cached_buffers.end()));
+            arena.num_cached_bytes += rounded_size;
+
+            arena.TrimLocked(arena.max_cached_bytes);
+
+            return;
+        }
+    }
+
+    std::free(p);
+}
+
+HostTensorArena::Scope::Scope()
+{
+    Arena& arena = get_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    arena.num_scope++;
+}
+
+HostTensorArena::Scope::~Scope()
+{
+    Arena& arena = get_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    if(--arena.num_scope == 0)
+        arena.ReleaseLocked();
+}
+
+std::size_t HostTensorArena::GetNumCachedBytes()
+{
+    Arena& arena = get_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    return arena.num_cached_bytes;
+}
+
+std::size_t HostTensorArena::GetMaxCachedBytes()
+{
+    Arena& arena = get_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    return arena.max_cached_bytes;
+}
+
+void HostTensorArena::SetMaxCachedBytes(std::size_t max_num_bytes)
+{
+    Arena& arena = get_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    arena.max_cached_bytes = max_num_bytes;
+    arena.TrimLocked(max_num_bytes);
+}
+
+std::size_t HostTensorArena::GetNumReusedAllocations() { return get_arena().num_reused; }
+
+void HostTensorArena::Release()
+{
+    Arena& arena = get_arena();
+
+    std::lock_guard<std::mutex> lock(arena.mtx);
+
+    arena.ReleaseLocked();
+}
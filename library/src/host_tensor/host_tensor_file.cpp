@@ -0,0 +1,318 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "host_tensor_file.hpp"
+#include "host_thread_pool.hpp"
+
+namespace {
+
+std::size_t get_data_type_size(HostTensorDataType data_type)
+{
+    switch(data_type)
+    {
+    case HostTensorDataType::Float: return sizeof(float);
+    case HostTensorDataType::Double: return sizeof(double);
+    case HostTensorDataType::Half: return sizeof(ck::half_t);
+    case HostTensorDataType::BHalf: return sizeof(ck::bhalf_t);
+    case HostTensorDataType::Int8: return sizeof(int8_t);
+    case HostTensorDataType::Int32: return sizeof(int32_t);
+    }
+
+    return 0;
+}
+
+std::size_t get_payload_offset(std::size_t num_dim, std::size_t tag_size)
+{
+    constexpr std::size_t alignment = HostTensorFileHeader::PayloadAlignment;
+
+    const std::size_t num_byte =
+        sizeof(HostTensorFileHeader) + 2 * num_dim * sizeof(uint64_t) + tag_size;
+
+    return (num_byte + alignment - 1) / alignment * alignment;
+}
+
+std::runtime_error make_file_error(const std::string& path, const std::string& what)
+{
+    return std::runtime_error("tensor file " + path + ": " + what);
+}
+
+// xxHash64 style round
+inline uint64_t digest_round(uint64_t acc, uint64_t v)
+{
+    constexpr uint64_t P1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+
+    acc += v * P2;
+    acc = (acc << 31) | (acc >> 33);
+
+    return acc * P1;
+}
+
+inline uint64_t digest_avalanche(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+
+    return h;
+}
+
+uint64_t get_chunk_digest(const unsigned char* p, std::size_t num_byte)
+{
+    constexpr std::size_t num_lane = 4;
+
+    uint64_t acc[num_lane] = {1, 2, 3, 4};
+
+    std::size_t i = 0;
+
+    for(; i + num_lane * sizeof(uint64_t) <= num_byte; i += num_lane * sizeof(uint64_t))
+    {
+        uint64_t v[num_lane];
+
+        std::memcpy(v, p + i, sizeof(v));
+
+        for(std::size_t l = 0; l < num_lane; ++l)
+            acc[l] = digest_round(acc[l], v[l]);
+    }
+
+    for(; i + sizeof(uint64_t) <= num_byte; i += sizeof(uint64_t))
+    {
+        uint64_t v;
+
+        std::memcpy(&v, p + i, sizeof(v));
+
+        acc[0] = digest_round(acc[0], v);
+    }
+
+    uint64_t tail = 0;
+
+    if(i < num_byte)
+        std::memcpy(&tail, p + i, num_byte - i);
+
+    uint64_t h = digest_round(num_byte, tail);
+
+    for(std::size_t l = 0; l < num_lane; ++l)
+        h = digest_round(h ^ acc[l], l);
+
+    return digest_avalanche(h);
+}
+
+} // namespace
+
+const char* get_host_tensor_data_type_name(HostTensorDataType data_type)
+{
+    switch(data_type)
+    {
+    case HostTensorDataType::Float: return "float";
+    case HostTensorDataType::Double: return "double";
+    case HostTensorDataType::Half: return "half";
+    case HostTensorDataType::BHalf: return "bhalf";
+    case HostTensorDataType::Int8: return "int8";
+    case HostTensorDataType::Int32: return "int32";
+    }
+
+    return "unknown";
+}
+
+void write_host_tensor_file(const std::string& path,
+                            const HostTensorDescriptor& desc,
+                            HostTensorDataType data_type,
+                            std::size_t element_size,
+                            const void* data,
+                            const std::string& tag)
+{
+    if(element_size != get_data_type_size(data_type))
+        throw make_file_error(path, "wrong! element size does not match the data type");
+
+    const std::size_t num_dim = desc.GetNumOfDimension();
+
+    HostTensorFileHeader header{};
+
+    std::memcpy(header.magic, HostTensorFileHeader::Magic, sizeof(header.magic));
+    header.version        = HostTensorFileHeader::Version;
+    header.data_type      = static_cast<uint32_t>(data_type);
+    header.element_size   = static_cast<uint32_t>(element_size);
+    header.num_dim        = static_cast<uint32_t>(num_dim);
+    header.tag_size       = tag.size();
+    header.payload_offset = get_payload_offset(num_dim, tag.size());
+    header.payload_size   = desc.GetElementSpace() * element_size;
+
+    std::vector<uint64_t> dims(desc.GetLengths().begin(), desc.GetLengths().end());
+    dims.insert(dims.end(), desc.GetStrides().begin(), desc.GetStrides().end());
+
+    const std::size_t num_padding_byte = header.payload_offset - sizeof(header) -
+                                         dims.size() * sizeof(uint64_t) - tag.size();
+    const std::vector<char> padding(num_padding_byte, 0);
+
+    // unique per process and call, so concurrent writers never share a temporary file
+    static std::atomic<uint64_t> num_written{0};
+
+    const std::string tmp_path = path + ".tmp." + std::to_string(getpid()) + "." +
+                                 std::to_string(num_written++);
+
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(dims.data()), dims.size() * sizeof(uint64_t));
+        file.write(tag.data(), tag.size());
+        file.write(padding.data(), padding.size());
+        file.write(static_cast<const char*>(data), header.payload_size);
+
+        file.close();
+
+        if(!file)
+        {
+            std::remove(tmp_path.c_str());
+            throw make_file_error(path, "failed to write " + tmp_path);
+        }
+    }
+
+    if(std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        const int err = errno;
+
+        std::remove(tmp_path.c_str());
+        throw make_file_error(path, std::string("failed to rename: ") + std::strerror(err));
+    }
+}
+
+std::shared_ptr<const HostTensorFileMapping> HostTensorFileMapping::Open(const std::string& path)
+{
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if(fd < 0)
+        throw make_file_error(path, std::string("failed to open: ") + std::strerror(errno));
+
+    struct stat st;
+
+    if(fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(HostTensorFileHeader)))
+    {
+        close(fd);
+        throw make_file_error(path, "not a tensor file");
+    }
+
+    const std::size_t num_byte = static_cast<std::size_t>(st.st_size);
+
+    void* address = mmap(nullptr, num_byte, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    const int err = errno;
+
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+
+    if(address == MAP_FAILED)
+        throw make_file_error(path, std::string("failed to map: ") + std::strerror(err));
+
+    auto fail = [&](const char* what) {
+        munmap(address, num_byte);
+        return make_file_error(path, what);
+    };
+
+    const char* p = static_cast<const char*>(address);
+
+    HostTensorFileHeader header;
+
+    std::memcpy(&header, p, sizeof(header));
+
+    if(std::memcmp(header.magic, HostTensorFileHeader::Magic, sizeof(header.magic)) != 0)
+        throw fail("not a tensor file");
+
+    if(header.version != HostTensorFileHeader::Version)
+        throw fail("unsupported version");
+
+    const auto data_type = static_cast<HostTensorDataType>(header.data_type);
+
+    if(get_data_type_size(data_type) == 0 || get_data_type_size(data_type) != header.element_size)
+        throw fail("unknown data type");
+
+    if(header.num_dim == 0 || header.num_dim > HostTensorFileHeader::MaxNumDim ||
+       header.tag_size > num_byte ||
+       header.payload_offset != get_payload_offset(header.num_dim, header.tag_size) ||
+       header.payload_offset > num_byte || header.payload_size > num_byte - header.payload_offset)
+        throw fail("truncated or corrupt header");
+
+    std::vector<uint64_t> dims(2 * header.num_dim);
+
+    std::memcpy(dims.data(), p + sizeof(header), dims.size() * sizeof(uint64_t));
+
+    if(std::find(dims.begin(), dims.begin() + header.num_dim, 0) != dims.begin() + header.num_dim)
+        throw fail("zero length dimension");
+
+    HostTensorDescriptor desc(std::vector<std::size_t>(dims.begin(), dims.begin() + header.num_dim),
+                              std::vector<std::size_t>(dims.begin() + header.num_dim, dims.end()));
+
+    if(desc.GetElementSpace() * header.element_size != header.payload_size)
+        throw fail("payload size does not match the tensor shape");
+
+    std::string tag(p + sizeof(header) + dims.size() * sizeof(uint64_t), header.tag_size);
+
+#ifdef MADV_WILLNEED
+    // only a hint, start reading the payload in ahead of the first access
+    madvise(address, num_byte, MADV_WILLNEED);
+#endif
+
+    return std::shared_ptr<const HostTensorFileMapping>(new HostTensorFileMapping(
+        address, num_byte, header.payload_offset, std::move(desc), data_type, std::move(tag)));
+}
+
+HostTensorFileMapping::HostTensorFileMapping(void* address,
+                                             std::size_t num_byte,
+                                             std::size_t payload_offset,
+                                             HostTensorDescriptor desc,
+                                             HostTensorDataType data_type,
+                                             std::string tag)
+    : address_(address),
+      num_byte_(num_byte),
+      payload_offset_(payload_offset),
+      desc_(std::move(desc)),
+      data_type_(data_type),
+      tag_(std::move(tag))
+{
+}
+
+HostTensorFileMapping::~HostTensorFileMapping() { munmap(address_, num_byte_); }
+
+uint64_t get_host_tensor_digest(const void* data, std::size_t num_byte)
+{
+    constexpr std::size_t chunk_size = std::size_t{1} << 20;
+
+    const std::size_t num_chunk =
+        std::max<std::size_t>((num_byte + chunk_size - 1) / chunk_size, 1);
+
+    std::vector<uint64_t> chunk_digests(num_chunk);
+
+    const auto* p = static_cast<const unsigned char*>(data);
+
+    host_parallel_for(num_chunk,
+                      std::thread::hardware_concurrency(),
+                      [&](std::size_t ic_begin, std::size_t ic_end) {
+                          for(std::size_t ic = ic_begin; ic < ic_end; ++ic)
+                          {
+                              const std::size_t begin = ic * chunk_size;
+                              const std::size_t end   = std::min(begin + chunk_size, num_byte);
+
+                              chunk_digests[ic] = get_chunk_digest(p + begin, end - begin);
+                          }
+                      });
+
+    uint64_t h = num_byte;
+
+    for(uint64_t d : chunk_digests)
+        h = digest_round(h, d);
+
+    return digest_avalanche(h);
+}
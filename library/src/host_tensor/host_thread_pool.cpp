@@ -0,0 +1,297 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "host_thread_pool.hpp"
+
+namespace {
+
+thread_local bool in_parallel_region = false;
+
+// chunks handed out per thread and per region; more chunks balance better but lock more often
+constexpr std::size_t chunks_per_thread = 16;
+
+struct WorkRange
+{
+    std::mutex mtx;
+    std::size_t begin = 0;
+    std::size_t end   = 0;
+};
+
+std::size_t get_max_num_thread_from_env()
+{
+    std::size_t num_thread = std::max(std::thread::hardware_concurrency(), 1u);
+
+    if(const char* env = std::getenv("CK_HOST_NUM_THREADS"))
+    {
+        const long num_thread_env = std::atol(env);
+
+        if(num_thread_env > 0)
+            num_thread = static_cast<std::size_t>(num_thread_env);
+    }
+
+    return num_thread;
+}
+
+} // namespace
+
+struct HostThreadPool::Impl
+{
+    explicit Impl(std::size_t max_num_thread) : max_num_thread_{max_num_thread}
+    {
+        ranges_ = std::make_unique<WorkRange[]>(max_num_thread_);
+
+        for(std::size_t i = 1; i < max_num_thread_; ++i)
+            workers_.emplace_back([this, i] { WorkerLoop(i); });
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            stop_ = true;
+        }
+
+        cv_start_.notify_all();
+
+        for(auto& worker : workers_)
+            worker.join();
+    }
+
+    void WorkerLoop(std::size_t slot)
+    {
+        std::size_t seen_generation = 0;
+
+        for(;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+
+                cv_start_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+
+                if(stop_)
+                    return;
+
+                seen_generation = generation_;
+
+                if(slot >= num_slot_)
+                    continue;
+            }
+
+            in_parallel_region = true;
+            Participate(slot);
+            in_parallel_region = false;
+
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if(--num_active_ == 0)
+                    cv_done_.notify_one();
+            }
+        }
+    }
+
+    bool PopChunk(std::size_t slot, std::size_t& begin, std::size_t& end)
+    {
+        WorkRange& range = ranges_[slot];
+
+        std::lock_guard<std::mutex> lock(range.mtx);
+
+        if(range.begin == range.end)
+            return false;
+
+        begin       = range.begin;
+        end         = std::min(range.end, begin + grain_);
+        range.begin = end;
+
+        return true;
+    }
+
+    bool Steal(std::size_t slot, std::size_t& begin, std::size_t& end)
+    {
+        for(std::size_t i = 1; i < num_slot_; ++i)
+        {
+            WorkRange& victim = ranges_[(slot + i) % num_slot_];
+
+            std::unique_lock<std::mutex> victim_lock(victim.mtx);
+
+            const std::size_t remaining = victim.end - victim.begin;
+
+            if(remaining == 0)
+                continue;
+
+            if(remaining <= grain_)
+            {
+                begin        = victim.begin;
+                end          = victim.end;
+                victim.begin = victim.end;
+
+                return true;
+            }
+
+            // take the upper half, run its first chunk and keep the rest as our own range
+            begin      = victim.begin + remaining / 2;
+            end        = victim.end;
+            victim.end = begin;
+
+            victim_lock.unlock();
+
+            WorkRange& own = ranges_[slot];
+
+            std::lock_guard<std::mutex> own_lock(own.mtx);
+
+            own.begin = std::min(begin + grain_, end);
+            own.end   = end;
+            end       = own.begin;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void Participate(std::size_t slot)
+    {
+        std::size_t begin;
+        std::size_t end;
+
+        while(PopChunk(slot, begin, end) || Steal(slot, begin, end))
+        {
+            if(failed_.load(std::memory_order_relaxed))
+                continue;
+
+            try
+            {
+                (*f_)(begin, end);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if(!failed_.exchange(true))
+                    error_ = std::current_exception();
+            }
+        }
+    }
+
+    void ParallelFor(std::size_t n, std::size_t num_thread, const RangeFunction& f)
+    {
+        std::lock_guard<std::mutex> submit_lock(submit_mtx_);
+
+        const std::size_t grain = std::max<std::size_t>(n / (num_thread * chunks_per_thread), 1);
+
+        for(std::size_t s = 0; s < num_thread; ++s)
+        {
+            ranges_[s].begin = n * s / num_thread;
+            ranges_[s].end   = n * (s + 1) / num_thread;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+
+            f_          = &f;
+            grain_      = grain;
+            num_slot_   = num_thread;
+            num_active_ = num_thread - 1;
+            error_      = nullptr;
+            failed_     = false;
+
+            ++generation_;
+        }
+
+        cv_start_.notify_all();
+
+        in_parallel_region = true;
+        Participate(0);
+        in_parallel_region = false;
+
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+
+            cv_done_.wait(lock, [&] { return num_active_ == 0; });
+        }
+
+        if(error_)
+            std::rethrow_exception(error_);
+    }
+
+    const std::size_t max_num_thread_;
+
+    std::vector<std::thread> workers_;
+    std::unique_ptr<WorkRange[]> ranges_;
+
+    // one parallel region at a time
+    std::mutex submit_mtx_;
+
+    // guards the job description below and the start/done handshake
+    std::mutex mtx_;
+    std::condition_variable cv_start_;
+    std::condition_variable cv_done_;
+    std::size_t generation_ = 0;
+    bool stop_              = false;
+
+    const RangeFunction* f_ = nullptr;
+    std::size_t grain_      = 1;
+    std::size_t num_slot_   = 0;
+    std::size_t num_active_ = 0;
+
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+};
+
+HostThreadPool::HostThreadPool(std::size_t max_num_thread)
+    : impl_{std::make_unique<Impl>(max_num_thread)}
+{
+}
+
+HostThreadPool::~HostThreadPool() = default;
+
+HostThreadPool& HostThreadPool::GetInstance()
+{
+    static HostThreadPool pool{get_max_num_thread_from_env()};
+
+    return pool;
+}
+
+std::size_t HostThreadPool::GetMaxNumThreads() const { return impl_->max_num_thread_; }
+
+bool HostThreadPool::IsInParallelRegion() { return in_parallel_region; }
+
+void HostThreadPool::ParallelFor(std::size_t n, std::size_t num_thread, const RangeFunction& f)
+{
+    if(n == 0)
+        return;
+
+    num_thread = std::min({num_thread, impl_->max_num_thread_, n});
+
+    if(in_parallel_region)
+    {
+        f(0, n);
+        return;
+    }
+
+    if(num_thread <= 1)
+    {
+        in_parallel_region = true;
+
+        try
+        {
+            f(0, n);
+        }
+        catch(...)
+        {
+            in_parallel_region = false;
+            throw;
+        }
+
+        in_parallel_region = false;
+        return;
+    }
+
+    impl_->ParallelFor(n, num_thread, f);
+}
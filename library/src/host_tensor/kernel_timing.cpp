@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+
+#include "kernel_timing.hpp"
+
+namespace {
+
+int get_env_int(const char* name, int default_value)
+{
+    const char* env = std::getenv(name);
+
+    return env == nullptr ? default_value : std::atoi(env);
+}
+
+} // namespace
+
+float get_sorted_percentile(const std::vector<float>& sorted_samples, float p)
+{
+    if(sorted_samples.empty())
+        return 0;
+
+    const float rank        = p / 100.f * static_cast<float>(sorted_samples.size() - 1);
+    const std::size_t lower = static_cast<std::size_t>(std::floor(rank));
+    const std::size_t upper = std::min(lower + 1, sorted_samples.size() - 1);
+    const float weight      = rank - static_cast<float>(lower);
+
+    return sorted_samples[lower] + weight * (sorted_samples[upper] - sorted_samples[lower]);
+}
+
+KernelTimingResult get_kernel_timing_result(std::vector<float> samples)
+{
+    KernelTimingResult result;
+
+    result.samples = std::move(samples);
+
+    if(result.samples.empty())
+        return result;
+
+    std::vector<float> sorted = result.samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    const double n   = static_cast<double>(sorted.size());
+    const double sum = std::accumulate(sorted.begin(), sorted.end(), 0.);
+
+    double square_sum = 0;
+
+    for(const float x : sorted)
+        square_sum += (x - sum / n) * (x - sum / n);
+
+    result.mean   = static_cast<float>(sum / n);
+    result.min    = sorted.front();
+    result.median = get_sorted_percentile(sorted, 50);
+    result.p90    = get_sorted_percentile(sorted, 90);
+    result.p99    = get_sorted_percentile(sorted, 99);
+    result.stddev = static_cast<float>(std::sqrt(square_sum / n));
+
+    const float q1  = get_sorted_percentile(sorted, 25);
+    const float q3  = get_sorted_percentile(sorted, 75);
+    const float iqr = q3 - q1;
+
+    for(const float x : sorted)
+    {
+        if(x < q1 - 1.5f * iqr || x > q3 + 1.5f * iqr)
+            ++result.num_outlier;
+    }
+
+    return result;
+}
+
+void add_kernel_timing_samples(KernelTimingResult& result, const std::vector<float>& samples)
+{
+    std::vector<float> sum = samples;
+
+    if(result.samples.size() == samples.size())
+    {
+        for(std::size_t i = 0; i < sum.size(); ++i)
+            sum[i] += result.samples[i];
+    }
+
+    result = get_kernel_timing_result(std::move(sum));
+}
+
+StreamConfig get_timing_stream_config(bool time_kernel, KernelTimingResult* result)
+{
+    StreamConfig config;
+
+    config.time_kernel_   = time_kernel;
+    config.n_warmup_      = std::max(get_env_int("CK_TIMING_WARMUP", config.n_warmup_), 0);
+    config.n_repeat_      = std::max(get_env_int("CK_TIMING_REPEAT", config.n_repeat_), 1);
+    config.flush_cache_   = get_env_int("CK_TIMING_FLUSH_CACHE", 0) != 0;
+    config.timing_result_ = result;
+
+    return config;
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_batched_gemm_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceGemmNoOpPtr = DeviceGemmPtr<PassThrough, PassThrough, PassThrough>;
+
+using DeviceGemmNoOpFactories = DeviceOperationFactories<DeviceGemmNoOpPtr>;
+
+void add_device_batched_gemm_xdl_f16_f16_f16_gmk_gkn_gmn_factories(DeviceGemmNoOpFactories&);
+void add_device_batched_gemm_xdl_f16_f16_f16_gmk_gnk_gmn_factories(DeviceGemmNoOpFactories&);
+void add_device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_factories(DeviceGemmNoOpFactories&);
+void add_device_batched_gemm_xdl_f16_f16_f16_gkm_gnk_gmn_factories(DeviceGemmNoOpFactories&);
+
+void add_device_batched_gemm_f16_groups(DeviceOperationRegistry<DeviceGemmNoOpPtr>& registry)
+{
+    registry.Add({"batched_gemm", "xdl", "f16_f16_f16", "gmk_gkn_gmn", "PassThrough"},
+                 add_device_batched_gemm_xdl_f16_f16_f16_gmk_gkn_gmn_factories)
+        .Add({"batched_gemm", "xdl", "f16_f16_f16", "gmk_gnk_gmn", "PassThrough"},
+             add_device_batched_gemm_xdl_f16_f16_f16_gmk_gnk_gmn_factories)
+        .Add({"batched_gemm", "xdl", "f16_f16_f16", "gkm_gkn_gmn", "PassThrough"},
+             add_device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_factories)
+        .Add({"batched_gemm", "xdl", "f16_f16_f16", "gkm_gnk_gmn", "PassThrough"},
+             add_device_batched_gemm_xdl_f16_f16_f16_gkm_gnk_gmn_factories);
+}
+
+} // namespace device_batched_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_batched_gemm_instance::DeviceGemmNoOpPtr> registry;
+
+    device_batched_gemm_instance::add_device_batched_gemm_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
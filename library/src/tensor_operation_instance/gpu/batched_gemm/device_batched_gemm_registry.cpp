@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_batched_gemm_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceGemmNoOpPtr = DeviceGemmPtr<PassThrough, PassThrough, PassThrough>;
+
+void add_device_batched_gemm_f32_groups(DeviceOperationRegistry<DeviceGemmNoOpPtr>&);
+void add_device_batched_gemm_f16_groups(DeviceOperationRegistry<DeviceGemmNoOpPtr>&);
+void add_device_batched_gemm_bf16_groups(DeviceOperationRegistry<DeviceGemmNoOpPtr>&);
+void add_device_batched_gemm_int8_groups(DeviceOperationRegistry<DeviceGemmNoOpPtr>&);
+
+const DeviceOperationRegistry<DeviceGemmNoOpPtr>& get_device_batched_gemm_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceGemmNoOpPtr> r;
+
+        add_device_batched_gemm_f32_groups(r);
+        add_device_batched_gemm_f16_groups(r);
+        add_device_batched_gemm_bf16_groups(r);
+        add_device_batched_gemm_int8_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_batched_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
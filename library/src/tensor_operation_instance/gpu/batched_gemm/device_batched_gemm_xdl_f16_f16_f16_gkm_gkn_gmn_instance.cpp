@@ -38,11 +38,18 @@ using device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_instances = std::tuple<
     // clang-format on
     >;
 
+void add_device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_factories(
+    DeviceOperationFactories<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& factories)
+{
+    add_device_operation_instances(factories,
+                                   device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_instances{});
+}
+
 void add_device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_instances(
     std::vector<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_instances{});
+    construct_device_operation_instances(
+        instances, add_device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_factories);
 }
 
 } // namespace device_batched_gemm_instance
@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "tuple.hpp"
+#include "device_gemm_reduce.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using F32            = float;
+using DPtrsGlobal    = ck::Tuple<F32*, F32*>;
+using PassThrough    = ck::tensor_operation::element_wise::PassThrough;
+using Identity       = ck::tensor_operation::element_wise::UnaryIdentic<F32, F32, false>;
+using Square         = ck::tensor_operation::element_wise::UnarySquare<F32, F32, false>;
+using DInElementOps  = ck::Tuple<Identity, Square>;
+using DOutElementOps = ck::Tuple<Identity, Identity>;
+
+using DeviceGemmReduceNoOpPtr = DeviceGemmReducePtr<DPtrsGlobal,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    DInElementOps,
+                                                    DOutElementOps>;
+
+using DeviceGemmReduceNoOpFactories = DeviceOperationFactories<DeviceGemmReduceNoOpPtr>;
+
+void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_factories(
+    DeviceGemmReduceNoOpFactories&);
+void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gnk_gmn_factories(
+    DeviceGemmReduceNoOpFactories&);
+void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gkn_gmn_factories(
+    DeviceGemmReduceNoOpFactories&);
+void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gnk_gmn_factories(
+    DeviceGemmReduceNoOpFactories&);
+
+void add_device_batched_gemm_reduce_f16_groups(
+    DeviceOperationRegistry<DeviceGemmReduceNoOpPtr>& registry)
+{
+    registry.Add(
+        {"batched_gemm_reduce",
+         "xdl_cshuffle",
+         "f16_f16_f16_f32_f32",
+         "gmk_gkn_gmn",
+         "PassThrough"},
+        add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_factories)
+        .Add({"batched_gemm_reduce",
+              "xdl_cshuffle",
+              "f16_f16_f16_f32_f32",
+              "gmk_gnk_gmn",
+              "PassThrough"},
+             add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gnk_gmn_factories)
+        .Add({"batched_gemm_reduce",
+              "xdl_cshuffle",
+              "f16_f16_f16_f32_f32",
+              "gkm_gkn_gmn",
+              "PassThrough"},
+             add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gkn_gmn_factories)
+        .Add({"batched_gemm_reduce",
+              "xdl_cshuffle",
+              "f16_f16_f16_f32_f32",
+              "gkm_gnk_gmn",
+              "PassThrough"},
+             add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gnk_gmn_factories);
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_gemm_instance::DeviceGemmReduceNoOpPtr> registry;
+
+    device_gemm_instance::add_device_batched_gemm_reduce_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
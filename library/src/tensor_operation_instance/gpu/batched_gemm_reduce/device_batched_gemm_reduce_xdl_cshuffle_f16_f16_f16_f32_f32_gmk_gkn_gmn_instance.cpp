@@ -61,6 +61,19 @@ using device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_in
         // clang-format on
         >;
 
+void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_factories(
+    DeviceOperationFactories<DeviceGemmReducePtr<DPtrsGlobal,
+                                                 PassThrough,
+                                                 PassThrough,
+                                                 PassThrough,
+                                                 DInElementOps,
+                                                 DOutElementOps>>& factories)
+{
+    add_device_operation_instances(
+        factories,
+        device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_instances{});
+}
+
 void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_instances(
     std::vector<DeviceGemmReducePtr<DPtrsGlobal,
                                     PassThrough,
@@ -69,9 +82,9 @@ void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn
                                     DInElementOps,
                                     DOutElementOps>>& instances)
 {
-    add_device_operation_instances(
+    construct_device_operation_instances(
         instances,
-        device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_instances{});
+        add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gmk_gkn_gmn_factories);
 }
 
 } // namespace device_gemm_instance
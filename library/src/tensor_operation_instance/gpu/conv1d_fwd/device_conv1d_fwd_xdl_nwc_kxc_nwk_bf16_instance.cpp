@@ -96,16 +96,23 @@ using device_conv1d_fwd_xdl_nwc_kxc_nwk_1x1_s1_p0_bf16_instances = std::tuple<
     // clang-format on
     >;
 
-void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_instances(
-    std::vector<DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>>& instances)
+void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_factories(
+    DeviceOperationFactories<DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>>& factories)
 {
-    add_device_operation_instances(instances, device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_instances{});
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories, device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_instances{});
+    add_device_operation_instances(factories,
                                    device_conv1d_fwd_xdl_nwc_kxc_nwk_1x1_p0_bf16_instances{});
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories,
                                    device_conv1d_fwd_xdl_nwc_kxc_nwk_1x1_s1_p0_bf16_instances{});
 }
 
+void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_instances(
+    std::vector<DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>>& instances)
+{
+    construct_device_operation_instances(instances,
+                                         add_device_conv1d_fwd_xdl_nwc_kxc_nwk_bf16_factories);
+}
+
 } // namespace device_conv1d_fwd_instance
 } // namespace device
 } // namespace tensor_operation
@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_bwd_data.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_bwd_data_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceConvBwdDataNoOpPtr = DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>;
+
+using DeviceConvBwdDataNoOpFactories = DeviceOperationFactories<DeviceConvBwdDataNoOpPtr>;
+
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_factories(DeviceConvBwdDataNoOpFactories&);
+
+void add_device_conv2d_bwd_data_f16_groups(
+    DeviceOperationRegistry<DeviceConvBwdDataNoOpPtr>& registry)
+{
+    registry.Add({"conv2d_bwd_data", "xdl", "f16", "nhwc_kyxc_nhwk", "PassThrough"},
+                 add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_factories);
+}
+
+} // namespace device_conv2d_bwd_data_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_conv2d_bwd_data_instance::DeviceConvBwdDataNoOpPtr> registry;
+
+    device_conv2d_bwd_data_instance::add_device_conv2d_bwd_data_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -68,13 +68,21 @@ using device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances =
         // clang-format on
         >;
 
-void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances(
-    std::vector<DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>>& instances)
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_factories(
+    DeviceOperationFactories<DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>>&
+        factories)
 {
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories,
                                    device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances{});
     add_device_operation_instances(
-        instances, device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances{});
+        factories, device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances{});
+}
+
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances(
+    std::vector<DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>>& instances)
+{
+    construct_device_operation_instances(
+        instances, add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_factories);
 }
 
 } // namespace device_conv2d_bwd_data_instance
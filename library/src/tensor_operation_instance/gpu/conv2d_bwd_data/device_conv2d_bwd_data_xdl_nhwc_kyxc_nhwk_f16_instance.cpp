@@ -70,13 +70,21 @@ using device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f16_instances =
         // clang-format on
         >;
 
-void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_instances(
-    std::vector<DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>>& instances)
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_factories(
+    DeviceOperationFactories<DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>>&
+        factories)
 {
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories,
                                    device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_instances{});
     add_device_operation_instances(
-        instances, device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f16_instances{});
+        factories, device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f16_instances{});
+}
+
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_instances(
+    std::vector<DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>>& instances)
+{
+    construct_device_operation_instances(
+        instances, add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_factories);
 }
 
 } // namespace device_conv2d_bwd_data_instance
@@ -0,0 +1,46 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_backward_weight.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_bwd_weight_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceConvBwdWeightNoOpPtr = DeviceConvBwdWeightPtr<PassThrough, PassThrough, PassThrough>;
+
+using DeviceConvBwdWeightNoOpFactories = DeviceOperationFactories<DeviceConvBwdWeightNoOpPtr>;
+
+void add_device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f16_factories(
+    DeviceConvBwdWeightNoOpFactories&);
+
+void add_device_conv2d_bwd_weight_f16_groups(
+    DeviceOperationRegistry<DeviceConvBwdWeightNoOpPtr>& registry)
+{
+    registry.Add({"conv2d_bwd_weight", "xdl", "f16", "nhwc_kyxc_nhwk", "PassThrough"},
+                 add_device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f16_factories);
+}
+
+} // namespace device_conv2d_bwd_weight_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_conv2d_bwd_weight_instance::DeviceConvBwdWeightNoOpPtr> registry;
+
+    device_conv2d_bwd_weight_instance::add_device_conv2d_bwd_weight_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -0,0 +1,37 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_backward_weight.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_bwd_weight_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceConvBwdWeightNoOpPtr = DeviceConvBwdWeightPtr<PassThrough, PassThrough, PassThrough>;
+
+void add_device_conv2d_bwd_weight_f32_groups(DeviceOperationRegistry<DeviceConvBwdWeightNoOpPtr>&);
+void add_device_conv2d_bwd_weight_f16_groups(DeviceOperationRegistry<DeviceConvBwdWeightNoOpPtr>&);
+
+const DeviceOperationRegistry<DeviceConvBwdWeightNoOpPtr>& get_device_conv2d_bwd_weight_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceConvBwdWeightNoOpPtr> r;
+
+        add_device_conv2d_bwd_weight_f32_groups(r);
+        add_device_conv2d_bwd_weight_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_conv2d_bwd_weight_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -39,11 +39,19 @@ using device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_instances = std::tuple<
     // clang-format on
     >;
 
+void add_device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_factories(
+    DeviceOperationFactories<DeviceConvBwdWeightPtr<PassThrough, PassThrough, PassThrough>>&
+        factories)
+{
+    add_device_operation_instances(factories,
+                                   device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_instances{});
+}
+
 void add_device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_instances(
     std::vector<DeviceConvBwdWeightPtr<PassThrough, PassThrough, PassThrough>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_instances{});
+    construct_device_operation_instances(
+        instances, add_device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_factories);
 }
 
 } // namespace device_conv2d_bwd_weight_instance
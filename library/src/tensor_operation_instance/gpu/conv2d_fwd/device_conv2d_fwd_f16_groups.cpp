@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_fwd.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_fwd_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceConvFwdNoOpPtr = DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>;
+
+using DeviceConvFwdNoOpFactories = DeviceOperationFactories<DeviceConvFwdNoOpPtr>;
+
+void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_factories(DeviceConvFwdNoOpFactories&);
+void add_device_conv2d_fwd_xdl_c_shuffle_nhwc_kyxc_nhwk_f16_factories(DeviceConvFwdNoOpFactories&);
+
+void add_device_conv2d_fwd_f16_groups(DeviceOperationRegistry<DeviceConvFwdNoOpPtr>& registry)
+{
+    registry.Add({"conv2d_fwd", "xdl", "f16", "nhwc_kyxc_nhwk", "PassThrough"},
+                 add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_factories)
+        .Add({"conv2d_fwd", "xdl_c_shuffle", "f16", "nhwc_kyxc_nhwk", "PassThrough"},
+             add_device_conv2d_fwd_xdl_c_shuffle_nhwc_kyxc_nhwk_f16_factories);
+}
+
+} // namespace device_conv2d_fwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_conv2d_fwd_instance::DeviceConvFwdNoOpPtr> registry;
+
+    device_conv2d_fwd_instance::add_device_conv2d_fwd_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
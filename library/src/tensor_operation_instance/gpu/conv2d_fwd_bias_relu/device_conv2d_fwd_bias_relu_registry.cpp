@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_fwd_bias_activation.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_fwd_bias_activation_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddRelu     = ck::tensor_operation::element_wise::AddRelu;
+
+using DeviceConvFwdBiasReluPtr = DeviceConvFwdBiasActivationPtr<PassThrough, PassThrough, AddRelu>;
+
+void add_device_conv2d_fwd_bias_relu_f16_groups(DeviceOperationRegistry<DeviceConvFwdBiasReluPtr>&);
+
+const DeviceOperationRegistry<DeviceConvFwdBiasReluPtr>& get_device_conv2d_fwd_bias_relu_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceConvFwdBiasReluPtr> r;
+
+        add_device_conv2d_fwd_bias_relu_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_conv2d_fwd_bias_activation_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
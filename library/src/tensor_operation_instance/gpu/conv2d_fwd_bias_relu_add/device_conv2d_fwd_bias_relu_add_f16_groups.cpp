@@ -0,0 +1,54 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_fwd_bias_activation_add.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_fwd_bias_activation_add_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddReluAdd  = ck::tensor_operation::element_wise::AddReluAdd;
+
+using DeviceConvFwdBiasReluAddPtr = DeviceConvFwdBiasActivationAddPtr<PassThrough,
+                                                                      PassThrough,
+                                                                      AddReluAdd>;
+
+using DeviceConvFwdBiasReluAddFactories = DeviceOperationFactories<DeviceConvFwdBiasReluAddPtr>;
+
+void add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_add_nhwc_kyxc_nhwk_f16_factories(
+    DeviceConvFwdBiasReluAddFactories&);
+
+void add_device_conv2d_fwd_bias_relu_add_f16_groups(
+    DeviceOperationRegistry<DeviceConvFwdBiasReluAddPtr>& registry)
+{
+    registry.Add({"conv2d_fwd_bias_relu_add",
+                  "xdl_c_shuffle",
+                  "f16",
+                  "nhwc_kyxc_nhwk",
+                  "PassThrough_PassThrough_AddReluAdd"},
+                 add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_add_nhwc_kyxc_nhwk_f16_factories);
+}
+
+} // namespace device_conv2d_fwd_bias_activation_add_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+    using namespace device_conv2d_fwd_bias_activation_add_instance;
+
+    DeviceOperationRegistry<DeviceConvFwdBiasReluAddPtr> registry;
+
+    add_device_conv2d_fwd_bias_relu_add_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_fwd_bias_activation_add.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_fwd_bias_activation_add_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddReluAdd  = ck::tensor_operation::element_wise::AddReluAdd;
+
+using DeviceConvFwdBiasReluAddPtr = DeviceConvFwdBiasActivationAddPtr<PassThrough,
+                                                                      PassThrough,
+                                                                      AddReluAdd>;
+
+void add_device_conv2d_fwd_bias_relu_add_f16_groups(
+    DeviceOperationRegistry<DeviceConvFwdBiasReluAddPtr>&);
+
+const DeviceOperationRegistry<DeviceConvFwdBiasReluAddPtr>&
+get_device_conv2d_fwd_bias_relu_add_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceConvFwdBiasReluAddPtr> r;
+
+        add_device_conv2d_fwd_bias_relu_add_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_conv2d_fwd_bias_activation_add_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_fwd_bias_activation.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_fwd_bias_activation_atomic_add_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddRelu     = ck::tensor_operation::element_wise::AddRelu;
+
+using DeviceConvFwdBiasReluPtr = DeviceConvFwdBiasActivationPtr<PassThrough, PassThrough, AddRelu>;
+
+using DeviceConvFwdBiasReluFactories = DeviceOperationFactories<DeviceConvFwdBiasReluPtr>;
+
+void add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_factories(
+    DeviceConvFwdBiasReluFactories&);
+
+void add_device_conv2d_fwd_bias_relu_atomic_add_f16_groups(
+    DeviceOperationRegistry<DeviceConvFwdBiasReluPtr>& registry)
+{
+    registry.Add(
+        {"conv2d_fwd_bias_relu_atomic_add",
+         "xdl_c_shuffle",
+         "f16",
+         "nhwc_kyxc_nhwk",
+         "PassThrough_PassThrough_AddRelu"},
+        add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_factories);
+}
+
+} // namespace device_conv2d_fwd_bias_activation_atomic_add_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+    using namespace device_conv2d_fwd_bias_activation_atomic_add_instance;
+
+    DeviceOperationRegistry<DeviceConvFwdBiasReluPtr> registry;
+
+    add_device_conv2d_fwd_bias_relu_atomic_add_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
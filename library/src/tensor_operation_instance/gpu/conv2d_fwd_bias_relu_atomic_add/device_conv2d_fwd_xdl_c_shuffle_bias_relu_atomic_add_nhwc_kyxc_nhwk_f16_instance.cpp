@@ -45,22 +45,22 @@ using device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_in
     // clang-format on
     >;
 
+void add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_factories(
+    DeviceOperationFactories<DeviceConvFwdBiasActivationPtr<PassThrough, PassThrough, AddRelu>>&
+        factories)
+{
+    add_device_operation_instances(
+        factories,
+        device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_instances{});
+}
+
 void add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_instances(
     std::vector<DeviceConvFwdBiasActivationPtr<PassThrough, PassThrough, AddRelu>>&
         instance_container)
 {
-    using Instances =
-        device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_instances;
-
-    const auto instances = Instances{};
-
-    ck::static_for<0, std::tuple_size_v<Instances>, 1>{}([&](auto i) {
-        using Instance = remove_cvref_t<decltype(std::get<i>(instances))>;
-
-        auto instance = Instance{};
-
-        instance_container.push_back(std::make_unique<Instance>(instance));
-    });
+    construct_device_operation_instances(
+        instance_container,
+        add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_factories);
 }
 
 } // namespace device_conv2d_fwd_bias_activation_atomic_add_instance
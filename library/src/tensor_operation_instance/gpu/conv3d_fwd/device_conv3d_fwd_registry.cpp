@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_fwd.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv3d_fwd_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceConvFwdNoOpPtr = DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>;
+
+void add_device_conv3d_fwd_f32_groups(DeviceOperationRegistry<DeviceConvFwdNoOpPtr>&);
+void add_device_conv3d_fwd_f16_groups(DeviceOperationRegistry<DeviceConvFwdNoOpPtr>&);
+void add_device_conv3d_fwd_bf16_groups(DeviceOperationRegistry<DeviceConvFwdNoOpPtr>&);
+void add_device_conv3d_fwd_int8_groups(DeviceOperationRegistry<DeviceConvFwdNoOpPtr>&);
+
+const DeviceOperationRegistry<DeviceConvFwdNoOpPtr>& get_device_conv3d_fwd_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceConvFwdNoOpPtr> r;
+
+        add_device_conv3d_fwd_f32_groups(r);
+        add_device_conv3d_fwd_f16_groups(r);
+        add_device_conv3d_fwd_bf16_groups(r);
+        add_device_conv3d_fwd_int8_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_conv3d_fwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -92,15 +92,22 @@ using device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_f32_instances = std::tup
     // clang-format on
     >;
 
-void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_instances(
-    std::vector<DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>>& instances)
+void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_factories(
+    DeviceOperationFactories<DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>>& factories)
 {
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories,
                                    device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_instances{});
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories,
                                    device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_1x1_p0_f32_instances{});
     add_device_operation_instances(
-        instances, device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_f32_instances{});
+        factories, device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_f32_instances{});
+}
+
+void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_instances(
+    std::vector<DeviceConvFwdPtr<PassThrough, PassThrough, PassThrough>>& instances)
+{
+    construct_device_operation_instances(instances,
+                                         add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_factories);
 }
 
 } // namespace device_conv3d_fwd_instance
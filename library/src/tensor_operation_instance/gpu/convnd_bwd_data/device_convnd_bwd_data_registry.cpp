@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_conv_bwd_data.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_bwd_data_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceConvBwdDataNoOpPtr = DeviceConvBwdDataPtr<PassThrough, PassThrough, PassThrough>;
+
+void add_device_convnd_bwd_data_f32_groups(DeviceOperationRegistry<DeviceConvBwdDataNoOpPtr>&);
+void add_device_convnd_bwd_data_f16_groups(DeviceOperationRegistry<DeviceConvBwdDataNoOpPtr>&);
+void add_device_convnd_bwd_data_bf16_groups(DeviceOperationRegistry<DeviceConvBwdDataNoOpPtr>&);
+void add_device_convnd_bwd_data_int8_groups(DeviceOperationRegistry<DeviceConvBwdDataNoOpPtr>&);
+
+const DeviceOperationRegistry<DeviceConvBwdDataNoOpPtr>& get_device_convnd_bwd_data_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceConvBwdDataNoOpPtr> r;
+
+        add_device_convnd_bwd_data_f32_groups(r);
+        add_device_convnd_bwd_data_f16_groups(r);
+        add_device_convnd_bwd_data_bf16_groups(r);
+        add_device_convnd_bwd_data_int8_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_conv2d_bwd_data_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
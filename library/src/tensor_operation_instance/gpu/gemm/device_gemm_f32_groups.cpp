@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using DeviceGemmNoOpPtr = DeviceGemmPtr<ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough>;
+
+using DeviceGemmNoOpFactories = DeviceOperationFactories<DeviceGemmNoOpPtr>;
+
+void add_device_gemm_xdl_f32_f32_f32_mk_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_f32_f32_f32_mk_nk_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_f32_f32_f32_km_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_f32_f32_f32_km_nk_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_nk_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_nk_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_splitk_f32_f32_f32_mk_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_splitk_f32_f32_f32_mk_nk_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_splitk_f32_f32_f32_km_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_splitk_f32_f32_f32_km_nk_mn_factories(DeviceGemmNoOpFactories&);
+
+void add_device_gemm_f32_groups(DeviceOperationRegistry<DeviceGemmNoOpPtr>& registry)
+{
+    registry.Add({"gemm", "xdl", "f32_f32_f32", "mk_kn_mn", "PassThrough"},
+                 add_device_gemm_xdl_f32_f32_f32_mk_kn_mn_factories)
+        .Add({"gemm", "xdl", "f32_f32_f32", "mk_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_f32_f32_f32_mk_nk_mn_factories)
+        .Add({"gemm", "xdl", "f32_f32_f32", "km_kn_mn", "PassThrough"},
+             add_device_gemm_xdl_f32_f32_f32_km_kn_mn_factories)
+        .Add({"gemm", "xdl", "f32_f32_f32", "km_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_f32_f32_f32_km_nk_mn_factories)
+        .Add({"gemm", "xdl_c_shuffle", "f32_f32_f32", "mk_kn_mn", "PassThrough"},
+             add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_kn_mn_factories)
+        .Add({"gemm", "xdl_c_shuffle", "f32_f32_f32", "mk_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_nk_mn_factories)
+        .Add({"gemm", "xdl_c_shuffle", "f32_f32_f32", "km_kn_mn", "PassThrough"},
+             add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_factories)
+        .Add({"gemm", "xdl_c_shuffle", "f32_f32_f32", "km_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_nk_mn_factories)
+        .Add({"gemm", "xdl_splitk", "f32_f32_f32", "mk_kn_mn", "PassThrough"},
+             add_device_gemm_xdl_splitk_f32_f32_f32_mk_kn_mn_factories)
+        .Add({"gemm", "xdl_splitk", "f32_f32_f32", "mk_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_splitk_f32_f32_f32_mk_nk_mn_factories)
+        .Add({"gemm", "xdl_splitk", "f32_f32_f32", "km_kn_mn", "PassThrough"},
+             add_device_gemm_xdl_splitk_f32_f32_f32_km_kn_mn_factories)
+        .Add({"gemm", "xdl_splitk", "f32_f32_f32", "km_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_splitk_f32_f32_f32_km_nk_mn_factories);
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_gemm_instance::DeviceGemmNoOpPtr> registry;
+
+    device_gemm_instance::add_device_gemm_f32_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using DeviceGemmNoOpPtr = DeviceGemmPtr<ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough>;
+
+using DeviceGemmNoOpFactories = DeviceOperationFactories<DeviceGemmNoOpPtr>;
+
+void add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_nk_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_kn_mn_factories(DeviceGemmNoOpFactories&);
+void add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_nk_mn_factories(DeviceGemmNoOpFactories&);
+
+void add_device_gemm_int8_groups(DeviceOperationRegistry<DeviceGemmNoOpPtr>& registry)
+{
+    registry.Add({"gemm", "xdl_c_shuffle", "int8_int8_int8", "mk_kn_mn", "PassThrough"},
+                 add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_kn_mn_factories)
+        .Add({"gemm", "xdl_c_shuffle", "int8_int8_int8", "mk_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_nk_mn_factories)
+        .Add({"gemm", "xdl_c_shuffle", "int8_int8_int8", "km_kn_mn", "PassThrough"},
+             add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_kn_mn_factories)
+        .Add({"gemm", "xdl_c_shuffle", "int8_int8_int8", "km_nk_mn", "PassThrough"},
+             add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_nk_mn_factories);
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_gemm_instance::DeviceGemmNoOpPtr> registry;
+
+    device_gemm_instance::add_device_gemm_int8_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -48,11 +48,18 @@ using device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_instances = std::tuple<
     // clang-format on
     >;
 
+void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_factories(
+    DeviceOperationFactories<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& factories)
+{
+    add_device_operation_instances(factories,
+                                   device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_instances{});
+}
+
 void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_instances(
     std::vector<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_instances{});
+    construct_device_operation_instances(
+        instances, add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_factories);
 }
 
 } // namespace device_gemm_instance
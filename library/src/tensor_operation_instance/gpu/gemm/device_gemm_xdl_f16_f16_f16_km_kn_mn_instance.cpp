@@ -41,10 +41,17 @@ using device_gemm_xdl_f16_f16_f16_km_kn_mn_instances =
         // clang-format on
         >;
 
+void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_factories(
+    DeviceOperationFactories<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& factories)
+{
+    add_device_operation_instances(factories, device_gemm_xdl_f16_f16_f16_km_kn_mn_instances{});
+}
+
 void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_instances(
     std::vector<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
 {
-    add_device_operation_instances(instances, device_gemm_xdl_f16_f16_f16_km_kn_mn_instances{});
+    construct_device_operation_instances(instances,
+                                         add_device_gemm_xdl_f16_f16_f16_km_kn_mn_factories);
 }
 
 } // namespace device_gemm_instance
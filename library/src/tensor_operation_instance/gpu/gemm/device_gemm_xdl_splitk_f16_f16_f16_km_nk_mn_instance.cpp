@@ -40,11 +40,18 @@ using device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_instances = std::tuple<
     // clang-format on
     >;
 
+void add_device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_factories(
+    DeviceOperationFactories<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& factories)
+{
+    add_device_operation_instances(factories,
+                                   device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_instances{});
+}
+
 void add_device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_instances(
     std::vector<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_instances{});
+    construct_device_operation_instances(instances,
+                                         add_device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_factories);
 }
 
 } // namespace device_gemm_instance
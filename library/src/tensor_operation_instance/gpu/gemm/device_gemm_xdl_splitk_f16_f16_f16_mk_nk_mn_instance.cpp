@@ -77,10 +77,10 @@ using device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_instances = std::tuple<
 //     // clang-format on
 //     >;
 
-void add_device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_instances(
-    std::vector<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
+void add_device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_factories(
+    DeviceOperationFactories<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& factories)
 {
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories,
                                    device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_instances{});
 
     // FIXME - IsSupportedArgument() is false, need to check validity
@@ -88,6 +88,13 @@ void add_device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_instances(
     //     instances, device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_irregular_tile_instances{});
 }
 
+void add_device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_instances(
+    std::vector<DeviceGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
+{
+    construct_device_operation_instances(instances,
+                                         add_device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_factories);
+}
+
 } // namespace device_gemm_instance
 } // namespace device
 } // namespace tensor_operation
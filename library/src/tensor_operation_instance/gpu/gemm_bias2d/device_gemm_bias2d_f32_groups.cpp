@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm_bias.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using PassThrough  = ck::tensor_operation::element_wise::PassThrough;
+using AlphaBetaAdd = ck::tensor_operation::element_wise::AlphaBetaAdd;
+
+using DeviceGemmBias2dPtr = DeviceGemmBiasPtr<PassThrough, PassThrough, AlphaBetaAdd>;
+
+using DeviceGemmBias2dFactories = DeviceOperationFactories<DeviceGemmBias2dPtr>;
+
+void add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_km_kn_mn_factories(
+    DeviceGemmBias2dFactories&);
+void add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_km_nk_mn_factories(
+    DeviceGemmBias2dFactories&);
+void add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_mk_kn_mn_factories(
+    DeviceGemmBias2dFactories&);
+void add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_mk_nk_mn_factories(
+    DeviceGemmBias2dFactories&);
+
+void add_device_gemm_bias2d_f32_groups(DeviceOperationRegistry<DeviceGemmBias2dPtr>& registry)
+{
+    registry.Add({"gemm_bias_2d",
+                  "xdl_c_shuffle",
+                  "f32_f32_f32",
+                  "km_kn_mn",
+                  "PassThrough_PassThrough_AlphaBetaAdd"},
+                 add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_km_kn_mn_factories)
+        .Add({"gemm_bias_2d",
+              "xdl_c_shuffle",
+              "f32_f32_f32",
+              "km_nk_mn",
+              "PassThrough_PassThrough_AlphaBetaAdd"},
+             add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_km_nk_mn_factories)
+        .Add({"gemm_bias_2d",
+              "xdl_c_shuffle",
+              "f32_f32_f32",
+              "mk_kn_mn",
+              "PassThrough_PassThrough_AlphaBetaAdd"},
+             add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_mk_kn_mn_factories)
+        .Add({"gemm_bias_2d",
+              "xdl_c_shuffle",
+              "f32_f32_f32",
+              "mk_nk_mn",
+              "PassThrough_PassThrough_AlphaBetaAdd"},
+             add_device_gemm_xdl_c_shuffle_bias_2d_f32_f32_f32_mk_nk_mn_factories);
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_gemm_instance::DeviceGemmBias2dPtr> registry;
+
+    device_gemm_instance::add_device_gemm_bias2d_f32_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -0,0 +1,38 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm_bias.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using PassThrough  = ck::tensor_operation::element_wise::PassThrough;
+using AlphaBetaAdd = ck::tensor_operation::element_wise::AlphaBetaAdd;
+
+using DeviceGemmBias2dPtr = DeviceGemmBiasPtr<PassThrough, PassThrough, AlphaBetaAdd>;
+
+void add_device_gemm_bias2d_f32_groups(DeviceOperationRegistry<DeviceGemmBias2dPtr>&);
+void add_device_gemm_bias2d_f16_groups(DeviceOperationRegistry<DeviceGemmBias2dPtr>&);
+
+const DeviceOperationRegistry<DeviceGemmBias2dPtr>& get_device_gemm_bias2d_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceGemmBias2dPtr> r;
+
+        add_device_gemm_bias2d_f32_groups(r);
+        add_device_gemm_bias2d_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -44,11 +44,18 @@ using device_gemm_xdl_c_shuffle_bias_2d_f16_f16_f16_mk_nk_mn_instances = std::tu
     // clang-format on
     >;
 
+void add_device_gemm_xdl_c_shuffle_bias_2d_f16_f16_f16_mk_nk_mn_factories(
+    DeviceOperationFactories<DeviceGemmBiasPtr<PassThrough, PassThrough, AlphaBetaAdd>>& factories)
+{
+    add_device_operation_instances(
+        factories, device_gemm_xdl_c_shuffle_bias_2d_f16_f16_f16_mk_nk_mn_instances{});
+}
+
 void add_device_gemm_xdl_c_shuffle_bias_2d_f16_f16_f16_mk_nk_mn_instances(
     std::vector<DeviceGemmBiasPtr<PassThrough, PassThrough, AlphaBetaAdd>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_gemm_xdl_c_shuffle_bias_2d_f16_f16_f16_mk_nk_mn_instances{});
+    construct_device_operation_instances(
+        instances, add_device_gemm_xdl_c_shuffle_bias_2d_f16_f16_f16_mk_nk_mn_factories);
 }
 
 } // namespace device_gemm_instance
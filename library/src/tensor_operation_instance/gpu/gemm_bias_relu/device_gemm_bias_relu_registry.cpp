@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm_bias_activation.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddRelu     = ck::tensor_operation::element_wise::AddRelu;
+
+using DeviceGemmBiasReluPtr = DeviceGemmBiasActivationPtr<PassThrough, PassThrough, AddRelu>;
+
+void add_device_gemm_bias_relu_f16_groups(DeviceOperationRegistry<DeviceGemmBiasReluPtr>&);
+
+const DeviceOperationRegistry<DeviceGemmBiasReluPtr>& get_device_gemm_bias_relu_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceGemmBiasReluPtr> r;
+
+        add_device_gemm_bias_relu_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
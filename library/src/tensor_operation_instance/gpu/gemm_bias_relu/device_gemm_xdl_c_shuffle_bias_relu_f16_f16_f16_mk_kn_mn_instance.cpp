@@ -39,11 +39,19 @@ using device_gemm_xdl_c_shuffle_bias_relu_f16_f16_f16_mk_kn_mn_instances = std::
     // clang-format on
     >;
 
+void add_device_gemm_xdl_c_shuffle_bias_relu_f16_f16_f16_mk_kn_mn_factories(
+    DeviceOperationFactories<DeviceGemmBiasActivationPtr<PassThrough, PassThrough, AddRelu>>&
+        factories)
+{
+    add_device_operation_instances(
+        factories, device_gemm_xdl_c_shuffle_bias_relu_f16_f16_f16_mk_kn_mn_instances{});
+}
+
 void add_device_gemm_xdl_c_shuffle_bias_relu_f16_f16_f16_mk_kn_mn_instances(
     std::vector<DeviceGemmBiasActivationPtr<PassThrough, PassThrough, AddRelu>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_gemm_xdl_c_shuffle_bias_relu_f16_f16_f16_mk_kn_mn_instances{});
+    construct_device_operation_instances(
+        instances, add_device_gemm_xdl_c_shuffle_bias_relu_f16_f16_f16_mk_kn_mn_factories);
 }
 
 } // namespace device_gemm_instance
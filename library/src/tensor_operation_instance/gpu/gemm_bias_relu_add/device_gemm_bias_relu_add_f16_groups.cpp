@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm_bias_activation_add.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddReluAdd  = ck::tensor_operation::element_wise::AddReluAdd;
+
+using DeviceGemmBiasReluAddPtr = DeviceGemmBiasActivationAddPtr<PassThrough,
+                                                                PassThrough,
+                                                                AddReluAdd>;
+
+using DeviceGemmBiasReluAddFactories = DeviceOperationFactories<DeviceGemmBiasReluAddPtr>;
+
+void add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_mk_kn_mn_factories(
+    DeviceGemmBiasReluAddFactories&);
+void add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_mk_nk_mn_factories(
+    DeviceGemmBiasReluAddFactories&);
+void add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_km_kn_mn_factories(
+    DeviceGemmBiasReluAddFactories&);
+void add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_km_nk_mn_factories(
+    DeviceGemmBiasReluAddFactories&);
+
+void add_device_gemm_bias_relu_add_f16_groups(
+    DeviceOperationRegistry<DeviceGemmBiasReluAddPtr>& registry)
+{
+    registry.Add({"gemm_bias_relu_add",
+                  "xdl_c_shuffle",
+                  "f16_f16_f16",
+                  "mk_kn_mn",
+                  "PassThrough_PassThrough_AddReluAdd"},
+                 add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_mk_kn_mn_factories)
+        .Add({"gemm_bias_relu_add",
+              "xdl_c_shuffle",
+              "f16_f16_f16",
+              "mk_nk_mn",
+              "PassThrough_PassThrough_AddReluAdd"},
+             add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_mk_nk_mn_factories)
+        .Add({"gemm_bias_relu_add",
+              "xdl_c_shuffle",
+              "f16_f16_f16",
+              "km_kn_mn",
+              "PassThrough_PassThrough_AddReluAdd"},
+             add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_km_kn_mn_factories)
+        .Add({"gemm_bias_relu_add",
+              "xdl_c_shuffle",
+              "f16_f16_f16",
+              "km_nk_mn",
+              "PassThrough_PassThrough_AddReluAdd"},
+             add_device_gemm_xdl_c_shuffle_bias_relu_add_f16_f16_f16_km_nk_mn_factories);
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_gemm_instance::DeviceGemmBiasReluAddPtr> registry;
+
+    device_gemm_instance::add_device_gemm_bias_relu_add_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -0,0 +1,38 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm_bias_activation_add.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddReluAdd  = ck::tensor_operation::element_wise::AddReluAdd;
+
+using DeviceGemmBiasReluAddPtr = DeviceGemmBiasActivationAddPtr<PassThrough,
+                                                                PassThrough,
+                                                                AddReluAdd>;
+
+void add_device_gemm_bias_relu_add_f16_groups(DeviceOperationRegistry<DeviceGemmBiasReluAddPtr>&);
+
+const DeviceOperationRegistry<DeviceGemmBiasReluAddPtr>& get_device_gemm_bias_relu_add_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceGemmBiasReluAddPtr> r;
+
+        add_device_gemm_bias_relu_add_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "tuple.hpp"
+#include "device_gemm_reduce.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+using F32            = float;
+using DPtrsGlobal    = ck::Tuple<F32*, F32*>;
+using PassThrough    = ck::tensor_operation::element_wise::PassThrough;
+using Identity       = ck::tensor_operation::element_wise::UnaryIdentic<F32, F32, false>;
+using Square         = ck::tensor_operation::element_wise::UnarySquare<F32, F32, false>;
+using DInElementOps  = ck::Tuple<Identity, Square>;
+using DOutElementOps = ck::Tuple<Identity, Identity>;
+
+using DeviceGemmReduceNoOpPtr = DeviceGemmReducePtr<DPtrsGlobal,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    DInElementOps,
+                                                    DOutElementOps>;
+
+void add_device_gemm_reduce_f16_groups(DeviceOperationRegistry<DeviceGemmReduceNoOpPtr>&);
+
+const DeviceOperationRegistry<DeviceGemmReduceNoOpPtr>& get_device_gemm_reduce_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceGemmReduceNoOpPtr> r;
+
+        add_device_gemm_reduce_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -60,6 +60,18 @@ using device_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_km_kn_mn_instances = s
     // clang-format on
     >;
 
+void add_device_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_km_kn_mn_factories(
+    DeviceOperationFactories<DeviceGemmReducePtr<DPtrsGlobal,
+                                                 PassThrough,
+                                                 PassThrough,
+                                                 PassThrough,
+                                                 DInElementOps,
+                                                 DOutElementOps>>& factories)
+{
+    add_device_operation_instances(
+        factories, device_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_km_kn_mn_instances{});
+}
+
 void add_device_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_km_kn_mn_instances(
     std::vector<DeviceGemmReducePtr<DPtrsGlobal,
                                     PassThrough,
@@ -68,8 +80,8 @@ void add_device_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_km_kn_mn_instances(
                                     DInElementOps,
                                     DOutElementOps>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_km_kn_mn_instances{});
+    construct_device_operation_instances(
+        instances, add_device_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_km_kn_mn_factories);
 }
 
 } // namespace device_gemm_instance
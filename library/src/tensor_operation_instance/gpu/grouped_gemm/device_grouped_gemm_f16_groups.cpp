@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_grouped_gemm_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceGroupedGemmNoOpPtr = DeviceGroupedGemmPtr<PassThrough, PassThrough, PassThrough>;
+
+using DeviceGroupedGemmNoOpFactories = DeviceOperationFactories<DeviceGroupedGemmNoOpPtr>;
+
+void add_device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_factories(DeviceGroupedGemmNoOpFactories&);
+void add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_factories(DeviceGroupedGemmNoOpFactories&);
+void add_device_grouped_gemm_xdl_f16_f16_f16_km_kn_mn_factories(DeviceGroupedGemmNoOpFactories&);
+void add_device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_factories(DeviceGroupedGemmNoOpFactories&);
+
+void add_device_grouped_gemm_f16_groups(DeviceOperationRegistry<DeviceGroupedGemmNoOpPtr>& registry)
+{
+    registry.Add({"grouped_gemm", "xdl", "f16_f16_f16", "mk_kn_mn", "PassThrough"},
+                 add_device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_factories)
+        .Add({"grouped_gemm", "xdl", "f16_f16_f16", "mk_nk_mn", "PassThrough"},
+             add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_factories)
+        .Add({"grouped_gemm", "xdl", "f16_f16_f16", "km_kn_mn", "PassThrough"},
+             add_device_grouped_gemm_xdl_f16_f16_f16_km_kn_mn_factories)
+        .Add({"grouped_gemm", "xdl", "f16_f16_f16", "km_nk_mn", "PassThrough"},
+             add_device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_factories);
+}
+
+} // namespace device_grouped_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<device_grouped_gemm_instance::DeviceGroupedGemmNoOpPtr> registry;
+
+    device_grouped_gemm_instance::add_device_grouped_gemm_f16_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -0,0 +1,35 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_grouped_gemm_instance {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceGroupedGemmNoOpPtr = DeviceGroupedGemmPtr<PassThrough, PassThrough, PassThrough>;
+
+void add_device_grouped_gemm_f16_groups(DeviceOperationRegistry<DeviceGroupedGemmNoOpPtr>&);
+
+const DeviceOperationRegistry<DeviceGroupedGemmNoOpPtr>& get_device_grouped_gemm_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceGroupedGemmNoOpPtr> r;
+
+        add_device_grouped_gemm_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_grouped_gemm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -49,11 +49,19 @@ using device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_instances = std::tuple<
     // clang-format on
     >;
 
+void add_device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_factories(
+    DeviceOperationFactories<DeviceGroupedGemmPtr<PassThrough, PassThrough, PassThrough>>&
+        factories)
+{
+    add_device_operation_instances(factories,
+                                   device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_instances{});
+}
+
 void add_device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_instances(
     std::vector<DeviceGroupedGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_instances{});
+    construct_device_operation_instances(
+        instances, add_device_grouped_gemm_xdl_f16_f16_f16_mk_kn_mn_factories);
 }
 
 } // namespace device_grouped_gemm_instance
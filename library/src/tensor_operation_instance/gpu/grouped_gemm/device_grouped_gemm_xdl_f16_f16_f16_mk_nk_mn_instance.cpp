@@ -58,13 +58,21 @@ using device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_irregular_tile_instances = st
     // clang-format on
     >;
 
-void add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_instances(
-    std::vector<DeviceGroupedGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
+void add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_factories(
+    DeviceOperationFactories<DeviceGroupedGemmPtr<PassThrough, PassThrough, PassThrough>>&
+        factories)
 {
-    add_device_operation_instances(instances,
+    add_device_operation_instances(factories,
                                    device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_instances{});
     add_device_operation_instances(
-        instances, device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_irregular_tile_instances{});
+        factories, device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_irregular_tile_instances{});
+}
+
+void add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_instances(
+    std::vector<DeviceGroupedGemmPtr<PassThrough, PassThrough, PassThrough>>& instances)
+{
+    construct_device_operation_instances(
+        instances, add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_factories);
 }
 
 } // namespace device_grouped_gemm_instance
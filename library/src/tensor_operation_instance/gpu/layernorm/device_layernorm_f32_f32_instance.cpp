@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_layernorm_blockwise.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_layernorm_instance {
+
+using F32 = float;
+
+// Compilation parameters for x[..., k] -> y[..., k], gamma[k], beta[k], normalizing along k
+template <ck::index_t Rank, ck::index_t NumReduceDim>
+using device_layernorm_f32_f32_instances = std::tuple<
+    // clang-format off
+        //#######################| XData| GammaData| BetaData| AccData| YData| Rank|    NumReduce| Block|   ReduceM|   ReduceK|   ReduceM|   ReduceK|    XSrc|    XSrc|    YDst|
+        //#######################|  Type|      Type|     Type|    Type|  Type|     |          Dim|  Size|   Thread-|   Thread-|    Thread|    Thread|  Vector|  Vector|  Vector|
+        //#######################|      |          |         |        |      |     |             |      |   Cluster|   Cluster|     Slice|     Slice|     Dim|    Size|    Size|
+        DeviceLayernormBlockwise<  F32,        F32,       F32,     F32,   F32, Rank, NumReduceDim,   256,         8,        32,         1,         8,       1,       4,       4>,
+        DeviceLayernormBlockwise<  F32,        F32,       F32,     F32,   F32, Rank, NumReduceDim,   256,         4,        64,         1,         8,       1,       4,       4>,
+        DeviceLayernormBlockwise<  F32,        F32,       F32,     F32,   F32, Rank, NumReduceDim,   256,         2,       128,         1,         8,       1,       4,       4>,
+        DeviceLayernormBlockwise<  F32,        F32,       F32,     F32,   F32, Rank, NumReduceDim,   256,         1,       256,         1,         8,       1,       4,       4>,
+        DeviceLayernormBlockwise<  F32,        F32,       F32,     F32,   F32, Rank, NumReduceDim,   256,         1,       256,         1,        16,       1,       4,       4>,
+        DeviceLayernormBlockwise<  F32,        F32,       F32,     F32,   F32, Rank, NumReduceDim,   256,         8,        32,         1,         8,       1,       1,       1>,
+        DeviceLayernormBlockwise<  F32,        F32,       F32,     F32,   F32, Rank, NumReduceDim,   256,        32,         8,         1,         4,       1,       4,       4>
+    // clang-format on
+    >;
+
+void add_device_layernorm_rank2_reduce1_f32_factories(
+    DeviceOperationFactories<DeviceLayernormPtr>& factories)
+{
+    add_device_operation_instances(factories, device_layernorm_f32_f32_instances<2, 1>{});
+}
+
+void add_device_layernorm_rank2_reduce1_f32_instances(std::vector<DeviceLayernormPtr>& instances)
+{
+    construct_device_operation_instances(instances,
+                                         add_device_layernorm_rank2_reduce1_f32_factories);
+}
+
+void add_device_layernorm_rank3_reduce1_f32_factories(
+    DeviceOperationFactories<DeviceLayernormPtr>& factories)
+{
+    add_device_operation_instances(factories, device_layernorm_f32_f32_instances<3, 1>{});
+}
+
+void add_device_layernorm_rank3_reduce1_f32_instances(std::vector<DeviceLayernormPtr>& instances)
+{
+    construct_device_operation_instances(instances,
+                                         add_device_layernorm_rank3_reduce1_f32_factories);
+}
+
+} // namespace device_layernorm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
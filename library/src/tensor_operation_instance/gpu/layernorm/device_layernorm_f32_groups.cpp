@@ -0,0 +1,42 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_layernorm.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_layernorm_instance {
+
+using DeviceLayernormFactories = DeviceOperationFactories<DeviceLayernormPtr>;
+
+void add_device_layernorm_rank2_reduce1_f32_factories(DeviceLayernormFactories&);
+void add_device_layernorm_rank3_reduce1_f32_factories(DeviceLayernormFactories&);
+
+void add_device_layernorm_f32_groups(DeviceOperationRegistry<DeviceLayernormPtr>& registry)
+{
+    registry.Add({"layernorm", "blockwise", "f32", "rank2_reduce1", "PassThrough"},
+                 add_device_layernorm_rank2_reduce1_f32_factories)
+        .Add({"layernorm", "blockwise", "f32", "rank3_reduce1", "PassThrough"},
+             add_device_layernorm_rank3_reduce1_f32_factories);
+}
+
+} // namespace device_layernorm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<DeviceLayernormPtr> registry;
+
+    device_layernorm_instance::add_device_layernorm_f32_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
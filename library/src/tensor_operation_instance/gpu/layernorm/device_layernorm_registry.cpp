@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_layernorm.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_layernorm_instance {
+
+void add_device_layernorm_f32_groups(DeviceOperationRegistry<DeviceLayernormPtr>&);
+void add_device_layernorm_f16_groups(DeviceOperationRegistry<DeviceLayernormPtr>&);
+
+const DeviceOperationRegistry<DeviceLayernormPtr>& get_device_layernorm_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceLayernormPtr> r;
+
+        add_device_layernorm_f32_groups(r);
+        add_device_layernorm_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_layernorm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_poolnd_bwd_nhwc_nhwc.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool_bwd_instance {
+
+using F32 = float;
+
+static constexpr auto MAX = ck::ReduceTensorOp::MAX;
+static constexpr auto AVG = ck::ReduceTensorOp::AVG;
+
+// Compilation parameters for in[n, hi, wi, c] -> out[n, ho, wo, c]
+template <ck::ReduceTensorOp ReduceOpId>
+using device_pool2d_bwd_nhwc_f32_instances = std::tuple<
+    // clang-format off
+        //####################################################| Spatial| DInData| DOutData| AccData|     Reduce| Block|   InOut|
+        //####################################################|     Dim|    Type|     Type|    Type|       OpId|  Size|  Vector|
+        //####################################################|        |        |         |        |           |      |    Size|
+        DevicePoolNdBwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,     F32,      F32,     F32, ReduceOpId,   256,       1>,
+        DevicePoolNdBwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,     F32,      F32,     F32, ReduceOpId,   256,       2>,
+        DevicePoolNdBwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,     F32,      F32,     F32, ReduceOpId,   256,       4>,
+        DevicePoolNdBwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,     F32,      F32,     F32, ReduceOpId,    64,       4>
+    // clang-format on
+    >;
+
+void add_device_pool2d_bwd_nhwc_max_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<2, MAX>>& factories)
+{
+    add_device_operation_instances(factories, device_pool2d_bwd_nhwc_f32_instances<MAX>{});
+}
+
+void add_device_pool2d_bwd_nhwc_max_f32_instances(std::vector<DevicePoolBwdPtr<2, MAX>>& instances)
+{
+    construct_device_operation_instances(instances, add_device_pool2d_bwd_nhwc_max_f32_factories);
+}
+
+void add_device_pool2d_bwd_nhwc_avg_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<2, AVG>>& factories)
+{
+    add_device_operation_instances(factories, device_pool2d_bwd_nhwc_f32_instances<AVG>{});
+}
+
+void add_device_pool2d_bwd_nhwc_avg_f32_instances(std::vector<DevicePoolBwdPtr<2, AVG>>& instances)
+{
+    construct_device_operation_instances(instances, add_device_pool2d_bwd_nhwc_avg_f32_factories);
+}
+
+} // namespace device_pool_bwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,83 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_pool_bwd.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool_bwd_instance {
+
+static constexpr auto MAX = ck::ReduceTensorOp::MAX;
+static constexpr auto AVG = ck::ReduceTensorOp::AVG;
+
+void add_device_pool1d_bwd_nwc_max_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<1, MAX>>&);
+void add_device_pool1d_bwd_nwc_avg_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<1, AVG>>&);
+void add_device_pool2d_bwd_nhwc_max_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<2, MAX>>&);
+void add_device_pool2d_bwd_nhwc_avg_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<2, AVG>>&);
+void add_device_pool3d_bwd_ndhwc_max_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<3, MAX>>&);
+void add_device_pool3d_bwd_ndhwc_avg_f32_factories(
+    DeviceOperationFactories<DevicePoolBwdPtr<3, AVG>>&);
+
+void add_device_pool_bwd_f32_groups(DeviceOperationRegistry<DevicePoolBwdPtr<1, MAX>>& registry)
+{
+    registry.Add({"pool1d_bwd", "max", "f32", "nwc", "PassThrough"},
+                 add_device_pool1d_bwd_nwc_max_f32_factories);
+}
+
+void add_device_pool_bwd_f32_groups(DeviceOperationRegistry<DevicePoolBwdPtr<1, AVG>>& registry)
+{
+    registry.Add({"pool1d_bwd", "avg", "f32", "nwc", "PassThrough"},
+                 add_device_pool1d_bwd_nwc_avg_f32_factories);
+}
+
+void add_device_pool_bwd_f32_groups(DeviceOperationRegistry<DevicePoolBwdPtr<2, MAX>>& registry)
+{
+    registry.Add({"pool2d_bwd", "max", "f32", "nhwc", "PassThrough"},
+                 add_device_pool2d_bwd_nhwc_max_f32_factories);
+}
+
+void add_device_pool_bwd_f32_groups(DeviceOperationRegistry<DevicePoolBwdPtr<2, AVG>>& registry)
+{
+    registry.Add({"pool2d_bwd", "avg", "f32", "nhwc", "PassThrough"},
+                 add_device_pool2d_bwd_nhwc_avg_f32_factories);
+}
+
+void add_device_pool_bwd_f32_groups(DeviceOperationRegistry<DevicePoolBwdPtr<3, MAX>>& registry)
+{
+    registry.Add({"pool3d_bwd", "max", "f32", "ndhwc", "PassThrough"},
+                 add_device_pool3d_bwd_ndhwc_max_f32_factories);
+}
+
+void add_device_pool_bwd_f32_groups(DeviceOperationRegistry<DevicePoolBwdPtr<3, AVG>>& registry)
+{
+    registry.Add({"pool3d_bwd", "avg", "f32", "ndhwc", "PassThrough"},
+                 add_device_pool3d_bwd_ndhwc_avg_f32_factories);
+}
+
+} // namespace device_pool_bwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+    using namespace device_pool_bwd_instance;
+
+    registrar.Add<DevicePoolBwdPtr<1, MAX>>(add_device_pool_bwd_f32_groups);
+    registrar.Add<DevicePoolBwdPtr<1, AVG>>(add_device_pool_bwd_f32_groups);
+    registrar.Add<DevicePoolBwdPtr<2, MAX>>(add_device_pool_bwd_f32_groups);
+    registrar.Add<DevicePoolBwdPtr<2, AVG>>(add_device_pool_bwd_f32_groups);
+    registrar.Add<DevicePoolBwdPtr<3, MAX>>(add_device_pool_bwd_f32_groups);
+    registrar.Add<DevicePoolBwdPtr<3, AVG>>(add_device_pool_bwd_f32_groups);
+}
+#endif
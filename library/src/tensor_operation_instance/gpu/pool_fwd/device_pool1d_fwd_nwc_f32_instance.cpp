@@ -0,0 +1,56 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_poolnd_fwd_nhwc_nhwc.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool_fwd_instance {
+
+using F32 = float;
+
+static constexpr auto MAX = ck::ReduceTensorOp::MAX;
+static constexpr auto AVG = ck::ReduceTensorOp::AVG;
+
+// Compilation parameters for in[n, wi, c] -> out[n, wo, c]
+template <ck::ReduceTensorOp ReduceOpId, bool NeedIndices>
+using device_pool1d_fwd_nwc_f32_instances = std::tuple<
+    // clang-format off
+        //####################################################| Spatial| InData| OutData| AccData|     Reduce|       Need| Block|   ReduceM|   ReduceK|   ReduceM|   ReduceK| InSrcOutDst|
+        //####################################################|     Dim|   Type|    Type|    Type|       OpId|    Indices|  Size|   Thread-|   Thread-|    Thread|    Thread|      Vector|
+        //####################################################|        |       |        |        |           |           |      |   Cluster|   Cluster|     Slice|     Slice|        Size|
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       1,    F32,     F32,     F32, ReduceOpId, NeedIndices,   256,       256,         1,         1,         1,           1>,
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       1,    F32,     F32,     F32, ReduceOpId, NeedIndices,   256,       256,         1,         2,         1,           2>,
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       1,    F32,     F32,     F32, ReduceOpId, NeedIndices,   256,       256,         1,         4,         1,           4>,
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       1,    F32,     F32,     F32, ReduceOpId, NeedIndices,    64,        64,         1,         4,         1,           4>
+    // clang-format on
+    >;
+
+// the MAX instances write the index of the maximum in its window, for backward pooling
+void add_device_pool1d_fwd_nwc_max_f32_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<1, MAX>>& factories)
+{
+    add_device_operation_instances(factories, device_pool1d_fwd_nwc_f32_instances<MAX, true>{});
+}
+
+void add_device_pool1d_fwd_nwc_max_f32_instances(std::vector<DevicePoolFwdPtr<1, MAX>>& instances)
+{
+    construct_device_operation_instances(instances, add_device_pool1d_fwd_nwc_max_f32_factories);
+}
+
+void add_device_pool1d_fwd_nwc_avg_f32_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<1, AVG>>& factories)
+{
+    add_device_operation_instances(factories, device_pool1d_fwd_nwc_f32_instances<AVG, false>{});
+}
+
+void add_device_pool1d_fwd_nwc_avg_f32_instances(std::vector<DevicePoolFwdPtr<1, AVG>>& instances)
+{
+    construct_device_operation_instances(instances, add_device_pool1d_fwd_nwc_avg_f32_factories);
+}
+
+} // namespace device_pool_fwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_poolnd_fwd_nhwc_nhwc.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool_fwd_instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+static constexpr auto MAX = ck::ReduceTensorOp::MAX;
+static constexpr auto AVG = ck::ReduceTensorOp::AVG;
+
+// Compilation parameters for in[n, hi, wi, c] -> out[n, ho, wo, c]
+template <ck::ReduceTensorOp ReduceOpId, bool NeedIndices>
+using device_pool2d_fwd_nhwc_f16_instances = std::tuple<
+    // clang-format off
+        //####################################################| Spatial| InData| OutData| AccData|     Reduce|       Need| Block|   ReduceM|   ReduceK|   ReduceM|   ReduceK| InSrcOutDst|
+        //####################################################|     Dim|   Type|    Type|    Type|       OpId|    Indices|  Size|   Thread-|   Thread-|    Thread|    Thread|      Vector|
+        //####################################################|        |       |        |        |           |           |      |   Cluster|   Cluster|     Slice|     Slice|        Size|
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,    F16,     F16,     F32, ReduceOpId, NeedIndices,   256,       256,         1,         1,         1,           1>,
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,    F16,     F16,     F32, ReduceOpId, NeedIndices,   256,       256,         1,         2,         1,           2>,
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,    F16,     F16,     F32, ReduceOpId, NeedIndices,   256,       256,         1,         4,         1,           4>,
+        DevicePoolNdFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<       2,    F16,     F16,     F32, ReduceOpId, NeedIndices,    64,        64,         1,         4,         1,           4>
+    // clang-format on
+    >;
+
+// the MAX instances write the index of the maximum in its window, for backward pooling
+void add_device_pool2d_fwd_nhwc_max_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<2, MAX>>& factories)
+{
+    add_device_operation_instances(factories, device_pool2d_fwd_nhwc_f16_instances<MAX, true>{});
+}
+
+void add_device_pool2d_fwd_nhwc_max_f16_instances(std::vector<DevicePoolFwdPtr<2, MAX>>& instances)
+{
+    construct_device_operation_instances(instances, add_device_pool2d_fwd_nhwc_max_f16_factories);
+}
+
+void add_device_pool2d_fwd_nhwc_avg_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<2, AVG>>& factories)
+{
+    add_device_operation_instances(factories, device_pool2d_fwd_nhwc_f16_instances<AVG, false>{});
+}
+
+void add_device_pool2d_fwd_nhwc_avg_f16_instances(std::vector<DevicePoolFwdPtr<2, AVG>>& instances)
+{
+    construct_device_operation_instances(instances, add_device_pool2d_fwd_nhwc_avg_f16_factories);
+}
+
+} // namespace device_pool_fwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,83 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_pool_fwd.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool_fwd_instance {
+
+static constexpr auto MAX = ck::ReduceTensorOp::MAX;
+static constexpr auto AVG = ck::ReduceTensorOp::AVG;
+
+void add_device_pool1d_fwd_nwc_max_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<1, MAX>>&);
+void add_device_pool1d_fwd_nwc_avg_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<1, AVG>>&);
+void add_device_pool2d_fwd_nhwc_max_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<2, MAX>>&);
+void add_device_pool2d_fwd_nhwc_avg_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<2, AVG>>&);
+void add_device_pool3d_fwd_ndhwc_max_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<3, MAX>>&);
+void add_device_pool3d_fwd_ndhwc_avg_f16_factories(
+    DeviceOperationFactories<DevicePoolFwdPtr<3, AVG>>&);
+
+void add_device_pool_fwd_f16_groups(DeviceOperationRegistry<DevicePoolFwdPtr<1, MAX>>& registry)
+{
+    registry.Add({"pool1d_fwd", "max", "f16", "nwc", "PassThrough"},
+                 add_device_pool1d_fwd_nwc_max_f16_factories);
+}
+
+void add_device_pool_fwd_f16_groups(DeviceOperationRegistry<DevicePoolFwdPtr<1, AVG>>& registry)
+{
+    registry.Add({"pool1d_fwd", "avg", "f16", "nwc", "PassThrough"},
+                 add_device_pool1d_fwd_nwc_avg_f16_factories);
+}
+
+void add_device_pool_fwd_f16_groups(DeviceOperationRegistry<DevicePoolFwdPtr<2, MAX>>& registry)
+{
+    registry.Add({"pool2d_fwd", "max", "f16", "nhwc", "PassThrough"},
+                 add_device_pool2d_fwd_nhwc_max_f16_factories);
+}
+
+void add_device_pool_fwd_f16_groups(DeviceOperationRegistry<DevicePoolFwdPtr<2, AVG>>& registry)
+{
+    registry.Add({"pool2d_fwd", "avg", "f16", "nhwc", "PassThrough"},
+                 add_device_pool2d_fwd_nhwc_avg_f16_factories);
+}
+
+void add_device_pool_fwd_f16_groups(DeviceOperationRegistry<DevicePoolFwdPtr<3, MAX>>& registry)
+{
+    registry.Add({"pool3d_fwd", "max", "f16", "ndhwc", "PassThrough"},
+                 add_device_pool3d_fwd_ndhwc_max_f16_factories);
+}
+
+void add_device_pool_fwd_f16_groups(DeviceOperationRegistry<DevicePoolFwdPtr<3, AVG>>& registry)
+{
+    registry.Add({"pool3d_fwd", "avg", "f16", "ndhwc", "PassThrough"},
+                 add_device_pool3d_fwd_ndhwc_avg_f16_factories);
+}
+
+} // namespace device_pool_fwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+    using namespace device_pool_fwd_instance;
+
+    registrar.Add<DevicePoolFwdPtr<1, MAX>>(add_device_pool_fwd_f16_groups);
+    registrar.Add<DevicePoolFwdPtr<1, AVG>>(add_device_pool_fwd_f16_groups);
+    registrar.Add<DevicePoolFwdPtr<2, MAX>>(add_device_pool_fwd_f16_groups);
+    registrar.Add<DevicePoolFwdPtr<2, AVG>>(add_device_pool_fwd_f16_groups);
+    registrar.Add<DevicePoolFwdPtr<3, MAX>>(add_device_pool_fwd_f16_groups);
+    registrar.Add<DevicePoolFwdPtr<3, AVG>>(add_device_pool_fwd_f16_groups);
+}
+#endif
@@ -0,0 +1,176 @@
+#include "device_reduce_instance.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_reduce_instance {
+
+void add_device_reduce_f64_groups(DeviceOperationPluginRegistrar& registrar)
+{
+    // clang-format off
+    // InDataType | AccDataType | OutDataType | ReduceOpId | NanPropaOpt | IndicesOpt | Rank | NumReduceDim
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 3); // for ADD
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 3); // for AVG
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 3); // for NORM2
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 3); // for MIN
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 3); // for MAX
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 3); // for AMAX
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 3); // for MIN
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 3); // for MAX
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 2, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 3); // for AMAX
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 4);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 1);
+    ADD_BLOCKWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 2, 1);
+
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 3); // for ADD
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 3); // for AVG
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 3); // for NORM2
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 3); // for MIN
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 3); // for MAX
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 3); // for AMAX
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 3); // for MIN
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 3); // for MAX
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 2, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 3); // for AMAX
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 4);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 1);
+    ADD_THREADWISE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 2, 1);
+
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 3); // for ADD
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 3); // for AVG
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 3); // for NORM2
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 3); // for MIN
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 3); // for MAX
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 3); // for AMAX
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 3); // for MIN
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 3); // for MAX
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 2, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 3); // for AMAX
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 4);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 1);
+    ADD_BLOCKWISE_SECOND_CALL_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 2, 1);
+
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 3); // for MIN
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 0, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 3); // for MAX
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 0, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 3); // for AMAX
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 0, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 3); // for MIN
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 2, 0, 1, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 3); // for MAX
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 3, 0, 1, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 3); // for AMAX
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 4, 0, 1, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 3); // for NORM2
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 7, 0, 0, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 3); // for ADD
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 0, 0, 0, 2, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 3); // for AVG
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 4);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 4, 1);
+    ADD_MULTIBLOCK_PARTIAL_REDUCE_GROUP_BY_ID(registrar, double, double, double, 5, 0, 0, 2, 1);
+    // clang-format on
+}
+
+} // namespace device_reduce_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device::device_reduce_instance;
+
+    add_device_reduce_f64_groups(registrar);
+}
+#endif
@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_softmax_blockwise.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_softmax_instance {
+
+using F32 = float;
+
+// Compilation parameters for in[..., k] -> out[..., k], the softmax taken along k
+template <ck::index_t Rank, ck::index_t NumReduceDim>
+using device_softmax_f32_f32_instances = std::tuple<
+    // clang-format off
+        //#####################| InData| AccData| OutData| Rank|    NumReduce| Block|   ReduceM|   ReduceK|   ReduceM|   ReduceK|   InSrc|   InSrc|  OutDst|
+        //#####################|   Type|    Type|    Type|     |          Dim|  Size|   Thread-|   Thread-|    Thread|    Thread|  Vector|  Vector|  Vector|
+        //#####################|       |        |        |     |             |      |   Cluster|   Cluster|     Slice|     Slice|     Dim|    Size|    Size|
+        DeviceSoftmaxBlockwise<    F32,     F32,     F32, Rank, NumReduceDim,   256,         8,        32,         1,         8,       1,       4,       4>,
+        DeviceSoftmaxBlockwise<    F32,     F32,     F32, Rank, NumReduceDim,   256,         4,        64,         1,         8,       1,       4,       4>,
+        DeviceSoftmaxBlockwise<    F32,     F32,     F32, Rank, NumReduceDim,   256,         2,       128,         1,         8,       1,       4,       4>,
+        DeviceSoftmaxBlockwise<    F32,     F32,     F32, Rank, NumReduceDim,   256,         1,       256,         1,         8,       1,       4,       4>,
+        DeviceSoftmaxBlockwise<    F32,     F32,     F32, Rank, NumReduceDim,   256,         1,       256,         1,        16,       1,       4,       4>,
+        DeviceSoftmaxBlockwise<    F32,     F32,     F32, Rank, NumReduceDim,   256,         8,        32,         1,         8,       1,       1,       1>,
+        DeviceSoftmaxBlockwise<    F32,     F32,     F32, Rank, NumReduceDim,   256,        32,         8,         1,         4,       1,       4,       4>
+    // clang-format on
+    >;
+
+void add_device_softmax_rank2_reduce1_f32_factories(
+    DeviceOperationFactories<DeviceSoftmaxPtr>& factories)
+{
+    add_device_operation_instances(factories, device_softmax_f32_f32_instances<2, 1>{});
+}
+
+void add_device_softmax_rank2_reduce1_f32_instances(std::vector<DeviceSoftmaxPtr>& instances)
+{
+    construct_device_operation_instances(instances, add_device_softmax_rank2_reduce1_f32_factories);
+}
+
+void add_device_softmax_rank3_reduce1_f32_factories(
+    DeviceOperationFactories<DeviceSoftmaxPtr>& factories)
+{
+    add_device_operation_instances(factories, device_softmax_f32_f32_instances<3, 1>{});
+}
+
+void add_device_softmax_rank3_reduce1_f32_instances(std::vector<DeviceSoftmaxPtr>& instances)
+{
+    construct_device_operation_instances(instances, add_device_softmax_rank3_reduce1_f32_factories);
+}
+
+} // namespace device_softmax_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
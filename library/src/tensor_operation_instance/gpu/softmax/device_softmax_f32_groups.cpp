@@ -0,0 +1,42 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_softmax.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_softmax_instance {
+
+using DeviceSoftmaxFactories = DeviceOperationFactories<DeviceSoftmaxPtr>;
+
+void add_device_softmax_rank2_reduce1_f32_factories(DeviceSoftmaxFactories&);
+void add_device_softmax_rank3_reduce1_f32_factories(DeviceSoftmaxFactories&);
+
+void add_device_softmax_f32_groups(DeviceOperationRegistry<DeviceSoftmaxPtr>& registry)
+{
+    registry.Add({"softmax", "blockwise", "f32", "rank2_reduce1", "PassThrough"},
+                 add_device_softmax_rank2_reduce1_f32_factories)
+        .Add({"softmax", "blockwise", "f32", "rank3_reduce1", "PassThrough"},
+             add_device_softmax_rank3_reduce1_f32_factories);
+}
+
+} // namespace device_softmax_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<DeviceSoftmaxPtr> registry;
+
+    device_softmax_instance::add_device_softmax_f32_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_softmax.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_softmax_instance {
+
+void add_device_softmax_f32_groups(DeviceOperationRegistry<DeviceSoftmaxPtr>&);
+void add_device_softmax_f16_groups(DeviceOperationRegistry<DeviceSoftmaxPtr>&);
+
+const DeviceOperationRegistry<DeviceSoftmaxPtr>& get_device_softmax_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceSoftmaxPtr> r;
+
+        add_device_softmax_f32_groups(r);
+        add_device_softmax_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_softmax_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
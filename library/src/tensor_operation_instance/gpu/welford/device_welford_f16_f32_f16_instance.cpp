@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_welford_multiblock.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_welford_instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+// Compilation parameters for in[..., k] -> mean[...], var[...], reducing the contiguous innermost
+// dimension (e.g. layernorm). Every K tile is at least 4 long.
+template <ck::index_t Rank, ck::index_t NumReduceDim>
+using device_welford_reduce_last_f16_f32_f16_instances = std::tuple<
+    // clang-format off
+        //######################| InData| AccData| OutData| Rank|    NumReduce| Block|   ReduceM|   ReduceK|   ReduceM|   ReduceK|   InSrc|   InSrc|  OutDst|
+        //######################|   Type|    Type|    Type|     |          Dim|  Size|   Thread-|   Thread-|    Thread|    Thread|  Vector|  Vector|  Vector|
+        //######################|       |        |        |     |             |      |   Cluster|   Cluster|     Slice|     Slice|     Dim|    Size|    Size|
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,         8,        32,         1,         8,       1,       4,       1>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,         4,        64,         1,         8,       1,       4,       1>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,         1,       256,         1,         8,       1,       4,       1>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,         1,       256,         1,         8,       1,       1,       1>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,       256,         1,         1,         4,       1,       4,       1>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,       256,         1,         1,         4,       1,       1,       1>
+    // clang-format on
+    >;
+
+// Compilation parameters for in[k..., c] -> mean[c], var[c], reducing all but the contiguous
+// innermost dimension (e.g. batchnorm of NHWC)
+template <ck::index_t Rank, ck::index_t NumReduceDim>
+using device_welford_reduce_outer_f16_f32_f16_instances = std::tuple<
+    // clang-format off
+        //######################| InData| AccData| OutData| Rank|    NumReduce| Block|   ReduceM|   ReduceK|   ReduceM|   ReduceK|   InSrc|   InSrc|  OutDst|
+        //######################|   Type|    Type|    Type|     |          Dim|  Size|   Thread-|   Thread-|    Thread|    Thread|  Vector|  Vector|  Vector|
+        //######################|       |        |        |     |             |      |   Cluster|   Cluster|     Slice|     Slice|     Dim|    Size|    Size|
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,        64,         4,         4,         8,       0,       4,       4>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,        32,         8,         4,         8,       0,       4,       4>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,        64,         4,         1,         8,       0,       1,       1>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,       256,         1,         4,         4,       0,       4,       4>,
+        DeviceWelfordMultiBlock<    F16,     F32,     F16, Rank, NumReduceDim,   256,       256,         1,         1,         4,       0,       1,       1>
+    // clang-format on
+    >;
+
+void add_device_welford_rank2_reduce1_f16_f32_f16_factories(
+    DeviceOperationFactories<DeviceWelfordPtr>& factories)
+{
+    add_device_operation_instances(factories,
+                                   device_welford_reduce_last_f16_f32_f16_instances<2, 1>{});
+}
+
+void add_device_welford_rank2_reduce1_f16_f32_f16_instances(
+    std::vector<DeviceWelfordPtr>& instances)
+{
+    construct_device_operation_instances(instances,
+                                         add_device_welford_rank2_reduce1_f16_f32_f16_factories);
+}
+
+void add_device_welford_rank4_reduce3_f16_f32_f16_factories(
+    DeviceOperationFactories<DeviceWelfordPtr>& factories)
+{
+    add_device_operation_instances(factories,
+                                   device_welford_reduce_outer_f16_f32_f16_instances<4, 3>{});
+}
+
+void add_device_welford_rank4_reduce3_f16_f32_f16_instances(
+    std::vector<DeviceWelfordPtr>& instances)
+{
+    construct_device_operation_instances(instances,
+                                         add_device_welford_rank4_reduce3_f16_f32_f16_factories);
+}
+
+} // namespace device_welford_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
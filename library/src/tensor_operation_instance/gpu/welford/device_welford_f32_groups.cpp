@@ -0,0 +1,42 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_welford.hpp"
+#include "device_operation_registry.hpp"
+#include "device_operation_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_welford_instance {
+
+using DeviceWelfordFactories = DeviceOperationFactories<DeviceWelfordPtr>;
+
+void add_device_welford_rank2_reduce1_f32_f32_f32_factories(DeviceWelfordFactories&);
+void add_device_welford_rank4_reduce3_f32_f32_f32_factories(DeviceWelfordFactories&);
+
+void add_device_welford_f32_groups(DeviceOperationRegistry<DeviceWelfordPtr>& registry)
+{
+    registry.Add({"welford", "multiblock", "f32_f32_f32", "rank2_reduce1", "PassThrough"},
+                 add_device_welford_rank2_reduce1_f32_f32_f32_factories)
+        .Add({"welford", "multiblock", "f32_f32_f32", "rank4_reduce3", "PassThrough"},
+             add_device_welford_rank4_reduce3_f32_f32_f32_factories);
+}
+
+} // namespace device_welford_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(
+    ck::tensor_operation::device::DeviceOperationPluginRegistrar& registrar)
+{
+    using namespace ck::tensor_operation::device;
+
+    DeviceOperationRegistry<DeviceWelfordPtr> registry;
+
+    device_welford_instance::add_device_welford_f32_groups(registry);
+
+    registrar.Add(registry);
+}
+#endif
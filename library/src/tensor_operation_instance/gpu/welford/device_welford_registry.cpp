@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include "config.hpp"
+#include "device_welford.hpp"
+#include "device_operation_registry.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_welford_instance {
+
+void add_device_welford_f32_groups(DeviceOperationRegistry<DeviceWelfordPtr>&);
+void add_device_welford_f16_groups(DeviceOperationRegistry<DeviceWelfordPtr>&);
+
+const DeviceOperationRegistry<DeviceWelfordPtr>& get_device_welford_registry()
+{
+    // made on first use
+    static const auto registry = [] {
+        DeviceOperationRegistry<DeviceWelfordPtr> r;
+
+        add_device_welford_f32_groups(r);
+        add_device_welford_f16_groups(r);
+
+        return r;
+    }();
+
+    return registry;
+}
+
+} // namespace device_welford_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,129 @@
+#include <stdexcept>
+
+#include <dirent.h>
+#include <dlfcn.h>
+
+#include "device_operation_plugin.hpp"
+
+#define CK_STRINGIFY_IMPL(x) #x
+#define CK_STRINGIFY(x) CK_STRINGIFY_IMPL(x)
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+namespace {
+
+constexpr char plugin_prefix[] = "libck_";
+constexpr char plugin_suffix[] = ".so";
+
+// name of the plugin of a file, empty if it is not a plugin
+std::string get_plugin_name(const std::string& file_name)
+{
+    const std::size_t prefix_size = sizeof(plugin_prefix) - 1;
+    const std::size_t suffix_size = sizeof(plugin_suffix) - 1;
+
+    if(file_name.size() <= prefix_size + suffix_size ||
+       file_name.compare(0, prefix_size, plugin_prefix) != 0 ||
+       file_name.compare(file_name.size() - suffix_size, suffix_size, plugin_suffix) != 0)
+        return {};
+
+    return file_name.substr(prefix_size, file_name.size() - prefix_size - suffix_size);
+}
+
+std::runtime_error make_plugin_error(const std::string& path, const std::string& what)
+{
+    return std::runtime_error("device operation plugin " + path + ": " + what);
+}
+
+} // namespace
+
+DeviceOperationPluginLoader::DeviceOperationPluginLoader(const std::string& directory)
+{
+    DIR* p_dir = opendir(directory.c_str());
+
+    // no directory, no plugins
+    if(p_dir == nullptr)
+        return;
+
+    while(const dirent* p_entry = readdir(p_dir))
+    {
+        const std::string file_name = p_entry->d_name;
+        const std::string name      = get_plugin_name(file_name);
+
+        if(name.empty())
+            continue;
+
+        plugins_[name].path = directory + "/" + file_name;
+    }
+
+    closedir(p_dir);
+}
+
+std::vector<std::string> DeviceOperationPluginLoader::GetPluginNames() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::string> names;
+
+    for(const auto& plugin : plugins_)
+        names.push_back(plugin.first);
+
+    return names;
+}
+
+bool DeviceOperationPluginLoader::HasPlugin(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return plugins_.count(name) != 0;
+}
+
+bool DeviceOperationPluginLoader::IsLoaded(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto it = plugins_.find(name);
+
+    return it != plugins_.end() && it->second.registrar != nullptr;
+}
+
+const DeviceOperationPluginRegistrar* DeviceOperationPluginLoader::Load(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto it = plugins_.find(name);
+
+    if(it == plugins_.end())
+        return nullptr;
+
+    Plugin& plugin = it->second;
+
+    if(plugin.registrar != nullptr)
+        return plugin.registrar.get();
+
+    // the plugin is never closed, the factories it registers point into it
+    plugin.handle = dlopen(plugin.path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if(plugin.handle == nullptr)
+        throw make_plugin_error(plugin.path, dlerror());
+
+    const auto entry = reinterpret_cast<DeviceOperationPluginEntry>(
+        dlsym(plugin.handle, CK_STRINGIFY(CK_DEVICE_OPERATION_PLUGIN_ENTRY)));
+
+    if(entry == nullptr)
+        throw make_plugin_error(plugin.path,
+                                "no " CK_STRINGIFY(CK_DEVICE_OPERATION_PLUGIN_ENTRY) " function");
+
+    auto registrar = std::make_unique<DeviceOperationPluginRegistrar>();
+
+    entry(*registrar);
+
+    plugin.registrar = std::move(registrar);
+
+    return plugin.registrar.get();
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace ck {
+namespace profiler {
+
+int profile_batch(int argc, char* argv[]);
+
+} // namespace profiler
+} // namespace ck
@@ -1,17 +1,24 @@
 #pragma once
+#include <algorithm>
+#include <cstdlib>
 #include <iomanip>
+#include <numeric>
 
 #include "check_err.hpp"
 #include "config.hpp"
+#include "cost_model.hpp"
 #include "device.hpp"
 #include "host_tensor.hpp"
 #include "host_tensor_generator.hpp"
 #include "host_conv.hpp"
+#include "profile_result.hpp"
 #include "tensor_layout.hpp"
 #include "device_tensor.hpp"
 #include "element_wise_operation.hpp"
 #include "device_gemm.hpp"
+#include "device_operation_registry.hpp"
 #include "reference_gemm.hpp"
+#include "tuning_db.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -23,56 +30,7 @@ using DeviceGemmNoOpPtr =
                                                 ck::tensor_operation::element_wise::PassThrough,
                                                 ck::tensor_operation::element_wise::PassThrough>;
 
-void add_device_gemm_xdl_f16_f16_f16_mk_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_f16_f16_f16_mk_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_f16_f16_f16_km_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_nk_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_kn_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_nk_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_f16_f16_f16_mk_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_f16_f16_f16_km_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_f16_f16_f16_km_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_kn_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_nk_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_kn_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_nk_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_c_shuffle_2_stage_f16_f16_f16_mk_nk_mn_instances(
-    std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_f32_f32_f32_mk_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_f32_f32_f32_mk_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_f32_f32_f32_km_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_f32_f32_f32_km_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_splitk_f32_f32_f32_mk_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_splitk_f32_f32_f32_mk_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_splitk_f32_f32_f32_km_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_splitk_f32_f32_f32_km_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-
-void add_device_gemm_xdl_splitk_f16_f16_f16_mk_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_splitk_f16_f16_f16_km_kn_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
-void add_device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_instances(std::vector<DeviceGemmNoOpPtr>&);
+const DeviceOperationRegistry<DeviceGemmNoOpPtr>& get_device_gemm_registry();
 
 } // namespace device_gemm_instance
 } // namespace device
@@ -82,6 +40,74 @@ void add_device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_instances(std::vector<Devic
 namespace ck {
 namespace profiler {
 
+// names of the types in the keys of instance registries
+template <typename DataType>
+std::string get_instance_data_type_name()
+{
+    if constexpr(is_same<DataType, float>::value)
+        return "f32";
+    else if constexpr(is_same<DataType, half_t>::value)
+        return "f16";
+    else if constexpr(is_same<DataType, ck::bhalf_t>::value)
+        return "bf16";
+    else if constexpr(is_same<DataType, int8_t>::value)
+        return "int8";
+    else
+        return "";
+}
+
+template <typename ALayout, typename BLayout, typename CLayout>
+std::string get_gemm_instance_layout_name()
+{
+    using Row = tensor_layout::gemm::RowMajor;
+
+    return std::string(is_same<ALayout, Row>::value ? "mk" : "km") + "_" +
+           (is_same<BLayout, Row>::value ? "kn" : "nk") + "_" +
+           (is_same<CLayout, Row>::value ? "mn" : "nm");
+}
+
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename ALayout,
+          typename BLayout,
+          typename CLayout>
+void add_device_gemm_instances(
+    std::vector<ck::tensor_operation::device::device_gemm_instance::DeviceGemmNoOpPtr>& gemm_ptrs,
+    int KBatch)
+{
+    using ck::tensor_operation::device::DeviceOperationKey;
+
+    const auto& registry =
+        ck::tensor_operation::device::device_gemm_instance::get_device_gemm_registry();
+
+    const std::string data_type = get_instance_data_type_name<ADataType>() + "_" +
+                                  get_instance_data_type_name<BDataType>() + "_" +
+                                  get_instance_data_type_name<CDataType>();
+
+    const std::string layout = get_gemm_instance_layout_name<ALayout, BLayout, CLayout>();
+
+    // split-K instances when K is split and there are any for the types, all others otherwise
+    const auto is_problem = [&](const DeviceOperationKey& key) {
+        return key.op == "gemm" && key.data_type == data_type && key.layout == layout;
+    };
+
+    const bool use_splitk =
+        KBatch > 1 && std::any_of(registry.GetGroups().begin(),
+                                  registry.GetGroups().end(),
+                                  [&](const auto& group) {
+                                      return is_problem(group.first) &&
+                                             group.first.algorithm == "xdl_splitk";
+                                  });
+
+    auto instances = registry.Make([&](const DeviceOperationKey& key) {
+        return is_problem(key) && (key.algorithm == "xdl_splitk") == use_splitk;
+    });
+
+    for(auto& instance : instances)
+        gemm_ptrs.push_back(std::move(instance));
+}
+
 template <typename ADataType,
           typename BDataType,
           typename CDataType,
@@ -98,7 +124,8 @@ void profile_gemm_impl(int do_verification,
                        int StrideA,
                        int StrideB,
                        int StrideC,
-                       int KBatch)
+                       int KBatch,
+                       std::size_t top_k = 0)
 {
     auto f_host_tensor_descriptor =
         [](std::size_t row, std::size_t col, std::size_t stride, auto layout) {
@@ -154,228 +181,17 @@ void profile_gemm_impl(int do_verification,
     b_device_buf.ToDevice(b_k_n.mData.data());
     c_device_buf.ToDevice(c_m_n_device_result.mData.data());
 
-    // add device GEMM instances
-    std::vector<ck::tensor_operation::device::device_gemm_instance::DeviceGemmNoOpPtr> gemm_ptrs;
-
-    if constexpr(is_same<ADataType, float>::value && is_same<BDataType, float>::value &&
-                 is_same<CDataType, float>::value)
-    {
-        if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f32_f32_f32_mk_kn_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f32_f32_f32_mk_kn_mn_instances(gemm_ptrs);
-
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_kn_mn_instances(gemm_ptrs);
-            }
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f32_f32_f32_mk_nk_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f32_f32_f32_mk_nk_mn_instances(gemm_ptrs);
-
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f32_f32_f32_mk_nk_mn_instances(gemm_ptrs);
-            }
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f32_f32_f32_km_kn_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f32_f32_f32_km_kn_mn_instances(gemm_ptrs);
-
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances(gemm_ptrs);
-            }
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f32_f32_f32_km_nk_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f32_f32_f32_km_nk_mn_instances(gemm_ptrs);
-
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_nk_mn_instances(gemm_ptrs);
-            }
-        }
-    }
-    else if constexpr(is_same<ADataType, half_t>::value && is_same<BDataType, half_t>::value &&
-                      is_same<CDataType, half_t>::value)
-    {
-        if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f16_f16_f16_mk_kn_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f16_f16_f16_mk_kn_mn_instances(gemm_ptrs);
-
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_instances(gemm_ptrs);
-            }
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f16_f16_f16_mk_nk_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f16_f16_f16_mk_nk_mn_instances(gemm_ptrs);
+    // Instances hold no problem state. They are created once per data type and layout combination
+    // and reused by later calls, e.g. for every problem of a batch run.
+    static std::vector<ck::tensor_operation::device::device_gemm_instance::DeviceGemmNoOpPtr>
+        cached_gemm_ptrs[2];
 
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f16_f16_f16_mk_nk_mn_instances(gemm_ptrs);
+    auto& gemm_ptrs = cached_gemm_ptrs[KBatch > 1 ? 1 : 0];
 
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_2_stage_f16_f16_f16_mk_nk_mn_instances(gemm_ptrs);
-            }
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f16_f16_f16_km_kn_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f16_f16_f16_km_kn_mn_instances(gemm_ptrs);
-
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f16_f16_f16_km_kn_mn_instances(gemm_ptrs);
-            }
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            if(KBatch > 1)
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_splitk_f16_f16_f16_km_nk_mn_instances(gemm_ptrs);
-            }
-            else
-            {
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_f16_f16_f16_km_nk_mn_instances(gemm_ptrs);
-
-                ck::tensor_operation::device::device_gemm_instance::
-                    add_device_gemm_xdl_c_shuffle_f16_f16_f16_km_nk_mn_instances(gemm_ptrs);
-            }
-        }
-    }
-    else if constexpr(is_same<ADataType, ck::bhalf_t>::value &&
-                      is_same<BDataType, ck::bhalf_t>::value &&
-                      is_same<CDataType, ck::bhalf_t>::value)
+    if(gemm_ptrs.empty())
     {
-        if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_kn_mn_instances(gemm_ptrs);
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_nk_mn_instances(gemm_ptrs);
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_kn_mn_instances(gemm_ptrs);
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_nk_mn_instances(gemm_ptrs);
-        }
-    }
-    else if constexpr(is_same<ADataType, int8_t>::value && is_same<BDataType, int8_t>::value &&
-                      is_same<CDataType, int8_t>::value)
-    {
-        if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                     is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_kn_mn_instances(gemm_ptrs);
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_int8_int8_int8_mk_nk_mn_instances(gemm_ptrs);
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::RowMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_kn_mn_instances(gemm_ptrs);
-        }
-        else if constexpr(is_same<ALayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<BLayout, tensor_layout::gemm::ColumnMajor>::value &&
-                          is_same<CLayout, tensor_layout::gemm::RowMajor>::value)
-        {
-            ck::tensor_operation::device::device_gemm_instance::
-                add_device_gemm_xdl_c_shuffle_int8_int8_int8_km_nk_mn_instances(gemm_ptrs);
-        }
+        add_device_gemm_instances<ADataType, BDataType, CDataType, ALayout, BLayout, CLayout>(
+            gemm_ptrs, KBatch);
     }
 
     if(gemm_ptrs.size() <= 0)
@@ -384,27 +200,81 @@ void profile_gemm_impl(int do_verification,
     }
 
     std::string best_gemm_name;
-    float best_ave_time   = 0;
-    float best_tflops     = 0;
-    float best_gb_per_sec = 0;
+    std::string best_gemm_key;
+    float best_ave_time    = 0;
+    float best_tflops      = 0;
+    float best_gb_per_sec  = 0;
+    float best_median_time = 0;
+
+    auto make_argument_ptr = [&](auto* gemm_ptr) {
+        return gemm_ptr->MakeArgumentPointer(
+            static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
+            static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
+            static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
+            M,
+            N,
+            K,
+            StrideA,
+            StrideB,
+            StrideC,
+            ck::tensor_operation::element_wise::PassThrough{},
+            ck::tensor_operation::element_wise::PassThrough{},
+            ck::tensor_operation::element_wise::PassThrough{},
+            KBatch);
+    };
+
+    const ck::utils::GemmCostProblem cost_problem{M,
+                                                  N,
+                                                  K,
+                                                  1,
+                                                  static_cast<int64_t>(sizeof(ADataType)),
+                                                  static_cast<int64_t>(sizeof(BDataType)),
+                                                  static_cast<int64_t>(sizeof(CDataType))};
+
+    const char* timing_path = std::getenv("CK_COST_MODEL_TIMINGS");
+
+    const auto tuning_problem = ck::utils::make_gemm_tuning_problem<ADataType,
+                                                                    BDataType,
+                                                                    CDataType,
+                                                                    ALayout,
+                                                                    BLayout,
+                                                                    CLayout,
+                                                                    AElementOp,
+                                                                    BElementOp,
+                                                                    CElementOp>(
+        M, N, K, StrideA, StrideB, StrideC, KBatch);
+
+    // all instances, the one the tuning database picks, or the best ones predicted by the cost
+    // model
+    std::vector<std::size_t> instance_ids(gemm_ptrs.size());
+    std::iota(instance_ids.begin(), instance_ids.end(), 0);
+
+    const auto tuned_instance_id =
+        ck::utils::find_tuned_instance_id(gemm_ptrs, tuning_problem, [&](auto& gemm) {
+            return gemm.IsSupportedArgument(make_argument_ptr(&gemm).get());
+        });
+
+    if(tuned_instance_id)
+    {
+        instance_ids = {*tuned_instance_id};
+
+        std::cout << "Profiling the instance picked by the tuning database" << std::endl;
+    }
+    else if(top_k > 0)
+    {
+        instance_ids = ck::utils::select_best_predicted_instances(
+            gemm_ptrs, cost_problem, top_k, make_argument_ptr);
+
+        std::cout << "Profiling " << instance_ids.size() << " of " << gemm_ptrs.size()
+                  << " instances, ranked by the cost model" << std::endl;
+    }
 
     // profile device GEMM instances
-    for(auto& gemm_ptr : gemm_ptrs)
+    for(std::size_t instance_id : instance_ids)
     {
-        auto argument_ptr =
-            gemm_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
-                                          static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
-                                          static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
-                                          M,
-                                          N,
-                                          K,
-                                          StrideA,
-                                          StrideB,
-                                          StrideC,
-                                          ck::tensor_operation::element_wise::PassThrough{},
-                                          ck::tensor_operation::element_wise::PassThrough{},
-                                          ck::tensor_operation::element_wise::PassThrough{},
-                                          KBatch);
+        auto& gemm_ptr = gemm_ptrs[instance_id];
+
+        auto argument_ptr = make_argument_ptr(gemm_ptr.get());
 
         auto invoker_ptr = gemm_ptr->MakeInvokerPointer();
 
@@ -416,8 +286,10 @@ void profile_gemm_impl(int do_verification,
 
             std::string gemm_name = gemm_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            KernelTimingResult timing;
+
+            float ave_time = invoker_ptr->Run(
+                argument_ptr.get(), get_timing_stream_config(time_kernel, &timing));
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -431,14 +303,38 @@ void profile_gemm_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << gemm_name << std::endl;
 
-            if(tflops > best_tflops)
+            ck::utils::print_kernel_timing_result(std::cout, timing);
+
+            if(time_kernel && timing_path != nullptr)
+            {
+                const auto tile =
+                    ck::utils::GemmCostTile::FromTuningParams(gemm_ptr->GetTuningParams());
+
+                if(tile)
+                {
+                    ck::utils::append_gemm_timing_record(
+                        timing_path,
+                        {gemm_name,
+                         cost_problem,
+                         *tile,
+                         gemm_ptr->GetGridSize(argument_ptr.get()),
+                         ave_time});
+                }
+            }
+
+            // the fastest instance by its median run time
+            if(best_gemm_name.empty() || timing.median < best_median_time)
             {
-                best_gemm_name  = gemm_name;
-                best_tflops     = tflops;
-                best_ave_time   = ave_time;
-                best_gb_per_sec = gb_per_sec;
+                best_gemm_name   = gemm_name;
+                best_gemm_key    = ck::utils::get_tuning_instance_key(*gemm_ptr);
+                best_tflops      = tflops;
+                best_ave_time    = ave_time;
+                best_gb_per_sec  = gb_per_sec;
+                best_median_time = timing.median;
             }
 
+            auto verification = ck::utils::ProfileVerification::NotRun;
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
@@ -473,7 +369,11 @@ void profile_gemm_impl(int do_verification,
 
                     ref_invoker.Run(ref_argument);
 
-                    ck::utils::check_err(c_m_n_device_f32_result.mData, c_m_n_host_result.mData);
+                    const bool pass = ck::utils::check_err(c_m_n_device_f32_result.mData,
+                                                           c_m_n_host_result.mData);
+
+                    verification = pass ? ck::utils::ProfileVerification::Pass
+                                        : ck::utils::ProfileVerification::Fail;
 
                     if(do_log)
                     {
@@ -502,7 +402,11 @@ void profile_gemm_impl(int do_verification,
                         a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
                     ref_invoker.Run(ref_argument);
-                    ck::utils::check_err(c_m_n_device_result.mData, c_m_n_host_result.mData);
+                    const bool pass =
+                        ck::utils::check_err(c_m_n_device_result.mData, c_m_n_host_result.mData);
+
+                    verification = pass ? ck::utils::ProfileVerification::Pass
+                                        : ck::utils::ProfileVerification::Fail;
 
                     if(do_log)
                     {
@@ -520,6 +424,9 @@ void profile_gemm_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ck::utils::report_profile_result(
+                {gemm_name, ave_time, tflops, gb_per_sec, verification, timing});
         }
         else
         {
@@ -529,6 +436,12 @@ void profile_gemm_impl(int do_verification,
 
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_gemm_name << std::endl;
+
+    // without timing every instance reports the same time, there is no best one to record
+    ck::utils::TuningDb& tuning_db = ck::utils::TuningDb::GetDefault();
+
+    if(time_kernel && tuning_db.IsPersistent() && !best_gemm_name.empty())
+        tuning_db.Update(tuning_problem, {best_gemm_key, best_median_time});
 }
 
 } // namespace profiler
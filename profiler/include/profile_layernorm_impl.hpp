@@ -0,0 +1,211 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "data_type.hpp"
+#include "device.hpp"
+#include "device_layernorm.hpp"
+#include "device_tensor.hpp"
+#include "host_reduce_util.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "reference_layernorm.hpp"
+#include "stream_config.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_layernorm_instance {
+
+void add_device_layernorm_rank2_reduce1_f16_instances(std::vector<DeviceLayernormPtr>&);
+
+void add_device_layernorm_rank3_reduce1_f16_instances(std::vector<DeviceLayernormPtr>&);
+
+void add_device_layernorm_rank2_reduce1_f32_instances(std::vector<DeviceLayernormPtr>&);
+
+void add_device_layernorm_rank3_reduce1_f32_instances(std::vector<DeviceLayernormPtr>&);
+
+} // namespace device_layernorm_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+namespace ck {
+namespace profiler {
+
+namespace detail {
+
+template <ck::index_t Rank, typename DataType>
+void add_device_layernorm_instances(std::vector<tensor_operation::device::DeviceLayernormPtr>& ptrs)
+{
+    using namespace ck::tensor_operation::device::device_layernorm_instance;
+
+    constexpr bool is_f16 = ck::is_same_v<DataType, ck::half_t>;
+    constexpr bool is_f32 = ck::is_same_v<DataType, float>;
+
+    // clang-format off
+    if constexpr(Rank == 2 && is_f16) add_device_layernorm_rank2_reduce1_f16_instances(ptrs);
+    if constexpr(Rank == 3 && is_f16) add_device_layernorm_rank3_reduce1_f16_instances(ptrs);
+    if constexpr(Rank == 2 && is_f32) add_device_layernorm_rank2_reduce1_f32_instances(ptrs);
+    if constexpr(Rank == 3 && is_f32) add_device_layernorm_rank3_reduce1_f32_instances(ptrs);
+    // clang-format on
+}
+
+template <typename DataType>
+void init_layernorm_tensor(Tensor<DataType>& t, int init_method, DataType lo, DataType hi)
+{
+    switch(init_method)
+    {
+    case 0: break;
+    case 1:
+        t.GenerateTensorValue(
+            GeneratorTensor_2<DataType>{static_cast<int>(lo), static_cast<int>(hi)});
+        break;
+    default: t.GenerateTensorValue(GeneratorTensor_3<DataType>{lo, hi});
+    }
+}
+
+} // namespace detail
+
+// Profiles the layernorm instances over the innermost dimension of a packed tensor, with gamma
+// and beta broadcast along the other dimensions, checking them against ReferenceLayernorm.
+template <ck::index_t Rank, typename DataType, typename AccDataType>
+bool profile_layernorm_impl(bool do_verification,
+                            int init_method,
+                            bool do_log,
+                            bool time_kernel,
+                            float epsilon,
+                            const std::vector<std::size_t>& lengths)
+{
+    const std::vector<int> reduce_dims{Rank - 1};
+
+    // gamma and beta hold lengths[Rank - 1] elements
+    std::vector<std::size_t> gamma_beta_strides(Rank, 0);
+
+    gamma_beta_strides[Rank - 1] = 1;
+
+    Tensor<DataType> x(lengths);
+    Tensor<DataType> gamma(lengths, gamma_beta_strides);
+    Tensor<DataType> beta(lengths, gamma_beta_strides);
+    Tensor<DataType> y_host(lengths);
+    Tensor<DataType> y_device(lengths);
+
+    std::cout << "x: " << x.mDesc << std::endl;
+    std::cout << "gamma, beta: " << gamma.mDesc << std::endl;
+
+    detail::init_layernorm_tensor<DataType>(x, init_method, -5, 5);
+    detail::init_layernorm_tensor<DataType>(gamma, init_method, 0, 2);
+    detail::init_layernorm_tensor<DataType>(beta, init_method, -1, 1);
+
+    if(do_verification)
+    {
+        using ReferenceLayernormInstance = ck::tensor_operation::host::
+            ReferenceLayernorm<DataType, DataType, DataType, AccDataType, DataType, Rank>;
+
+        auto ref_layernorm = ReferenceLayernormInstance{};
+        auto ref_invoker   = ref_layernorm.MakeInvoker();
+        auto ref_argument  = ref_layernorm.MakeArgument(
+            x, gamma, beta, y_host, reduce_dims, static_cast<AccDataType>(epsilon));
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    DeviceMem x_device_buf(sizeof(DataType) * x.mDesc.GetElementSpace());
+    DeviceMem gamma_device_buf(sizeof(DataType) * gamma.mDesc.GetElementSpace());
+    DeviceMem beta_device_buf(sizeof(DataType) * beta.mDesc.GetElementSpace());
+    DeviceMem y_device_buf(sizeof(DataType) * y_device.mDesc.GetElementSpace());
+
+    x_device_buf.ToDevice(x.mData.data());
+    gamma_device_buf.ToDevice(gamma.mData.data());
+    beta_device_buf.ToDevice(beta.mData.data());
+
+    std::vector<tensor_operation::device::DeviceLayernormPtr> layernorm_ptrs;
+
+    detail::add_device_layernorm_instances<Rank, DataType>(layernorm_ptrs);
+
+    if(layernorm_ptrs.empty())
+    {
+        throw std::runtime_error("wrong! no device layernorm instance found");
+    }
+
+    // x is read once or twice, depending on the instance
+    const std::size_t num_btype =
+        sizeof(DataType) * (2 * x.mDesc.GetElementSize() + 2 * gamma.mDesc.GetElementSpace());
+
+    std::string best_layernorm_name;
+    float best_ave_time   = 0;
+    float best_gb_per_sec = 0;
+
+    const auto i_lengths      = to_int_vector(x.mDesc.GetLengths());
+    const auto i_xStrides     = to_int_vector(x.mDesc.GetStrides());
+    const auto i_gammaStrides = to_int_vector(gamma.mDesc.GetStrides());
+    const auto i_betaStrides  = to_int_vector(beta.mDesc.GetStrides());
+
+    bool pass = true;
+
+    for(auto& layernorm_ptr : layernorm_ptrs)
+    {
+        auto argument_ptr = layernorm_ptr->MakeArgumentPointer(i_lengths,
+                                                               i_xStrides,
+                                                               i_gammaStrides,
+                                                               i_betaStrides,
+                                                               reduce_dims,
+                                                               epsilon,
+                                                               x_device_buf.GetDeviceBuffer(),
+                                                               gamma_device_buf.GetDeviceBuffer(),
+                                                               beta_device_buf.GetDeviceBuffer(),
+                                                               y_device_buf.GetDeviceBuffer());
+
+        if(!layernorm_ptr->IsSupportedArgument(argument_ptr.get()))
+            continue;
+
+        auto invoker_ptr = layernorm_ptr->MakeInvokerPointer();
+
+        const std::string layernorm_name = layernorm_ptr->GetTypeString();
+
+        float ave_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        float gb_per_sec = num_btype / 1.E6 / ave_time;
+
+        std::cout << "Perf: " << ave_time << " ms, " << gb_per_sec << " GB/s, " << layernorm_name
+                  << std::endl;
+
+        if(best_ave_time == 0 || ave_time < best_ave_time)
+        {
+            best_layernorm_name = layernorm_name;
+            best_ave_time       = ave_time;
+            best_gb_per_sec     = gb_per_sec;
+        }
+
+        if(do_verification)
+        {
+            y_device_buf.FromDevice(y_device.mData.data());
+
+            const bool instance_pass = ck::utils::check_err(y_device.mData, y_host.mData);
+
+            if(!instance_pass)
+                std::cout << "Fail info: " << layernorm_name << std::endl;
+
+            if(do_log)
+            {
+                LogRangeAsType<float>(std::cout << "x : ", x.mData, ",") << std::endl;
+                LogRangeAsType<float>(std::cout << "y_host  : ", y_host.mData, ",") << std::endl;
+                LogRangeAsType<float>(std::cout << "y_device: ", y_device.mData, ",")
+                    << std::endl;
+            }
+
+            pass = pass && instance_pass;
+        }
+    }
+
+    std::cout << "Best Perf: " << best_ave_time << " ms, " << best_gb_per_sec << " GB/s, "
+              << best_layernorm_name << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,552 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "data_type.hpp"
+#include "device.hpp"
+#include "device_pool_bwd.hpp"
+#include "device_pool_fwd.hpp"
+#include "device_tensor.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "reference_pool_bwd.hpp"
+#include "reference_pool_fwd.hpp"
+#include "stream_config.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+namespace device_pool_fwd_instance {
+
+void add_device_pool1d_fwd_nwc_max_f16_instances(
+    std::vector<DevicePoolFwdPtr<1, ReduceTensorOp::MAX>>&);
+
+void add_device_pool1d_fwd_nwc_avg_f16_instances(
+    std::vector<DevicePoolFwdPtr<1, ReduceTensorOp::AVG>>&);
+
+void add_device_pool1d_fwd_nwc_max_f32_instances(
+    std::vector<DevicePoolFwdPtr<1, ReduceTensorOp::MAX>>&);
+
+void add_device_pool1d_fwd_nwc_avg_f32_instances(
+    std::vector<DevicePoolFwdPtr<1, ReduceTensorOp::AVG>>&);
+
+void add_device_pool2d_fwd_nhwc_max_f16_instances(
+    std::vector<DevicePoolFwdPtr<2, ReduceTensorOp::MAX>>&);
+
+void add_device_pool2d_fwd_nhwc_avg_f16_instances(
+    std::vector<DevicePoolFwdPtr<2, ReduceTensorOp::AVG>>&);
+
+void add_device_pool2d_fwd_nhwc_max_f32_instances(
+    std::vector<DevicePoolFwdPtr<2, ReduceTensorOp::MAX>>&);
+
+void add_device_pool2d_fwd_nhwc_avg_f32_instances(
+    std::vector<DevicePoolFwdPtr<2, ReduceTensorOp::AVG>>&);
+
+void add_device_pool3d_fwd_ndhwc_max_f16_instances(
+    std::vector<DevicePoolFwdPtr<3, ReduceTensorOp::MAX>>&);
+
+void add_device_pool3d_fwd_ndhwc_avg_f16_instances(
+    std::vector<DevicePoolFwdPtr<3, ReduceTensorOp::AVG>>&);
+
+void add_device_pool3d_fwd_ndhwc_max_f32_instances(
+    std::vector<DevicePoolFwdPtr<3, ReduceTensorOp::MAX>>&);
+
+void add_device_pool3d_fwd_ndhwc_avg_f32_instances(
+    std::vector<DevicePoolFwdPtr<3, ReduceTensorOp::AVG>>&);
+
+} // namespace device_pool_fwd_instance
+
+namespace device_pool_bwd_instance {
+
+void add_device_pool1d_bwd_nwc_max_f16_instances(
+    std::vector<DevicePoolBwdPtr<1, ReduceTensorOp::MAX>>&);
+
+void add_device_pool1d_bwd_nwc_avg_f16_instances(
+    std::vector<DevicePoolBwdPtr<1, ReduceTensorOp::AVG>>&);
+
+void add_device_pool1d_bwd_nwc_max_f32_instances(
+    std::vector<DevicePoolBwdPtr<1, ReduceTensorOp::MAX>>&);
+
+void add_device_pool1d_bwd_nwc_avg_f32_instances(
+    std::vector<DevicePoolBwdPtr<1, ReduceTensorOp::AVG>>&);
+
+void add_device_pool2d_bwd_nhwc_max_f16_instances(
+    std::vector<DevicePoolBwdPtr<2, ReduceTensorOp::MAX>>&);
+
+void add_device_pool2d_bwd_nhwc_avg_f16_instances(
+    std::vector<DevicePoolBwdPtr<2, ReduceTensorOp::AVG>>&);
+
+void add_device_pool2d_bwd_nhwc_max_f32_instances(
+    std::vector<DevicePoolBwdPtr<2, ReduceTensorOp::MAX>>&);
+
+void add_device_pool2d_bwd_nhwc_avg_f32_instances(
+    std::vector<DevicePoolBwdPtr<2, ReduceTensorOp::AVG>>&);
+
+void add_device_pool3d_bwd_ndhwc_max_f16_instances(
+    std::vector<DevicePoolBwdPtr<3, ReduceTensorOp::MAX>>&);
+
+void add_device_pool3d_bwd_ndhwc_avg_f16_instances(
+    std::vector<DevicePoolBwdPtr<3, ReduceTensorOp::AVG>>&);
+
+void add_device_pool3d_bwd_ndhwc_max_f32_instances(
+    std::vector<DevicePoolBwdPtr<3, ReduceTensorOp::MAX>>&);
+
+void add_device_pool3d_bwd_ndhwc_avg_f32_instances(
+    std::vector<DevicePoolBwdPtr<3, ReduceTensorOp::AVG>>&);
+
+} // namespace device_pool_bwd_instance
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+namespace ck {
+namespace profiler {
+
+namespace detail {
+
+// logical [N, C, X...] lengths, channel-last strides
+inline HostTensorDescriptor make_pool_host_tensor_descriptor(ck::index_t N,
+                                                             ck::index_t C,
+                                                             const std::vector<ck::index_t>& Xs)
+{
+    std::vector<std::size_t> lengths{static_cast<std::size_t>(N), static_cast<std::size_t>(C)};
+    std::vector<std::size_t> strides(Xs.size() + 2);
+
+    lengths.insert(lengths.end(), Xs.begin(), Xs.end());
+
+    std::size_t stride = C;
+
+    strides[1] = 1;
+
+    for(std::size_t d = Xs.size(); d-- > 0;)
+    {
+        strides[d + 2] = stride;
+        stride *= Xs[d];
+    }
+
+    strides[0] = stride;
+
+    return HostTensorDescriptor(lengths, strides);
+}
+
+template <std::size_t NumDimSpatial>
+std::array<ck::index_t, NumDimSpatial> to_array(const std::vector<ck::index_t>& v)
+{
+    std::array<ck::index_t, NumDimSpatial> a;
+
+    std::copy(v.begin(), v.end(), a.begin());
+
+    return a;
+}
+
+template <ck::index_t NumDimSpatial, typename DataType, ck::ReduceTensorOp ReduceOpId>
+void add_device_pool_fwd_instances(
+    std::vector<tensor_operation::device::DevicePoolFwdPtr<NumDimSpatial, ReduceOpId>>& pool_ptrs)
+{
+    using namespace ck::tensor_operation::device::device_pool_fwd_instance;
+
+    constexpr bool is_f16 = ck::is_same_v<DataType, ck::half_t>;
+    constexpr bool is_f32 = ck::is_same_v<DataType, float>;
+    constexpr bool is_max = ReduceOpId == ReduceTensorOp::MAX;
+    constexpr bool is_avg = ReduceOpId == ReduceTensorOp::AVG;
+
+    // clang-format off
+    if constexpr(NumDimSpatial == 1 && is_f16 && is_max) add_device_pool1d_fwd_nwc_max_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 1 && is_f16 && is_avg) add_device_pool1d_fwd_nwc_avg_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 1 && is_f32 && is_max) add_device_pool1d_fwd_nwc_max_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 1 && is_f32 && is_avg) add_device_pool1d_fwd_nwc_avg_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f16 && is_max) add_device_pool2d_fwd_nhwc_max_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f16 && is_avg) add_device_pool2d_fwd_nhwc_avg_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f32 && is_max) add_device_pool2d_fwd_nhwc_max_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f32 && is_avg) add_device_pool2d_fwd_nhwc_avg_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f16 && is_max) add_device_pool3d_fwd_ndhwc_max_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f16 && is_avg) add_device_pool3d_fwd_ndhwc_avg_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f32 && is_max) add_device_pool3d_fwd_ndhwc_max_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f32 && is_avg) add_device_pool3d_fwd_ndhwc_avg_f32_instances(pool_ptrs);
+    // clang-format on
+}
+
+template <ck::index_t NumDimSpatial, typename DataType, ck::ReduceTensorOp ReduceOpId>
+void add_device_pool_bwd_instances(
+    std::vector<tensor_operation::device::DevicePoolBwdPtr<NumDimSpatial, ReduceOpId>>& pool_ptrs)
+{
+    using namespace ck::tensor_operation::device::device_pool_bwd_instance;
+
+    constexpr bool is_f16 = ck::is_same_v<DataType, ck::half_t>;
+    constexpr bool is_f32 = ck::is_same_v<DataType, float>;
+    constexpr bool is_max = ReduceOpId == ReduceTensorOp::MAX;
+    constexpr bool is_avg = ReduceOpId == ReduceTensorOp::AVG;
+
+    // clang-format off
+    if constexpr(NumDimSpatial == 1 && is_f16 && is_max) add_device_pool1d_bwd_nwc_max_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 1 && is_f16 && is_avg) add_device_pool1d_bwd_nwc_avg_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 1 && is_f32 && is_max) add_device_pool1d_bwd_nwc_max_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 1 && is_f32 && is_avg) add_device_pool1d_bwd_nwc_avg_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f16 && is_max) add_device_pool2d_bwd_nhwc_max_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f16 && is_avg) add_device_pool2d_bwd_nhwc_avg_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f32 && is_max) add_device_pool2d_bwd_nhwc_max_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 2 && is_f32 && is_avg) add_device_pool2d_bwd_nhwc_avg_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f16 && is_max) add_device_pool3d_bwd_ndhwc_max_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f16 && is_avg) add_device_pool3d_bwd_ndhwc_avg_f16_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f32 && is_max) add_device_pool3d_bwd_ndhwc_max_f32_instances(pool_ptrs);
+    if constexpr(NumDimSpatial == 3 && is_f32 && is_avg) add_device_pool3d_bwd_ndhwc_avg_f32_instances(pool_ptrs);
+    // clang-format on
+}
+
+template <typename DataType>
+void init_pool_tensor(Tensor<DataType>& t, int init_method)
+{
+    switch(init_method)
+    {
+    case 0: break;
+    case 1: t.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5}); break;
+    default: t.GenerateTensorValue(GeneratorTensor_3<DataType>{-5.0, 5.0});
+    }
+}
+
+} // namespace detail
+
+// Profiles the forward pooling instances of channel-last tensors, checking them against
+// ReferencePoolFwd. The MAX instances also output the indices, which are checked too.
+template <ck::index_t NumDimSpatial,
+          typename DataType,
+          typename AccDataType,
+          ck::ReduceTensorOp ReduceOpId>
+bool profile_pool_fwd_impl(bool do_verification,
+                           int init_method,
+                           bool do_log,
+                           bool time_kernel,
+                           ck::index_t N,
+                           ck::index_t C,
+                           const std::vector<ck::index_t>& input_spatial_lengths,
+                           const std::vector<ck::index_t>& window_spatial_lengths,
+                           const std::vector<ck::index_t>& output_spatial_lengths,
+                           const std::vector<ck::index_t>& window_strides,
+                           const std::vector<ck::index_t>& input_left_pads,
+                           const std::vector<ck::index_t>& input_right_pads)
+{
+    constexpr bool NeedIndices = ReduceOpId != ReduceTensorOp::AVG;
+
+    Tensor<DataType> in(
+        detail::make_pool_host_tensor_descriptor(N, C, input_spatial_lengths));
+    Tensor<DataType> out_host(
+        detail::make_pool_host_tensor_descriptor(N, C, output_spatial_lengths));
+    Tensor<DataType> out_device(out_host.mDesc);
+    Tensor<int32_t> out_indices_host(out_host.mDesc);
+    Tensor<int32_t> out_indices_device(out_host.mDesc);
+
+    std::cout << "in: " << in.mDesc << std::endl;
+    std::cout << "out: " << out_host.mDesc << std::endl;
+
+    detail::init_pool_tensor(in, init_method);
+
+    if(do_verification)
+    {
+        using ReferencePoolFwdInstance = ck::tensor_operation::host::ReferencePoolFwd<NumDimSpatial,
+                                                                                      DataType,
+                                                                                      DataType,
+                                                                                      AccDataType,
+                                                                                      ReduceOpId,
+                                                                                      false,
+                                                                                      NeedIndices>;
+
+        auto ref_pool     = ReferencePoolFwdInstance{};
+        auto ref_invoker  = ref_pool.MakeInvoker();
+        auto ref_argument = ref_pool.MakeArgument(in,
+                                                  out_host,
+                                                  out_indices_host,
+                                                  window_spatial_lengths,
+                                                  window_strides,
+                                                  input_left_pads,
+                                                  input_right_pads);
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    DeviceMem in_device_buf(sizeof(DataType) * in.mDesc.GetElementSpace());
+    DeviceMem out_device_buf(sizeof(DataType) * out_device.mDesc.GetElementSpace());
+    DeviceMem out_indices_device_buf(sizeof(int32_t) * out_device.mDesc.GetElementSpace());
+
+    in_device_buf.ToDevice(in.mData.data());
+
+    std::vector<tensor_operation::device::DevicePoolFwdPtr<NumDimSpatial, ReduceOpId>> pool_ptrs;
+
+    detail::add_device_pool_fwd_instances<NumDimSpatial, DataType, ReduceOpId>(pool_ptrs);
+
+    if(pool_ptrs.empty())
+    {
+        throw std::runtime_error("wrong! no device pooling instance found");
+    }
+
+    const std::size_t num_in  = in.mDesc.GetElementSize();
+    const std::size_t num_out = out_host.mDesc.GetElementSize();
+
+    std::size_t num_btype = sizeof(DataType) * (num_in + num_out);
+
+    if constexpr(NeedIndices)
+        num_btype += sizeof(int32_t) * num_out;
+
+    std::string best_pool_name;
+    float best_ave_time   = 0;
+    float best_gb_per_sec = 0;
+
+    bool pass = true;
+
+    for(auto& pool_ptr : pool_ptrs)
+    {
+        auto argument_ptr = pool_ptr->MakeArgumentPointer(
+            in_device_buf.GetDeviceBuffer(),
+            out_device_buf.GetDeviceBuffer(),
+            out_indices_device_buf.GetDeviceBuffer(),
+            N,
+            C,
+            detail::to_array<NumDimSpatial>(input_spatial_lengths),
+            detail::to_array<NumDimSpatial>(window_spatial_lengths),
+            detail::to_array<NumDimSpatial>(output_spatial_lengths),
+            detail::to_array<NumDimSpatial>(window_strides),
+            detail::to_array<NumDimSpatial>(input_left_pads),
+            detail::to_array<NumDimSpatial>(input_right_pads));
+
+        if(!pool_ptr->IsSupportedArgument(argument_ptr.get()))
+            continue;
+
+        auto invoker_ptr = pool_ptr->MakeInvokerPointer();
+
+        const std::string pool_name = pool_ptr->GetTypeString();
+
+        float ave_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        float gb_per_sec = num_btype / 1.E6 / ave_time;
+
+        std::cout << "Perf: " << ave_time << " ms, " << gb_per_sec << " GB/s, " << pool_name
+                  << std::endl;
+
+        if(best_ave_time == 0 || ave_time < best_ave_time)
+        {
+            best_pool_name  = pool_name;
+            best_ave_time   = ave_time;
+            best_gb_per_sec = gb_per_sec;
+        }
+
+        if(do_verification)
+        {
+            out_device_buf.FromDevice(out_device.mData.data());
+
+            bool instance_pass = ck::utils::check_err(out_device.mData, out_host.mData);
+
+            if constexpr(NeedIndices)
+            {
+                out_indices_device_buf.FromDevice(out_indices_device.mData.data());
+
+                instance_pass = instance_pass && ck::utils::check_err(out_indices_device.mData,
+                                                                      out_indices_host.mData);
+            }
+
+            if(!instance_pass)
+                std::cout << "Fail info: " << pool_name << std::endl;
+
+            if(do_log)
+            {
+                LogRangeAsType<float>(std::cout << "in : ", in.mData, ",") << std::endl;
+                LogRangeAsType<float>(std::cout << "out_host  : ", out_host.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(std::cout << "out_device: ", out_device.mData, ",")
+                    << std::endl;
+            }
+
+            pass = pass && instance_pass;
+        }
+    }
+
+    std::cout << "Best Perf: " << best_ave_time << " ms, " << best_gb_per_sec << " GB/s, "
+              << best_pool_name << std::endl;
+
+    return pass;
+}
+
+// Profiles the backward pooling instances of channel-last tensors, checking them against
+// ReferencePoolBwd. The indices MAX backward takes come from ReferencePoolFwd.
+template <ck::index_t NumDimSpatial,
+          typename DataType,
+          typename AccDataType,
+          ck::ReduceTensorOp ReduceOpId>
+bool profile_pool_bwd_impl(bool do_verification,
+                           int init_method,
+                           bool do_log,
+                           bool time_kernel,
+                           ck::index_t N,
+                           ck::index_t C,
+                           const std::vector<ck::index_t>& input_spatial_lengths,
+                           const std::vector<ck::index_t>& window_spatial_lengths,
+                           const std::vector<ck::index_t>& output_spatial_lengths,
+                           const std::vector<ck::index_t>& window_strides,
+                           const std::vector<ck::index_t>& input_left_pads,
+                           const std::vector<ck::index_t>& input_right_pads,
+                           bool count_include_pad)
+{
+    constexpr bool UseIndices = ReduceOpId != ReduceTensorOp::AVG;
+
+    Tensor<DataType> din_host(
+        detail::make_pool_host_tensor_descriptor(N, C, input_spatial_lengths));
+    Tensor<DataType> din_device(din_host.mDesc);
+    Tensor<DataType> dout(
+        detail::make_pool_host_tensor_descriptor(N, C, output_spatial_lengths));
+    Tensor<int32_t> out_indices(dout.mDesc);
+
+    std::cout << "din: " << din_host.mDesc << std::endl;
+    std::cout << "dout: " << dout.mDesc << std::endl;
+
+    detail::init_pool_tensor(dout, init_method);
+
+    if constexpr(UseIndices)
+    {
+        // indices of a forward pass over a random input
+        Tensor<DataType> in(din_host.mDesc);
+        Tensor<DataType> out(dout.mDesc);
+
+        detail::init_pool_tensor(in, init_method);
+
+        using ReferencePoolFwdInstance = ck::tensor_operation::host::ReferencePoolFwd<NumDimSpatial,
+                                                                                      DataType,
+                                                                                      DataType,
+                                                                                      AccDataType,
+                                                                                      ReduceOpId,
+                                                                                      false,
+                                                                                      true>;
+
+        auto ref_pool     = ReferencePoolFwdInstance{};
+        auto ref_invoker  = ref_pool.MakeInvoker();
+        auto ref_argument = ref_pool.MakeArgument(in,
+                                                  out,
+                                                  out_indices,
+                                                  window_spatial_lengths,
+                                                  window_strides,
+                                                  input_left_pads,
+                                                  input_right_pads);
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    if(do_verification)
+    {
+        using ReferencePoolBwdInstance = ck::tensor_operation::host::
+            ReferencePoolBwd<NumDimSpatial, DataType, DataType, AccDataType, ReduceOpId>;
+
+        auto ref_pool     = ReferencePoolBwdInstance{};
+        auto ref_invoker  = ref_pool.MakeInvoker();
+        auto ref_argument = ref_pool.MakeArgument(din_host,
+                                                  dout,
+                                                  out_indices,
+                                                  window_spatial_lengths,
+                                                  window_strides,
+                                                  input_left_pads,
+                                                  input_right_pads,
+                                                  count_include_pad);
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    DeviceMem din_device_buf(sizeof(DataType) * din_device.mDesc.GetElementSpace());
+    DeviceMem dout_device_buf(sizeof(DataType) * dout.mDesc.GetElementSpace());
+    DeviceMem out_indices_device_buf(sizeof(int32_t) * out_indices.mDesc.GetElementSpace());
+
+    dout_device_buf.ToDevice(dout.mData.data());
+    out_indices_device_buf.ToDevice(out_indices.mData.data());
+
+    std::vector<tensor_operation::device::DevicePoolBwdPtr<NumDimSpatial, ReduceOpId>> pool_ptrs;
+
+    detail::add_device_pool_bwd_instances<NumDimSpatial, DataType, ReduceOpId>(pool_ptrs);
+
+    if(pool_ptrs.empty())
+    {
+        throw std::runtime_error("wrong! no device pooling instance found");
+    }
+
+    const std::size_t num_in  = din_host.mDesc.GetElementSize();
+    const std::size_t num_out = dout.mDesc.GetElementSize();
+
+    std::size_t num_btype = sizeof(DataType) * (num_in + num_out);
+
+    if constexpr(UseIndices)
+        num_btype += sizeof(int32_t) * num_out;
+
+    std::string best_pool_name;
+    float best_ave_time   = 0;
+    float best_gb_per_sec = 0;
+
+    bool pass = true;
+
+    for(auto& pool_ptr : pool_ptrs)
+    {
+        auto argument_ptr = pool_ptr->MakeArgumentPointer(
+            dout_device_buf.GetDeviceBuffer(),
+            out_indices_device_buf.GetDeviceBuffer(),
+            din_device_buf.GetDeviceBuffer(),
+            N,
+            C,
+            detail::to_array<NumDimSpatial>(input_spatial_lengths),
+            detail::to_array<NumDimSpatial>(window_spatial_lengths),
+            detail::to_array<NumDimSpatial>(output_spatial_lengths),
+            detail::to_array<NumDimSpatial>(window_strides),
+            detail::to_array<NumDimSpatial>(input_left_pads),
+            detail::to_array<NumDimSpatial>(input_right_pads),
+            count_include_pad);
+
+        if(!pool_ptr->IsSupportedArgument(argument_ptr.get()))
+            continue;
+
+        auto invoker_ptr = pool_ptr->MakeInvokerPointer();
+
+        const std::string pool_name = pool_ptr->GetTypeString();
+
+        float ave_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        float gb_per_sec = num_btype / 1.E6 / ave_time;
+
+        std::cout << "Perf: " << ave_time << " ms, " << gb_per_sec << " GB/s, " << pool_name
+                  << std::endl;
+
+        if(best_ave_time == 0 || ave_time < best_ave_time)
+        {
+            best_pool_name  = pool_name;
+            best_ave_time   = ave_time;
+            best_gb_per_sec = gb_per_sec;
+        }
+
+        if(do_verification)
+        {
+            din_device_buf.FromDevice(din_device.mData.data());
+
+            const bool instance_pass = ck::utils::check_err(din_device.mData, din_host.mData);
+
+            if(!instance_pass)
+                std::cout << "Fail info: " << pool_name << std::endl;
+
+            if(do_log)
+            {
+                LogRangeAsType<float>(std::cout << "dout: ", dout.mData, ",") << std::endl;
+                LogRangeAsType<float>(std::cout << "din_host  : ", din_host.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(std::cout << "din_device: ", din_device.mData, ",")
+                    << std::endl;
+            }
+
+            pass = pass && instance_pass;
+        }
+    }
+
+    std::cout << "Best Perf: " << best_ave_time << " ms, " << best_gb_per_sec << " GB/s, "
+              << best_pool_name << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -3,6 +3,7 @@
 #include "check_err.hpp"
 #include "device_reduce.hpp"
 #include "device_reduce_instance.hpp"
+#include "device_reduce_dispatcher_instance.hpp"
 #include "reduction_enums.hpp"
 #include "host_reduction.hpp"
 
@@ -615,6 +616,63 @@ void profile_reduce_impl_impl(bool do_verification,
 
         std::cout << "Best Perf: " << best_avg_time << " ms, " << best_gb_per_sec << " GB/s"
                   << std::endl;
+
+        // what production code gets from the dispatcher, to compare with the best above
+        auto dispatcher = make_device_reduce_dispatcher<InDataType,
+                                                        AccDataType,
+                                                        OutDataType,
+                                                        Rank,
+                                                        NumReduceDim,
+                                                        ReduceOpId,
+                                                        NanOpt,
+                                                        IndicesOpt>();
+
+        DeviceMem dispatch_ws_dev(dispatcher->GetWorkspaceSizeInBytes(i_inLengths, reduceDims));
+
+        auto dispatch_argument_ptr = dispatcher->MakeArgumentPointer(
+            i_inLengths,
+            i_inStrides,
+            i_outLengths,
+            i_outStrides,
+            reduceDims,
+            alpha,
+            beta,
+            in_dev.GetDeviceBuffer(),
+            out_dev.GetDeviceBuffer(),
+            out_indices_dev.GetDeviceBuffer(),
+            dispatch_ws_dev.GetDeviceBuffer(),
+            InElementwiseOperation_0(static_cast<int32_t>(reduce_total_length)),
+            AccElementwiseOperation_0(static_cast<int32_t>(reduce_total_length)));
+
+        if(dispatcher->IsSupportedArgument(dispatch_argument_ptr.get()))
+        {
+            float avg_time = dispatcher->MakeInvokerPointer()->Run(
+                dispatch_argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+            std::size_t num_bytes =
+                invariant_total_length * reduce_total_length * sizeof(InDataType) +
+                invariant_total_length * sizeof(OutDataType);
+
+            std::cout << "Dispatched Perf: " << avg_time << " ms, " << num_bytes / 1.E6 / avg_time
+                      << " GB/s, " << dispatcher->GetPlanString(dispatch_argument_ptr.get())
+                      << std::endl;
+
+            if(do_verification)
+            {
+                out_dev.FromDevice(out.mData.data());
+                ck::utils::check_err(out.mData, out_ref.mData);
+
+                if(NeedIndices)
+                {
+                    out_indices_dev.FromDevice(out_indices.mData.data());
+                    ck::utils::check_err(out_indices.mData, out_indices_ref.mData);
+                };
+            };
+        }
+        else
+        {
+            std::cout << "Dispatched: no instance supports the problem" << std::endl;
+        };
     }
     else
     {
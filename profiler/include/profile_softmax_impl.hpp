@@ -0,0 +1,185 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "data_type.hpp"
+#include "device.hpp"
+#include "device_softmax.hpp"
+#include "device_tensor.hpp"
+#include "host_reduce_util.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "reference_softmax.hpp"
+#include "stream_config.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_softmax_instance {
+
+void add_device_softmax_rank2_reduce1_f16_instances(std::vector<DeviceSoftmaxPtr>&);
+
+void add_device_softmax_rank3_reduce1_f16_instances(std::vector<DeviceSoftmaxPtr>&);
+
+void add_device_softmax_rank2_reduce1_f32_instances(std::vector<DeviceSoftmaxPtr>&);
+
+void add_device_softmax_rank3_reduce1_f32_instances(std::vector<DeviceSoftmaxPtr>&);
+
+} // namespace device_softmax_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+namespace ck {
+namespace profiler {
+
+namespace detail {
+
+template <ck::index_t Rank, typename DataType>
+void add_device_softmax_instances(std::vector<tensor_operation::device::DeviceSoftmaxPtr>& ptrs)
+{
+    using namespace ck::tensor_operation::device::device_softmax_instance;
+
+    constexpr bool is_f16 = ck::is_same_v<DataType, ck::half_t>;
+    constexpr bool is_f32 = ck::is_same_v<DataType, float>;
+
+    // clang-format off
+    if constexpr(Rank == 2 && is_f16) add_device_softmax_rank2_reduce1_f16_instances(ptrs);
+    if constexpr(Rank == 3 && is_f16) add_device_softmax_rank3_reduce1_f16_instances(ptrs);
+    if constexpr(Rank == 2 && is_f32) add_device_softmax_rank2_reduce1_f32_instances(ptrs);
+    if constexpr(Rank == 3 && is_f32) add_device_softmax_rank3_reduce1_f32_instances(ptrs);
+    // clang-format on
+}
+
+template <typename DataType>
+void init_softmax_tensor(Tensor<DataType>& t, int init_method)
+{
+    switch(init_method)
+    {
+    case 0: break;
+    case 1: t.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5}); break;
+    default: t.GenerateTensorValue(GeneratorTensor_3<DataType>{-5.0, 5.0});
+    }
+}
+
+} // namespace detail
+
+// Profiles the softmax instances over the innermost dimension of a packed tensor, checking them
+// against ReferenceSoftmax.
+template <ck::index_t Rank, typename DataType, typename AccDataType>
+bool profile_softmax_impl(bool do_verification,
+                          int init_method,
+                          bool do_log,
+                          bool time_kernel,
+                          const std::vector<std::size_t>& lengths)
+{
+    const std::vector<int> reduce_dims{Rank - 1};
+
+    Tensor<DataType> in(lengths);
+    Tensor<DataType> out_host(lengths);
+    Tensor<DataType> out_device(lengths);
+
+    std::cout << "in: " << in.mDesc << std::endl;
+
+    detail::init_softmax_tensor(in, init_method);
+
+    if(do_verification)
+    {
+        using ReferenceSoftmaxInstance =
+            ck::tensor_operation::host::ReferenceSoftmax<DataType, DataType, AccDataType, Rank>;
+
+        auto ref_softmax  = ReferenceSoftmaxInstance{};
+        auto ref_invoker  = ref_softmax.MakeInvoker();
+        auto ref_argument = ref_softmax.MakeArgument(in, out_host, reduce_dims);
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    DeviceMem in_device_buf(sizeof(DataType) * in.mDesc.GetElementSpace());
+    DeviceMem out_device_buf(sizeof(DataType) * out_device.mDesc.GetElementSpace());
+
+    in_device_buf.ToDevice(in.mData.data());
+
+    std::vector<tensor_operation::device::DeviceSoftmaxPtr> softmax_ptrs;
+
+    detail::add_device_softmax_instances<Rank, DataType>(softmax_ptrs);
+
+    if(softmax_ptrs.empty())
+    {
+        throw std::runtime_error("wrong! no device softmax instance found");
+    }
+
+    // the input is read once or twice, depending on the instance
+    const std::size_t num_btype = sizeof(DataType) * 2 * in.mDesc.GetElementSize();
+
+    std::string best_softmax_name;
+    float best_ave_time   = 0;
+    float best_gb_per_sec = 0;
+
+    const auto i_lengths = to_int_vector(in.mDesc.GetLengths());
+    const auto i_strides = to_int_vector(in.mDesc.GetStrides());
+
+    bool pass = true;
+
+    for(auto& softmax_ptr : softmax_ptrs)
+    {
+        auto argument_ptr = softmax_ptr->MakeArgumentPointer(i_lengths,
+                                                             i_strides,
+                                                             reduce_dims,
+                                                             in_device_buf.GetDeviceBuffer(),
+                                                             out_device_buf.GetDeviceBuffer());
+
+        if(!softmax_ptr->IsSupportedArgument(argument_ptr.get()))
+            continue;
+
+        auto invoker_ptr = softmax_ptr->MakeInvokerPointer();
+
+        const std::string softmax_name = softmax_ptr->GetTypeString();
+
+        float ave_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        float gb_per_sec = num_btype / 1.E6 / ave_time;
+
+        std::cout << "Perf: " << ave_time << " ms, " << gb_per_sec << " GB/s, " << softmax_name
+                  << std::endl;
+
+        if(best_ave_time == 0 || ave_time < best_ave_time)
+        {
+            best_softmax_name = softmax_name;
+            best_ave_time     = ave_time;
+            best_gb_per_sec   = gb_per_sec;
+        }
+
+        if(do_verification)
+        {
+            out_device_buf.FromDevice(out_device.mData.data());
+
+            const bool instance_pass = ck::utils::check_err(out_device.mData, out_host.mData);
+
+            if(!instance_pass)
+                std::cout << "Fail info: " << softmax_name << std::endl;
+
+            if(do_log)
+            {
+                LogRangeAsType<float>(std::cout << "in : ", in.mData, ",") << std::endl;
+                LogRangeAsType<float>(std::cout << "out_host  : ", out_host.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(std::cout << "out_device: ", out_device.mData, ",")
+                    << std::endl;
+            }
+
+            pass = pass && instance_pass;
+        }
+    }
+
+    std::cout << "Best Perf: " << best_ave_time << " ms, " << best_gb_per_sec << " GB/s, "
+              << best_softmax_name << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "data_type.hpp"
+#include "device.hpp"
+#include "device_tensor.hpp"
+#include "device_welford.hpp"
+#include "host_reduce_util.hpp"
+#include "host_reduction.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "stream_config.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_welford_instance {
+
+void add_device_welford_rank2_reduce1_f16_f32_f16_instances(std::vector<DeviceWelfordPtr>&);
+
+void add_device_welford_rank4_reduce3_f16_f32_f16_instances(std::vector<DeviceWelfordPtr>&);
+
+void add_device_welford_rank2_reduce1_f32_f32_f32_instances(std::vector<DeviceWelfordPtr>&);
+
+void add_device_welford_rank4_reduce3_f32_f32_f32_instances(std::vector<DeviceWelfordPtr>&);
+
+} // namespace device_welford_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+namespace ck {
+namespace profiler {
+
+namespace detail {
+
+template <ck::index_t Rank, ck::index_t NumReduceDim, typename InDataType>
+void add_device_welford_instances(std::vector<tensor_operation::device::DeviceWelfordPtr>& ptrs)
+{
+    using namespace ck::tensor_operation::device::device_welford_instance;
+
+    constexpr bool is_f16 = ck::is_same_v<InDataType, ck::half_t>;
+    constexpr bool is_f32 = ck::is_same_v<InDataType, float>;
+
+    constexpr bool is_rank2_reduce1 = Rank == 2 && NumReduceDim == 1;
+    constexpr bool is_rank4_reduce3 = Rank == 4 && NumReduceDim == 3;
+
+    // clang-format off
+    if constexpr(is_rank2_reduce1 && is_f16) add_device_welford_rank2_reduce1_f16_f32_f16_instances(ptrs);
+    if constexpr(is_rank4_reduce3 && is_f16) add_device_welford_rank4_reduce3_f16_f32_f16_instances(ptrs);
+    if constexpr(is_rank2_reduce1 && is_f32) add_device_welford_rank2_reduce1_f32_f32_f32_instances(ptrs);
+    if constexpr(is_rank4_reduce3 && is_f32) add_device_welford_rank4_reduce3_f32_f32_f32_instances(ptrs);
+    // clang-format on
+}
+
+template <typename DataType>
+void init_welford_tensor(Tensor<DataType>& t, int init_method)
+{
+    switch(init_method)
+    {
+    case 0: break;
+    case 1: t.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5}); break;
+    default: t.GenerateTensorValue(GeneratorTensor_3<DataType>{-5.0, 5.0});
+    }
+}
+
+} // namespace detail
+
+// Profiles the Welford instances computing the mean and variance of a packed tensor over its
+// innermost dimension for rank 2 (layernorm), or over all but its innermost dimension for rank 4
+// (batchnorm of NHWC), checking them against ReductionHostWelford.
+template <ck::index_t Rank, typename InDataType, typename AccDataType, typename OutDataType>
+bool profile_welford_impl(bool do_verification,
+                          int init_method,
+                          bool do_log,
+                          bool time_kernel,
+                          const std::vector<std::size_t>& lengths)
+{
+    static_assert(Rank == 2 || Rank == 4, "wrong! there are only Welford instances of rank 2, 4");
+
+    constexpr ck::index_t NumReduceDim = Rank == 2 ? 1 : 3;
+
+    const std::vector<int> reduce_dims    = Rank == 2 ? std::vector<int>{1}
+                                                      : std::vector<int>{0, 1, 2};
+    const std::vector<int> invariant_dims = Rank == 2 ? std::vector<int>{0} : std::vector<int>{3};
+
+    const std::vector<std::size_t> out_lengths{lengths[invariant_dims[0]]};
+
+    Tensor<InDataType> in(lengths);
+    Tensor<OutDataType> mean_host(out_lengths);
+    Tensor<OutDataType> var_host(out_lengths);
+    Tensor<OutDataType> mean_device(out_lengths);
+    Tensor<OutDataType> var_device(out_lengths);
+
+    std::cout << "in: " << in.mDesc << std::endl;
+
+    detail::init_welford_tensor(in, init_method);
+
+    if(do_verification)
+    {
+        using ReductionHostWelfordInstance =
+            ReductionHostWelford<InDataType, AccDataType, OutDataType, Rank, NumReduceDim>;
+
+        ReductionHostWelfordInstance welford_host(
+            in.mDesc, mean_host.mDesc, invariant_dims, reduce_dims);
+
+        welford_host.Run(in.mData.data(), mean_host.mData.data(), var_host.mData.data());
+    }
+
+    DeviceMem in_device_buf(sizeof(InDataType) * in.mDesc.GetElementSpace());
+    DeviceMem mean_device_buf(sizeof(OutDataType) * mean_device.mDesc.GetElementSpace());
+    DeviceMem var_device_buf(sizeof(OutDataType) * var_device.mDesc.GetElementSpace());
+
+    in_device_buf.ToDevice(in.mData.data());
+
+    std::vector<tensor_operation::device::DeviceWelfordPtr> welford_ptrs;
+
+    detail::add_device_welford_instances<Rank, NumReduceDim, InDataType>(welford_ptrs);
+
+    if(welford_ptrs.empty())
+    {
+        throw std::runtime_error("wrong! no device Welford instance found");
+    }
+
+    // the input is read once, the mean and variance are written once
+    const std::size_t num_btype = sizeof(InDataType) * in.mDesc.GetElementSize() +
+                                  sizeof(OutDataType) * 2 * mean_device.mDesc.GetElementSize();
+
+    std::string best_welford_name;
+    float best_ave_time   = 0;
+    float best_gb_per_sec = 0;
+
+    const auto i_in_lengths  = to_int_vector(in.mDesc.GetLengths());
+    const auto i_in_strides  = to_int_vector(in.mDesc.GetStrides());
+    const auto i_out_lengths = to_int_vector(mean_device.mDesc.GetLengths());
+    const auto i_out_strides = to_int_vector(mean_device.mDesc.GetStrides());
+
+    bool pass = true;
+
+    for(auto& welford_ptr : welford_ptrs)
+    {
+        DeviceMem workspace(welford_ptr->GetWorkspaceSizeInBytes(i_in_lengths, reduce_dims));
+
+        auto argument_ptr = welford_ptr->MakeArgumentPointer(i_in_lengths,
+                                                             i_in_strides,
+                                                             i_out_lengths,
+                                                             i_out_strides,
+                                                             reduce_dims,
+                                                             in_device_buf.GetDeviceBuffer(),
+                                                             mean_device_buf.GetDeviceBuffer(),
+                                                             var_device_buf.GetDeviceBuffer(),
+                                                             workspace.GetDeviceBuffer());
+
+        if(!welford_ptr->IsSupportedArgument(argument_ptr.get()))
+            continue;
+
+        auto invoker_ptr = welford_ptr->MakeInvokerPointer();
+
+        const std::string welford_name = welford_ptr->GetTypeString();
+
+        float ave_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        float gb_per_sec = num_btype / 1.E6 / ave_time;
+
+        std::cout << "Perf: " << ave_time << " ms, " << gb_per_sec << " GB/s, " << welford_name
+                  << std::endl;
+
+        if(best_ave_time == 0 || ave_time < best_ave_time)
+        {
+            best_welford_name = welford_name;
+            best_ave_time     = ave_time;
+            best_gb_per_sec   = gb_per_sec;
+        }
+
+        if(do_verification)
+        {
+            mean_device_buf.FromDevice(mean_device.mData.data());
+            var_device_buf.FromDevice(var_device.mData.data());
+
+            // the device merges the partial results in another order than the host
+            const double rtol = ck::is_same_v<OutDataType, float> ? 1e-4 : 1e-3;
+            const double atol = ck::is_same_v<OutDataType, float> ? 1e-5 : 1e-3;
+
+            const bool instance_pass =
+                ck::utils::check_err(
+                    mean_device.mData, mean_host.mData, "Error: Incorrect mean!", rtol, atol) &&
+                ck::utils::check_err(
+                    var_device.mData, var_host.mData, "Error: Incorrect variance!", rtol, atol);
+
+            if(!instance_pass)
+                std::cout << "Fail info: " << welford_name << std::endl;
+
+            if(do_log)
+            {
+                LogRangeAsType<float>(std::cout << "mean_host  : ", mean_host.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(std::cout << "mean_device: ", mean_device.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(std::cout << "var_host  : ", var_host.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(std::cout << "var_device: ", var_device.mData, ",")
+                    << std::endl;
+            }
+
+            pass = pass && instance_pass;
+        }
+    }
+
+    if(best_welford_name.empty())
+    {
+        std::cout << "no Welford instance supports " << in.mDesc << std::endl;
+        return false;
+    }
+
+    std::cout << "Best Perf: " << best_ave_time << " ms, " << best_gb_per_sec << " GB/s, "
+              << best_welford_name << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
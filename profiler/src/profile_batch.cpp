@@ -0,0 +1,436 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cost_model.hpp"
+#include "device.hpp"
+#include "profile_batch.hpp"
+#include "profile_convnd_fwd.hpp"
+#include "profile_result.hpp"
+
+int profile_gemm(int, char*[]);
+
+namespace {
+
+// a line of the problem file: the arguments of a single ckProfiler run, starting with the op
+struct BatchProblem
+{
+    std::size_t line;
+    std::vector<std::string> args;
+    // the number of earlier lines with the same arguments
+    std::size_t repeat = 0;
+
+    // identifies the problem in the progress journal: repeated lines are distinct problems, keyed
+    // on their arguments and repeat count rather than on their line, which would change when lines
+    // are added to the file between runs
+    std::string GetKey() const
+    {
+        std::string key;
+
+        for(const auto& arg : args)
+            key += (key.empty() ? "" : ",") + arg;
+
+        if(repeat > 0)
+            key += "#" + std::to_string(repeat);
+
+        return key;
+    }
+};
+
+// Fields are separated by commas and/or white space, empty lines and lines starting with '#' are
+// skipped.
+std::vector<BatchProblem> read_batch_problems(const std::string& path)
+{
+    std::ifstream file(path);
+
+    if(!file)
+        throw std::runtime_error("wrong! failed to open problem file " + path);
+
+    std::vector<BatchProblem> problems;
+    std::map<std::vector<std::string>, std::size_t> num_seen;
+    std::string line;
+
+    for(std::size_t line_id = 1; std::getline(file, line); ++line_id)
+    {
+        for(char& c : line)
+        {
+            if(c == ',' || c == '\t' || c == '\r')
+                c = ' ';
+        }
+
+        std::istringstream fields(line);
+        BatchProblem problem{line_id, {}};
+
+        for(std::string field; fields >> field;)
+            problem.args.push_back(field);
+
+        if(problem.args.empty() || problem.args[0][0] == '#')
+            continue;
+
+        problem.repeat = num_seen[problem.args]++;
+
+        problems.push_back(std::move(problem));
+    }
+
+    return problems;
+}
+
+/**
+ * @brief      Journal of the problems a batch run started and finished.
+ *
+ *             "<results>.progress" gets a "start" line before and a "done"
+ *             line after each problem, both flushed right away. A rerun skips
+ *             finished problems; a problem that was started but not finished
+ *             crashed the previous run and is reported as failed instead of
+ *             being run again.
+ */
+class BatchProgress
+{
+    public:
+    explicit BatchProgress(const std::string& path)
+    {
+        std::ifstream in(path);
+        std::string line;
+
+        while(std::getline(in, line))
+        {
+            const std::size_t split = line.find('\t');
+
+            if(split == std::string::npos)
+                continue;
+
+            const std::string state = line.substr(0, split);
+            const std::string key   = line.substr(split + 1);
+
+            if(state == "start")
+                started_.insert(key);
+            else if(state == "done")
+                done_.insert(key);
+        }
+
+        out_.open(path, std::ios::app);
+
+        if(!out_)
+            throw std::runtime_error("wrong! failed to open progress file " + path);
+    }
+
+    bool IsDone(const std::string& key) const { return done_.count(key) > 0; }
+
+    bool HasCrashed(const std::string& key) const
+    {
+        return started_.count(key) > 0 && done_.count(key) == 0;
+    }
+
+    void Start(const std::string& key)
+    {
+        started_.insert(key);
+        out_ << "start\t" << key << std::endl;
+    }
+
+    void Finish(const std::string& key)
+    {
+        done_.insert(key);
+        out_ << "done\t" << key << std::endl;
+    }
+
+    private:
+    std::set<std::string> started_;
+    std::set<std::string> done_;
+    std::ofstream out_;
+};
+
+std::string get_json_string(const std::string& s)
+{
+    std::ostringstream os;
+
+    os << '"';
+
+    for(const char c : s)
+    {
+        if(c == '"' || c == '\\')
+            os << '\\' << c;
+        else if(static_cast<unsigned char>(c) < 0x20)
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+        else
+            os << c;
+    }
+
+    os << '"';
+
+    return os.str();
+}
+
+// times and rates of untimed runs are not finite, JSON has no number for them
+std::string get_json_number(float x)
+{
+    if(!std::isfinite(x))
+        return "null";
+
+    std::ostringstream os;
+
+    os << x;
+
+    return os.str();
+}
+
+std::string get_csv_field(const std::string& s)
+{
+    if(s.find_first_of(",\"\n") == std::string::npos)
+        return s;
+
+    std::string field = "\"";
+
+    for(const char c : s)
+        field += c == '"' ? std::string("\"\"") : std::string(1, c);
+
+    return field + '"';
+}
+
+// Result rows, one per instance, as JSON lines or, for a path ending in ".csv", as CSV.
+class BatchResultWriter
+{
+    public:
+    explicit BatchResultWriter(const std::string& path)
+        : csv_(path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0)
+    {
+        out_.open(path, std::ios::app);
+
+        if(!out_)
+            throw std::runtime_error("wrong! failed to open result file " + path);
+
+        if(csv_ && out_.tellp() == 0)
+        {
+            out_ << "line,op,args,instance,avg_time_ms,tflops,gb_per_sec,min_time_ms,"
+                    "median_time_ms,p90_time_ms,p99_time_ms,stddev_ms,num_outlier,verification,"
+                    "error"
+                 << std::endl;
+        }
+    }
+
+    void Write(const BatchProblem& problem,
+               const ck::utils::ProfileResult* result,
+               const std::string& error)
+    {
+        std::string args;
+
+        for(std::size_t i = 1; i < problem.args.size(); ++i)
+            args += (i > 1 ? " " : "") + problem.args[i];
+
+        const char* verification =
+            result ? ck::utils::get_profile_verification_name(result->verification) : "none";
+
+        if(csv_)
+        {
+            out_ << problem.line << ',' << get_csv_field(problem.args[0]) << ','
+                 << get_csv_field(args) << ',';
+
+            if(result)
+            {
+                out_ << get_csv_field(result->instance) << ',' << result->avg_time << ','
+                     << result->tflops << ',' << result->gb_per_sec;
+
+                if(!result->timing.samples.empty())
+                {
+                    const KernelTimingResult& timing = result->timing;
+
+                    out_ << ',' << timing.min << ',' << timing.median << ',' << timing.p90 << ','
+                         << timing.p99 << ',' << timing.stddev << ',' << timing.num_outlier;
+                }
+                else
+                {
+                    out_ << ",,,,,,";
+                }
+            }
+            else
+            {
+                out_ << ",,,,,,,,,";
+            }
+
+            out_ << ',' << verification << ',' << get_csv_field(error) << '\n';
+        }
+        else
+        {
+            out_ << "{\"line\": " << problem.line
+                 << ", \"op\": " << get_json_string(problem.args[0])
+                 << ", \"args\": " << get_json_string(args);
+
+            if(result)
+            {
+                out_ << ", \"instance\": " << get_json_string(result->instance)
+                     << ", \"avg_time_ms\": " << get_json_number(result->avg_time)
+                     << ", \"tflops\": " << get_json_number(result->tflops)
+                     << ", \"gb_per_sec\": " << get_json_number(result->gb_per_sec);
+
+                // statistics of the timed runs, only if the kernels were timed
+                if(!result->timing.samples.empty())
+                {
+                    const KernelTimingResult& timing = result->timing;
+
+                    out_ << ", \"min_time_ms\": " << get_json_number(timing.min)
+                         << ", \"median_time_ms\": " << get_json_number(timing.median)
+                         << ", \"p90_time_ms\": " << get_json_number(timing.p90)
+                         << ", \"p99_time_ms\": " << get_json_number(timing.p99)
+                         << ", \"stddev_ms\": " << get_json_number(timing.stddev)
+                         << ", \"num_outlier\": " << timing.num_outlier;
+                }
+            }
+
+            out_ << ", \"verification\": \"" << verification << '"';
+
+            if(!error.empty())
+                out_ << ", \"error\": " << get_json_string(error);
+
+            out_ << "}\n";
+        }
+    }
+
+    void Flush() { out_.flush(); }
+
+    private:
+    bool csv_;
+    std::ofstream out_;
+};
+
+// Run one problem in this process. The profilers exit on malformed command lines, so these are
+// checked here first and reported as errors.
+void run_batch_problem(const BatchProblem& problem)
+{
+    std::vector<std::string> args{"ckProfiler"};
+    args.insert(args.end(), problem.args.begin(), problem.args.end());
+
+    std::vector<char*> argv;
+
+    for(auto& arg : args)
+        argv.push_back(&arg[0]);
+
+    argv.push_back(nullptr);
+
+    // check the command line on a copy, the profilers remove --top-k themselves
+    std::vector<char*> check_argv = argv;
+    int check_argc                = static_cast<int>(args.size());
+
+    ck::utils::extract_top_k_arg(check_argc, check_argv.data());
+
+    const int argc        = static_cast<int>(args.size());
+    const std::string& op = problem.args[0];
+
+    if(op == "gemm")
+    {
+        if(check_argc != 14 && check_argc != 15)
+            throw std::runtime_error("gemm needs 13 or 14 arguments, see ckProfiler gemm");
+
+        profile_gemm(argc, argv.data());
+    }
+    else if(op == "conv_fwd")
+    {
+        if(check_argc >= 10 && check_argc != 12 + 6 * std::stoi(check_argv[8]))
+            throw std::runtime_error("wrong number of convolution parameters, see ckProfiler "
+                                     "conv_fwd");
+
+        ck::profiler::profile_convnd_fwd(argc, argv.data());
+    }
+    else
+    {
+        throw std::runtime_error("op " + op + " is not supported in batch mode");
+    }
+}
+
+} // namespace
+
+int ck::profiler::profile_batch(int argc, char* argv[])
+{
+    if(argc != 4)
+    {
+        printf("arg1: tensor operation (batch: run a list of problems)\n");
+        printf("arg2: problem file, one problem per line: the arguments of a gemm or conv_fwd\n");
+        printf("      run, separated by commas or spaces, e.g.\n");
+        printf("      gemm,1,1,1,2,0,1,3840,4096,4096,-1,-1,-1\n");
+        printf("arg3: result file, CSV if it ends in .csv, JSON lines otherwise; results are\n");
+        printf("      appended and <result file>.progress records the finished problems, so a\n");
+        printf("      run continues where an interrupted one stopped\n");
+        exit(1);
+    }
+
+    const std::string result_path = argv[3];
+
+    const auto problems = read_batch_problems(argv[2]);
+
+    BatchProgress progress(result_path + ".progress");
+    BatchResultWriter writer(result_path);
+
+    // device buffers of one problem are reused for the next instead of reallocated, as host
+    // tensors are by the arena scope of main()
+    DeviceMemArena::Scope device_mem_arena_scope;
+
+    std::size_t num_skipped = 0;
+    std::size_t num_failed  = 0;
+
+    for(const auto& problem : problems)
+    {
+        const std::string key = problem.GetKey();
+
+        if(progress.IsDone(key))
+        {
+            ++num_skipped;
+            continue;
+        }
+
+        std::cout << "Problem at line " << problem.line << ": " << key << std::endl;
+
+        if(progress.HasCrashed(key))
+        {
+            writer.Write(problem, nullptr, "the process ended while running this problem");
+            writer.Flush();
+            progress.Finish(key);
+            ++num_failed;
+            continue;
+        }
+
+        progress.Start(key);
+
+        ck::utils::ProfileResultCollector collector;
+        std::string error;
+
+        try
+        {
+            run_batch_problem(problem);
+        }
+        catch(const std::exception& e)
+        {
+            error = e.what();
+        }
+
+        if(error.empty() && collector.GetResults().empty())
+            error = "no instance supports this problem";
+
+        if(!error.empty())
+        {
+            std::cerr << "Error: " << error << std::endl;
+            ++num_failed;
+        }
+
+        for(const auto& result : collector.GetResults())
+            writer.Write(problem, &result, error);
+
+        if(collector.GetResults().empty())
+            writer.Write(problem, nullptr, error);
+
+        writer.Flush();
+        progress.Finish(key);
+    }
+
+    std::cout << "Batch: " << problems.size() << " problems, " << num_skipped
+              << " finished by an earlier run, " << num_failed << " failed" << std::endl;
+
+    return 0;
+}
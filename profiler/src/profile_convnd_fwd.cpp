@@ -93,6 +93,7 @@ void print_use_msg()
               << " <dilations>, (ie Dy, Dx for 2D)\n"
               << " <left padding>, (ie LeftPy, LeftPx for 2D)\n"
               << " <right padding>, (ie RightPy, RightPx for 2D)\n"
+              << "--top-k K (anywhere): only profile the K instances the cost model ranks best\n"
               << std::endl;
 }
 
@@ -121,6 +122,7 @@ void profile_convnd_instances_impl(const ck::utils::conv::ConvParams& params,
                                    bool do_log,
                                    bool time_kernel,
                                    int init_method,
+                                   std::size_t top_k,
                                    ConvLayouts)
 {
     using namespace std::placeholders;
@@ -183,16 +185,31 @@ void profile_convnd_instances_impl(const ck::utils::conv::ConvParams& params,
         _3);
     OpInstanceRunEngine<InDataType, WeiDataType, OutDataType> run_engine(*conv_instance,
                                                                          reference_conv_fwd_fun);
+
+    // instances hold no problem state, a batch run creates them once for all its problems
+    static const auto conv_ptrs =
+        conv::ConvolutionFwdInstances<InDataType, WeiDataType, OutDataType>::template Get<NDim>();
+
+    const auto tuning_problem = conv::make_conv_fwd_tuning_problem<InDataType,
+                                                                   WeiDataType,
+                                                                   OutDataType,
+                                                                   typename ConvLayouts::Input,
+                                                                   typename ConvLayouts::Weight,
+                                                                   typename ConvLayouts::Output>(
+        params);
+
     auto best_conf = run_engine.Profile(
-        conv::ConvolutionFwdInstances<InDataType, WeiDataType, OutDataType>::template Get<NDim>(),
-        time_kernel,
-        do_verification,
-        do_log);
+        conv_ptrs, time_kernel, do_verification, do_log, top_k, tuning_problem);
 
     std::cout << "Best configuration parameters:"
               << "\nname: " << best_conf.best_op_name << "\navg_time: " << best_conf.best_avg_time
               << "\ntflops: " << best_conf.best_tflops << "\nGB/s: " << best_conf.best_gb_per_sec
               << std::endl;
+
+    TuningDb& tuning_db = TuningDb::GetDefault();
+
+    if(time_kernel && tuning_db.IsPersistent() && !best_conf.best_op_name.empty())
+        tuning_db.Update(tuning_problem, {best_conf.best_op_key, best_conf.best_median_time});
 }
 
 template <int NDim>
@@ -202,7 +219,8 @@ void profile_convnd_instances(ConvDataType data_type,
                               bool do_verification,
                               bool do_log,
                               bool time_kernel,
-                              int init_method)
+                              int init_method,
+                              std::size_t top_k)
 {
     switch(data_layout)
     {
@@ -216,6 +234,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NHWC>{});
             break;
         case ConvDataType::F16_F16_F16:
@@ -225,6 +244,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NHWC>{});
             break;
         case ConvDataType::BF16_BF16_BF16:
@@ -234,6 +254,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NHWC>{});
             break;
         case ConvDataType::INT8_INT8_INT8:
@@ -243,6 +264,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NHWC>{});
             break;
         }
@@ -258,6 +280,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NCHW>{});
             break;
         case ConvDataType::F16_F16_F16:
@@ -267,6 +290,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NCHW>{});
             break;
         case ConvDataType::BF16_BF16_BF16:
@@ -276,6 +300,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NCHW>{});
             break;
         case ConvDataType::INT8_INT8_INT8:
@@ -285,6 +310,7 @@ void profile_convnd_instances(ConvDataType data_type,
                 do_log,
                 time_kernel,
                 init_method,
+                top_k,
                 ConvolutionLayouts<NDim, ConvDataLayout::NCHW>{});
             break;
         }
@@ -308,6 +334,8 @@ int ck::profiler::profile_convnd_fwd(int argc, char* argv[])
     int num_dim_spatial{2};
     ConvParams params;
 
+    const std::size_t top_k = ck::utils::extract_top_k_arg(argc, argv);
+
     if(argc >= 4)
     {
         data_type   = static_cast<ConvDataType>(std::stoi(argv[2]));
@@ -331,16 +359,34 @@ int ck::profiler::profile_convnd_fwd(int argc, char* argv[])
     switch(num_dim_spatial)
     {
     case 1:
-        profile_convnd_instances<1>(
-            data_type, data_layout, params, do_verification, do_log, time_kernel, init_method);
+        profile_convnd_instances<1>(data_type,
+                                    data_layout,
+                                    params,
+                                    do_verification,
+                                    do_log,
+                                    time_kernel,
+                                    init_method,
+                                    top_k);
         break;
     case 2:
-        profile_convnd_instances<2>(
-            data_type, data_layout, params, do_verification, do_log, time_kernel, init_method);
+        profile_convnd_instances<2>(data_type,
+                                    data_layout,
+                                    params,
+                                    do_verification,
+                                    do_log,
+                                    time_kernel,
+                                    init_method,
+                                    top_k);
         break;
     case 3:
-        profile_convnd_instances<3>(
-            data_type, data_layout, params, do_verification, do_log, time_kernel, init_method);
+        profile_convnd_instances<3>(data_type,
+                                    data_layout,
+                                    params,
+                                    do_verification,
+                                    do_log,
+                                    time_kernel,
+                                    init_method,
+                                    top_k);
         break;
     default:
         throw std::runtime_error("profile_conv_fwd: unsupported num_dim_spatial value: " +
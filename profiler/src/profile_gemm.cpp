@@ -28,6 +28,8 @@ enum struct GemmDataType
 
 int profile_gemm(int argc, char* argv[])
 {
+    const std::size_t top_k = ck::utils::extract_top_k_arg(argc, argv);
+
     if(!(argc == 14 || argc == 15))
     {
         printf("arg1: tensor operation (gemm: GEMM)\n");
@@ -42,6 +44,7 @@ int profile_gemm(int argc, char* argv[])
         printf("arg7: time kernel (0=n0, 1=yes)\n");
         printf("arg8 to 13: M, N, K, StrideA, StrideB, StrideC\n");
         printf("arg14: split k into  mulitiple batch\n");
+        printf("--top-k K (anywhere): only profile the K instances the cost model ranks best\n");
         exit(1);
     }
 
@@ -81,7 +84,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -101,7 +105,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -121,7 +126,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -141,7 +147,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_KN_MN)
     {
@@ -161,7 +168,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -181,7 +189,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -201,7 +210,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -221,7 +231,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_KN_MN)
     {
@@ -241,7 +252,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -261,7 +273,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -281,7 +294,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -301,7 +315,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_KN_MN)
     {
@@ -321,7 +336,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -341,7 +357,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -361,7 +378,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -381,7 +399,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            top_k);
     }
     else
     {
@@ -0,0 +1,86 @@
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+#include <stdlib.h>
+#include <half.hpp>
+#include "profile_layernorm_impl.hpp"
+
+enum struct LayernormDataType
+{
+    F32_F32, // 0
+    F16_F16, // 1
+};
+
+namespace {
+
+template <ck::index_t Rank>
+bool profile_layernorm(LayernormDataType data_type,
+                       bool do_verification,
+                       int init_method,
+                       bool do_log,
+                       bool time_kernel,
+                       float epsilon,
+                       const std::vector<std::size_t>& lengths)
+{
+    if(data_type == LayernormDataType::F32_F32)
+    {
+        return ck::profiler::profile_layernorm_impl<Rank, float, float>(
+            do_verification, init_method, do_log, time_kernel, epsilon, lengths);
+    }
+    else if(data_type == LayernormDataType::F16_F16)
+    {
+        return ck::profiler::profile_layernorm_impl<Rank, ck::half_t, float>(
+            do_verification, init_method, do_log, time_kernel, epsilon, lengths);
+    }
+    else
+    {
+        throw std::runtime_error("wrong! this layernorm data_type is not implemented");
+    }
+}
+
+} // namespace
+
+int profile_layernorm(int argc, char* argv[])
+{
+    if(argc != 10 && argc != 11)
+    {
+        printf("arg1: tensor operation (layernorm: Layer normalization)\n");
+        printf("arg2: data type (0: fp32; 1: fp16)\n");
+        printf("arg3: verification (0: no; 1: yes)\n");
+        printf("arg4: initialization (0: no init; 1: integer value; 2: decimal value)\n");
+        printf("arg5: print tensor value (0: no; 1: yes)\n");
+        printf("arg6: time kernel (0: no; 1: yes)\n");
+        printf("arg7: epsilon\n");
+        printf("arg8 onwards: 2 or 3 lengths of a packed tensor, normalized along the last\n");
+        exit(1);
+    }
+
+    const auto data_type       = static_cast<LayernormDataType>(std::stoi(argv[2]));
+    const bool do_verification = std::stoi(argv[3]);
+    const int init_method      = std::stoi(argv[4]);
+    const bool do_log          = std::stoi(argv[5]);
+    const bool time_kernel     = std::stoi(argv[6]);
+    const float epsilon        = std::stof(argv[7]);
+
+    std::vector<std::size_t> lengths;
+
+    for(int i = 8; i < argc; ++i)
+        lengths.push_back(std::stoul(argv[i]));
+
+    bool pass = false;
+
+    switch(lengths.size())
+    {
+    case 2:
+        pass = profile_layernorm<2>(
+            data_type, do_verification, init_method, do_log, time_kernel, epsilon, lengths);
+        break;
+    case 3:
+        pass = profile_layernorm<3>(
+            data_type, do_verification, init_method, do_log, time_kernel, epsilon, lengths);
+        break;
+    }
+
+    return pass ? 0 : 1;
+}
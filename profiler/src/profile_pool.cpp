@@ -0,0 +1,190 @@
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+#include <stdlib.h>
+#include <half.hpp>
+#include "profile_pool_impl.hpp"
+
+enum struct PoolDirection
+{
+    Forward,  // 0
+    Backward, // 1
+};
+
+enum struct PoolReduceOp
+{
+    MAX, // 0
+    AVG, // 1
+};
+
+enum struct PoolDataType
+{
+    F32_F32, // 0
+    F16_F16, // 1
+};
+
+namespace {
+
+struct PoolProblem
+{
+    bool do_verification;
+    int init_method;
+    bool do_log;
+    bool time_kernel;
+    bool count_include_pad;
+    ck::index_t N;
+    ck::index_t C;
+    std::vector<ck::index_t> input_spatial_lengths;
+    std::vector<ck::index_t> window_spatial_lengths;
+    std::vector<ck::index_t> output_spatial_lengths;
+    std::vector<ck::index_t> window_strides;
+    std::vector<ck::index_t> input_left_pads;
+    std::vector<ck::index_t> input_right_pads;
+};
+
+template <ck::index_t NumDimSpatial, typename DataType, ck::ReduceTensorOp ReduceOpId>
+bool profile_pool(PoolDirection direction, const PoolProblem& p)
+{
+    if(direction == PoolDirection::Forward)
+    {
+        if(ReduceOpId == ck::ReduceTensorOp::AVG && !p.count_include_pad)
+        {
+            throw std::runtime_error("wrong! forward AVG pooling counts the padding");
+        }
+
+        return ck::profiler::profile_pool_fwd_impl<NumDimSpatial, DataType, float, ReduceOpId>(
+            p.do_verification,
+            p.init_method,
+            p.do_log,
+            p.time_kernel,
+            p.N,
+            p.C,
+            p.input_spatial_lengths,
+            p.window_spatial_lengths,
+            p.output_spatial_lengths,
+            p.window_strides,
+            p.input_left_pads,
+            p.input_right_pads);
+    }
+    else
+    {
+        return ck::profiler::profile_pool_bwd_impl<NumDimSpatial, DataType, float, ReduceOpId>(
+            p.do_verification,
+            p.init_method,
+            p.do_log,
+            p.time_kernel,
+            p.N,
+            p.C,
+            p.input_spatial_lengths,
+            p.window_spatial_lengths,
+            p.output_spatial_lengths,
+            p.window_strides,
+            p.input_left_pads,
+            p.input_right_pads,
+            p.count_include_pad);
+    }
+}
+
+template <ck::index_t NumDimSpatial>
+bool profile_pool(PoolDirection direction,
+                  PoolReduceOp reduce_op,
+                  PoolDataType data_type,
+                  const PoolProblem& p)
+{
+    using ck::ReduceTensorOp;
+
+    if(data_type == PoolDataType::F32_F32 && reduce_op == PoolReduceOp::MAX)
+    {
+        return profile_pool<NumDimSpatial, float, ReduceTensorOp::MAX>(direction, p);
+    }
+    else if(data_type == PoolDataType::F32_F32 && reduce_op == PoolReduceOp::AVG)
+    {
+        return profile_pool<NumDimSpatial, float, ReduceTensorOp::AVG>(direction, p);
+    }
+    else if(data_type == PoolDataType::F16_F16 && reduce_op == PoolReduceOp::MAX)
+    {
+        return profile_pool<NumDimSpatial, ck::half_t, ReduceTensorOp::MAX>(direction, p);
+    }
+    else if(data_type == PoolDataType::F16_F16 && reduce_op == PoolReduceOp::AVG)
+    {
+        return profile_pool<NumDimSpatial, ck::half_t, ReduceTensorOp::AVG>(direction, p);
+    }
+    else
+    {
+        throw std::runtime_error("wrong! this pooling data_type & reduce op is not implemented");
+    }
+}
+
+} // namespace
+
+int profile_pool(int argc, char* argv[])
+{
+    const int num_dim_spatial = argc > 10 ? std::stoi(argv[10]) : 0;
+
+    if(num_dim_spatial < 1 || num_dim_spatial > 3 || argc != 13 + 5 * num_dim_spatial)
+    {
+        printf("arg1: tensor operation (pool: Pooling)\n");
+        printf("arg2: direction (0: forward; 1: backward)\n");
+        printf("arg3: reduce op (0: max; 1: avg)\n");
+        printf("arg4: data type (0: fp32; 1: fp16)\n");
+        printf("arg5: verification (0: no; 1: yes)\n");
+        printf("arg6: initialization (0: no init; 1: integer value; 2: decimal value)\n");
+        printf("arg7: print tensor value (0: no; 1: yes)\n");
+        printf("arg8: time kernel (0: no; 1: yes)\n");
+        printf("arg9: avg counts the padding (0: no; 1: yes), forward avg always does\n");
+        printf("arg10: number of spatial dimensions (1 to 3)\n");
+        printf("arg11 to 12: N, C\n");
+        printf("arg13 onwards, one per spatial dimension: Xi..., Y..., S..., LeftP..., "
+               "RightP...\n");
+        exit(1);
+    }
+
+    const auto direction = static_cast<PoolDirection>(std::stoi(argv[2]));
+    const auto reduce_op = static_cast<PoolReduceOp>(std::stoi(argv[3]));
+    const auto data_type = static_cast<PoolDataType>(std::stoi(argv[4]));
+
+    PoolProblem p;
+
+    p.do_verification   = std::stoi(argv[5]);
+    p.init_method       = std::stoi(argv[6]);
+    p.do_log            = std::stoi(argv[7]);
+    p.time_kernel       = std::stoi(argv[8]);
+    p.count_include_pad = std::stoi(argv[9]);
+    p.N                 = std::stoi(argv[11]);
+    p.C                 = std::stoi(argv[12]);
+
+    auto read_spatial = [&](int arg_begin) {
+        std::vector<ck::index_t> v;
+
+        for(int d = 0; d < num_dim_spatial; ++d)
+            v.push_back(std::stoi(argv[arg_begin + d]));
+
+        return v;
+    };
+
+    p.input_spatial_lengths  = read_spatial(13);
+    p.window_spatial_lengths = read_spatial(13 + num_dim_spatial);
+    p.window_strides         = read_spatial(13 + 2 * num_dim_spatial);
+    p.input_left_pads        = read_spatial(13 + 3 * num_dim_spatial);
+    p.input_right_pads       = read_spatial(13 + 4 * num_dim_spatial);
+
+    for(int d = 0; d < num_dim_spatial; ++d)
+    {
+        const ck::index_t x = p.input_spatial_lengths[d] + p.input_left_pads[d] +
+                              p.input_right_pads[d] - p.window_spatial_lengths[d];
+
+        p.output_spatial_lengths.push_back(x / p.window_strides[d] + 1);
+    }
+
+    bool pass = false;
+
+    switch(num_dim_spatial)
+    {
+    case 1: pass = profile_pool<1>(direction, reduce_op, data_type, p); break;
+    case 2: pass = profile_pool<2>(direction, reduce_op, data_type, p); break;
+    case 3: pass = profile_pool<3>(direction, reduce_op, data_type, p); break;
+    }
+
+    return pass ? 0 : 1;
+}
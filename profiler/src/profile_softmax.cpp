@@ -0,0 +1,84 @@
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+#include <stdlib.h>
+#include <half.hpp>
+#include "profile_softmax_impl.hpp"
+
+enum struct SoftmaxDataType
+{
+    F32_F32, // 0
+    F16_F16, // 1
+};
+
+namespace {
+
+template <ck::index_t Rank>
+bool profile_softmax(SoftmaxDataType data_type,
+                     bool do_verification,
+                     int init_method,
+                     bool do_log,
+                     bool time_kernel,
+                     const std::vector<std::size_t>& lengths)
+{
+    if(data_type == SoftmaxDataType::F32_F32)
+    {
+        return ck::profiler::profile_softmax_impl<Rank, float, float>(
+            do_verification, init_method, do_log, time_kernel, lengths);
+    }
+    else if(data_type == SoftmaxDataType::F16_F16)
+    {
+        return ck::profiler::profile_softmax_impl<Rank, ck::half_t, float>(
+            do_verification, init_method, do_log, time_kernel, lengths);
+    }
+    else
+    {
+        throw std::runtime_error("wrong! this softmax data_type is not implemented");
+    }
+}
+
+} // namespace
+
+int profile_softmax(int argc, char* argv[])
+{
+    if(argc != 9 && argc != 10)
+    {
+        printf("arg1: tensor operation (softmax: Softmax)\n");
+        printf("arg2: data type (0: fp32; 1: fp16)\n");
+        printf("arg3: verification (0: no; 1: yes)\n");
+        printf("arg4: initialization (0: no init; 1: integer value; 2: decimal value)\n");
+        printf("arg5: print tensor value (0: no; 1: yes)\n");
+        printf("arg6: time kernel (0: no; 1: yes)\n");
+        printf("arg7 onwards: 2 or 3 lengths of a packed tensor, the softmax taken along the "
+               "last\n");
+        exit(1);
+    }
+
+    const auto data_type       = static_cast<SoftmaxDataType>(std::stoi(argv[2]));
+    const bool do_verification = std::stoi(argv[3]);
+    const int init_method      = std::stoi(argv[4]);
+    const bool do_log          = std::stoi(argv[5]);
+    const bool time_kernel     = std::stoi(argv[6]);
+
+    std::vector<std::size_t> lengths;
+
+    for(int i = 7; i < argc; ++i)
+        lengths.push_back(std::stoul(argv[i]));
+
+    bool pass = false;
+
+    switch(lengths.size())
+    {
+    case 2:
+        pass = profile_softmax<2>(
+            data_type, do_verification, init_method, do_log, time_kernel, lengths);
+        break;
+    case 3:
+        pass = profile_softmax<3>(
+            data_type, do_verification, init_method, do_log, time_kernel, lengths);
+        break;
+    }
+
+    return pass ? 0 : 1;
+}
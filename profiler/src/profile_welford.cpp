@@ -0,0 +1,84 @@
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+#include <stdlib.h>
+#include <half.hpp>
+#include "profile_welford_impl.hpp"
+
+enum struct WelfordDataType
+{
+    F32_F32_F32, // 0
+    F16_F32_F16, // 1
+};
+
+namespace {
+
+template <ck::index_t Rank>
+bool profile_welford(WelfordDataType data_type,
+                     bool do_verification,
+                     int init_method,
+                     bool do_log,
+                     bool time_kernel,
+                     const std::vector<std::size_t>& lengths)
+{
+    if(data_type == WelfordDataType::F32_F32_F32)
+    {
+        return ck::profiler::profile_welford_impl<Rank, float, float, float>(
+            do_verification, init_method, do_log, time_kernel, lengths);
+    }
+    else if(data_type == WelfordDataType::F16_F32_F16)
+    {
+        return ck::profiler::profile_welford_impl<Rank, ck::half_t, float, ck::half_t>(
+            do_verification, init_method, do_log, time_kernel, lengths);
+    }
+    else
+    {
+        throw std::runtime_error("wrong! this Welford data_type is not implemented");
+    }
+}
+
+} // namespace
+
+int profile_welford(int argc, char* argv[])
+{
+    if(argc != 9 && argc != 11)
+    {
+        printf("arg1: tensor operation (welford: Welford mean and variance)\n");
+        printf("arg2: data type (0: fp32; 1: fp16)\n");
+        printf("arg3: verification (0: no; 1: yes)\n");
+        printf("arg4: initialization (0: no init; 1: integer value; 2: decimal value)\n");
+        printf("arg5: print tensor value (0: no; 1: yes)\n");
+        printf("arg6: time kernel (0: no; 1: yes)\n");
+        printf("arg7 onwards: 2 lengths of a packed tensor, reduced along the last, or 4 lengths "
+               "of a packed NHWC tensor, reduced along N, H and W\n");
+        exit(1);
+    }
+
+    const auto data_type       = static_cast<WelfordDataType>(std::stoi(argv[2]));
+    const bool do_verification = std::stoi(argv[3]);
+    const int init_method      = std::stoi(argv[4]);
+    const bool do_log          = std::stoi(argv[5]);
+    const bool time_kernel     = std::stoi(argv[6]);
+
+    std::vector<std::size_t> lengths;
+
+    for(int i = 7; i < argc; ++i)
+        lengths.push_back(std::stoul(argv[i]));
+
+    bool pass = false;
+
+    switch(lengths.size())
+    {
+    case 2:
+        pass = profile_welford<2>(
+            data_type, do_verification, init_method, do_log, time_kernel, lengths);
+        break;
+    case 4:
+        pass = profile_welford<4>(
+            data_type, do_verification, init_method, do_log, time_kernel, lengths);
+        break;
+    }
+
+    return pass ? 0 : 1;
+}
@@ -4,6 +4,8 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "host_tensor_allocator.hpp"
+#include "profile_batch.hpp"
 #include "profile_convnd_fwd.hpp"
 
 int profile_gemm(int, char*[]);
@@ -20,9 +22,16 @@ int profile_convnd_bwd_data(int, char*[], int);
 int profile_reduce(int, char*[]);
 int profile_conv_bwd_weight(int, char*[]);
 int profile_batched_gemm_reduce(int, char*[]);
+int profile_pool(int, char*[]);
+int profile_softmax(int, char*[]);
+int profile_layernorm(int, char*[]);
+int profile_welford(int, char*[]);
 
 int main(int argc, char* argv[])
 {
+    // host tensors of the same shape are created for every problem and instance, reuse their memory
+    HostTensorArena::Scope host_tensor_arena_scope;
+
     if(strcmp(argv[1], "gemm") == 0)
     {
         return profile_gemm(argc, argv);
@@ -91,6 +100,26 @@ int main(int argc, char* argv[])
     {
         return profile_conv_bwd_weight(argc, argv);
     }
+    else if(strcmp(argv[1], "pool") == 0)
+    {
+        return profile_pool(argc, argv);
+    }
+    else if(strcmp(argv[1], "softmax") == 0)
+    {
+        return profile_softmax(argc, argv);
+    }
+    else if(strcmp(argv[1], "layernorm") == 0)
+    {
+        return profile_layernorm(argc, argv);
+    }
+    else if(strcmp(argv[1], "welford") == 0)
+    {
+        return profile_welford(argc, argv);
+    }
+    else if(strcmp(argv[1], "batch") == 0)
+    {
+        return ck::profiler::profile_batch(argc, argv);
+    }
     else
     {
         // clang-format off
@@ -108,7 +137,12 @@ int main(int argc, char* argv[])
                "                        conv2d_bwd_data: BackwardConvolution data 2 dim\n"
                "                        conv3d_bwd_data: BackwardConvolution data 3 dim\n"
                "                        reduce: REDUCE\n"
-               "                        conv2d_bwd_weight: Backward Weight Convolution 2d\n");
+               "                        conv2d_bwd_weight: Backward Weight Convolution 2d\n"
+               "                        pool: Pooling forward and backward, 1 to 3 dim\n"
+               "                        softmax: Softmax along the innermost dim\n"
+               "                        layernorm: Layer normalization along the innermost dim\n"
+               "                        welford: Mean and variance in one pass (Welford)\n"
+               "                        batch: gemm and conv_fwd problems listed in a file\n");
         // clang-format on
     }
     return 0;
@@ -0,0 +1,206 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "check_err.hpp"
+#include "host_tensor.hpp"
+
+using ck::utils::CheckErrConfig;
+using ck::utils::CheckErrReport;
+
+TEST(CheckErr, HalfConversionIsExact)
+{
+    using Traits = ck::utils::detail::CheckErrTypeTraits<ck::half_t>;
+
+    for(uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        const uint16_t h = static_cast<uint16_t>(bits);
+
+        ck::half_t x;
+        std::memcpy(&x, &h, sizeof(h));
+
+        const float expected = static_cast<float>(x);
+        const float actual   = Traits::Convert(x);
+
+        if(std::isnan(expected))
+            ASSERT_TRUE(std::isnan(actual)) << std::hex << bits;
+        else
+            ASSERT_EQ(std::memcmp(&expected, &actual, sizeof(float)), 0) << std::hex << bits;
+    }
+}
+
+TEST(CheckErr, BhalfConversionIsExact)
+{
+    using Traits = ck::utils::detail::CheckErrTypeTraits<ck::bhalf_t>;
+
+    for(uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        const float expected = ck::type_convert<float>(static_cast<ck::bhalf_t>(bits));
+        const float actual   = Traits::Convert(static_cast<ck::bhalf_t>(bits));
+
+        ASSERT_EQ(std::memcmp(&expected, &actual, sizeof(float)), 0) << std::hex << bits;
+    }
+}
+
+TEST(CheckErr, UlpDistance)
+{
+    using ck::utils::detail::get_ulp_distance;
+
+    const float x = 1.f;
+
+    EXPECT_EQ(get_ulp_distance(x, x), 0);
+    EXPECT_EQ(get_ulp_distance(x, std::nextafter(x, 2.f)), 1);
+    EXPECT_EQ(get_ulp_distance(std::nextafter(x, 0.f), std::nextafter(x, 2.f)), 2);
+    EXPECT_EQ(get_ulp_distance(0.f, -0.f), 0);
+    EXPECT_EQ(get_ulp_distance(std::numeric_limits<float>::denorm_min(),
+                               -std::numeric_limits<float>::denorm_min()),
+              2);
+}
+
+TEST(CheckErr, Report)
+{
+    Tensor<float> ref(std::vector<std::size_t>{300, 1000});
+    Tensor<float> out(std::vector<std::size_t>{300, 1000});
+
+    for(std::size_t i = 0; i < ref.mData.size(); ++i)
+        ref.mData[i] = out.mData[i] = static_cast<float>(i % 97) + 1.f;
+
+    out(10, 20)   = std::nextafter(ref(10, 20), 1000.f);
+    out(200, 7)   = ref(200, 7) + 0.5f;
+    out(299, 999) = std::numeric_limits<float>::quiet_NaN();
+    out(5, 1)     = ref(5, 1) + 2.f;
+
+    for(std::size_t num_thread : {1, 3, 8})
+    {
+        CheckErrConfig config;
+        config.num_thread                = num_thread;
+        config.max_num_recorded_mismatch = 2;
+
+        const CheckErrReport report = ck::utils::check_err_report(out, ref, config);
+
+        EXPECT_FALSE(report.pass);
+        EXPECT_FALSE(report.exited_early);
+        EXPECT_EQ(report.num_checked, ref.mData.size());
+
+        // the one-ulp difference is within tolerance
+        EXPECT_EQ(report.num_mismatch, 3);
+
+        EXPECT_EQ(report.max_abs_err, 2.f);
+        EXPECT_EQ(report.max_abs_err_index, 5 * 1000 + 1);
+
+        // mismatches with the lowest indices, mapped back to coordinates
+        ASSERT_EQ(report.mismatches.size(), 2);
+        EXPECT_EQ(report.mismatches[0].multi_index, (std::vector<std::size_t>{5, 1}));
+        EXPECT_EQ(report.mismatches[1].multi_index, (std::vector<std::size_t>{200, 7}));
+        EXPECT_EQ(report.mismatches[1].out, ref(200, 7) + 0.5f);
+
+        EXPECT_EQ(report.ulp_histogram[0], ref.mData.size() - 4);
+        EXPECT_EQ(report.ulp_histogram[1], 1);
+        EXPECT_EQ(report.ulp_histogram[CheckErrReport::NumUlpBin - 1], 1);
+    }
+}
+
+TEST(CheckErr, EqualMaximaReportSmallestIndex)
+{
+    std::vector<float> ref(300000, 1.f);
+    std::vector<float> out(ref);
+
+    // equal errors in the ranges of different threads
+    for(std::size_t i : {250000, 10, 140000})
+    {
+        out[i]     = 3.f;
+        out[i + 1] = 1.5f;
+        ref[i + 1] = 0.5f;
+    }
+
+    for(std::size_t num_thread : {1, 3, 5})
+    {
+        CheckErrConfig config;
+        config.num_thread = num_thread;
+
+        const CheckErrReport report = ck::utils::check_err_report(out, ref, config);
+
+        EXPECT_EQ(report.max_abs_err, 2.f);
+        EXPECT_EQ(report.max_abs_err_index, 10) << num_thread << " threads";
+        EXPECT_EQ(report.max_rel_err, 2.f);
+        EXPECT_EQ(report.max_rel_err_index, 10) << num_thread << " threads";
+    }
+}
+
+TEST(CheckErr, ColumnMajorCoordinates)
+{
+    const HostTensorDescriptor desc{std::vector<std::size_t>{7, 9}, std::vector<std::size_t>{1, 7}};
+
+    Tensor<ck::half_t> ref(desc);
+    Tensor<ck::half_t> out(desc);
+
+    out(4, 6) = ck::type_convert<ck::half_t>(1.f);
+
+    const CheckErrReport report = ck::utils::check_err_report(out, ref);
+
+    ASSERT_EQ(report.mismatches.size(), 1);
+    EXPECT_EQ(report.mismatches[0].index, 4 + 6 * 7);
+    EXPECT_EQ(report.mismatches[0].multi_index, (std::vector<std::size_t>{4, 6}));
+}
+
+TEST(CheckErr, EarlyExit)
+{
+    std::vector<ck::bhalf_t> ref(1 << 20, ck::type_convert<ck::bhalf_t>(1.f));
+    std::vector<ck::bhalf_t> out(ref);
+
+    CheckErrConfig config = ck::utils::get_default_check_err_config<ck::bhalf_t>();
+
+    config.early_exit = true;
+
+    EXPECT_TRUE(ck::utils::check_err_report(out, ref, config).pass);
+
+    out[12345] = ck::type_convert<ck::bhalf_t>(3.f);
+
+    const CheckErrReport report = ck::utils::check_err_report(out, ref, config);
+
+    EXPECT_FALSE(report.pass);
+    EXPECT_TRUE(report.exited_early);
+    EXPECT_EQ(report.num_mismatch, 1);
+    EXPECT_LT(report.num_checked, ref.size());
+    ASSERT_EQ(report.mismatches.size(), 1);
+    EXPECT_EQ(report.mismatches[0].index, 12345);
+}
+
+TEST(CheckErr, BooleanInterface)
+{
+    const std::vector<float> ref{1.f, 2.f, 3.f};
+
+    EXPECT_TRUE(ck::utils::check_err(ref, ref));
+    EXPECT_FALSE(ck::utils::check_err(std::vector<float>{1.f, 2.f}, ref));
+    EXPECT_FALSE(ck::utils::check_err(std::vector<float>{1.f, 2.1f, 3.f}, ref));
+    EXPECT_TRUE(ck::utils::check_err(std::vector<float>{1.f, 2.1f, 3.f}, ref, "", 0, 0.2));
+    EXPECT_FALSE(ck::utils::check_err(
+        std::vector<float>{1.f, std::numeric_limits<float>::infinity(), 3.f}, ref, "", 0, 1e30));
+
+    EXPECT_TRUE(ck::utils::check_err(std::vector<int8_t>{1, 2}, std::vector<int8_t>{1, 2}));
+    EXPECT_FALSE(ck::utils::check_err(std::vector<int8_t>{1, 2}, std::vector<int8_t>{1, 3}));
+}
+
+TEST(CheckErr, LargeIntegersCompareExactly)
+{
+    // 2^53 and 2^53 + 1 are the same double
+    const int64_t big = int64_t{1} << 53;
+
+    EXPECT_FALSE(ck::utils::check_err(std::vector<int64_t>{big + 1}, std::vector<int64_t>{big}));
+    EXPECT_TRUE(
+        ck::utils::check_err(std::vector<int64_t>{big + 1}, std::vector<int64_t>{big + 1}));
+
+    // the tolerances of the config do not apply to integers
+    CheckErrConfig config;
+
+    config.rtol = 1;
+    config.atol = 1;
+
+    const std::vector<int32_t> out{2};
+    const std::vector<int32_t> ref{3};
+
+    EXPECT_FALSE(ck::utils::check_err_report(out, ref, config).pass);
+}
@@ -0,0 +1,339 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+#include "cost_model.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::BaseArgument;
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::TuningParams;
+using ck::utils::estimate_gemm_cost;
+using ck::utils::GemmCostProblem;
+using ck::utils::GemmCostTile;
+using ck::utils::GpuCostModelConfig;
+
+// tiles of fp16 xdl instances, with the LDS of their A and B blocks and their accumulator registers
+GemmCostTile make_fp16_tile(int64_t block_size, int64_t m, int64_t n, int64_t k)
+{
+    return GemmCostTile{block_size, m, n, k, (m + n) * k * 2, m * n / block_size};
+}
+
+GemmCostProblem make_fp16_problem(int64_t M, int64_t N, int64_t K)
+{
+    return GemmCostProblem{M, N, K, 1, 2, 2, 2};
+}
+
+struct FakeGemmOp : public BaseOperator
+{
+    FakeGemmOp(TuningParams params, bool supported)
+        : params_(std::move(params)), supported_(supported)
+    {
+    }
+
+    bool IsSupportedArgument(const BaseArgument*) override { return supported_; }
+    std::string GetTypeString() const override { return params_.GetName(); }
+    TuningParams GetTuningParams() const override { return params_; }
+
+    TuningParams params_;
+    bool supported_;
+};
+
+std::unique_ptr<BaseOperator>
+make_fake_op(const std::string& name, int64_t m, int64_t n, bool supported = true)
+{
+    TuningParams params(name);
+
+    params.Set("BlockSize", 256)
+        .Set("MPerBlock", m)
+        .Set("NPerBlock", n)
+        .Set("K0PerBlock", 4)
+        .Set("K1", 8)
+        .Set("LdsBytes", (m + n) * 32 * 2)
+        .Set("AccVgprs", m * n / 256);
+
+    return std::make_unique<FakeGemmOp>(std::move(params), supported);
+}
+
+} // namespace
+
+TEST(CostModel, PaddingWaste)
+{
+    const auto problem = make_fp16_problem(64, 64, 4096);
+
+    const auto large = estimate_gemm_cost(problem, make_fp16_tile(256, 256, 128, 32));
+    const auto small = estimate_gemm_cost(problem, make_fp16_tile(256, 64, 64, 32));
+
+    EXPECT_DOUBLE_EQ(large.padding_efficiency, 64. * 64 / (256 * 128));
+    EXPECT_DOUBLE_EQ(small.padding_efficiency, 1.);
+    EXPECT_LT(small.time_ms, large.time_ms);
+}
+
+TEST(CostModel, WaveQuantisation)
+{
+    GpuCostModelConfig config;
+    config.num_cu = 120;
+
+    // one workgroup per compute unit
+    GemmCostTile tile = make_fp16_tile(256, 128, 128, 32);
+    tile.lds_bytes    = 40000;
+
+    const auto full = estimate_gemm_cost(make_fp16_problem(128 * 120, 128, 4096), tile, 0, config);
+    const auto tail = estimate_gemm_cost(make_fp16_problem(128 * 121, 128, 4096), tile, 0, config);
+
+    EXPECT_EQ(full.occupancy, 1);
+    EXPECT_DOUBLE_EQ(full.wave_efficiency, 1.);
+    EXPECT_DOUBLE_EQ(tail.wave_efficiency, 121. / 240);
+
+    // the 121st tile takes a whole second round
+    EXPECT_GT(tail.time_ms, 1.9 * full.time_ms);
+
+    // a configured larger device runs both in one round
+    config.num_cu = 128;
+
+    const auto wide = estimate_gemm_cost(make_fp16_problem(128 * 121, 128, 4096), tile, 0, config);
+
+    EXPECT_LT(wide.time_ms, 1.1 * full.time_ms);
+}
+
+TEST(CostModel, Occupancy)
+{
+    const auto problem = make_fp16_problem(4096, 4096, 4096);
+
+    // 64 accumulators + 64 other registers allow 4 waves per SIMD, 4 workgroups of 4 waves
+    GemmCostTile tile = make_fp16_tile(256, 128, 128, 32);
+    EXPECT_EQ(estimate_gemm_cost(problem, tile).occupancy, 4);
+
+    // LDS limited
+    tile.lds_bytes = 32768;
+    EXPECT_EQ(estimate_gemm_cost(problem, tile).occupancy, 2);
+
+    // register limited
+    tile           = make_fp16_tile(256, 128, 128, 32);
+    tile.acc_vgprs = 192;
+    EXPECT_EQ(estimate_gemm_cost(problem, tile).occupancy, 2);
+
+    // does not fit
+    tile.lds_bytes = 65537;
+
+    const auto estimate = estimate_gemm_cost(problem, tile);
+
+    EXPECT_EQ(estimate.occupancy, 0);
+    EXPECT_TRUE(std::isinf(estimate.time_ms));
+}
+
+TEST(CostModel, ArithmeticIntensity)
+{
+    const auto square = make_fp16_problem(4096, 4096, 4096);
+
+    const auto large = estimate_gemm_cost(square, make_fp16_tile(256, 256, 128, 32));
+    const auto small = estimate_gemm_cost(square, make_fp16_tile(256, 64, 64, 32));
+
+    EXPECT_GT(large.arithmetic_intensity, small.arithmetic_intensity);
+    EXPECT_TRUE(large.compute_bound);
+    EXPECT_LT(large.time_ms, small.time_ms);
+
+    // a tall and skinny GEMM streams A from DRAM
+    const auto skinny =
+        estimate_gemm_cost(make_fp16_problem(65536, 64, 4096), make_fp16_tile(256, 64, 64, 32));
+
+    EXPECT_FALSE(skinny.compute_bound);
+}
+
+TEST(CostModel, SplitK)
+{
+    // a split-K grid fills the device with a problem of few output tiles
+    const auto problem = make_fp16_problem(256, 256, 65536);
+    const auto tile    = make_fp16_tile(256, 128, 128, 32);
+
+    const auto single = estimate_gemm_cost(problem, tile);
+    const auto split  = estimate_gemm_cost(problem, tile, 4 * 32);
+
+    EXPECT_LT(split.time_ms, single.time_ms / 8);
+}
+
+TEST(CostModel, TileFromTuningParams)
+{
+    TuningParams params("Op");
+
+    EXPECT_FALSE(GemmCostTile::FromTuningParams(params).has_value());
+
+    params.Set("BlockSize", 256).Set("MPerBlock", 256).Set("NPerBlock", 128);
+
+    EXPECT_FALSE(GemmCostTile::FromTuningParams(params).has_value());
+
+    params.Set("K0PerBlock", 4).Set("K1", 8).Set("LdsBytes", 1024);
+
+    const auto tile = GemmCostTile::FromTuningParams(params);
+
+    ASSERT_TRUE(tile.has_value());
+    EXPECT_EQ(tile->k_per_block, 32);
+    EXPECT_EQ(tile->lds_bytes, 1024);
+    EXPECT_EQ(tile->acc_vgprs, 0);
+
+    params.Set("KPerBlock", 64);
+
+    EXPECT_EQ(GemmCostTile::FromTuningParams(params)->k_per_block, 64);
+}
+
+TEST(CostModel, SelectBestPredicted)
+{
+    std::vector<std::unique_ptr<BaseOperator>> op_ptrs;
+
+    op_ptrs.push_back(make_fake_op("256x128", 256, 128));
+    op_ptrs.push_back(make_fake_op("unsupported", 64, 64, false));
+    op_ptrs.push_back(make_fake_op("128x128", 128, 128));
+    op_ptrs.push_back(std::make_unique<FakeGemmOp>(TuningParams("not a gemm"), true));
+    op_ptrs.push_back(make_fake_op("64x64", 64, 64));
+
+    const auto problem       = make_fp16_problem(64, 64, 4096);
+    const auto make_argument = [](BaseOperator*) { return std::make_unique<BaseArgument>(); };
+
+    const auto all = ck::utils::select_best_predicted_instances(
+        op_ptrs, problem, 0, make_argument, GpuCostModelConfig{});
+
+    EXPECT_EQ(all, (std::vector<std::size_t>{3, 4, 2, 0}));
+
+    const auto best = ck::utils::select_best_predicted_instances(
+        op_ptrs, problem, 1, make_argument, GpuCostModelConfig{});
+
+    EXPECT_EQ(best, (std::vector<std::size_t>{3, 4}));
+}
+
+TEST(CostModel, RankCorrelation)
+{
+    const std::vector<double> x{1, 2, 3, 4, 5};
+
+    EXPECT_DOUBLE_EQ(ck::utils::get_rank_correlation(x, {10, 20, 30, 40, 50}), 1.);
+    EXPECT_DOUBLE_EQ(ck::utils::get_rank_correlation(x, {5, 4, 3, 2, 1}), -1.);
+    EXPECT_DOUBLE_EQ(ck::utils::get_rank_correlation(x, {1, 1, 1, 1, 1}), 0.);
+
+    // tied values get their average rank: ranks of y are 0, 2, 2, 2, 4
+    EXPECT_NEAR(
+        ck::utils::get_rank_correlation(x, {1, 7, 7, 7, 9}), 8. / std::sqrt(10. * 8), 1e-12);
+}
+
+TEST(CostModel, ExtractTopKArg)
+{
+    char a0[] = "ckProfiler", a1[] = "gemm", a2[] = "--top-k", a3[] = "8", a4[] = "1";
+    char* argv[] = {a0, a1, a2, a3, a4, nullptr};
+    int argc     = 5;
+
+    EXPECT_EQ(ck::utils::extract_top_k_arg(argc, argv), 8);
+    EXPECT_EQ(argc, 3);
+    EXPECT_STREQ(argv[2], "1");
+    EXPECT_EQ(argv[3], nullptr);
+
+    EXPECT_EQ(ck::utils::extract_top_k_arg(argc, argv), 0);
+    EXPECT_EQ(argc, 3);
+}
+
+TEST(CostModel, TimingTableRoundTrip)
+{
+    char path[] = "/tmp/ck_cost_model_XXXXXX";
+
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    std::remove(path);
+
+    const ck::utils::GemmTimingRecord record{
+        "DeviceGemmXdl<256, 256, 128, 4, 8>",
+        make_fp16_problem(3840, 4096, 4096),
+        make_fp16_tile(256, 256, 128, 32),
+        480,
+        0.25};
+
+    ck::utils::append_gemm_timing_record(path, record);
+    ck::utils::append_gemm_timing_record(path, record);
+
+    std::ifstream file(path);
+
+    const auto records = ck::utils::load_gemm_timing_records(file);
+
+    std::remove(path);
+
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[1].instance, record.instance);
+    EXPECT_EQ(records[1].problem.M, 3840);
+    EXPECT_EQ(records[1].tile.m_per_block, 256);
+    EXPECT_EQ(records[1].tile.lds_bytes, record.tile.lds_bytes);
+    EXPECT_EQ(records[1].grid_size, 480);
+    EXPECT_DOUBLE_EQ(records[1].avg_time, 0.25);
+}
+
+// Rank correlation of predicted and measured times on the timing tables named by
+// CK_COST_MODEL_TIMINGS (colon separated), as written by ckProfiler with the variable set.
+TEST(CostModel, RecordedTimingTables)
+{
+    const char* env = std::getenv("CK_COST_MODEL_TIMINGS");
+
+    if(env == nullptr)
+        GTEST_SKIP() << "CK_COST_MODEL_TIMINGS is not set";
+
+    using ProblemKey = std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t>;
+
+    std::map<ProblemKey, std::vector<ck::utils::GemmTimingRecord>> problems;
+
+    std::istringstream paths(env);
+
+    for(std::string path; std::getline(paths, path, ':');)
+    {
+        std::ifstream file(path);
+
+        ASSERT_TRUE(file) << "failed to open " << path;
+
+        for(auto& r : ck::utils::load_gemm_timing_records(file))
+        {
+            const ProblemKey key{
+                r.problem.M, r.problem.N, r.problem.K, r.problem.batch, r.problem.a_element_size};
+
+            problems[key].push_back(std::move(r));
+        }
+    }
+
+    const auto config = GpuCostModelConfig::GetDefault();
+
+    double sum_correlation = 0;
+    int num_problem        = 0;
+
+    for(const auto& problem : problems)
+    {
+        if(problem.second.size() < 4)
+            continue;
+
+        std::vector<double> predicted;
+        std::vector<double> measured;
+
+        for(const auto& r : problem.second)
+        {
+            predicted.push_back(estimate_gemm_cost(r.problem, r.tile, r.grid_size, config).time_ms);
+            measured.push_back(r.avg_time);
+        }
+
+        const double correlation = ck::utils::get_rank_correlation(predicted, measured);
+
+        std::cout << "M " << std::get<0>(problem.first) << " N " << std::get<1>(problem.first)
+                  << " K " << std::get<2>(problem.first) << ": " << problem.second.size()
+                  << " instances, rank correlation " << correlation << std::endl;
+
+        EXPECT_GT(correlation, 0.);
+
+        sum_correlation += correlation;
+        ++num_problem;
+    }
+
+    ASSERT_GT(num_problem, 0) << "no problem with at least 4 timed instances";
+    EXPECT_GT(sum_correlation / num_problem, 0.5);
+}
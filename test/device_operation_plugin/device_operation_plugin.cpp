@@ -0,0 +1,115 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include <dlfcn.h>
+#include <unistd.h>
+
+#include "device_operation_plugin.hpp"
+#include "fake_device_operation.hpp"
+
+using ck::tensor_operation::device::DeviceOperationKey;
+using ck::tensor_operation::device::DeviceOperationPluginLoader;
+
+namespace {
+
+const std::string plugin_dir = FAKE_PLUGIN_DIR;
+
+bool any_key(const DeviceOperationKey&) { return true; }
+
+// whether the process has mapped the shared object, without loading it
+bool is_mapped(const std::string& path)
+{
+    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_NOLOAD);
+
+    if(handle == nullptr)
+        return false;
+
+    dlclose(handle);
+
+    return true;
+}
+
+} // namespace
+
+TEST(DeviceOperationPlugin, LoadsOnFirstQuery)
+{
+    DeviceOperationPluginLoader loader(plugin_dir);
+
+    EXPECT_EQ(loader.GetPluginNames(), (std::vector<std::string>{"fake_f16", "fake_f32"}));
+    EXPECT_FALSE(loader.IsLoaded("fake_f16"));
+    EXPECT_FALSE(loader.IsLoaded("fake_f32"));
+    EXPECT_FALSE(is_mapped(plugin_dir + "/libck_fake_f16.so"));
+
+    const auto registry = loader.GetRegistry<fake::DeviceFakePtr>("fake", "f16");
+
+    ASSERT_EQ(registry.GetGroups().size(), 1);
+    EXPECT_EQ(registry.GetGroups()[0].first.data_type, "f16");
+
+    const auto op_ptrs = registry.Make(any_key);
+
+    ASSERT_EQ(op_ptrs.size(), 2);
+    EXPECT_EQ(op_ptrs[0]->GetTileSize(), 64);
+    EXPECT_EQ(op_ptrs[1]->GetTileSize(), 128);
+
+    EXPECT_TRUE(loader.IsLoaded("fake_f16"));
+    EXPECT_TRUE(is_mapped(plugin_dir + "/libck_fake_f16.so"));
+
+    // only the plugin queried
+    EXPECT_FALSE(loader.IsLoaded("fake_f32"));
+    EXPECT_FALSE(is_mapped(plugin_dir + "/libck_fake_f32.so"));
+}
+
+TEST(DeviceOperationPlugin, QueriesLoadOnce)
+{
+    DeviceOperationPluginLoader loader(plugin_dir);
+
+    const auto a = loader.GetRegistry<fake::DeviceFakePtr>("fake", "f32");
+    const auto b = loader.GetRegistry<fake::DeviceFakePtr>("fake", "f32");
+
+    ASSERT_EQ(a.GetGroups().size(), 1);
+    ASSERT_EQ(b.GetGroups().size(), 1);
+    EXPECT_EQ(a.GetGroups()[0].second, b.GetGroups()[0].second);
+
+    const auto factories = b.Find(any_key);
+
+    ASSERT_EQ(factories.size(), 2);
+    EXPECT_EQ(factories[0].GetTypeString(), "DeviceFakeImpl<32>");
+    EXPECT_EQ(factories[1].GetTypeString(), "DeviceFakeImpl<64>");
+}
+
+TEST(DeviceOperationPlugin, NoPlugin)
+{
+    DeviceOperationPluginLoader loader(plugin_dir);
+
+    EXPECT_FALSE(loader.HasPlugin("fake_bf16"));
+    EXPECT_TRUE(loader.GetRegistry<fake::DeviceFakePtr>("fake", "bf16").GetGroups().empty());
+
+    DeviceOperationPluginLoader no_dir_loader(plugin_dir + "/none");
+
+    EXPECT_TRUE(no_dir_loader.GetPluginNames().empty());
+}
+
+TEST(DeviceOperationPlugin, BadPluginThrows)
+{
+    char dir[] = "/tmp/ck_plugin_XXXXXX";
+
+    ASSERT_NE(mkdtemp(dir), nullptr);
+
+    const std::string path = std::string(dir) + "/libck_bad_f16.so";
+
+    std::ofstream(path) << "not a shared object";
+
+    DeviceOperationPluginLoader loader(dir);
+
+    EXPECT_TRUE(loader.HasPlugin("bad_f16"));
+    EXPECT_THROW(loader.GetRegistry<fake::DeviceFakePtr>("bad", "f16"), std::runtime_error);
+    EXPECT_FALSE(loader.IsLoaded("bad_f16"));
+
+    std::remove(path.c_str());
+    rmdir(dir);
+}
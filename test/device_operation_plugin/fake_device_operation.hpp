@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "device_base.hpp"
+
+// A device operation interface shared by the test and its plugins. It is not in an anonymous
+// namespace, so the plugins and the test agree on its type.
+namespace fake {
+
+struct DeviceFake : public ck::tensor_operation::device::BaseOperator
+{
+    virtual int GetTileSize() const = 0;
+};
+
+using DeviceFakePtr = std::unique_ptr<DeviceFake>;
+
+template <int TileSize>
+struct DeviceFakeImpl : public DeviceFake
+{
+    int GetTileSize() const override { return TileSize; }
+
+    std::string GetTypeString() const override
+    {
+        return "DeviceFakeImpl<" + std::to_string(TileSize) + ">";
+    }
+};
+
+} // namespace fake
@@ -0,0 +1,31 @@
+#include <tuple>
+
+#include "device_operation_plugin.hpp"
+#include "fake_device_operation.hpp"
+
+// built once per data type, with FAKE_DATA_TYPE and FAKE_TILE_SIZE defined
+
+using ck::tensor_operation::device::DeviceOperationFactories;
+using ck::tensor_operation::device::DeviceOperationPluginRegistrar;
+using ck::tensor_operation::device::DeviceOperationRegistry;
+
+namespace {
+
+using fake_instances =
+    std::tuple<fake::DeviceFakeImpl<FAKE_TILE_SIZE>, fake::DeviceFakeImpl<2 * FAKE_TILE_SIZE>>;
+
+void add_fake_factories(DeviceOperationFactories<fake::DeviceFakePtr>& factories)
+{
+    add_device_operation_instances(factories, fake_instances{});
+}
+
+} // namespace
+
+extern "C" void CK_DEVICE_OPERATION_PLUGIN_ENTRY(DeviceOperationPluginRegistrar& registrar)
+{
+    DeviceOperationRegistry<fake::DeviceFakePtr> registry;
+
+    registry.Add({"fake", "xdl", FAKE_DATA_TYPE, "mk", "PassThrough"}, add_fake_factories);
+
+    registrar.Add(registry);
+}
@@ -0,0 +1,123 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "config.hpp"
+#include "device_base.hpp"
+#include "device_operation_registry.hpp"
+
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::DeviceOperationFactories;
+using ck::tensor_operation::device::DeviceOperationKey;
+using ck::tensor_operation::device::DeviceOperationRegistry;
+using ck::tensor_operation::device::TuningParams;
+
+namespace {
+
+// instances alive
+int num_instances = 0;
+
+struct DeviceFake : public BaseOperator
+{
+    virtual int GetTileSize() const = 0;
+};
+
+using DeviceFakePtr = std::unique_ptr<DeviceFake>;
+
+template <int TileSize>
+struct DeviceFakeImpl : public DeviceFake
+{
+    DeviceFakeImpl() { ++num_instances; }
+    DeviceFakeImpl(const DeviceFakeImpl&) : DeviceFake() { ++num_instances; }
+    ~DeviceFakeImpl() override { --num_instances; }
+
+    int GetTileSize() const override { return TileSize; }
+
+    std::string GetTypeString() const override
+    {
+        return "DeviceFakeImpl<" + std::to_string(TileSize) + ">";
+    }
+
+    TuningParams GetTuningParams() const override
+    {
+        return TuningParams{"DeviceFakeImpl"}.Set("TileSize", TileSize);
+    }
+};
+
+using fake_f16_instances = std::tuple<DeviceFakeImpl<64>, DeviceFakeImpl<128>, DeviceFakeImpl<256>>;
+using fake_f32_instances = std::tuple<DeviceFakeImpl<32>, DeviceFakeImpl<64>>;
+
+void add_fake_f16_factories(DeviceOperationFactories<DeviceFakePtr>& factories)
+{
+    add_device_operation_instances(factories, fake_f16_instances{});
+}
+
+void add_fake_f32_factories(DeviceOperationFactories<DeviceFakePtr>& factories)
+{
+    add_device_operation_instances(factories, fake_f32_instances{});
+}
+
+DeviceOperationRegistry<DeviceFakePtr> make_registry()
+{
+    DeviceOperationRegistry<DeviceFakePtr> registry;
+
+    registry.Add({"fake", "xdl", "f16", "mk", "PassThrough"}, add_fake_f16_factories)
+        .Add({"fake", "xdl", "f32", "mk", "PassThrough"}, add_fake_f32_factories);
+
+    return registry;
+}
+
+} // namespace
+
+TEST(DeviceOperationRegistry, FindKeepsNoInstances)
+{
+    const auto registry = make_registry();
+
+    const auto factories =
+        registry.Find([](const DeviceOperationKey& key) { return key.data_type == "f16"; });
+
+    ASSERT_EQ(factories.size(), 3);
+    EXPECT_EQ(factories[1].GetTypeString(), "DeviceFakeImpl<128>");
+    EXPECT_EQ(factories[2].GetTuningParams().Get("TileSize"), 256);
+
+    // type strings and tuning parameters come from temporaries
+    EXPECT_EQ(num_instances, 0);
+
+    const auto all = registry.Find([](const DeviceOperationKey&) { return true; });
+
+    EXPECT_EQ(all.size(), 5);
+    EXPECT_EQ(registry.GetGroups().size(), 2);
+}
+
+TEST(DeviceOperationRegistry, MakesSelectedInstances)
+{
+    const auto registry = make_registry();
+
+    const auto instances = registry.Make(
+        [](const DeviceOperationKey& key) { return key.op == "fake"; },
+        [](const auto& factory) { return factory.GetTuningParams().Get("TileSize") == 64; });
+
+    ASSERT_EQ(instances.size(), 2);
+    EXPECT_EQ(instances[0]->GetTileSize(), 64);
+    EXPECT_EQ(instances[1]->GetTileSize(), 64);
+
+    EXPECT_EQ(num_instances, 2);
+
+    const auto one = registry.Find(
+        [](const DeviceOperationKey& key) { return key.data_type == "f32"; })[0].Make();
+
+    EXPECT_EQ(one->GetTileSize(), 32);
+    EXPECT_EQ(num_instances, 3);
+}
+
+TEST(DeviceOperationRegistry, ConstructsAllForAddInstances)
+{
+    std::vector<DeviceFakePtr> instances;
+
+    construct_device_operation_instances(instances, add_fake_f32_factories);
+
+    ASSERT_EQ(instances.size(), 2);
+    EXPECT_EQ(instances[0]->GetTypeString(), "DeviceFakeImpl<32>");
+    EXPECT_EQ(instances[1]->GetTypeString(), "DeviceFakeImpl<64>");
+}
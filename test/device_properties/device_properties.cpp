@@ -0,0 +1,122 @@
+#include <atomic>
+#include <memory>
+#include "gtest/gtest.h"
+
+#include "device_properties.hpp"
+
+namespace {
+
+// MI100-like: 120 CUs of 40 waves of 64 threads and 64 KiB of LDS
+DeviceProperties make_test_properties()
+{
+    DeviceProperties props;
+
+    props.name                  = "test";
+    props.num_cu                = 120;
+    props.warp_size             = 64;
+    props.max_threads_per_block = 1024;
+    props.max_waves_per_cu      = 40;
+    props.lds_per_cu            = 65536;
+    props.max_lds_per_block     = 65536;
+    props.l2_size               = 8 << 20;
+
+    return props;
+}
+
+struct CountingDevicePropertiesProvider : public FakeDevicePropertiesProvider
+{
+    using FakeDevicePropertiesProvider::FakeDevicePropertiesProvider;
+
+    DeviceProperties GetDeviceProperties(int device) const override
+    {
+        num_query++;
+
+        auto props   = FakeDevicePropertiesProvider::GetDeviceProperties(device);
+        props.num_cu = props.num_cu + device;
+
+        return props;
+    }
+
+    mutable std::atomic<int> num_query{0};
+};
+
+} // namespace
+
+TEST(DeviceProperties, QueriedOncePerDevice)
+{
+    auto provider = std::make_shared<CountingDevicePropertiesProvider>(make_test_properties());
+
+    ScopedDevicePropertiesProvider scoped(provider);
+
+    EXPECT_EQ(get_device_properties().num_cu, 120);
+    EXPECT_EQ(get_device_properties(0).num_cu, 120);
+    EXPECT_EQ(provider->num_query, 1);
+
+    EXPECT_EQ(get_device_properties(1).num_cu, 121);
+    EXPECT_EQ(get_device_properties(1).num_cu, 121);
+    EXPECT_EQ(provider->num_query, 2);
+}
+
+TEST(DeviceProperties, ProviderChangeDropsCache)
+{
+    auto props = make_test_properties();
+
+    ScopedDevicePropertiesProvider outer(std::make_shared<FakeDevicePropertiesProvider>(props));
+
+    EXPECT_EQ(get_device_properties().num_cu, 120);
+
+    props.num_cu = 60;
+
+    {
+        ScopedDevicePropertiesProvider inner(std::make_shared<FakeDevicePropertiesProvider>(props));
+
+        EXPECT_EQ(get_device_properties().num_cu, 60);
+    }
+
+    EXPECT_EQ(get_device_properties().num_cu, 120);
+}
+
+TEST(DeviceProperties, MaxActiveBlocksPerCu)
+{
+    const auto props = make_test_properties();
+
+    // limited by waves: 40 waves of 1, 2, 4 or 16 waves a block
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 64, 0), 40);
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 128, 0), 20);
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 256, 0), 10);
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 1024, 0), 2);
+    // a partial wave takes a whole one
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 200, 0), 10);
+
+    // limited by LDS
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 256, 16384), 4);
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 256, 65536), 1);
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 256, 20000), 3);
+    // LDS to spare, limited by waves again
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 256, 1024), 10);
+
+    // does not fit
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 0, 0), 0);
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 2048, 0), 0);
+    EXPECT_EQ(get_max_active_blocks_per_cu(props, 256, 65537), 0);
+}
+
+TEST(DeviceProperties, PersistentGridSize)
+{
+    const auto props = make_test_properties();
+
+    // 120 CUs of 10 blocks of 256 threads
+    EXPECT_EQ(get_persistent_grid_size(props, 256, 0, 1 << 20), 1200);
+    // 4 blocks by LDS
+    EXPECT_EQ(get_persistent_grid_size(props, 256, 16384, 1 << 20), 480);
+    // no more blocks than work
+    EXPECT_EQ(get_persistent_grid_size(props, 256, 0, 100), 100);
+    // at least one
+    EXPECT_EQ(get_persistent_grid_size(props, 256, 0, 0), 1);
+    // a block that does not fit still gets one per CU, for the launch to report the error
+    EXPECT_EQ(get_persistent_grid_size(props, 2048, 0, 1 << 20), 120);
+
+    ScopedDevicePropertiesProvider scoped(std::make_shared<FakeDevicePropertiesProvider>(props));
+
+    EXPECT_EQ(get_persistent_grid_size(256, 0, 1 << 20), 1200);
+}
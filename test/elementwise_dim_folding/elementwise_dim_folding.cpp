@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "config.hpp"
+#include "elementwise_dim_folding.hpp"
+#include "reference_elementwise.hpp"
+
+using ck::index_t;
+using ck::tensor_operation::device::fold_elementwise_dims;
+using ck::tensor_operation::device::get_elementwise_vector_size;
+
+namespace {
+
+// y = relu((x + bias + residual) * scale)
+struct AddAddScaleRelu
+{
+    void operator()(
+        float& y, const float& x, const float& bias, const float& res, const float& scale) const
+    {
+        y = std::max((x + bias + res) * scale, 0.f);
+    }
+};
+
+using ReferenceAddAddScaleRelu =
+    ck::tensor_operation::host::ReferenceElementwise<ck::Tuple<float, float, float, float>,
+                                                     ck::Tuple<float>,
+                                                     float,
+                                                     AddAddScaleRelu>;
+
+void run_reference(const std::vector<float>& x,
+                   const std::vector<float>& bias,
+                   const std::vector<float>& residual,
+                   const std::vector<float>& scale,
+                   std::vector<float>& y,
+                   const std::vector<index_t>& lengths,
+                   const std::array<std::vector<index_t>, 4>& in_strides,
+                   const std::vector<index_t>& out_strides)
+{
+    auto invoker  = ReferenceAddAddScaleRelu::MakeInvoker();
+    auto argument = ReferenceAddAddScaleRelu::MakeArgument(
+        {x.data(), bias.data(), residual.data(), scale.data()},
+        {y.data()},
+        lengths,
+        in_strides,
+        {out_strides},
+        AddAddScaleRelu{});
+
+    invoker.Run(argument);
+}
+
+} // namespace
+
+TEST(ElementwiseDimFolding, FoldsPackedTensors)
+{
+    const auto folded = fold_elementwise_dims({2, 3, 4}, {{12, 4, 1}, {12, 4, 1}});
+
+    EXPECT_EQ(folded.lengths, (std::vector<index_t>{24}));
+    EXPECT_EQ(folded.strides[0], (std::vector<index_t>{1}));
+    EXPECT_EQ(folded.strides[1], (std::vector<index_t>{1}));
+}
+
+TEST(ElementwiseDimFolding, DropsUnitDims)
+{
+    const auto folded = fold_elementwise_dims({1, 5, 1}, {{5, 1, 1}, {0, 2, 7}});
+
+    EXPECT_EQ(folded.lengths, (std::vector<index_t>{5}));
+    EXPECT_EQ(folded.strides[0], (std::vector<index_t>{1}));
+    EXPECT_EQ(folded.strides[1], (std::vector<index_t>{2}));
+
+    const auto scalar = fold_elementwise_dims({1, 1}, {{1, 1}});
+
+    EXPECT_EQ(scalar.lengths, (std::vector<index_t>{1}));
+    EXPECT_EQ(scalar.strides[0], (std::vector<index_t>{1}));
+}
+
+TEST(ElementwiseDimFolding, FoldsBroadcastDims)
+{
+    // bias of the innermost dimension broadcast over the two outer ones
+    const auto folded = fold_elementwise_dims({8, 16, 32}, {{512, 32, 1}, {0, 0, 1}});
+
+    EXPECT_EQ(folded.lengths, (std::vector<index_t>{128, 32}));
+    EXPECT_EQ(folded.strides[0], (std::vector<index_t>{32, 1}));
+    EXPECT_EQ(folded.strides[1], (std::vector<index_t>{0, 1}));
+
+    // per-row scale broadcast along the innermost dimension
+    const auto rows = fold_elementwise_dims({8, 16, 32}, {{512, 32, 1}, {16, 1, 0}});
+
+    EXPECT_EQ(rows.lengths, (std::vector<index_t>{128, 32}));
+    EXPECT_EQ(rows.strides[1], (std::vector<index_t>{1, 0}));
+}
+
+TEST(ElementwiseDimFolding, KeepsPaddedRows)
+{
+    const auto folded = fold_elementwise_dims({4, 32}, {{40, 1}, {32, 1}});
+
+    EXPECT_EQ(folded.lengths, (std::vector<index_t>{4, 32}));
+    EXPECT_EQ(folded.strides[0], (std::vector<index_t>{40, 1}));
+    EXPECT_EQ(folded.strides[1], (std::vector<index_t>{32, 1}));
+}
+
+TEST(ElementwiseDimFolding, VectorSizePerTensor)
+{
+    EXPECT_EQ(get_elementwise_vector_size({128, 32}, {32, 1}, 8), 8);
+    EXPECT_EQ(get_elementwise_vector_size({128, 32}, {0, 1}, 8), 8);
+    EXPECT_EQ(get_elementwise_vector_size({128, 32}, {1, 0}, 8), 1);
+    EXPECT_EQ(get_elementwise_vector_size({128, 30}, {30, 1}, 8), 2);
+    EXPECT_EQ(get_elementwise_vector_size({128, 32}, {36, 1}, 8), 4);
+    EXPECT_EQ(get_elementwise_vector_size({4, 32}, {1, 4}, 8), 1);
+}
+
+TEST(ReferenceElementwise, BroadcastInputs)
+{
+    const index_t N = 2, H = 3, W = 4;
+
+    std::vector<float> x(N * H * W), residual(N * H * W), bias(W), scale(N * H), y(N * H * W);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i]        = static_cast<float>(i) - 10;
+        residual[i] = static_cast<float>(i % 5);
+    }
+
+    for(std::size_t i = 0; i < bias.size(); ++i)
+        bias[i] = 0.5f * i;
+
+    for(std::size_t i = 0; i < scale.size(); ++i)
+        scale[i] = 1.f + i;
+
+    run_reference(x,
+                  bias,
+                  residual,
+                  scale,
+                  y,
+                  {N, H, W},
+                  {{{H * W, W, 1}, {0, 0, 1}, {H * W, W, 1}, {H, 1, 0}}},
+                  {H * W, W, 1});
+
+    for(index_t n = 0; n < N; ++n)
+        for(index_t h = 0; h < H; ++h)
+            for(index_t w = 0; w < W; ++w)
+            {
+                const index_t i = (n * H + h) * W + w;
+
+                EXPECT_EQ(y[i], std::max((x[i] + bias[w] + residual[i]) * scale[n * H + h], 0.f));
+            }
+}
+
+TEST(ReferenceElementwise, FoldedProblemMatches)
+{
+    const std::vector<index_t> lengths{3, 1, 5, 8};
+    const std::array<std::vector<index_t>, 4> in_strides{
+        {{40, 40, 8, 1}, {0, 0, 0, 1}, {40, 40, 8, 1}, {5, 5, 1, 0}}};
+    const std::vector<index_t> out_strides{40, 40, 8, 1};
+
+    std::vector<float> x(120), residual(120), bias(8), scale(15);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i]        = static_cast<float>(i % 13) - 6;
+        residual[i] = static_cast<float>(i % 7) * 0.25f;
+    }
+
+    for(std::size_t i = 0; i < bias.size(); ++i)
+        bias[i] = -1.f + i;
+
+    for(std::size_t i = 0; i < scale.size(); ++i)
+        scale[i] = 0.5f * i;
+
+    std::vector<float> y(120, -1), y_folded(120, -2);
+
+    run_reference(x, bias, residual, scale, y, lengths, in_strides, out_strides);
+
+    auto strides = std::vector<std::vector<index_t>>(in_strides.begin(), in_strides.end());
+    strides.push_back(out_strides);
+
+    const auto folded = fold_elementwise_dims(lengths, strides);
+
+    ASSERT_EQ(folded.lengths, (std::vector<index_t>{15, 8}));
+
+    run_reference(x,
+                  bias,
+                  residual,
+                  scale,
+                  y_folded,
+                  folded.lengths,
+                  {{folded.strides[0], folded.strides[1], folded.strides[2], folded.strides[3]}},
+                  folded.strides[4]);
+
+    EXPECT_EQ(y, y_folded);
+}
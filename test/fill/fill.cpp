@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "data_type.hpp"
+#include "fill.hpp"
+#include "host_philox.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+
+namespace {
+
+template <typename T>
+double to_double(T v)
+{
+    if constexpr(std::is_same<T, ck::bhalf_t>::value)
+        return ck::type_convert<float>(v);
+    else
+        return static_cast<double>(v);
+}
+
+template <typename T>
+void get_mean_and_variance(const std::vector<T>& data, double& mean, double& variance)
+{
+    mean     = 0;
+    variance = 0;
+
+    for(const T& v : data)
+        mean += to_double(v);
+
+    mean /= data.size();
+
+    for(const T& v : data)
+        variance += (to_double(v) - mean) * (to_double(v) - mean);
+
+    variance /= data.size();
+}
+
+// a forward iterator over an array that throws when it is stepped past the end
+struct CheckedForwardIterator
+{
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = float;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = float*;
+    using reference         = float&;
+
+    float& operator*() const { return *p; }
+
+    CheckedForwardIterator& operator++()
+    {
+        if(p == end)
+            throw std::out_of_range("iterator stepped past the end");
+
+        ++p;
+
+        return *this;
+    }
+
+    CheckedForwardIterator operator++(int)
+    {
+        auto old = *this;
+        ++*this;
+        return old;
+    }
+
+    bool operator==(const CheckedForwardIterator& other) const { return p == other.p; }
+    bool operator!=(const CheckedForwardIterator& other) const { return p != other.p; }
+
+    float* p;
+    float* end;
+};
+
+} // anonymous namespace
+
+TEST(Philox4x32, KnownAnswer)
+{
+    // test vectors of the reference implementation (Random123 kat_vectors)
+    EXPECT_EQ(Philox4x32::Generate(0, {0, 0, 0, 0}),
+              (Philox4x32::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(Philox4x32::Generate(0xffffffffffffffff,
+                                   {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}),
+              (Philox4x32::Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(Philox4x32::Generate(0x299f31d0a4093822,
+                                   {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}),
+              (Philox4x32::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(Philox4x32, WordsDoNotDependOnSplit)
+{
+    const std::size_t n = 4 * 1000;
+
+    std::vector<uint32_t> whole(n), pieces(n);
+
+    Philox4x32::GenerateWords(42, 3, 0, n, whole.data());
+
+    for(std::size_t begin = 0; begin < n; begin += 36)
+        Philox4x32::GenerateWords(
+            42, 3, begin, std::min<std::size_t>(36, n - begin), &pieces[begin]);
+
+    EXPECT_EQ(whole, pieces);
+
+    for(std::size_t b = 0; b < n / 4; b += 97)
+    {
+        const auto r = Philox4x32::Generate(42, {static_cast<uint32_t>(b), 0, 3, 0});
+
+        EXPECT_TRUE(std::equal(r.begin(), r.end(), &whole[4 * b])) << "block " << b;
+    }
+}
+
+TEST(Fill, SameResultForAnyIterator)
+{
+    // the vector is filled in parallel, the list serially
+    const std::size_t n = 100003;
+
+    std::vector<float> v(n);
+    std::list<float> l(n);
+
+    ck::utils::FillNormal<float>{1.f, 2.f, 7}(v.begin(), v.end());
+    ck::utils::FillNormal<float>{1.f, 2.f, 7}(l.begin(), l.end());
+
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), l.begin()));
+
+    std::vector<float> w(n);
+
+    ck::utils::FillNormal<float>{1.f, 2.f, 8}(w.begin(), w.end());
+
+    EXPECT_NE(v, w);
+}
+
+TEST(Fill, ForwardIteratorStaysInRange)
+{
+    // not a multiple of the chunk size, the last chunk is short
+    const std::size_t n = 2500;
+
+    std::vector<float> v(n), w(n);
+
+    ck::utils::FillUniform<float>{-1.f, 1.f, 5}(v.begin(), v.end());
+
+    float* const end = w.data() + n;
+
+    EXPECT_NO_THROW((ck::utils::FillUniform<float>{-1.f, 1.f, 5}(
+        CheckedForwardIterator{w.data(), end}, CheckedForwardIterator{end, end})));
+
+    EXPECT_EQ(v, w);
+}
+
+TEST(Fill, Uniform)
+{
+    std::vector<float> v(1 << 20);
+
+    ck::utils::FillUniform<float>{-1.f, 3.f}(v.begin(), v.end());
+
+    double mean, variance;
+    get_mean_and_variance(v, mean, variance);
+
+    EXPECT_GE(*std::min_element(v.begin(), v.end()), -1.f);
+    EXPECT_LT(*std::max_element(v.begin(), v.end()), 3.f);
+    EXPECT_NEAR(mean, 1.0, 0.01);
+    EXPECT_NEAR(variance, 16.0 / 12.0, 0.01);
+
+    std::vector<ck::bhalf_t> b(1 << 16);
+
+    ck::utils::FillUniform<ck::bhalf_t>{-1.f, 3.f}(b.begin(), b.end());
+
+    get_mean_and_variance(b, mean, variance);
+
+    EXPECT_NEAR(mean, 1.0, 0.05);
+}
+
+TEST(Fill, UniformInteger)
+{
+    std::vector<int8_t> v(1 << 16);
+
+    ck::utils::FillUniformInteger<int8_t>{-5, 5}(v.begin(), v.end());
+
+    std::vector<std::size_t> count(10, 0);
+
+    for(int8_t x : v)
+    {
+        ASSERT_GE(x, -5);
+        ASSERT_LT(x, 5);
+
+        count[x + 5]++;
+    }
+
+    for(std::size_t c : count)
+        EXPECT_NEAR(c, v.size() / 10.0, v.size() / 100.0);
+
+    std::vector<ck::bhalf_t> b(1000);
+
+    ck::utils::FillUniformInteger<ck::bhalf_t>{-3, 4}(b.begin(), b.end());
+
+    for(ck::bhalf_t x : b)
+    {
+        const float f = ck::type_convert<float>(x);
+
+        EXPECT_EQ(f, std::round(f));
+        EXPECT_GE(f, -3.f);
+        EXPECT_LT(f, 4.f);
+    }
+}
+
+TEST(Fill, Normal)
+{
+    std::vector<double> v(1 << 20);
+
+    ck::utils::FillNormal<double>{0.5f, 2.f}(v.begin(), v.end());
+
+    double mean, variance;
+    get_mean_and_variance(v, mean, variance);
+
+    EXPECT_NEAR(mean, 0.5, 0.01);
+    EXPECT_NEAR(variance, 4.0, 0.02);
+
+    for(double x : v)
+        ASSERT_TRUE(std::isfinite(x));
+}
+
+TEST(GeneratorTensor, SameResultForAnyNumberOfThreads)
+{
+    Tensor<float> a1(std::vector<std::size_t>{37, 5, 3, 11, 2});
+    Tensor<float> a4(a1.mDesc);
+    Tensor<int8_t> b1(std::vector<std::size_t>{300, 7});
+    Tensor<int8_t> b4(b1.mDesc);
+
+    const GeneratorTensor_3<float> gen_a{-1.f, 1.f};
+    const GeneratorTensor_2<int8_t> gen_b{-5, 5};
+
+    a1.GenerateTensorValue(gen_a, 1);
+    a4.GenerateTensorValue(gen_a, 4);
+    b1.GenerateTensorValue(gen_b, 1);
+    b4.GenerateTensorValue(gen_b, 4);
+
+    EXPECT_EQ(a1.mData, a4.mData);
+    EXPECT_EQ(b1.mData, b4.mData);
+
+    EXPECT_NE(std::count(b1.mData.begin(), b1.mData.end(), b1.mData[0]), b1.mData.size());
+
+    for(int8_t x : b1.mData)
+    {
+        ASSERT_GE(x, -5);
+        ASSERT_LT(x, 5);
+    }
+
+    // generators that are not given a seed produce different tensors
+    Tensor<float> c(a1.mDesc);
+
+    c.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+
+    EXPECT_NE(a1.mData, c.mData);
+}
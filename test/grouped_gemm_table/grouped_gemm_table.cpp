@@ -0,0 +1,155 @@
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "grouped_gemm_table.hpp"
+
+using ck::index_t;
+using ck::tensor_operation::device::find_grouped_gemm_group;
+using ck::tensor_operation::device::GemmShape;
+using ck::tensor_operation::device::GroupedGemmTable;
+
+namespace {
+
+// stands in for the kernel argument of a group, one workgroup per 16x16 tile of C
+struct GroupDesc
+{
+    index_t M, N;
+    const void* p_c;
+
+    index_t BlockStart_, BlockEnd_;
+};
+
+GroupDesc make_desc(index_t, const GemmShape& shape, index_t block_start)
+{
+    const index_t grid_size = ((shape.M + 15) / 16) * ((shape.N + 15) / 16);
+
+    return GroupDesc{shape.M, shape.N, nullptr, block_start, block_start + grid_size};
+}
+
+GemmShape make_shape(index_t M, index_t N) { return GemmShape{M, N, 64, 64, 64, N}; }
+
+struct Table
+{
+    index_t Update(const std::vector<GemmShape>& shapes)
+    {
+        p_c_.assign(shapes.size(), nullptr);
+
+        for(std::size_t i = 0; i < shapes.size(); ++i)
+            p_c_[i] = &p_c_[i];
+
+        return table_.Update(
+            shapes, make_desc, [&](index_t i, GroupDesc& desc) { desc.p_c = p_c_[i]; });
+    }
+
+    std::vector<const void*> p_c_;
+    GroupedGemmTable<GemmShape, GroupDesc> table_;
+};
+
+} // namespace
+
+TEST(GroupedGemmTable, FindsGroupOfEveryWorkgroup)
+{
+    // groups 1 and 3 have no workgroups
+    const std::vector<GemmShape> shapes{
+        make_shape(32, 32), make_shape(0, 32), make_shape(16, 48), make_shape(32, 0),
+        make_shape(64, 16)};
+
+    Table t;
+
+    const index_t grid_size = t.Update(shapes);
+
+    ASSERT_EQ(grid_size, 4 + 3 + 4);
+    ASSERT_EQ(t.table_.GetGroupCount(), 5);
+    ASSERT_EQ(t.table_.GetByteSize(), 5 * sizeof(GroupDesc));
+
+    const auto& descs = t.table_.GetDescs();
+
+    for(index_t block_id = 0; block_id < grid_size; ++block_id)
+    {
+        const index_t group = find_grouped_gemm_group(descs.data(), 5, block_id);
+
+        EXPECT_LE(descs[group].BlockStart_, block_id) << "block " << block_id;
+        EXPECT_LT(block_id, descs[group].BlockEnd_) << "block " << block_id;
+        EXPECT_EQ(descs[group].p_c, t.p_c_[group]);
+    }
+
+    EXPECT_EQ(find_grouped_gemm_group(descs.data(), 5, 3), 0);
+    EXPECT_EQ(find_grouped_gemm_group(descs.data(), 5, 4), 2);
+    EXPECT_EQ(find_grouped_gemm_group(descs.data(), 5, 7), 4);
+}
+
+TEST(GroupedGemmTable, ManyGroups)
+{
+    std::vector<GemmShape> shapes;
+
+    for(index_t i = 0; i < 1000; ++i)
+        shapes.push_back(make_shape(16 * (i % 7), 16 * (i % 3 + 1)));
+
+    Table t;
+
+    const index_t grid_size = t.Update(shapes);
+    const auto& descs       = t.table_.GetDescs();
+
+    index_t block_id = 0;
+
+    for(index_t i = 0; i < 1000; ++i)
+        for(index_t j = 0; j < (i % 7) * (i % 3 + 1); ++j, ++block_id)
+            ASSERT_EQ(find_grouped_gemm_group(descs.data(), 1000, block_id), i);
+
+    EXPECT_EQ(block_id, grid_size);
+}
+
+TEST(GroupedGemmTable, RebuildsOnlyChangedGroups)
+{
+    std::vector<GemmShape> shapes{
+        make_shape(32, 32), make_shape(16, 16), make_shape(48, 16), make_shape(16, 32)};
+
+    Table t;
+
+    t.Update(shapes);
+    EXPECT_EQ(t.table_.GetNumRebuilt(), 4);
+
+    // only pointers change
+    t.Update(shapes);
+    EXPECT_EQ(t.table_.GetNumRebuilt(), 0);
+    EXPECT_EQ(t.table_.GetDescs()[2].p_c, t.p_c_[2]);
+
+    // same number of workgroups, later groups keep their first workgroup
+    shapes[1] = make_shape(16, 15);
+    t.Update(shapes);
+    EXPECT_EQ(t.table_.GetNumRebuilt(), 1);
+    EXPECT_EQ(t.table_.GetDescs()[1].N, 15);
+
+    // the workgroups of the later groups move
+    shapes[1] = make_shape(32, 16);
+    t.Update(shapes);
+    EXPECT_EQ(t.table_.GetNumRebuilt(), 3);
+    EXPECT_EQ(t.table_.GetDescs()[3].BlockStart_, 4 + 2 + 3);
+}
+
+TEST(GroupedGemmTable, GroupCountChanges)
+{
+    std::vector<GemmShape> shapes{make_shape(32, 32), make_shape(16, 16), make_shape(48, 16)};
+
+    Table t;
+
+    t.Update(shapes);
+
+    shapes.pop_back();
+    EXPECT_EQ(t.Update(shapes), 5);
+    EXPECT_EQ(t.table_.GetNumRebuilt(), 0);
+    EXPECT_EQ(t.table_.GetGroupCount(), 2);
+
+    shapes.push_back(make_shape(16, 16));
+    shapes.push_back(make_shape(16, 32));
+    EXPECT_EQ(t.Update(shapes), 8);
+    EXPECT_EQ(t.table_.GetNumRebuilt(), 2);
+    EXPECT_EQ(t.table_.GetGroupCount(), 4);
+
+    shapes.clear();
+    EXPECT_EQ(t.Update(shapes), 0);
+    EXPECT_EQ(t.table_.GetGroupCount(), 0);
+    EXPECT_EQ(t.table_.GetByteSize(), 0);
+}
@@ -0,0 +1,258 @@
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "common_header.hpp"
+#include "device.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "binary_element_wise_operation.hpp"
+#include "device_binary_elementwise.hpp"
+
+// The kernels of these tests are plain HIP. They run on the GPU, or on the CPU when built with
+// -DCK_HOST_BACKEND=ON.
+
+namespace {
+
+constexpr ck::index_t BlockSize = 256;
+
+__global__ void write_ids(ck::index_t* p_out)
+{
+    p_out[ck::get_thread_global_1d_id()] =
+        ck::get_block_1d_id() * 1000 + ck::get_thread_local_1d_id();
+}
+
+// sum of the values of each block, reduced through LDS
+__global__ void block_sum(const float* p_in, float* p_out)
+{
+    __shared__ float p_lds[BlockSize];
+
+    const ck::index_t tid = ck::get_thread_local_1d_id();
+
+    p_lds[tid] = p_in[ck::get_thread_global_1d_id()];
+
+    for(ck::index_t stride = BlockSize / 2; stride > 0; stride /= 2)
+    {
+        ck::block_sync_lds();
+
+        if(tid < stride)
+            p_lds[tid] += p_lds[tid + stride];
+    }
+
+    if(tid == 0)
+        p_out[ck::get_block_1d_id()] = p_lds[0];
+}
+
+// each thread copies an element of a buffer of `size` elements, through buffer instructions
+__global__ void buffer_copy(const float* p_in, float* p_loaded, float* p_stored, ck::index_t size)
+{
+    const ck::index_t i = ck::get_thread_global_1d_id();
+
+    const float x = ck::amd_buffer_load_invalid_element_return_zero<float, 1>(p_in, i, true, size);
+
+    p_loaded[i] = x;
+
+    ck::amd_buffer_store<float, 1>(x, p_stored, i, true, size);
+}
+
+__global__ void buffer_count(int32_t* p_count)
+{
+    ck::amd_buffer_atomic_add<int32_t, 1>(1, p_count, 0, true, 1);
+}
+
+// threads that return early do not wait at later barriers
+__global__ void count_after_barrier(int32_t* p_count)
+{
+    if(ck::get_thread_local_1d_id() % 2 == 1)
+        return;
+
+    __syncthreads();
+
+    atomicAdd(p_count, 1);
+}
+
+} // namespace
+
+TEST(HostBackend, ThreadAndBlockIds)
+{
+    constexpr ck::index_t GridSize = 5;
+
+    DeviceMem out_buf(sizeof(ck::index_t) * GridSize * BlockSize);
+
+    launch_and_time_kernel(StreamConfig{},
+                           write_ids,
+                           dim3(GridSize),
+                           dim3(BlockSize),
+                           0,
+                           static_cast<ck::index_t*>(out_buf.GetDeviceBuffer()));
+
+    std::vector<ck::index_t> out(GridSize * BlockSize);
+    out_buf.FromDevice(out.data());
+
+    for(ck::index_t block = 0; block < GridSize; ++block)
+    {
+        for(ck::index_t thread = 0; thread < BlockSize; ++thread)
+            EXPECT_EQ(out[block * BlockSize + thread], block * 1000 + thread);
+    }
+}
+
+TEST(HostBackend, LdsReduction)
+{
+    constexpr ck::index_t GridSize = 37;
+
+    std::vector<float> in(GridSize * BlockSize);
+
+    for(std::size_t i = 0; i < in.size(); ++i)
+        in[i] = static_cast<float>(i % 7);
+
+    DeviceMem in_buf(sizeof(float) * in.size());
+    DeviceMem out_buf(sizeof(float) * GridSize);
+
+    in_buf.ToDevice(in.data());
+
+    launch_and_time_kernel(StreamConfig{},
+                           block_sum,
+                           dim3(GridSize),
+                           dim3(BlockSize),
+                           0,
+                           static_cast<const float*>(in_buf.GetDeviceBuffer()),
+                           static_cast<float*>(out_buf.GetDeviceBuffer()));
+
+    std::vector<float> out(GridSize);
+    out_buf.FromDevice(out.data());
+
+    for(ck::index_t block = 0; block < GridSize; ++block)
+    {
+        const float expected = std::accumulate(
+            in.begin() + block * BlockSize, in.begin() + (block + 1) * BlockSize, 0.f);
+
+        EXPECT_EQ(out[block], expected);
+    }
+}
+
+TEST(HostBackend, BufferOutOfRange)
+{
+    // the second block accesses elements past the end of the buffers
+    constexpr ck::index_t Size = BlockSize + BlockSize / 2;
+
+    std::vector<float> in(2 * BlockSize);
+    std::iota(in.begin(), in.end(), 1.f);
+
+    DeviceMem in_buf(sizeof(float) * in.size());
+    DeviceMem loaded_buf(sizeof(float) * in.size());
+    DeviceMem stored_buf(sizeof(float) * in.size());
+
+    in_buf.ToDevice(in.data());
+    stored_buf.SetValue(-1.f);
+
+    launch_and_time_kernel(StreamConfig{},
+                           buffer_copy,
+                           dim3(2),
+                           dim3(BlockSize),
+                           0,
+                           static_cast<const float*>(in_buf.GetDeviceBuffer()),
+                           static_cast<float*>(loaded_buf.GetDeviceBuffer()),
+                           static_cast<float*>(stored_buf.GetDeviceBuffer()),
+                           Size);
+
+    std::vector<float> loaded(in.size());
+    std::vector<float> stored(in.size());
+    loaded_buf.FromDevice(loaded.data());
+    stored_buf.FromDevice(stored.data());
+
+    for(ck::index_t i = 0; i < 2 * BlockSize; ++i)
+    {
+        EXPECT_EQ(loaded[i], i < Size ? in[i] : 0.f);
+        EXPECT_EQ(stored[i], i < Size ? in[i] : -1.f);
+    }
+}
+
+TEST(HostBackend, Atomics)
+{
+    constexpr ck::index_t GridSize = 8;
+
+    DeviceMem count_buf(sizeof(int32_t));
+
+    int32_t count = 0;
+
+    count_buf.ToDevice(&count);
+
+    launch_and_time_kernel(StreamConfig{},
+                           buffer_count,
+                           dim3(GridSize),
+                           dim3(BlockSize),
+                           0,
+                           static_cast<int32_t*>(count_buf.GetDeviceBuffer()));
+
+    count_buf.FromDevice(&count);
+    EXPECT_EQ(count, GridSize * BlockSize);
+
+    count = 0;
+    count_buf.ToDevice(&count);
+
+    launch_and_time_kernel(StreamConfig{},
+                           count_after_barrier,
+                           dim3(GridSize),
+                           dim3(BlockSize),
+                           0,
+                           static_cast<int32_t*>(count_buf.GetDeviceBuffer()));
+
+    count_buf.FromDevice(&count);
+    EXPECT_EQ(count, GridSize * BlockSize / 2);
+}
+
+TEST(HostBackend, DeviceBinaryElementwise)
+{
+    using Add = ck::tensor_operation::binary_element_wise::Add;
+
+    using DeviceElementwiseAddInstance = ck::tensor_operation::device::
+        DeviceBinaryElementwise<ck::half_t, ck::half_t, ck::half_t, float, Add, 1, 8>;
+
+    const ck::index_t M = 1000;
+
+    const std::vector<std::size_t> lengths{static_cast<std::size_t>(M)};
+
+    Tensor<ck::half_t> a(lengths);
+    Tensor<ck::half_t> b(lengths);
+    Tensor<ck::half_t> c(lengths);
+    Tensor<ck::half_t> c_host(lengths);
+
+    a.GenerateTensorValue(GeneratorTensor_3<ck::half_t>{0.0, 1.0});
+    b.GenerateTensorValue(GeneratorTensor_3<ck::half_t>{0.0, 1.0});
+
+    DeviceMem a_buf(sizeof(ck::half_t) * a.mDesc.GetElementSpace());
+    DeviceMem b_buf(sizeof(ck::half_t) * b.mDesc.GetElementSpace());
+    DeviceMem c_buf(sizeof(ck::half_t) * c.mDesc.GetElementSpace());
+
+    a_buf.ToDevice(a.mData.data());
+    b_buf.ToDevice(b.mData.data());
+
+    auto add      = DeviceElementwiseAddInstance{};
+    auto argument = add.MakeArgumentPointer(a_buf.GetDeviceBuffer(),
+                                            b_buf.GetDeviceBuffer(),
+                                            c_buf.GetDeviceBuffer(),
+                                            {M},
+                                            {1},
+                                            {1},
+                                            {1},
+                                            Add{});
+
+    ASSERT_TRUE(add.IsSupportedArgument(argument.get()));
+
+    add.MakeInvokerPointer()->Run(argument.get(), StreamConfig{});
+
+    c_buf.FromDevice(c.mData.data());
+
+    for(ck::index_t m = 0; m < M; ++m)
+    {
+        float x = 0;
+        Add{}(x, ck::type_convert<float>(a(m)), ck::type_convert<float>(b(m)));
+        c_host(m) = ck::type_convert<ck::half_t>(x);
+    }
+
+    EXPECT_TRUE(
+        ck::utils::check_err(c.mData, c_host.mData, "Error: incorrect results", 1e-3, 1e-3));
+}
@@ -0,0 +1,303 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "data_type.hpp"
+#include "host_reduction.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+
+namespace {
+
+using ck::ReduceTensorOp;
+
+// Straightforward reference: decodes every (output, reduced element) pair from its flattened
+// position, with the reduced elements in row-major order of reduce_dims
+template <ReduceTensorOp ReduceOpId, bool PropagateNan>
+void naive_reduce(const Tensor<float>& in,
+                  const std::vector<int>& invariant_dims,
+                  const std::vector<int>& reduce_dims,
+                  std::vector<float>& out,
+                  std::vector<int>& indices)
+{
+    using ReduceOp = ck::host_reduce::HostReduceOp<float, ReduceOpId, PropagateNan>;
+
+    const auto& lens    = in.mDesc.GetLengths();
+    const auto& strides = in.mDesc.GetStrides();
+
+    // offset of flattened position i over dims
+    auto get_offset = [&](std::size_t i, const std::vector<int>& dims) {
+        std::size_t offset = 0;
+
+        for(std::size_t d = dims.size(); d-- > 0;)
+        {
+            offset += i % lens[dims[d]] * strides[dims[d]];
+            i /= lens[dims[d]];
+        }
+
+        return offset;
+    };
+
+    std::size_t num_out = 1, num_reduce = 1;
+
+    for(int d : invariant_dims)
+        num_out *= lens[d];
+    for(int d : reduce_dims)
+        num_reduce *= lens[d];
+
+    out.assign(num_out, ReduceOp::GetIdentityValue());
+    indices.assign(num_out, 0);
+
+    for(std::size_t io = 0; io < num_out; ++io)
+    {
+        for(std::size_t ir = 0; ir < num_reduce; ++ir)
+        {
+            float v = in.mData[get_offset(io, invariant_dims) + get_offset(ir, reduce_dims)];
+
+            ReduceOp::PreUnaryOp(v);
+            ReduceOp::Reduce(out[io], v, indices[io], static_cast<int>(ir));
+        }
+
+        ReduceOp::PosUnaryOp(out[io], static_cast<int32_t>(num_reduce));
+    }
+}
+
+template <ReduceTensorOp ReduceOpId,
+          int Rank,
+          int NumReduceDim,
+          bool PropagateNan,
+          bool NeedIndices>
+void test_reduction(const std::vector<std::size_t>& lens,
+                    const std::vector<std::size_t>& strides,
+                    const std::vector<int>& invariant_dims,
+                    const std::vector<int>& reduce_dims)
+{
+    Tensor<float> in(HostTensorDescriptor{lens, strides});
+
+    // values on a coarse grid, so min/max ties are common
+    in.GenerateTensorValue(GeneratorTensor_2<float>{-8, 8});
+
+    if constexpr(PropagateNan)
+    {
+        in.mData[in.mData.size() / 3] = std::numeric_limits<float>::quiet_NaN();
+        in.mData[in.mData.size() / 2] = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    std::vector<std::size_t> out_lens;
+
+    for(int d : invariant_dims)
+        out_lens.push_back(lens[d]);
+    if(out_lens.empty())
+        out_lens.push_back(1);
+
+    HostTensorDescriptor in_desc = in.mDesc;
+    HostTensorDescriptor out_desc{out_lens};
+
+    std::vector<float> out(out_desc.GetElementSpace());
+    std::vector<int> indices(out_desc.GetElementSpace());
+
+    ReductionHost<float, float, float, ReduceOpId, Rank, NumReduceDim, PropagateNan, NeedIndices>
+        reduce(in_desc, out_desc, invariant_dims, reduce_dims);
+
+    reduce.Run(1.f, in.mData.data(), 0.f, out.data(), indices.data());
+
+    std::vector<float> out_ref;
+    std::vector<int> indices_ref;
+
+    naive_reduce<ReduceOpId, PropagateNan>(in, invariant_dims, reduce_dims, out_ref, indices_ref);
+
+    for(std::size_t i = 0; i < out.size(); ++i)
+    {
+        if(std::isnan(out_ref[i]))
+        {
+            EXPECT_TRUE(std::isnan(out[i])) << "output " << i;
+        }
+        else
+        {
+            EXPECT_NEAR(out[i], out_ref[i], 1e-5 * (1 + std::abs(out_ref[i]))) << "output " << i;
+        }
+
+        if(NeedIndices)
+        {
+            EXPECT_EQ(indices[i], indices_ref[i]) << "output " << i;
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST(ReductionHost, PartialReductionNoIndex)
+{
+    const std::vector<std::size_t> lens{5, 7, 9, 11};
+    const std::vector<std::size_t> packed{693, 99, 11, 1};
+    const std::vector<std::size_t> transposed{1, 5, 35, 315};
+
+    for(const auto& strides : {packed, transposed})
+    {
+        test_reduction<ReduceTensorOp::ADD, 4, 3, false, false>(lens, strides, {0}, {1, 2, 3});
+        test_reduction<ReduceTensorOp::AVG, 4, 2, false, false>(lens, strides, {1, 3}, {0, 2});
+        test_reduction<ReduceTensorOp::NORM1, 4, 1, false, false>(lens, strides, {1, 2, 3}, {0});
+        test_reduction<ReduceTensorOp::NORM2, 4, 1, false, false>(lens, strides, {0, 1, 2}, {3});
+        test_reduction<ReduceTensorOp::MAX, 4, 3, true, false>(lens, strides, {2}, {0, 1, 3});
+    }
+}
+
+TEST(ReductionHost, PartialReductionWithIndex)
+{
+    const std::vector<std::size_t> lens{5, 7, 9, 11};
+    const std::vector<std::size_t> packed{693, 99, 11, 1};
+    const std::vector<std::size_t> transposed{1, 5, 35, 315};
+
+    for(const auto& strides : {packed, transposed})
+    {
+        test_reduction<ReduceTensorOp::MAX, 4, 2, false, true>(lens, strides, {0, 3}, {1, 2});
+        test_reduction<ReduceTensorOp::MIN, 4, 3, true, true>(lens, strides, {2}, {0, 1, 3});
+        // reduced dimensions not in memory order
+        test_reduction<ReduceTensorOp::AMAX, 4, 2, false, true>(lens, strides, {0, 3}, {2, 1});
+    }
+}
+
+TEST(ReductionHost, FullReduction)
+{
+    // more elements than one chunk of the parallel full reduction
+    const std::vector<std::size_t> lens{3, 170, 257};
+    const std::vector<std::size_t> strides{170 * 257, 257, 1};
+
+    test_reduction<ReduceTensorOp::ADD, 3, 3, false, false>(lens, strides, {}, {0, 1, 2});
+    test_reduction<ReduceTensorOp::MAX, 3, 3, false, true>(lens, strides, {}, {0, 1, 2});
+    test_reduction<ReduceTensorOp::AMAX, 3, 3, true, true>(lens, strides, {}, {0, 1, 2});
+    test_reduction<ReduceTensorOp::MIN, 3, 3, false, true>(lens, strides, {}, {2, 0, 1});
+}
+
+namespace {
+
+// Two-pass reference in double of the mean and population variance over reduce_dims
+void naive_mean_var(const Tensor<float>& in,
+                    const std::vector<int>& invariant_dims,
+                    const std::vector<int>& reduce_dims,
+                    std::vector<double>& mean,
+                    std::vector<double>& var)
+{
+    const auto& lens    = in.mDesc.GetLengths();
+    const auto& strides = in.mDesc.GetStrides();
+
+    auto get_offset = [&](std::size_t i, const std::vector<int>& dims) {
+        std::size_t offset = 0;
+
+        for(std::size_t d = dims.size(); d-- > 0;)
+        {
+            offset += i % lens[dims[d]] * strides[dims[d]];
+            i /= lens[dims[d]];
+        }
+
+        return offset;
+    };
+
+    std::size_t num_out = 1, num_reduce = 1;
+
+    for(int d : invariant_dims)
+        num_out *= lens[d];
+    for(int d : reduce_dims)
+        num_reduce *= lens[d];
+
+    mean.assign(num_out, 0);
+    var.assign(num_out, 0);
+
+    for(std::size_t io = 0; io < num_out; ++io)
+    {
+        for(std::size_t ir = 0; ir < num_reduce; ++ir)
+            mean[io] += in.mData[get_offset(io, invariant_dims) + get_offset(ir, reduce_dims)];
+
+        mean[io] /= num_reduce;
+
+        for(std::size_t ir = 0; ir < num_reduce; ++ir)
+        {
+            const double d =
+                in.mData[get_offset(io, invariant_dims) + get_offset(ir, reduce_dims)] - mean[io];
+
+            var[io] += d * d;
+        }
+
+        var[io] /= num_reduce;
+    }
+}
+
+template <int Rank, int NumReduceDim>
+void test_welford(const std::vector<std::size_t>& lens,
+                  const std::vector<std::size_t>& strides,
+                  const std::vector<int>& invariant_dims,
+                  const std::vector<int>& reduce_dims,
+                  float offset)
+{
+    Tensor<float> in(HostTensorDescriptor{lens, strides});
+
+    in.GenerateTensorValue(GeneratorTensor_3<float>{offset - 1, offset + 1});
+
+    std::vector<std::size_t> out_lens;
+
+    for(int d : invariant_dims)
+        out_lens.push_back(lens[d]);
+    if(out_lens.empty())
+        out_lens.push_back(1);
+
+    HostTensorDescriptor in_desc = in.mDesc;
+    HostTensorDescriptor out_desc{out_lens};
+
+    std::vector<float> mean(out_desc.GetElementSpace());
+    std::vector<float> var(out_desc.GetElementSpace());
+
+    ReductionHostWelford<float, float, float, Rank, NumReduceDim> welford(
+        in_desc, out_desc, invariant_dims, reduce_dims);
+
+    welford.Run(in.mData.data(), mean.data(), var.data());
+
+    std::vector<double> mean_ref;
+    std::vector<double> var_ref;
+
+    naive_mean_var(in, invariant_dims, reduce_dims, mean_ref, var_ref);
+
+    for(std::size_t i = 0; i < mean.size(); ++i)
+    {
+        EXPECT_NEAR(mean[i], mean_ref[i], 1e-5 * (1 + std::abs(mean_ref[i]))) << "output " << i;
+        // the variance of elements in [offset - 1, offset + 1] is about 1/3 whatever the offset
+        EXPECT_NEAR(var[i], var_ref[i], 1e-3 * var_ref[i]) << "output " << i;
+    }
+}
+
+} // anonymous namespace
+
+TEST(ReductionHostWelford, PartialReduction)
+{
+    const std::vector<std::size_t> lens{5, 7, 9, 11};
+    const std::vector<std::size_t> packed{693, 99, 11, 1};
+    const std::vector<std::size_t> transposed{1, 5, 35, 315};
+
+    for(const auto& strides : {packed, transposed})
+    {
+        // batchnorm over NHW
+        test_welford<4, 3>(lens, strides, {3}, {0, 1, 2}, 0.f);
+        // layernorm over the last dimension
+        test_welford<4, 1>(lens, strides, {0, 1, 2}, {3}, 0.f);
+        test_welford<4, 2>(lens, strides, {1, 3}, {2, 0}, 0.f);
+    }
+}
+
+TEST(ReductionHostWelford, FullReduction)
+{
+    // more elements than one chunk of the parallel full reduction
+    const std::vector<std::size_t> lens{3, 170, 257};
+    const std::vector<std::size_t> strides{170 * 257, 257, 1};
+
+    test_welford<3, 3>(lens, strides, {}, {0, 1, 2}, 0.f);
+}
+
+TEST(ReductionHostWelford, LargeMean)
+{
+    // the sum of squares minus the squared sum would cancel all the digits of the variance in
+    // float, Welford keeps them
+    const std::vector<std::size_t> lens{4, 4096};
+    const std::vector<std::size_t> strides{4096, 1};
+
+    test_welford<2, 1>(lens, strides, {0}, {1}, 1e4f);
+}
@@ -0,0 +1,256 @@
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "host_tensor.hpp"
+
+namespace {
+
+// value whose decimal digits are the element's indices, e.g. (5, 3, 4) -> 534
+struct GeneratorTensor_Digits
+{
+    template <typename... Is>
+    float operator()(Is... is) const
+    {
+        float v = 0;
+
+        ((v = v * 10 + static_cast<float>(is)), ...);
+
+        return v;
+    }
+};
+
+} // anonymous namespace
+
+TEST(StaticHostTensorDescriptor, MatchesDynamicDescriptor)
+{
+    const std::vector<std::size_t> lens{3, 5, 2, 7};
+    const std::vector<std::size_t> strides{1, 3 * 7 * 2, 3, 3 * 2};
+
+    const HostTensorDescriptor dynamic_desc{lens, strides};
+    const StaticHostTensorDescriptor<4> static_desc{dynamic_desc};
+
+    EXPECT_EQ(static_desc.GetNumOfDimension(), 4);
+    EXPECT_EQ(static_desc.GetElementSize(), dynamic_desc.GetElementSize());
+    EXPECT_EQ(static_desc.GetElementSpace(), dynamic_desc.GetElementSpace());
+
+    for(std::size_t i0 = 0; i0 < lens[0]; ++i0)
+        for(std::size_t i1 = 0; i1 < lens[1]; ++i1)
+            for(std::size_t i2 = 0; i2 < lens[2]; ++i2)
+                for(std::size_t i3 = 0; i3 < lens[3]; ++i3)
+                {
+                    const std::size_t offset = dynamic_desc.GetOffsetFromMultiIndex(i0, i1, i2, i3);
+
+                    ASSERT_EQ(static_desc.GetOffsetFromMultiIndex(i0, i1, i2, i3), offset);
+                    ASSERT_EQ(static_desc.GetOffsetFromMultiIndex({i0, i1, i2, i3}), offset);
+                }
+
+    const HostTensorDescriptor round_trip{static_desc};
+
+    EXPECT_EQ(round_trip.GetLengths(), lens);
+    EXPECT_EQ(round_trip.GetStrides(), strides);
+
+    EXPECT_THROW(StaticHostTensorDescriptor<3>{dynamic_desc}, std::runtime_error);
+}
+
+TEST(StaticHostTensorDescriptor, MoveToNextMultiIndex)
+{
+    const StaticHostTensorDescriptor<3> desc{std::vector<std::size_t>{4, 3, 5},
+                                             std::vector<std::size_t>{1, 60, 4}};
+
+    std::array<std::size_t, 3> idx{0, 0, 0};
+    std::size_t offset = 0;
+
+    for(std::size_t i = 0; i < desc.GetElementSize(); ++i)
+    {
+        ASSERT_EQ(idx, desc.GetMultiIndex(i));
+        ASSERT_EQ(offset, desc.GetOffsetFromMultiIndex(idx));
+
+        desc.MoveToNextMultiIndex(idx, offset);
+    }
+
+    // stepping past the last element wraps around to the first
+    EXPECT_EQ(idx, (std::array<std::size_t, 3>{0, 0, 0}));
+    EXPECT_EQ(offset, 0);
+}
+
+TEST(StaticHostTensorDescriptor, ForEachIndex)
+{
+    const StaticHostTensorDescriptor<2> desc{std::array<std::size_t, 2>{37, 29}};
+
+    std::vector<int> visits(desc.GetElementSpace(), 0);
+
+    desc.ForEachIndex(
+        [&](const std::array<std::size_t, 2>& idx, std::size_t offset) {
+            EXPECT_EQ(offset, idx[0] * 29 + idx[1]);
+            visits[offset]++;
+        },
+        std::thread::hardware_concurrency());
+
+    for(int v : visits)
+        ASSERT_EQ(v, 1);
+}
+
+TEST(StaticRankTensor, MatchesDynamicTensor)
+{
+    Tensor<float> dynamic_tensor(std::vector<std::size_t>{6, 4, 5},
+                                 std::vector<std::size_t>{1, 30, 6});
+    Tensor<float, 3> static_tensor(dynamic_tensor.mDesc);
+
+    dynamic_tensor.GenerateTensorValue(GeneratorTensor_Digits{},
+                                       std::thread::hardware_concurrency());
+    static_tensor.GenerateTensorValue(GeneratorTensor_Digits{},
+                                      std::thread::hardware_concurrency());
+
+    EXPECT_EQ(static_tensor.mData, dynamic_tensor.mData);
+    EXPECT_EQ(static_tensor(5, 3, 4), 534.f);
+    EXPECT_EQ(static_tensor({2, 1, 0}), 210.f);
+
+    const Tensor<float> converted(static_tensor);
+
+    EXPECT_EQ(converted.mDesc.GetStrides(), dynamic_tensor.mDesc.GetStrides());
+    EXPECT_EQ(converted(4, 2, 1), 421.f);
+}
+
+TEST(ParallelTensorFunctor, VisitsEveryIndexInOrder)
+{
+    const std::size_t n0 = 5, n1 = 1, n2 = 9;
+
+    // a single worker visits the indices in row-major order
+    std::vector<std::size_t> order;
+
+    make_ParallelTensorFunctor(
+        [&](auto i0, auto i1, auto i2) { order.push_back((i0 * n1 + i1) * n2 + i2); },
+        n0,
+        n1,
+        n2)(1);
+
+    std::vector<std::size_t> expected(n0 * n1 * n2);
+    std::iota(expected.begin(), expected.end(), 0);
+
+    EXPECT_EQ(order, expected);
+
+    // several workers visit every index once
+    std::vector<std::atomic<std::size_t>> visits(n0 * n1 * n2);
+
+    make_ParallelTensorFunctor(
+        [&](auto i0, auto i1, auto i2) { visits[(i0 * n1 + i1) * n2 + i2]++; }, n0, n1, n2)(4);
+
+    for(const auto& v : visits)
+        ASSERT_EQ(v.load(), 1);
+}
+
+TEST(HostTensorAllocator, AlignedAndZeroed)
+{
+    for(std::size_t n : {1, 17, 1000, 3 << 20})
+    {
+        Tensor<float> t(std::vector<std::size_t>{n});
+
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(t.mData.data()) % HostTensorMemory::Alignment,
+                  0);
+
+        for(float v : t.mData)
+            ASSERT_EQ(v, 0.f);
+    }
+
+    // huge-page sized buffers are aligned to the huge page size
+    Tensor<ck::half_t> t(std::vector<std::size_t>{HostTensorMemory::HugePageSize});
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(t.mData.data()) % HostTensorMemory::HugePageSize, 0);
+}
+
+TEST(HostTensorAllocator, NoInit)
+{
+    const HostTensorDescriptor desc{std::vector<std::size_t>{64, 64}};
+
+    Tensor<float> t(desc, HostTensorNoInit{});
+
+    EXPECT_EQ(t.mData.size(), desc.GetElementSpace());
+
+    t.GenerateTensorValue(GeneratorTensor_Digits{});
+
+    EXPECT_EQ(t(3, 7), 37.f);
+}
+
+TEST(HostTensorArena, ReusesBuffers)
+{
+    const std::vector<std::size_t> lens{128, 129};
+
+    {
+        HostTensorArena::Scope scope;
+
+        const std::size_t num_reused = HostTensorArena::GetNumReusedAllocations();
+
+        const float* p = nullptr;
+
+        {
+            Tensor<float> t(lens);
+            t(5, 5) = 1.f;
+            p       = t.mData.data();
+        }
+
+        EXPECT_GE(HostTensorArena::GetNumCachedBytes(), 128 * 129 * sizeof(float));
+
+        Tensor<float> t(lens);
+
+        EXPECT_EQ(t.mData.data(), p);
+        EXPECT_EQ(HostTensorArena::GetNumReusedAllocations(), num_reused + 1);
+
+        // reused buffers are zeroed like fresh ones
+        EXPECT_EQ(t(5, 5), 0.f);
+    }
+
+    // cached buffers are released when the last scope ends
+    EXPECT_EQ(HostTensorArena::GetNumCachedBytes(), 0);
+}
+
+TEST(HostTensorArena, EvictsPastCap)
+{
+    const std::size_t max_cached_bytes = HostTensorArena::GetMaxCachedBytes();
+
+    // room for two of the three buffers below
+    HostTensorArena::SetMaxCachedBytes(2 * 4096 * sizeof(float) + 1024);
+
+    {
+        HostTensorArena::Scope scope;
+
+        auto t0 = std::make_unique<Tensor<float>>(std::vector<std::size_t>{4096});
+        auto t1 = std::make_unique<Tensor<float>>(std::vector<std::size_t>{4000});
+        auto t2 = std::make_unique<Tensor<float>>(std::vector<std::size_t>{4096});
+
+        const float* p2 = t2->mData.data();
+
+        // t0 is released first, so it is the one evicted when t2 is released
+        t0.reset();
+        t1.reset();
+        t2.reset();
+
+        EXPECT_LE(HostTensorArena::GetNumCachedBytes(), HostTensorArena::GetMaxCachedBytes());
+
+        const std::size_t num_reused = HostTensorArena::GetNumReusedAllocations();
+
+        Tensor<float> t(std::vector<std::size_t>{4096});
+
+        EXPECT_EQ(t.mData.data(), p2);
+        EXPECT_EQ(HostTensorArena::GetNumReusedAllocations(), num_reused + 1);
+
+        // only one buffer of t's size was left
+        Tensor<float> u(std::vector<std::size_t>{4096});
+
+        EXPECT_EQ(HostTensorArena::GetNumReusedAllocations(), num_reused + 1);
+
+        // buffers larger than the cap are never cached
+        {
+            Tensor<float> big(std::vector<std::size_t>{1 << 20});
+        }
+
+        EXPECT_LE(HostTensorArena::GetNumCachedBytes(), HostTensorArena::GetMaxCachedBytes());
+    }
+
+    HostTensorArena::SetMaxCachedBytes(max_cached_bytes);
+}
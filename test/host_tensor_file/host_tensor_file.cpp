@@ -0,0 +1,250 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+#include "data_type.hpp"
+#include "element_wise_operation.hpp"
+#include "fill.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_file.hpp"
+#include "reference_cache.hpp"
+
+namespace {
+
+class HostTensorFileTest : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        char dir[] = "/tmp/ck_host_tensor_file_XXXXXX";
+
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        dir_ = dir;
+    }
+
+    void TearDown() override
+    {
+        for(const auto& path : paths_)
+            std::remove(path.c_str());
+
+        rmdir(dir_.c_str());
+    }
+
+    std::string GetPath(const std::string& name)
+    {
+        paths_.push_back(dir_ + "/" + name);
+
+        return paths_.back();
+    }
+
+    std::string dir_;
+    std::vector<std::string> paths_;
+};
+
+} // namespace
+
+TEST_F(HostTensorFileTest, RoundTripStrided)
+{
+    // padded strides, so the payload holds elements outside of the tensor as well
+    Tensor<ck::half_t> t(std::vector<std::size_t>{3, 5, 7}, std::vector<std::size_t>{64, 8, 1});
+
+    ck::utils::FillUniform<ck::half_t>{-1.f, 1.f, 7}(t.begin(), t.end());
+
+    const std::string path = GetPath("strided.cktensor");
+
+    write_host_tensor_file(path, t, "strided tensor");
+
+    const HostTensorView<ck::half_t> view = map_host_tensor_file<ck::half_t>(path);
+
+    EXPECT_EQ(view.mDesc.GetLengths(), t.mDesc.GetLengths());
+    EXPECT_EQ(view.mDesc.GetStrides(), t.mDesc.GetStrides());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.mData) % HostTensorFileHeader::PayloadAlignment,
+              0);
+
+    ASSERT_EQ(view.end() - view.begin(), static_cast<std::ptrdiff_t>(t.mData.size()));
+
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+        EXPECT_EQ(ck::type_convert<float>(view.mData[i]), ck::type_convert<float>(t.mData[i]));
+
+    EXPECT_EQ(ck::type_convert<float>(view(2, 4, 6)), ck::type_convert<float>(t(2, 4, 6)));
+
+    const auto mapping = HostTensorFileMapping::Open(path);
+
+    EXPECT_EQ(mapping->GetDataType(), HostTensorDataType::Half);
+    EXPECT_EQ(mapping->GetTag(), "strided tensor");
+}
+
+TEST_F(HostTensorFileTest, ViewSurvivesRewrite)
+{
+    Tensor<int32_t> t(std::vector<std::size_t>{1000});
+
+    ck::utils::FillUniformInteger<int32_t>{-100, 100, 3}(t.begin(), t.end());
+
+    const std::string path = GetPath("int32.cktensor");
+
+    write_host_tensor_file(path, t);
+
+    const HostTensorView<int32_t> view =
+        make_host_tensor_view<int32_t>(HostTensorFileMapping::Open(path));
+
+    // rewriting the file replaces it, the existing mapping keeps the old contents
+    Tensor<int32_t> t2(std::vector<std::size_t>{1000});
+    write_host_tensor_file(path, t2);
+
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), t.mData.begin()));
+}
+
+TEST_F(HostTensorFileTest, RejectsBadFiles)
+{
+    Tensor<float> t(std::vector<std::size_t>{16, 16});
+
+    const std::string path = GetPath("float.cktensor");
+
+    write_host_tensor_file(path, t);
+
+    EXPECT_THROW(map_host_tensor_file<ck::half_t>(path), std::runtime_error);
+    EXPECT_THROW(map_host_tensor_file<float>(GetPath("missing.cktensor")), std::runtime_error);
+
+    const std::string truncated_path = GetPath("truncated.cktensor");
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)),
+                                std::istreambuf_iterator<char>());
+
+        std::ofstream out(truncated_path, std::ios::binary);
+        out.write(bytes.data(), bytes.size() - 4);
+    }
+
+    EXPECT_THROW(map_host_tensor_file<float>(truncated_path), std::runtime_error);
+
+    const std::string text_path = GetPath("text.cktensor");
+    {
+        std::ofstream out(text_path);
+        out << "this is not a tensor file, but it is longer than the header of one";
+    }
+
+    EXPECT_THROW(map_host_tensor_file<float>(text_path), std::runtime_error);
+}
+
+TEST_F(HostTensorFileTest, Digest)
+{
+    Tensor<float> a(std::vector<std::size_t>{3, 1 << 20});
+
+    ck::utils::FillUniform<float>{0.f, 1.f, 5}(a.begin(), a.end());
+
+    Tensor<float> b(a);
+
+    EXPECT_EQ(get_host_tensor_digest(a), get_host_tensor_digest(b));
+
+    b.mData.back() += 1.f;
+
+    EXPECT_NE(get_host_tensor_digest(a), get_host_tensor_digest(b));
+}
+
+TEST_F(HostTensorFileTest, ReferenceCache)
+{
+    const ck::utils::ReferenceCache cache(dir_ + "/cache");
+
+    Tensor<float> in(std::vector<std::size_t>{64, 64});
+
+    ck::utils::FillUniform<float>{-1.f, 1.f, 9}(in.begin(), in.end());
+
+    ck::utils::ReferenceCacheKey key("scale by 2");
+    key.AddInput(in);
+
+    paths_.push_back(cache.GetPath(key));
+
+    int num_compute = 0;
+
+    auto run = [&](Tensor<float>& out) {
+        return cache.LoadOrCompute(key, out, [&] {
+            ++num_compute;
+            for(std::size_t i = 0; i < in.mData.size(); ++i)
+                out.mData[i] = 2.f * in.mData[i];
+        });
+    };
+
+    Tensor<float> out0(in.mDesc);
+    Tensor<float> out1(in.mDesc);
+
+    EXPECT_FALSE(run(out0));
+    EXPECT_TRUE(run(out1));
+    EXPECT_EQ(num_compute, 1);
+    EXPECT_EQ(out0.mData, out1.mData);
+
+    // a different input gives a different key
+    in.mData[0] += 1.f;
+
+    ck::utils::ReferenceCacheKey other_key("scale by 2");
+    other_key.AddInput(in);
+
+    EXPECT_NE(other_key.GetText(), key.GetText());
+    EXPECT_FALSE(cache.Find<float>(other_key, in.mDesc).has_value());
+
+    // a cached output is only used for a matching descriptor
+    const HostTensorDescriptor flat_desc(std::vector<std::size_t>{64 * 64});
+
+    EXPECT_FALSE(cache.Find<float>(key, flat_desc).has_value());
+
+    // std::remove also removes the then empty directory
+    paths_.push_back(dir_ + "/cache");
+}
+
+TEST_F(HostTensorFileTest, ReferenceCacheKeyedOnOpStateAndVersion)
+{
+    const ck::utils::ReferenceCache cache(dir_ + "/cache");
+
+    Tensor<float> out(std::vector<std::size_t>{4});
+
+    std::fill(out.begin(), out.end(), 1.f);
+
+    using ck::tensor_operation::element_wise::AlphaBetaAdd;
+    using ck::tensor_operation::element_wise::PassThrough;
+
+    auto make_key = [](float alpha, int version) {
+        return ck::utils::ReferenceCacheKey(
+            "add " + ck::utils::get_reference_cache_op_state(AlphaBetaAdd{alpha, 1.f}), version);
+    };
+
+    const auto key = make_key(2.f, ck::utils::ReferenceCacheKey::Version);
+
+    cache.Store(key, out);
+    paths_.push_back(cache.GetPath(key));
+    paths_.push_back(dir_ + "/cache");
+
+    EXPECT_TRUE(cache.Find<float>(key, out.mDesc).has_value());
+
+    // the same operation type with another state, or another cache version, is a miss
+    const auto other_alpha   = make_key(3.f, ck::utils::ReferenceCacheKey::Version);
+    const auto other_version = make_key(2.f, ck::utils::ReferenceCacheKey::Version + 1);
+
+    EXPECT_NE(other_alpha.GetText(), key.GetText());
+    EXPECT_NE(other_version.GetText(), key.GetText());
+    EXPECT_FALSE(cache.Find<float>(other_alpha, out.mDesc).has_value());
+    EXPECT_FALSE(cache.Find<float>(other_version, out.mDesc).has_value());
+
+    // stateless operations are keyed on their type only
+    EXPECT_EQ(ck::utils::get_reference_cache_op_state(PassThrough{}), typeid(PassThrough).name());
+}
+
+TEST(ReferenceCache, DisabledWithoutDirectory)
+{
+    const ck::utils::ReferenceCache cache("");
+
+    Tensor<float> out(std::vector<std::size_t>{4});
+
+    ck::utils::ReferenceCacheKey key("noop");
+
+    int num_compute = 0;
+
+    EXPECT_FALSE(cache.LoadOrCompute(key, out, [&] { ++num_compute; }));
+    EXPECT_FALSE(cache.LoadOrCompute(key, out, [&] { ++num_compute; }));
+    EXPECT_EQ(num_compute, 2);
+}
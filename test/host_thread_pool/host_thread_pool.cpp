@@ -0,0 +1,137 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "host_tensor.hpp"
+#include "host_thread_pool.hpp"
+
+TEST(HostThreadPool, VisitsEveryIndexOnce)
+{
+    for(std::size_t n : {0, 1, 7, 1000, 100003})
+    {
+        for(std::size_t num_thread : {1, 2, 4, 64})
+        {
+            std::vector<std::atomic<int>> visits(n);
+
+            host_parallel_for(n, num_thread, [&](std::size_t begin, std::size_t end) {
+                ASSERT_LE(begin, end);
+                ASSERT_LE(end, n);
+
+                for(std::size_t i = begin; i < end; ++i)
+                    visits[i]++;
+            });
+
+            for(std::size_t i = 0; i < n; ++i)
+                ASSERT_EQ(visits[i].load(), 1) << "n " << n << ", num_thread " << num_thread;
+        }
+    }
+}
+
+TEST(HostThreadPool, UnbalancedWork)
+{
+    const std::size_t n = 4096;
+
+    std::vector<std::atomic<int>> visits(n);
+
+    // the last quarter is much more expensive than the rest, so other threads have to steal it
+    host_parallel_for(n, 4, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            if(i >= 3 * n / 4)
+            {
+                volatile double x = 0;
+
+                for(int k = 0; k < 10000; ++k)
+                    x = x + 1;
+            }
+
+            visits[i]++;
+        }
+    });
+
+    for(std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(visits[i].load(), 1);
+}
+
+TEST(HostThreadPool, NestedRegionRunsSerially)
+{
+    const std::size_t n_outer = 16;
+    const std::size_t n_inner = 100;
+
+    std::vector<std::atomic<int>> visits(n_outer * n_inner);
+
+    host_parallel_for(n_outer, 4, [&](std::size_t outer_begin, std::size_t outer_end) {
+        for(std::size_t i = outer_begin; i < outer_end; ++i)
+        {
+            const auto caller = std::this_thread::get_id();
+
+            host_parallel_for(n_inner, 4, [&](std::size_t begin, std::size_t end) {
+                EXPECT_TRUE(HostThreadPool::IsInParallelRegion());
+                EXPECT_EQ(std::this_thread::get_id(), caller);
+
+                for(std::size_t j = begin; j < end; ++j)
+                    visits[i * n_inner + j]++;
+            });
+        }
+    });
+
+    EXPECT_FALSE(HostThreadPool::IsInParallelRegion());
+
+    for(std::size_t i = 0; i < n_outer * n_inner; ++i)
+        ASSERT_EQ(visits[i].load(), 1);
+}
+
+TEST(HostThreadPool, PropagatesException)
+{
+    EXPECT_THROW(host_parallel_for(1000,
+                                   4,
+                                   [](std::size_t begin, std::size_t end) {
+                                       if(begin <= 500 && 500 < end)
+                                           throw std::runtime_error("failed");
+                                   }),
+                 std::runtime_error);
+
+    // the pool is still usable afterwards
+    std::atomic<std::size_t> sum{0};
+
+    host_parallel_for(1000, 4, [&](std::size_t begin, std::size_t end) { sum += end - begin; });
+
+    EXPECT_EQ(sum.load(), 1000);
+}
+
+TEST(HostThreadPool, ConcurrentCallers)
+{
+    std::atomic<std::size_t> sum{0};
+
+    std::vector<std::thread> callers;
+
+    for(int t = 0; t < 4; ++t)
+        callers.emplace_back([&] {
+            for(int r = 0; r < 50; ++r)
+                host_parallel_for(
+                    100, 4, [&](std::size_t begin, std::size_t end) { sum += end - begin; });
+        });
+
+    for(auto& caller : callers)
+        caller.join();
+
+    EXPECT_EQ(sum.load(), 4 * 50 * 100);
+}
+
+TEST(HostThreadPool, ParallelTensorFunctor)
+{
+    Tensor<float> t(std::vector<std::size_t>{7, 13, 5});
+
+    make_ParallelTensorFunctor(
+        [&](auto i, auto j, auto k) { t(i, j, k) = static_cast<float>(i * 100 + j * 10 + k); },
+        7,
+        13,
+        5)(std::thread::hardware_concurrency());
+
+    for(std::size_t i = 0; i < 7; ++i)
+        for(std::size_t j = 0; j < 13; ++j)
+            for(std::size_t k = 0; k < 5; ++k)
+                ASSERT_EQ(t(i, j, k), static_cast<float>(i * 100 + j * 10 + k));
+}
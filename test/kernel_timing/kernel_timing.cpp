@@ -0,0 +1,215 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "kernel_timing.hpp"
+
+namespace {
+
+// A clock that advances by a scripted duration for each launch, and records the order of the
+// launches, cache flushes and timer calls.
+struct FakeClock
+{
+    std::vector<float> durations;
+    std::size_t num_launch = 0;
+    float now              = 0;
+    std::string trace;
+
+    void Launch()
+    {
+        now += num_launch < durations.size() ? durations[num_launch] : 0;
+        ++num_launch;
+        trace += 'L';
+    }
+
+    void Flush() { trace += 'F'; }
+};
+
+struct FakeTimer
+{
+    explicit FakeTimer(FakeClock& clock) : clock_(clock) {}
+
+    void Start()
+    {
+        start_ = clock_.now;
+        clock_.trace += '[';
+    }
+
+    void Stop()
+    {
+        samples_.push_back(clock_.now - start_);
+        clock_.trace += ']';
+    }
+
+    std::vector<float> GetSamples() { return samples_; }
+
+    private:
+    FakeClock& clock_;
+    float start_ = 0;
+    std::vector<float> samples_;
+};
+
+StreamConfig make_config(int n_warmup, int n_repeat, bool flush_cache)
+{
+    StreamConfig config;
+
+    config.time_kernel_ = true;
+    config.n_warmup_    = n_warmup;
+    config.n_repeat_    = n_repeat;
+    config.flush_cache_ = flush_cache;
+
+    return config;
+}
+
+std::vector<float> run(FakeClock& clock, const StreamConfig& config)
+{
+    FakeTimer timer(clock);
+
+    return run_timed_repetitions(
+        config, timer, [&] { clock.Launch(); }, [&] { clock.Flush(); });
+}
+
+} // namespace
+
+TEST(KernelTiming, WarmupRunsAreNotTimed)
+{
+    FakeClock clock;
+    clock.durations = {100, 50, 1, 2, 3};
+
+    const auto samples = run(clock, make_config(2, 3, false));
+
+    EXPECT_EQ(clock.num_launch, 5);
+    EXPECT_EQ(clock.trace, "LL[L][L][L]");
+    EXPECT_EQ(samples, (std::vector<float>{1, 2, 3}));
+}
+
+TEST(KernelTiming, CacheFlushPrecedesEachTimedRun)
+{
+    FakeClock clock;
+    clock.durations = {5, 1, 2};
+
+    const auto samples = run(clock, make_config(1, 2, true));
+
+    // flushes are outside of the timed region
+    EXPECT_EQ(clock.trace, "LF[L]F[L]");
+    EXPECT_EQ(samples, (std::vector<float>{1, 2}));
+}
+
+TEST(KernelTiming, NoWarmup)
+{
+    FakeClock clock;
+    clock.durations = {4};
+
+    const auto samples = run(clock, make_config(0, 1, false));
+
+    EXPECT_EQ(clock.trace, "[L]");
+    EXPECT_EQ(samples, (std::vector<float>{4}));
+}
+
+TEST(KernelTiming, Percentiles)
+{
+    const std::vector<float> sorted{1, 2, 3, 4, 5};
+
+    EXPECT_FLOAT_EQ(get_sorted_percentile(sorted, 0), 1);
+    EXPECT_FLOAT_EQ(get_sorted_percentile(sorted, 50), 3);
+    EXPECT_FLOAT_EQ(get_sorted_percentile(sorted, 100), 5);
+    // rank 0.9 * 4 = 3.6, between 4 and 5
+    EXPECT_FLOAT_EQ(get_sorted_percentile(sorted, 90), 4.6f);
+    EXPECT_FLOAT_EQ(get_sorted_percentile(sorted, 25), 2);
+
+    EXPECT_FLOAT_EQ(get_sorted_percentile({7}, 99), 7);
+    EXPECT_FLOAT_EQ(get_sorted_percentile({}, 50), 0);
+}
+
+TEST(KernelTiming, Statistics)
+{
+    // in run order, not sorted
+    const auto result = get_kernel_timing_result({4, 2, 5, 4, 5, 7, 4, 9});
+
+    EXPECT_EQ(result.samples, (std::vector<float>{4, 2, 5, 4, 5, 7, 4, 9}));
+    EXPECT_FLOAT_EQ(result.mean, 5);
+    EXPECT_FLOAT_EQ(result.min, 2);
+    EXPECT_FLOAT_EQ(result.median, 4.5f);
+    // population standard deviation
+    EXPECT_FLOAT_EQ(result.stddev, 2);
+    // rank 0.99 * 7 = 6.93, between 7 and 9
+    EXPECT_FLOAT_EQ(result.p99, 8.86f);
+    // quartiles 4 and 5.5, so 9 is above the upper fence of 7.75
+    EXPECT_EQ(result.num_outlier, 1);
+}
+
+TEST(KernelTiming, Outliers)
+{
+    // quartiles 1 and 1.5: a single slow run is an outlier, as is a suspiciously fast one
+    const auto result = get_kernel_timing_result({1, 1, 1, 1.5f, 1.5f, 1.5f, 10, 0.1f});
+
+    EXPECT_EQ(result.num_outlier, 2);
+    EXPECT_FLOAT_EQ(result.min, 0.1f);
+
+    const auto slow = get_kernel_timing_result({1, 1, 1, 1, 1, 1, 1, 10});
+
+    EXPECT_EQ(slow.num_outlier, 1);
+    EXPECT_FLOAT_EQ(slow.median, 1);
+}
+
+TEST(KernelTiming, Empty)
+{
+    const auto result = get_kernel_timing_result({});
+
+    EXPECT_TRUE(result.samples.empty());
+    EXPECT_FLOAT_EQ(result.mean, 0);
+    EXPECT_EQ(result.num_outlier, 0);
+}
+
+TEST(KernelTiming, AddSamplesOfSeveralKernels)
+{
+    KernelTimingResult result;
+
+    add_kernel_timing_samples(result, {1, 2, 3});
+    EXPECT_FLOAT_EQ(result.mean, 2);
+
+    // a second kernel of the same operation, run as many times
+    add_kernel_timing_samples(result, {0.5f, 0.5f, 0.5f});
+    EXPECT_EQ(result.samples, (std::vector<float>{1.5f, 2.5f, 3.5f}));
+    EXPECT_FLOAT_EQ(result.mean, 2.5f);
+    EXPECT_FLOAT_EQ(result.median, 2.5f);
+
+    // a run with other settings starts over
+    add_kernel_timing_samples(result, {4});
+    EXPECT_EQ(result.samples, (std::vector<float>{4}));
+}
+
+TEST(KernelTiming, StreamConfigFromEnvironment)
+{
+    KernelTimingResult result;
+
+    unsetenv("CK_TIMING_WARMUP");
+    unsetenv("CK_TIMING_REPEAT");
+    unsetenv("CK_TIMING_FLUSH_CACHE");
+
+    const auto defaults = get_timing_stream_config(true, &result);
+
+    EXPECT_TRUE(defaults.time_kernel_);
+    EXPECT_EQ(defaults.n_warmup_, StreamConfig{}.n_warmup_);
+    EXPECT_EQ(defaults.n_repeat_, StreamConfig{}.n_repeat_);
+    EXPECT_FALSE(defaults.flush_cache_);
+    EXPECT_EQ(defaults.timing_result_, &result);
+
+    setenv("CK_TIMING_WARMUP", "3", 1);
+    setenv("CK_TIMING_REPEAT", "0", 1);
+    setenv("CK_TIMING_FLUSH_CACHE", "1", 1);
+
+    const auto config = get_timing_stream_config(false);
+
+    EXPECT_FALSE(config.time_kernel_);
+    EXPECT_EQ(config.n_warmup_, 3);
+    // at least one timed run
+    EXPECT_EQ(config.n_repeat_, 1);
+    EXPECT_TRUE(config.flush_cache_);
+    EXPECT_EQ(config.timing_result_, nullptr);
+
+    unsetenv("CK_TIMING_WARMUP");
+    unsetenv("CK_TIMING_REPEAT");
+    unsetenv("CK_TIMING_FLUSH_CACHE");
+}
@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "config.hpp"
+#include "reduction_method_selection.hpp"
+
+using ck::ReduceTensorOp;
+using ck::tensor_operation::device::estimate_reduce_instance_efficiency;
+using ck::tensor_operation::device::get_reduce_block_group;
+using ck::tensor_operation::device::get_reduce_method_candidates;
+using ck::tensor_operation::device::make_reduce_problem;
+using ck::tensor_operation::device::reduce_supports_atomic_add;
+using ck::tensor_operation::device::ReduceInstanceTile;
+using ck::tensor_operation::device::ReduceMethod;
+using ck::tensor_operation::device::ReduceProblem;
+using ck::tensor_operation::device::select_reduce_method;
+
+namespace {
+
+constexpr ck::index_t num_cu = 120;
+
+ReduceProblem make_problem(ck::long_index_t M,
+                           ck::long_index_t K,
+                           bool reduce_dim_is_innermost = true,
+                           bool can_use_atomic_add     = false)
+{
+    ReduceProblem problem;
+
+    problem.invariant_total_length  = M;
+    problem.reduce_total_length     = K;
+    problem.reduce_dim_is_innermost = reduce_dim_is_innermost;
+    problem.in_data_size            = 4;
+    problem.can_use_atomic_add      = can_use_atomic_add;
+
+    return problem;
+}
+
+} // anonymous namespace
+
+TEST(ReduceMethodSelection, MakeProblemMergesInvariantAndReducedDims)
+{
+    const std::vector<int> lengths{8, 16, 32, 64};
+    const std::vector<int> strides{16 * 32 * 64, 32 * 64, 64, 1};
+
+    const auto inner = make_reduce_problem(lengths, strides, {1, 2, 3}, 2, true);
+
+    EXPECT_EQ(inner.invariant_total_length, 8);
+    EXPECT_EQ(inner.reduce_total_length, 16 * 32 * 64);
+    EXPECT_TRUE(inner.reduce_dim_is_innermost);
+    EXPECT_EQ(inner.in_data_size, 2);
+    EXPECT_TRUE(inner.can_use_atomic_add);
+
+    const auto outer = make_reduce_problem(lengths, strides, {0}, 4, false);
+
+    EXPECT_EQ(outer.invariant_total_length, 16 * 32 * 64);
+    EXPECT_EQ(outer.reduce_total_length, 8);
+    EXPECT_FALSE(outer.reduce_dim_is_innermost);
+
+    // every dim reduced
+    const auto all = make_reduce_problem(lengths, strides, {0, 1, 2, 3}, 4, false);
+
+    EXPECT_EQ(all.invariant_total_length, 1);
+    EXPECT_EQ(all.reduce_total_length, 8 * 16 * 32 * 64);
+    EXPECT_TRUE(all.reduce_dim_is_innermost);
+
+    // the reduced dims are kept last, so the rows of a transposed tensor are contiguous
+    const auto transposed = make_reduce_problem({4, 8}, {1, 4}, {0}, 4, false);
+
+    EXPECT_TRUE(transposed.reduce_dim_is_innermost);
+}
+
+TEST(ReduceMethodSelection, ShortRowsGoToThreadWise)
+{
+    EXPECT_EQ(select_reduce_method(make_problem(1, 16), num_cu), ReduceMethod::ThreadWise);
+    EXPECT_EQ(select_reduce_method(make_problem(1 << 20, 8), num_cu), ReduceMethod::ThreadWise);
+
+    // rows read across threads
+    EXPECT_EQ(select_reduce_method(make_problem(64, 100, false), num_cu),
+              ReduceMethod::ThreadWise);
+
+    // contiguous rows only when there are enough of them for every CU
+    EXPECT_EQ(select_reduce_method(make_problem(64, 100), num_cu), ReduceMethod::BlockWise);
+    EXPECT_EQ(select_reduce_method(make_problem(2 * num_cu * 256, 100), num_cu),
+              ReduceMethod::ThreadWise);
+}
+
+TEST(ReduceMethodSelection, RowsOfOnePassOrManyRowsGoToBlockWise)
+{
+    EXPECT_EQ(select_reduce_method(make_problem(1, 2048), num_cu), ReduceMethod::BlockWise);
+    EXPECT_EQ(select_reduce_method(make_problem(2 * num_cu, 1 << 20), num_cu),
+              ReduceMethod::BlockWise);
+    EXPECT_EQ(select_reduce_method(make_problem(1 << 16, 4096, false), num_cu),
+              ReduceMethod::BlockWise);
+}
+
+TEST(ReduceMethodSelection, LongRowsOfFewRowsGoToMultiBlock)
+{
+    EXPECT_EQ(select_reduce_method(make_problem(4, 1 << 20, true, true), num_cu),
+              ReduceMethod::MultiBlockAtomicAdd);
+    EXPECT_EQ(select_reduce_method(make_problem(4, 1 << 20, true, false), num_cu),
+              ReduceMethod::MultiBlockPartialReduce);
+
+    // fewer CUs need fewer rows to be busy
+    EXPECT_EQ(select_reduce_method(make_problem(16, 1 << 20), 8), ReduceMethod::BlockWise);
+}
+
+TEST(ReduceMethodSelection, CandidatesStartWithTheSelectedMethod)
+{
+    for(const auto& problem : {make_problem(1, 16),
+                               make_problem(64, 100),
+                               make_problem(4, 1 << 20, true, true),
+                               make_problem(4, 1 << 20, true, false)})
+    {
+        const auto methods = get_reduce_method_candidates(problem, num_cu);
+
+        EXPECT_EQ(methods.front(), select_reduce_method(problem, num_cu));
+
+        // each method once, MultiBlockAtomicAdd only if the problem can use it
+        auto sorted = methods;
+        std::sort(sorted.begin(), sorted.end());
+
+        EXPECT_EQ(std::unique(sorted.begin(), sorted.end()), sorted.end());
+        EXPECT_EQ(methods.size(), problem.can_use_atomic_add ? 4u : 3u);
+        EXPECT_EQ(std::count(methods.begin(), methods.end(), ReduceMethod::MultiBlockAtomicAdd),
+                  problem.can_use_atomic_add ? 1 : 0);
+    }
+
+    EXPECT_EQ(get_reduce_method_candidates(make_problem(1, 16), num_cu),
+              (std::vector<ReduceMethod>{ReduceMethod::ThreadWise,
+                                         ReduceMethod::MultiBlockPartialReduce,
+                                         ReduceMethod::BlockWise}));
+}
+
+TEST(ReduceMethodSelection, InstanceEfficiency)
+{
+    const auto few_rows = make_problem(4, 4096);
+
+    // a workgroup of one row leaves less of the device idle than one of 128 rows, though both
+    // are short of work
+    const auto one_row =
+        estimate_reduce_instance_efficiency(few_rows, ReduceMethod::BlockWise, {1, 256, 4}, num_cu);
+    const auto many_rows =
+        estimate_reduce_instance_efficiency(few_rows, ReduceMethod::BlockWise, {128, 2, 4}, num_cu);
+
+    EXPECT_GT(one_row, many_rows);
+    EXPECT_LT(one_row, 1.0);
+
+    // splitting each row over workgroups keeps the device busy
+    EXPECT_DOUBLE_EQ(estimate_reduce_instance_efficiency(
+                         few_rows, ReduceMethod::MultiBlockPartialReduce, {1, 64, 4}, num_cu),
+                     1.0);
+
+    // padding and narrow vectors cost
+    const auto many = make_problem(1 << 16, 1000);
+
+    EXPECT_DOUBLE_EQ(
+        estimate_reduce_instance_efficiency(many, ReduceMethod::BlockWise, {8, 1000, 4}, num_cu),
+        1.0);
+    EXPECT_DOUBLE_EQ(
+        estimate_reduce_instance_efficiency(many, ReduceMethod::BlockWise, {8, 1024, 4}, num_cu),
+        1000.0 / 1024);
+    EXPECT_DOUBLE_EQ(
+        estimate_reduce_instance_efficiency(many, ReduceMethod::BlockWise, {8, 1000, 1}, num_cu),
+        0.25);
+}
+
+TEST(ReduceMethodSelection, BlockGroup)
+{
+    // enough rows: one workgroup per row, looping over the whole row
+    auto group = get_reduce_block_group(make_problem(1 << 16, 1000), {1, 256, 4}, num_cu);
+
+    EXPECT_EQ(group.block_group_size, 1);
+    EXPECT_EQ(group.num_k_block_tile_iteration, 4);
+
+    // few rows: 60 workgroups per row keep 2 per CU busy, which the 18 iterations each need to
+    // cover the 1024 tiles of a row bring down to 57
+    group = get_reduce_block_group(make_problem(4, 1 << 20), {1, 1024, 4}, num_cu);
+
+    EXPECT_EQ(group.block_group_size, 57);
+    EXPECT_EQ(group.num_k_block_tile_iteration, 18);
+
+    // no more workgroups than tiles
+    group = get_reduce_block_group(make_problem(4, 3000), {1, 1024, 4}, num_cu);
+
+    EXPECT_EQ(group.block_group_size, 3);
+    EXPECT_EQ(group.num_k_block_tile_iteration, 1);
+
+    // nor than max_block_group_size
+    group = get_reduce_block_group(make_problem(1, 1 << 30), {1, 256, 4}, num_cu, 16);
+
+    EXPECT_EQ(group.block_group_size, 16);
+    EXPECT_EQ(group.num_k_block_tile_iteration, 1 << 18);
+}
+
+TEST(ReduceMethodSelection, AtomicAddSupport)
+{
+    EXPECT_TRUE(reduce_supports_atomic_add<float>(ReduceTensorOp::ADD, false));
+    EXPECT_TRUE(reduce_supports_atomic_add<double>(ReduceTensorOp::AVG, false));
+    EXPECT_TRUE(reduce_supports_atomic_add<float>(ReduceTensorOp::NORM1, false));
+
+    EXPECT_FALSE(reduce_supports_atomic_add<float>(ReduceTensorOp::NORM2, false));
+    EXPECT_FALSE(reduce_supports_atomic_add<float>(ReduceTensorOp::MAX, false));
+    EXPECT_FALSE(reduce_supports_atomic_add<float>(ReduceTensorOp::ADD, true));
+    EXPECT_FALSE(reduce_supports_atomic_add<int32_t>(ReduceTensorOp::ADD, false));
+}
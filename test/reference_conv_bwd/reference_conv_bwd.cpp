@@ -0,0 +1,435 @@
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "conv_util.hpp"
+#include "element_wise_operation.hpp"
+#include "fill.hpp"
+#include "host_conv_gemm.hpp"
+#include "host_tensor.hpp"
+#include "reference_conv_backward_weight.hpp"
+#include "reference_conv_bwd_data.hpp"
+#include "tensor_layout.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+struct ScaleRelu
+{
+    void operator()(float& y, const float& x) const { y = x > 0 ? 2.f * x : 0.f; }
+};
+
+// the thread pool reads its size once, at first use; give it several threads whatever the host
+const bool pool_size_set = setenv("CK_HOST_NUM_THREADS", "4", 1) == 0;
+
+// Passes the input through and records the threads it is called on. Each thread's first call
+// waits (for a bounded time) until some other thread has been seen too, so that a single thread
+// cannot take all the work before the others are scheduled.
+struct RecordThreads
+{
+    struct State
+    {
+        std::mutex mutex;
+        std::set<std::thread::id> ids;
+    };
+
+    void operator()(float& y, const float& x) const
+    {
+        y = x;
+
+        {
+            std::lock_guard<std::mutex> lock{state->mutex};
+
+            if(!state->ids.insert(std::this_thread::get_id()).second)
+                return;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+
+        while(std::chrono::steady_clock::now() < deadline)
+        {
+            {
+                std::lock_guard<std::mutex> lock{state->mutex};
+
+                if(state->ids.size() > 1)
+                    return;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    State* state;
+};
+
+template <typename DataType, typename InLayout, typename WeiLayout, typename OutLayout>
+struct ConvTensors
+{
+    explicit ConvTensors(const ck::utils::conv::ConvParams& params)
+        : input(get_descriptor(params.N_, params.C_, params.input_spatial_lengths_, InLayout{})),
+          weight(get_descriptor(params.K_, params.C_, params.filter_spatial_lengths_, WeiLayout{})),
+          output(get_descriptor(
+              params.N_, params.K_, params.GetOutputSpatialLengths(), OutLayout{}))
+    {
+        ck::utils::FillUniform<DataType>{-1.f, 1.f, 1}(input.begin(), input.end());
+        ck::utils::FillUniform<DataType>{-1.f, 1.f, 2}(weight.begin(), weight.end());
+        ck::utils::FillUniform<DataType>{-1.f, 1.f, 3}(output.begin(), output.end());
+    }
+
+    template <typename Layout>
+    static HostTensorDescriptor get_descriptor(ck::index_t n,
+                                               ck::index_t c,
+                                               const std::vector<ck::index_t>& spatial_lengths,
+                                               Layout layout)
+    {
+        std::vector<std::size_t> dims{static_cast<std::size_t>(n), static_cast<std::size_t>(c)};
+        dims.insert(std::end(dims), std::begin(spatial_lengths), std::end(spatial_lengths));
+
+        return ck::utils::conv::get_host_tensor_descriptor(dims, layout);
+    }
+
+    Tensor<DataType> input;
+    Tensor<DataType> weight;
+    Tensor<DataType> output;
+};
+
+// Runs both the direct loops and the GEMM-lowered path of ReferenceConvBwdData on the same problem
+// and checks that they agree.
+template <ck::index_t NDim,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename DataType    = float,
+          typename InElementOp = PassThrough>
+bool check_reference_convolution_backward_data_gemm(const ck::utils::conv::ConvParams& params,
+                                                    const InElementOp& in_element_op = {})
+{
+    ConvTensors<DataType, InLayout, WeiLayout, OutLayout> naive{params};
+    ConvTensors<DataType, InLayout, WeiLayout, OutLayout> gemm{params};
+
+    auto ref_conv    = ck::tensor_operation::host::ReferenceConvBwdData<DataType,
+                                                                     DataType,
+                                                                     DataType,
+                                                                     float,
+                                                                     InElementOp,
+                                                                     PassThrough,
+                                                                     PassThrough,
+                                                                     NDim>();
+    auto ref_invoker = ref_conv.MakeInvoker();
+
+    for(auto* tensors : {&naive, &gemm})
+    {
+        auto ref_argument = ref_conv.MakeArgument(tensors->input,
+                                                  tensors->weight,
+                                                  tensors->output,
+                                                  params.conv_filter_strides_,
+                                                  params.conv_filter_dilations_,
+                                                  params.input_left_pads_,
+                                                  params.input_right_pads_,
+                                                  in_element_op,
+                                                  PassThrough{},
+                                                  PassThrough{});
+
+        if(tensors == &naive)
+            ref_invoker.RunNaive(ref_argument);
+        else
+            ref_invoker.RunGemm(ref_argument);
+    }
+
+    return ck::utils::check_err(gemm.input.mData,
+                                naive.input.mData,
+                                "Error: GEMM-lowered backward data mismatch!",
+                                1e-4,
+                                1e-5);
+}
+
+// Runs both the direct loops and the GEMM-lowered path of ReferenceConvBwdWeight on the same
+// problem and checks that they agree.
+template <ck::index_t NDim,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename DataType     = float,
+          typename WeiElementOp = PassThrough>
+bool check_reference_convolution_backward_weight_gemm(const ck::utils::conv::ConvParams& params,
+                                                      const WeiElementOp& wei_element_op = {})
+{
+    ConvTensors<DataType, InLayout, WeiLayout, OutLayout> naive{params};
+    ConvTensors<DataType, InLayout, WeiLayout, OutLayout> gemm{params};
+
+    auto ref_conv    = ck::tensor_operation::host::ReferenceConvBwdWeight<DataType,
+                                                                       DataType,
+                                                                       DataType,
+                                                                       PassThrough,
+                                                                       WeiElementOp,
+                                                                       PassThrough,
+                                                                       NDim>();
+    auto ref_invoker = ref_conv.MakeInvoker();
+
+    for(auto* tensors : {&naive, &gemm})
+    {
+        auto ref_argument = ref_conv.MakeArgument(tensors->input,
+                                                  tensors->weight,
+                                                  tensors->output,
+                                                  params.conv_filter_strides_,
+                                                  params.conv_filter_dilations_,
+                                                  params.input_left_pads_,
+                                                  params.input_right_pads_,
+                                                  PassThrough{},
+                                                  wei_element_op,
+                                                  PassThrough{});
+
+        if(tensors == &naive)
+            ref_invoker.RunNaive(ref_argument);
+        else
+            ref_invoker.RunGemm(ref_argument);
+    }
+
+    // the reduction over N is ordered differently, which can flip the rounding of half outputs
+    const double tol = std::is_same<DataType, ck::half_t>::value ? 1e-3 : 1e-4;
+
+    return ck::utils::check_err(gemm.weight.mData,
+                                naive.weight.mData,
+                                "Error: GEMM-lowered backward weight mismatch!",
+                                tol,
+                                tol);
+}
+
+ck::utils::conv::ConvParams get_conv1d_params()
+{
+    ck::utils::conv::ConvParams params;
+    params.num_dim_spatial_        = 1;
+    params.N_                      = 3;
+    params.K_                      = 37;
+    params.C_                      = 19;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{5};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{71};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{2};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{3};
+    params.input_left_pads_        = std::vector<ck::index_t>{4};
+    params.input_right_pads_       = std::vector<ck::index_t>{1};
+
+    return params;
+}
+
+ck::utils::conv::ConvParams get_conv2d_params()
+{
+    ck::utils::conv::ConvParams params;
+    params.N_                      = 2;
+    params.K_                      = 24;
+    params.C_                      = 13;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{3, 3};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{17, 14};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{2, 1};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{1, 2};
+    params.input_left_pads_        = std::vector<ck::index_t>{1, 2};
+    params.input_right_pads_       = std::vector<ck::index_t>{0, 2};
+
+    return params;
+}
+
+ck::utils::conv::ConvParams get_conv3d_params()
+{
+    ck::utils::conv::ConvParams params;
+    params.num_dim_spatial_        = 3;
+    params.N_                      = 2;
+    params.K_                      = 9;
+    params.C_                      = 7;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{3, 2, 3};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{9, 8, 10};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{1, 2, 3};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{2, 1, 1};
+    params.input_left_pads_        = std::vector<ck::index_t>{2, 1, 0};
+    params.input_right_pads_       = std::vector<ck::index_t>{1, 1, 2};
+
+    return params;
+}
+
+// strides larger than the filter leave input points that no filter tap reaches
+ck::utils::conv::ConvParams get_conv2d_sparse_params()
+{
+    ck::utils::conv::ConvParams params;
+    params.N_                      = 3;
+    params.K_                      = 5;
+    params.C_                      = 6;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{2, 1};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{13, 11};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{3, 4};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{1, 1};
+    params.input_left_pads_        = std::vector<ck::index_t>{1, 0};
+    params.input_right_pads_       = std::vector<ck::index_t>{0, 0};
+
+    return params;
+}
+
+} // anonymous namespace
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdDataConv1DNWC)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    EXPECT_TRUE((check_reference_convolution_backward_data_gemm<1, NWC, KXC, NWK>(
+        get_conv1d_params())));
+}
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdDataConv2D)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    for(const auto& params : {get_conv2d_params(), get_conv2d_sparse_params()})
+    {
+        EXPECT_TRUE(
+            (check_reference_convolution_backward_data_gemm<2, NHWC, KYXC, NHWK>(params)));
+        EXPECT_TRUE(
+            (check_reference_convolution_backward_data_gemm<2, NCHW, KCYX, NKHW>(params)));
+        EXPECT_TRUE((check_reference_convolution_backward_data_gemm<2,
+                                                                    NHWC,
+                                                                    KYXC,
+                                                                    NHWK,
+                                                                    ck::half_t,
+                                                                    ScaleRelu>(params)));
+    }
+}
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdDataConv3DNDHWC)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    EXPECT_TRUE((check_reference_convolution_backward_data_gemm<3, NDHWC, KZYXC, NDHWK>(
+        get_conv3d_params())));
+}
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdWeightConv1DNWC)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    EXPECT_TRUE((check_reference_convolution_backward_weight_gemm<1, NWC, KXC, NWK>(
+        get_conv1d_params())));
+}
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdWeightConv2D)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    for(const auto& params : {get_conv2d_params(), get_conv2d_sparse_params()})
+    {
+        EXPECT_TRUE(
+            (check_reference_convolution_backward_weight_gemm<2, NHWC, KYXC, NHWK>(params)));
+        EXPECT_TRUE(
+            (check_reference_convolution_backward_weight_gemm<2, NCHW, KCYX, NKHW>(params)));
+        EXPECT_TRUE((check_reference_convolution_backward_weight_gemm<2,
+                                                                      NHWC,
+                                                                      KYXC,
+                                                                      NHWK,
+                                                                      ck::half_t,
+                                                                      ScaleRelu>(params)));
+    }
+}
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdWeightConv3DNDHWC)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    EXPECT_TRUE((check_reference_convolution_backward_weight_gemm<3, NDHWC, KZYXC, NDHWK>(
+        get_conv3d_params())));
+}
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdWeightFewerImagesThanThreads)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    ck::utils::conv::ConvParams params;
+    params.N_                      = 2;
+    params.K_                      = 40;
+    params.C_                      = 24;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{3, 3};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{15, 13};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{1, 1};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{1, 1};
+    params.input_left_pads_        = std::vector<ck::index_t>{1, 1};
+    params.input_right_pads_       = std::vector<ck::index_t>{1, 1};
+
+    ConvTensors<float, NHWC, KYXC, NHWK> naive{params};
+
+    auto ref_conv = ck::tensor_operation::host::
+        ReferenceConvBwdWeight<float, float, float, PassThrough, PassThrough, PassThrough, 2>();
+    auto ref_argument = ref_conv.MakeArgument(naive.input,
+                                              naive.weight,
+                                              naive.output,
+                                              params.conv_filter_strides_,
+                                              params.conv_filter_dilations_,
+                                              params.input_left_pads_,
+                                              params.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+
+    ref_conv.MakeInvoker().RunNaive(ref_argument);
+
+    // more threads than images: the threads split the tiles of each image's GEMM
+    for(std::size_t num_thread : {1, 3, 8})
+    {
+        ConvTensors<float, NHWC, KYXC, NHWK> gemm{params};
+
+        ck::host_conv::conv_bwd_weight_gemm(gemm.input,
+                                            gemm.weight,
+                                            gemm.output,
+                                            params.conv_filter_strides_,
+                                            params.conv_filter_dilations_,
+                                            params.input_left_pads_,
+                                            PassThrough{},
+                                            PassThrough{},
+                                            PassThrough{},
+                                            num_thread);
+
+        EXPECT_TRUE(ck::utils::check_err(gemm.weight.mData,
+                                         naive.weight.mData,
+                                         "Error: GEMM-lowered backward weight mismatch!",
+                                         1e-4,
+                                         1e-4))
+            << num_thread << " threads";
+    }
+}
+
+TEST(ReferenceConvolutionBWD, GemmLoweringBwdWeightFewerImagesThanThreadsRunsInParallel)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    ASSERT_TRUE(pool_size_set);
+
+    ck::utils::conv::ConvParams params;
+    params.N_                      = 1;
+    params.K_                      = 40;
+    params.C_                      = 24;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{3, 3};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{15, 13};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{1, 1};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{1, 1};
+    params.input_left_pads_        = std::vector<ck::index_t>{1, 1};
+    params.input_right_pads_       = std::vector<ck::index_t>{1, 1};
+
+    ConvTensors<float, NHWC, KYXC, NHWK> tensors{params};
+
+    RecordThreads::State state;
+
+    ck::host_conv::conv_bwd_weight_gemm(tensors.input,
+                                        tensors.weight,
+                                        tensors.output,
+                                        params.conv_filter_strides_,
+                                        params.conv_filter_dilations_,
+                                        params.input_left_pads_,
+                                        RecordThreads{&state},
+                                        PassThrough{},
+                                        PassThrough{},
+                                        4);
+
+    EXPECT_GT(state.ids.size(), 1u);
+}
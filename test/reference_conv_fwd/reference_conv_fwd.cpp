@@ -86,6 +86,81 @@ run_reference_convolution_forward(const ck::utils::conv::ConvParams& params,
     return host_output;
 }
 
+// Runs both the direct loops and the GEMM-lowered path of ReferenceConvFwd on the same problem
+// and checks that they agree.
+template <ck::index_t NDim,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename InDataType = float,
+          typename OutElementOp_ = OutElementOp>
+bool check_reference_convolution_forward_gemm(const ck::utils::conv::ConvParams& params,
+                                              const OutElementOp_& out_element_op = {})
+{
+    std::vector<std::size_t> input_dims{static_cast<std::size_t>(params.N_),
+                                        static_cast<std::size_t>(params.C_)};
+    input_dims.insert(std::end(input_dims),
+                      std::begin(params.input_spatial_lengths_),
+                      std::end(params.input_spatial_lengths_));
+
+    std::vector<std::size_t> filter_dims{static_cast<std::size_t>(params.K_),
+                                         static_cast<std::size_t>(params.C_)};
+    filter_dims.insert(std::end(filter_dims),
+                       std::begin(params.filter_spatial_lengths_),
+                       std::end(params.filter_spatial_lengths_));
+
+    const std::vector<ck::index_t>& output_spatial_lengths = params.GetOutputSpatialLengths();
+    std::vector<std::size_t> output_dims{static_cast<std::size_t>(params.N_),
+                                         static_cast<std::size_t>(params.K_)};
+    output_dims.insert(std::end(output_dims),
+                       std::begin(output_spatial_lengths),
+                       std::end(output_spatial_lengths));
+
+    Tensor<InDataType> input(ck::utils::conv::get_host_tensor_descriptor(input_dims, InLayout{}));
+    Tensor<float> weights(ck::utils::conv::get_host_tensor_descriptor(filter_dims, WeiLayout{}));
+    Tensor<float> out_naive(ck::utils::conv::get_host_tensor_descriptor(output_dims, OutLayout{}));
+    Tensor<float> out_gemm(ck::utils::conv::get_host_tensor_descriptor(output_dims, OutLayout{}));
+
+    ck::utils::FillUniform<InDataType>{-1.f, 1.f}(input.begin(), input.end());
+    ck::utils::FillUniform<float>{-1.f, 1.f}(weights.begin(), weights.end());
+
+    auto ref_conv    = ck::tensor_operation::host::ReferenceConvFwd<InDataType,
+                                                                 float,
+                                                                 float,
+                                                                 InElementOp,
+                                                                 WeiElementOp,
+                                                                 OutElementOp_,
+                                                                 NDim>();
+    auto ref_invoker = ref_conv.MakeInvoker();
+
+    for(auto* output : {&out_naive, &out_gemm})
+    {
+        auto ref_argument = ref_conv.MakeArgument(input,
+                                                  weights,
+                                                  *output,
+                                                  params.conv_filter_strides_,
+                                                  params.conv_filter_dilations_,
+                                                  params.input_left_pads_,
+                                                  params.input_right_pads_,
+                                                  InElementOp{},
+                                                  WeiElementOp{},
+                                                  out_element_op);
+
+        if(output == &out_naive)
+            ref_invoker.RunNaive(ref_argument);
+        else
+            ref_invoker.RunGemm(ref_argument);
+    }
+
+    return ck::utils::check_err(
+        out_gemm.mData, out_naive.mData, "Error: GEMM-lowered path mismatch!", 1e-4, 1e-5);
+}
+
+struct ScaleRelu
+{
+    void operator()(float& y, const float& x) const { y = x > 0 ? 2.f * x : 0.f; }
+};
+
 } // anonymous namespace
 
 TEST(ReferenceConvolutionFWD, Conv2DNHWC)
@@ -387,3 +462,75 @@ TEST(ReferenceConvolutionFWD, Conv3DNCDHWStridesDilations)
     EXPECT_TRUE(ck::utils::check_err(
         out_tensor.mData, ref_data, "Error [case 2]: incorrect results!", 1e-4f, 1e-6f));
 }
+
+TEST(ReferenceConvolutionFWD, GemmLoweringConv1DNWC)
+{
+    ck::utils::conv::ConvParams params;
+    params.num_dim_spatial_        = 1;
+    params.N_                      = 3;
+    params.K_                      = 37;
+    params.C_                      = 19;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{5};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{71};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{2};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{3};
+    params.input_left_pads_        = std::vector<ck::index_t>{4};
+    params.input_right_pads_       = std::vector<ck::index_t>{1};
+
+    EXPECT_TRUE((check_reference_convolution_forward_gemm<1,
+                                                          ck::tensor_layout::convolution::NWC,
+                                                          ck::tensor_layout::convolution::KXC,
+                                                          ck::tensor_layout::convolution::NWK>(
+        params)));
+}
+
+TEST(ReferenceConvolutionFWD, GemmLoweringConv2D)
+{
+    ck::utils::conv::ConvParams params;
+    params.N_                      = 2;
+    params.K_                      = 24;
+    params.C_                      = 13;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{3, 3};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{17, 14};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{2, 1};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{1, 2};
+    params.input_left_pads_        = std::vector<ck::index_t>{1, 2};
+    params.input_right_pads_       = std::vector<ck::index_t>{0, 2};
+
+    EXPECT_TRUE((check_reference_convolution_forward_gemm<2,
+                                                          ck::tensor_layout::convolution::NHWC,
+                                                          ck::tensor_layout::convolution::KYXC,
+                                                          ck::tensor_layout::convolution::NHWK>(
+        params)));
+    EXPECT_TRUE((check_reference_convolution_forward_gemm<2,
+                                                          ck::tensor_layout::convolution::NCHW,
+                                                          ck::tensor_layout::convolution::KCYX,
+                                                          ck::tensor_layout::convolution::NKHW>(
+        params)));
+    EXPECT_TRUE((check_reference_convolution_forward_gemm<2,
+                                                          ck::tensor_layout::convolution::NHWC,
+                                                          ck::tensor_layout::convolution::KYXC,
+                                                          ck::tensor_layout::convolution::NHWK,
+                                                          ck::half_t>(params, ScaleRelu{})));
+}
+
+TEST(ReferenceConvolutionFWD, GemmLoweringConv3DNDHWC)
+{
+    ck::utils::conv::ConvParams params;
+    params.num_dim_spatial_        = 3;
+    params.N_                      = 2;
+    params.K_                      = 9;
+    params.C_                      = 7;
+    params.filter_spatial_lengths_ = std::vector<ck::index_t>{3, 2, 3};
+    params.input_spatial_lengths_  = std::vector<ck::index_t>{9, 8, 10};
+    params.conv_filter_strides_    = std::vector<ck::index_t>{1, 2, 3};
+    params.conv_filter_dilations_  = std::vector<ck::index_t>{2, 1, 1};
+    params.input_left_pads_        = std::vector<ck::index_t>{2, 1, 0};
+    params.input_right_pads_       = std::vector<ck::index_t>{1, 1, 2};
+
+    EXPECT_TRUE((check_reference_convolution_forward_gemm<3,
+                                                          ck::tensor_layout::convolution::NDHWC,
+                                                          ck::tensor_layout::convolution::KZYXC,
+                                                          ck::tensor_layout::convolution::NDHWK>(
+        params)));
+}
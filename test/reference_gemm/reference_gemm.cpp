@@ -0,0 +1,174 @@
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "config.hpp"
+#include "element_wise_operation.hpp"
+#include "host_blocked_gemm.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "reference_gemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+struct Scale
+{
+    float scale_;
+
+    void operator()(float& y, const float& x) const { y = scale_ * x; }
+};
+
+HostTensorDescriptor make_2d_descriptor(std::size_t rows, std::size_t cols, bool row_major)
+{
+    return row_major ? HostTensorDescriptor(std::vector<std::size_t>{rows, cols},
+                                            std::vector<std::size_t>{cols, 1})
+                     : HostTensorDescriptor(std::vector<std::size_t>{rows, cols},
+                                            std::vector<std::size_t>{1, rows});
+}
+
+// the straightforward triple loop the blocked engine replaced, plus the magnitude sum used to
+// bound the fused multiply-add rounding difference
+template <typename ADataType,
+          typename BDataType,
+          typename AElementOp,
+          typename BElementOp,
+          typename CElementOp>
+void naive_gemm(const Tensor<ADataType>& a,
+                const Tensor<BDataType>& b,
+                Tensor<float>& c,
+                Tensor<float>& c_abs,
+                AElementOp a_op,
+                BElementOp b_op,
+                CElementOp c_op)
+{
+    const std::size_t M = c.mDesc.GetLengths()[0];
+    const std::size_t N = c.mDesc.GetLengths()[1];
+    const std::size_t K = a.mDesc.GetLengths()[1];
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            float acc     = 0;
+            float acc_abs = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                float v_a;
+                float v_b;
+
+                a_op(v_a, ck::type_convert<float>(a(m, k)));
+                b_op(v_b, ck::type_convert<float>(b(k, n)));
+
+                acc += v_a * v_b;
+                acc_abs += std::abs(v_a * v_b);
+            }
+
+            c_op(c(m, n), acc);
+            c_abs(m, n) = acc_abs;
+        }
+    }
+}
+
+template <typename ADataType, typename BDataType, typename AElementOp = PassThrough>
+void run_test(std::size_t M,
+              std::size_t N,
+              std::size_t K,
+              bool a_row_major,
+              bool b_row_major,
+              ck::host_gemm::HostGemmIsa isa,
+              AElementOp a_op = AElementOp{})
+{
+    Tensor<ADataType> a(make_2d_descriptor(M, K, a_row_major));
+    Tensor<BDataType> b(make_2d_descriptor(K, N, b_row_major));
+    Tensor<float> c(make_2d_descriptor(M, N, true));
+    Tensor<float> c_ref(make_2d_descriptor(M, N, true));
+    Tensor<float> c_abs(make_2d_descriptor(M, N, true));
+
+    const uint64_t seed = M * 131 + N * 17 + K;
+    a.GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5, seed});
+    b.GenerateTensorValue(GeneratorTensor_3<BDataType>{-1.0, 1.0, seed + 1});
+
+    naive_gemm(a, b, c_ref, c_abs, a_op, PassThrough{}, Scale{0.5f});
+
+    ck::host_gemm::blocked_gemm(a, b, c, a_op, PassThrough{}, Scale{0.5f}, 3, isa);
+
+    const float tol = 2.f * K * std::ldexp(1.f, -24);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            ASSERT_LE(std::abs(c(m, n) - c_ref(m, n)), tol * 0.5f * c_abs(m, n))
+                << "m " << m << ", n " << n << ", isa "
+                << ck::host_gemm::GetHostGemmIsaString(isa);
+        }
+    }
+}
+
+const std::vector<ck::host_gemm::HostGemmIsa> isas{ck::host_gemm::HostGemmIsa::Generic,
+                                                   ck::host_gemm::HostGemmIsa::Avx2,
+                                                   ck::host_gemm::HostGemmIsa::Avx512};
+
+} // anonymous namespace
+
+TEST(ReferenceGemm, AllLayoutsFp32)
+{
+    for(auto isa : isas)
+        for(bool a_row_major : {true, false})
+            for(bool b_row_major : {true, false})
+                run_test<float, float>(67, 45, 300, a_row_major, b_row_major, isa);
+}
+
+TEST(ReferenceGemm, WidenedInputs)
+{
+    for(auto isa : isas)
+    {
+        run_test<ck::half_t, ck::half_t>(33, 70, 129, true, false, isa);
+        run_test<int8_t, float>(97, 1030, 17, false, true, isa);
+        run_test<ck::bhalf_t, ck::bhalf_t>(13, 40, 64, true, true, isa);
+    }
+}
+
+TEST(ReferenceGemm, EdgeShapes)
+{
+    run_test<float, float>(1, 1, 1, true, true, ck::host_gemm::HostGemmIsa::Generic);
+    run_test<float, float>(5, 9, 0, true, true, ck::host_gemm::HostGemmIsa::Generic);
+    run_test<float, float>(
+        20, 20, 20, true, true, ck::host_gemm::HostGemmIsa::Generic, Scale{-2.f});
+}
+
+TEST(ReferenceGemm, ReferenceOperator)
+{
+    const std::size_t M = 50, N = 60, K = 70;
+
+    Tensor<ck::half_t> a(make_2d_descriptor(M, K, false));
+    Tensor<ck::half_t> b(make_2d_descriptor(K, N, false));
+    Tensor<float> c(make_2d_descriptor(M, N, true));
+    Tensor<float> c_ref(make_2d_descriptor(M, N, true));
+    Tensor<float> c_abs(make_2d_descriptor(M, N, true));
+
+    a.GenerateTensorValue(GeneratorTensor_3<ck::half_t>{-1.0, 1.0});
+    b.GenerateTensorValue(GeneratorTensor_3<ck::half_t>{-1.0, 1.0});
+
+    naive_gemm(a, b, c_ref, c_abs, PassThrough{}, PassThrough{}, PassThrough{});
+
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<ck::half_t, ck::half_t, float, PassThrough, PassThrough, PassThrough>;
+
+    auto ref_gemm     = ReferenceGemm{};
+    auto ref_invoker  = ref_gemm.MakeInvoker();
+    auto ref_argument = ref_gemm.MakeArgument(a, b, c, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ref_invoker.Run(ref_argument);
+
+    const float tol = 2.f * K * std::ldexp(1.f, -24);
+
+    for(std::size_t m = 0; m < M; ++m)
+        for(std::size_t n = 0; n < N; ++n)
+            EXPECT_LE(std::abs(c(m, n) - c_ref(m, n)), tol * c_abs(m, n))
+                << "m " << m << ", n " << n;
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "fill.hpp"
+#include "host_tensor.hpp"
+#include "reference_layernorm.hpp"
+
+namespace {
+
+template <ck::index_t Rank>
+void run_layernorm(const Tensor<float>& x,
+                   const Tensor<float>& gamma,
+                   const Tensor<float>& beta,
+                   Tensor<float>& y,
+                   const std::vector<int>& reduce_dims,
+                   float epsilon)
+{
+    using ReferenceLayernorm =
+        ck::tensor_operation::host::ReferenceLayernorm<float, float, float, float, float, Rank>;
+
+    auto ref_layernorm = ReferenceLayernorm{};
+    auto ref_invoker   = ref_layernorm.MakeInvoker();
+    auto ref_argument  = ref_layernorm.MakeArgument(x, gamma, beta, y, reduce_dims, epsilon);
+
+    ref_invoker.Run(ref_argument);
+}
+
+} // anonymous namespace
+
+TEST(ReferenceLayernorm, Values)
+{
+    const std::vector<std::size_t> lengths{2, 4};
+
+    // gamma and beta of length 4, broadcast along dim 0
+    Tensor<float> x(lengths);
+    Tensor<float> gamma(lengths, std::vector<std::size_t>{0, 1});
+    Tensor<float> beta(lengths, std::vector<std::size_t>{0, 1});
+    Tensor<float> y(lengths);
+
+    x.mData     = {1, 2, 3, 4, 5, 5, 5, 5};
+    gamma.mData = {1, 2, 1, 1};
+    beta.mData  = {0, 0, 0, 10};
+
+    run_layernorm<2>(x, gamma, beta, y, {1}, 0.f);
+
+    // the first row has mean 2.5 and variance 1.25, the second variance 0
+    const float a = 1.5f / std::sqrt(1.25f);
+    const float b = 0.5f / std::sqrt(1.25f);
+
+    EXPECT_TRUE(ck::utils::check_err(std::vector<float>(y.mData.begin(), y.mData.begin() + 4),
+                                     std::vector<float>{-a, -2 * b, b, a + 10}));
+
+    run_layernorm<2>(x, gamma, beta, y, {1}, 1.f);
+
+    EXPECT_TRUE(ck::utils::check_err(std::vector<float>(y.mData.begin() + 4, y.mData.end()),
+                                     std::vector<float>{0, 0, 0, 10}));
+}
+
+TEST(ReferenceLayernorm, NormalizesRows)
+{
+    // reduce over the last two dims; with gamma 1 and beta 0 each row has mean 0 and variance 1
+    const std::vector<std::size_t> lengths{3, 4, 16};
+
+    Tensor<float> x(lengths);
+    Tensor<float> gamma(lengths, std::vector<std::size_t>{0, 16, 1});
+    Tensor<float> beta(lengths, std::vector<std::size_t>{0, 16, 1});
+    Tensor<float> y(lengths);
+
+    ck::utils::FillUniform<float>{-2.f, 6.f, 1}(x.begin(), x.end());
+    std::fill(gamma.mData.begin(), gamma.mData.end(), 1.f);
+    std::fill(beta.mData.begin(), beta.mData.end(), 0.f);
+
+    run_layernorm<3>(x, gamma, beta, y, {1, 2}, 0.f);
+
+    for(std::size_t i = 0; i < 3; ++i)
+    {
+        double mean = 0;
+        double var  = 0;
+
+        for(std::size_t j = 0; j < 4; ++j)
+            for(std::size_t k = 0; k < 16; ++k)
+                mean += y(i, j, k);
+
+        mean /= 64;
+
+        for(std::size_t j = 0; j < 4; ++j)
+            for(std::size_t k = 0; k < 16; ++k)
+                var += (y(i, j, k) - mean) * (y(i, j, k) - mean);
+
+        var /= 64;
+
+        EXPECT_NEAR(mean, 0., 1e-5);
+        EXPECT_NEAR(var, 1., 1e-4);
+    }
+}
@@ -0,0 +1,245 @@
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "fill.hpp"
+#include "host_tensor.hpp"
+#include "reference_pool_bwd.hpp"
+#include "reference_pool_fwd.hpp"
+
+namespace {
+
+using ck::ReduceTensorOp;
+
+struct PoolParams
+{
+    std::vector<std::size_t> in_lengths;
+    std::vector<ck::index_t> window;
+    std::vector<ck::index_t> strides;
+    std::vector<ck::index_t> left_pads;
+    std::vector<ck::index_t> right_pads;
+
+    // [N, C, Xo...]
+    std::vector<std::size_t> GetOutputLengths() const
+    {
+        std::vector<std::size_t> out_lengths{in_lengths[0], in_lengths[1]};
+
+        for(std::size_t d = 0; d < window.size(); ++d)
+        {
+            const auto x = static_cast<ck::index_t>(in_lengths[d + 2]) + left_pads[d] +
+                           right_pads[d] - window[d];
+
+            out_lengths.push_back(static_cast<std::size_t>(x / strides[d] + 1));
+        }
+
+        return out_lengths;
+    }
+};
+
+template <ck::index_t NDim, ReduceTensorOp Op, bool NeedIndices>
+void run_pool_fwd(const PoolParams& params,
+                  const Tensor<float>& in,
+                  Tensor<float>& out,
+                  Tensor<int32_t>& out_indices,
+                  bool count_include_pad = true)
+{
+    using ReferencePoolFwd = ck::tensor_operation::host::
+        ReferencePoolFwd<NDim, float, float, float, Op, false, NeedIndices>;
+
+    auto ref_pool     = ReferencePoolFwd{};
+    auto ref_invoker  = ref_pool.MakeInvoker();
+    auto ref_argument = ref_pool.MakeArgument(in,
+                                              out,
+                                              out_indices,
+                                              params.window,
+                                              params.strides,
+                                              params.left_pads,
+                                              params.right_pads,
+                                              count_include_pad);
+
+    ref_invoker.Run(ref_argument);
+}
+
+template <ck::index_t NDim, ReduceTensorOp Op>
+void run_pool_bwd(const PoolParams& params,
+                  Tensor<float>& din,
+                  const Tensor<float>& dout,
+                  const Tensor<int32_t>& out_indices,
+                  bool count_include_pad = true)
+{
+    using ReferencePoolBwd =
+        ck::tensor_operation::host::ReferencePoolBwd<NDim, float, float, float, Op>;
+
+    auto ref_pool     = ReferencePoolBwd{};
+    auto ref_invoker  = ref_pool.MakeInvoker();
+    auto ref_argument = ref_pool.MakeArgument(din,
+                                              dout,
+                                              out_indices,
+                                              params.window,
+                                              params.strides,
+                                              params.left_pads,
+                                              params.right_pads,
+                                              count_include_pad);
+
+    ref_invoker.Run(ref_argument);
+}
+
+double dot(const Tensor<float>& a, const Tensor<float>& b)
+{
+    return std::inner_product(a.mData.begin(), a.mData.end(), b.mData.begin(), 0.0);
+}
+
+// <avg_pool(x), g> == <x, avg_pool_bwd(g)>, with overlapping windows and padding
+template <ck::index_t NDim>
+void check_avg_pool_adjoint(const PoolParams& params, bool count_include_pad)
+{
+    Tensor<float> x(params.in_lengths);
+    Tensor<float> dx(params.in_lengths);
+    Tensor<float> y(params.GetOutputLengths());
+    Tensor<float> g(params.GetOutputLengths());
+    Tensor<int32_t> no_indices(std::vector<std::size_t>{1});
+
+    ck::utils::FillUniform<float>{-1.f, 1.f, 1}(x.begin(), x.end());
+    ck::utils::FillUniform<float>{-1.f, 1.f, 2}(g.begin(), g.end());
+
+    run_pool_fwd<NDim, ReduceTensorOp::AVG, false>(params, x, y, no_indices, count_include_pad);
+    run_pool_bwd<NDim, ReduceTensorOp::AVG>(params, dx, g, no_indices, count_include_pad);
+
+    EXPECT_NEAR(dot(y, g), dot(x, dx), 1e-4);
+}
+
+} // anonymous namespace
+
+TEST(ReferencePool, MaxPool2DValuesAndIndices)
+{
+    const PoolParams params{{1, 1, 4, 4}, {2, 2}, {2, 2}, {0, 0}, {0, 0}};
+
+    Tensor<float> in(params.in_lengths);
+    Tensor<float> out(params.GetOutputLengths());
+    Tensor<int32_t> out_indices(params.GetOutputLengths());
+
+    std::iota(in.mData.begin(), in.mData.end(), 0.f);
+
+    run_pool_fwd<2, ReduceTensorOp::MAX, true>(params, in, out, out_indices);
+
+    // the maximum of each window is its last element
+    EXPECT_TRUE(ck::utils::check_err(out.mData, std::vector<float>{5, 7, 13, 15}));
+    EXPECT_TRUE(ck::utils::check_err(out_indices.mData, std::vector<int32_t>{3, 3, 3, 3}));
+}
+
+TEST(ReferencePool, MaxPoolIndicesSkipPadding)
+{
+    // the padding is not a candidate even though the input is negative
+    const PoolParams params{{1, 1, 3}, {3}, {1}, {1}, {1}};
+
+    Tensor<float> in(params.in_lengths);
+    Tensor<float> out(params.GetOutputLengths());
+    Tensor<int32_t> out_indices(params.GetOutputLengths());
+
+    in.mData = {-3, -1, -2};
+
+    run_pool_fwd<1, ReduceTensorOp::MAX, true>(params, in, out, out_indices);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, std::vector<float>{-1, -1, -1}));
+    EXPECT_TRUE(ck::utils::check_err(out_indices.mData, std::vector<int32_t>{2, 1, 0}));
+}
+
+TEST(ReferencePool, AvgPoolCountIncludePad)
+{
+    const PoolParams params{{1, 1, 3}, {3}, {1}, {1}, {1}};
+
+    Tensor<float> in(params.in_lengths);
+    Tensor<float> out(params.GetOutputLengths());
+    Tensor<int32_t> no_indices(std::vector<std::size_t>{1});
+
+    in.mData = {1, 2, 3};
+
+    run_pool_fwd<1, ReduceTensorOp::AVG, false>(params, in, out, no_indices, true);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, std::vector<float>{1.f, 2.f, 5.f / 3}));
+
+    run_pool_fwd<1, ReduceTensorOp::AVG, false>(params, in, out, no_indices, false);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, std::vector<float>{1.5f, 2.f, 2.5f}));
+}
+
+TEST(ReferencePool, MaxPool3DBackwardRoutesToArgmax)
+{
+    // non-overlapping windows, so each input gets the gradient of at most one output
+    const PoolParams params{{2, 3, 4, 6, 4}, {2, 3, 2}, {2, 3, 2}, {0, 0, 0}, {0, 0, 0}};
+
+    Tensor<float> in(params.in_lengths);
+    Tensor<float> din(params.in_lengths);
+    Tensor<float> out(params.GetOutputLengths());
+    Tensor<float> dout(params.GetOutputLengths());
+    Tensor<int32_t> out_indices(params.GetOutputLengths());
+
+    ck::utils::FillUniform<float>{-1.f, 1.f, 1}(in.begin(), in.end());
+    ck::utils::FillUniform<float>{1.f, 2.f, 2}(dout.begin(), dout.end());
+
+    run_pool_fwd<3, ReduceTensorOp::MAX, true>(params, in, out, out_indices);
+    run_pool_bwd<3, ReduceTensorOp::MAX>(params, din, dout, out_indices);
+
+    Tensor<float> din_expected(params.in_lengths);
+
+    for(std::size_t n = 0; n < 2; ++n)
+        for(std::size_t c = 0; c < 3; ++c)
+            for(std::size_t x0 = 0; x0 < 4; ++x0)
+                for(std::size_t x1 = 0; x1 < 6; ++x1)
+                    for(std::size_t x2 = 0; x2 < 4; ++x2)
+                    {
+                        const std::size_t o0 = x0 / 2, o1 = x1 / 3, o2 = x2 / 2;
+
+                        const bool is_argmax = in(n, c, x0, x1, x2) == out(n, c, o0, o1, o2);
+
+                        din_expected(n, c, x0, x1, x2) = is_argmax ? dout(n, c, o0, o1, o2) : 0.f;
+                    }
+
+    EXPECT_TRUE(ck::utils::check_err(din.mData, din_expected.mData));
+}
+
+TEST(ReferencePool, MaxPoolBackwardAccumulatesOverlappingWindows)
+{
+    const PoolParams params{{1, 1, 4}, {3}, {1}, {0}, {0}};
+
+    Tensor<float> in(params.in_lengths);
+    Tensor<float> din(params.in_lengths);
+    Tensor<float> out(params.GetOutputLengths());
+    Tensor<float> dout(params.GetOutputLengths());
+    Tensor<int32_t> out_indices(params.GetOutputLengths());
+
+    in.mData   = {0, 5, 1, 2};
+    dout.mData = {1, 10};
+
+    run_pool_fwd<1, ReduceTensorOp::MAX, true>(params, in, out, out_indices);
+    run_pool_bwd<1, ReduceTensorOp::MAX>(params, din, dout, out_indices);
+
+    EXPECT_TRUE(ck::utils::check_err(din.mData, std::vector<float>{0, 11, 0, 0}));
+}
+
+TEST(ReferencePool, AvgPool1DBackwardIsAdjoint)
+{
+    const PoolParams params{{2, 3, 17}, {4}, {3}, {2}, {1}};
+
+    check_avg_pool_adjoint<1>(params, true);
+    check_avg_pool_adjoint<1>(params, false);
+}
+
+TEST(ReferencePool, AvgPool2DBackwardIsAdjoint)
+{
+    const PoolParams params{{2, 3, 9, 10}, {3, 3}, {2, 2}, {1, 1}, {1, 1}};
+
+    check_avg_pool_adjoint<2>(params, true);
+    check_avg_pool_adjoint<2>(params, false);
+}
+
+TEST(ReferencePool, AvgPool3DBackwardIsAdjoint)
+{
+    const PoolParams params{{1, 2, 5, 6, 7}, {2, 3, 3}, {1, 2, 2}, {1, 1, 0}, {0, 1, 1}};
+
+    check_avg_pool_adjoint<3>(params, true);
+    check_avg_pool_adjoint<3>(params, false);
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "fill.hpp"
+#include "host_tensor.hpp"
+#include "reference_softmax.hpp"
+
+namespace {
+
+template <ck::index_t Rank>
+void run_softmax(const Tensor<float>& in, Tensor<float>& out, const std::vector<int>& reduce_dims)
+{
+    using ReferenceSoftmax =
+        ck::tensor_operation::host::ReferenceSoftmax<float, float, float, Rank>;
+
+    auto ref_softmax  = ReferenceSoftmax{};
+    auto ref_invoker  = ref_softmax.MakeInvoker();
+    auto ref_argument = ref_softmax.MakeArgument(in, out, reduce_dims);
+
+    ref_invoker.Run(ref_argument);
+}
+
+} // anonymous namespace
+
+TEST(ReferenceSoftmax, Values)
+{
+    Tensor<float> in(std::vector<std::size_t>{2, 3});
+    Tensor<float> out(std::vector<std::size_t>{2, 3});
+
+    in.mData = {0, 0, 0, 1, 2, 3};
+
+    run_softmax<2>(in, out, {1});
+
+    const float s = 1.f + std::exp(1.f) + std::exp(2.f);
+
+    const std::vector<float> expected{
+        1.f / 3, 1.f / 3, 1.f / 3, 1.f / s, std::exp(1.f) / s, std::exp(2.f) / s};
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, expected));
+}
+
+TEST(ReferenceSoftmax, LargeInputsDoNotOverflow)
+{
+    Tensor<float> in(std::vector<std::size_t>{1, 2});
+    Tensor<float> out(std::vector<std::size_t>{1, 2});
+
+    in.mData = {1000.f, 1000.f};
+
+    run_softmax<2>(in, out, {1});
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, std::vector<float>{0.5f, 0.5f}));
+}
+
+TEST(ReferenceSoftmax, ReduceOuterDims)
+{
+    // reduce over dims 0 and 2 of a transposed tensor, so the rows are strided
+    const std::vector<std::size_t> lengths{3, 4, 5};
+
+    Tensor<float> in(lengths, std::vector<std::size_t>{1, 15, 3});
+    Tensor<float> out(lengths);
+
+    ck::utils::FillUniform<float>{-4.f, 4.f, 1}(in.begin(), in.end());
+
+    run_softmax<3>(in, out, {0, 2});
+
+    for(std::size_t j = 0; j < 4; ++j)
+    {
+        float max = in(0, j, 0);
+
+        for(std::size_t i = 0; i < 3; ++i)
+            for(std::size_t k = 0; k < 5; ++k)
+                max = std::max(max, in(i, j, k));
+
+        float sum = 0;
+
+        for(std::size_t i = 0; i < 3; ++i)
+            for(std::size_t k = 0; k < 5; ++k)
+                sum += std::exp(in(i, j, k) - max);
+
+        float out_sum = 0;
+
+        for(std::size_t i = 0; i < 3; ++i)
+            for(std::size_t k = 0; k < 5; ++k)
+            {
+                EXPECT_NEAR(out(i, j, k), std::exp(in(i, j, k) - max) / sum, 1e-6);
+
+                out_sum += out(i, j, k);
+            }
+
+        EXPECT_NEAR(out_sum, 1.f, 1e-5);
+    }
+}
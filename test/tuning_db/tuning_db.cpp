@@ -0,0 +1,225 @@
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+#include "data_type.hpp"
+#include "element_wise_operation.hpp"
+#include "tensor_layout.hpp"
+#include "tuning_db.hpp"
+
+namespace {
+
+using ck::utils::TuningDb;
+using ck::utils::TuningInstanceIndex;
+using ck::utils::TuningProblem;
+using ck::utils::TuningRecord;
+
+// an instance whose type string leaves out its vector width, like many of the XDL instances
+struct FakeOp
+{
+    std::string name;
+    int64_t vector_size = 0;
+
+    std::string GetTypeString() const { return name; }
+
+    ck::tensor_operation::device::TuningParams GetTuningParams() const
+    {
+        auto params = ck::tensor_operation::device::TuningParams{name};
+
+        if(vector_size > 0)
+            params.Set("VectorSize", vector_size).SetOption("GemmSpec", "Default");
+
+        return params;
+    }
+};
+
+TuningProblem make_problem(int64_t M, int64_t N, int64_t K, int KBatch = 1)
+{
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+    return ck::utils::make_gemm_tuning_problem<ck::half_t,
+                                               ck::half_t,
+                                               ck::half_t,
+                                               Row,
+                                               Row,
+                                               Row,
+                                               PassThrough,
+                                               PassThrough,
+                                               PassThrough>(M, N, K, K, N, N, KBatch);
+}
+
+class TuningDbFileTest : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        char dir[] = "/tmp/ck_tuning_db_XXXXXX";
+
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        dir_  = dir;
+        path_ = dir_ + "/tuning.db";
+    }
+
+    void TearDown() override
+    {
+        std::remove(path_.c_str());
+        std::remove((path_ + ".lock").c_str());
+        rmdir(dir_.c_str());
+    }
+
+    std::string dir_;
+    std::string path_;
+};
+
+} // namespace
+
+TEST(TuningDb, KeepsFastestRecord)
+{
+    TuningDb db;
+
+    const TuningProblem problem = make_problem(256, 256, 64);
+
+    EXPECT_FALSE(db.Find(problem).has_value());
+
+    EXPECT_TRUE(db.Update(problem, {"a", 2.f}));
+    EXPECT_FALSE(db.Update(problem, {"b", 3.f}));
+    EXPECT_TRUE(db.Update(problem, {"c", 1.f}));
+
+    ASSERT_TRUE(db.Find(problem).has_value());
+    EXPECT_EQ(db.Find(problem)->instance, "c");
+    EXPECT_EQ(db.Find(problem)->median_time, 1.f);
+
+    // KBatch selects a different instance set, it is part of the exact match
+    EXPECT_FALSE(db.Find(make_problem(256, 256, 64, 4)).has_value());
+    EXPECT_TRUE(db.FindNearest(make_problem(256, 256, 64, 4)).empty());
+}
+
+TEST(TuningDb, NearestShape)
+{
+    TuningDb db;
+
+    db.Update(make_problem(64, 64, 64), {"small", 1.f});
+    db.Update(make_problem(1024, 1024, 1024), {"medium", 1.f});
+    db.Update(make_problem(8192, 8192, 8192), {"large", 1.f});
+
+    const auto nearest = db.FindNearest(make_problem(2048, 1024, 1024));
+
+    ASSERT_EQ(nearest.size(), 3);
+    EXPECT_EQ(nearest[0].instance, "medium");
+    EXPECT_EQ(nearest[1].instance, "large");
+    EXPECT_EQ(nearest[2].instance, "small");
+}
+
+TEST(TuningDb, FindBestInstance)
+{
+    std::vector<std::unique_ptr<FakeOp>> op_ptrs;
+
+    for(const char* name : {"a", "b", "c"})
+        op_ptrs.push_back(std::make_unique<FakeOp>(FakeOp{name}));
+
+    const TuningInstanceIndex<std::unique_ptr<FakeOp>> index(op_ptrs);
+
+    TuningDb db;
+
+    EXPECT_EQ(index.FindBestInstance(db, make_problem(128, 128, 128)), nullptr);
+
+    db.Update(make_problem(128, 128, 128), {"b", 1.f});
+    db.Update(make_problem(4096, 4096, 4096), {"not built", 1.f});
+
+    EXPECT_EQ(index.FindBestInstance(db, make_problem(128, 128, 128)), op_ptrs[1].get());
+
+    // the nearest record names an instance that is not in the vector, the next one is used
+    EXPECT_EQ(index.FindBestInstance(db, make_problem(4000, 4000, 4000)), op_ptrs[1].get());
+}
+
+TEST(TuningDb, FindBestSupportedInstanceId)
+{
+    std::vector<std::unique_ptr<FakeOp>> op_ptrs;
+
+    for(const char* name : {"a", "b", "c"})
+        op_ptrs.push_back(std::make_unique<FakeOp>(FakeOp{name}));
+
+    const TuningInstanceIndex<std::unique_ptr<FakeOp>> index(op_ptrs);
+
+    TuningDb db;
+
+    db.Update(make_problem(128, 128, 128), {"b", 1.f});
+    db.Update(make_problem(256, 256, 256), {"c", 1.f});
+
+    auto is_supported = [](const FakeOp& op) { return op.name != "b"; };
+
+    // the recorded instance does not support the problem, the nearest shape's does
+    EXPECT_EQ(index.FindBestInstanceId(db, make_problem(128, 128, 128), is_supported), 2);
+
+    EXPECT_FALSE(index
+                     .FindBestInstanceId(
+                         db, make_problem(128, 128, 128), [](const FakeOp&) { return false; })
+                     .has_value());
+}
+
+TEST(TuningDb, InstancesKeyedOnTuningParams)
+{
+    std::vector<std::unique_ptr<FakeOp>> op_ptrs;
+
+    op_ptrs.push_back(std::make_unique<FakeOp>(FakeOp{"gemm", 4}));
+    op_ptrs.push_back(std::make_unique<FakeOp>(FakeOp{"gemm", 8}));
+
+    const std::string key = ck::utils::get_tuning_instance_key(*op_ptrs[1]);
+
+    EXPECT_EQ(key, "gemm<VectorSize=8,GemmSpec=Default>");
+
+    const TuningInstanceIndex<std::unique_ptr<FakeOp>> index(op_ptrs);
+
+    TuningDb db;
+
+    db.Update(make_problem(128, 128, 128), {key, 1.f});
+
+    // the instance that was timed, not the first one with its type string
+    EXPECT_EQ(index.FindBestInstance(db, make_problem(128, 128, 128)), op_ptrs[1].get());
+
+    // instances the database cannot tell apart are rejected
+    op_ptrs.push_back(std::make_unique<FakeOp>(FakeOp{"gemm", 8}));
+
+    EXPECT_THROW(TuningInstanceIndex<std::unique_ptr<FakeOp>>{op_ptrs}, std::invalid_argument);
+}
+
+TEST_F(TuningDbFileTest, Persistence)
+{
+    {
+        TuningDb db(path_);
+
+        db.Update(make_problem(256, 256, 64), {"DeviceGemmXdl<256, 256, 128, 4, 8>", 0.5f});
+    }
+
+    // a second writer merges its records with the ones already in the file
+    {
+        TuningDb db(path_);
+
+        db.Update(make_problem(512, 512, 64), {"DeviceGemmXdl<256, 128, 128, 4, 8>", 0.25f});
+    }
+
+    TuningDb db(path_);
+
+    EXPECT_EQ(db.GetNumRecords(), 2);
+
+    const auto record = db.Find(make_problem(256, 256, 64));
+
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->instance, "DeviceGemmXdl<256, 256, 128, 4, 8>");
+    EXPECT_EQ(record->median_time, 0.5f);
+
+    // a stale in-memory copy does not overwrite a faster record written by someone else
+    TuningDb stale(path_);
+
+    db.Update(make_problem(256, 256, 64), {"faster", 0.1f});
+    stale.Update(make_problem(256, 256, 64), {"slower", 0.3f});
+
+    EXPECT_EQ(TuningDb(path_).Find(make_problem(256, 256, 64))->instance, "faster");
+}
@@ -0,0 +1,62 @@
+#include <iostream>
+
+#include "profile_welford_impl.hpp"
+
+namespace {
+
+template <typename InDataType, typename OutDataType>
+bool test_welford(const char* name)
+{
+    bool pass = true;
+
+    auto run = [&](const std::vector<std::size_t>& lengths) {
+        const bool problem_pass =
+            lengths.size() == 2
+                ? ck::profiler::profile_welford_impl<2, InDataType, float, OutDataType>(
+                      true, 2, false, false, lengths)
+                : ck::profiler::profile_welford_impl<4, InDataType, float, OutDataType>(
+                      true, 2, false, false, lengths);
+
+        if(!problem_pass)
+            std::cout << "test Welford " << name << " failed for " << lengths.size()
+                      << "-d lengths starting with " << lengths[0] << std::endl;
+
+        pass = pass && problem_pass;
+    };
+
+    // rows of 3 fit one K tile of every instance, so each row is reduced by one workgroup
+    // (block_group_size == 1) from a partial tile
+    run({4096, 3});
+    // 3 rows are too few to fill any device, so each row is split over a group of workgroups
+    // (block_group_size > 1) whose last tile is partial
+    run({3, 100003});
+    run({64, 1000});
+
+    // batchnorm of NHWC: the vectorized instances for C = 64, only the scalar ones for C = 6,
+    // whose rows of 16 * 28 * 28 are split over groups of workgroups
+    run({2, 7, 7, 64});
+    run({16, 28, 28, 6});
+
+    return pass;
+}
+
+} // namespace
+
+int main()
+{
+    bool pass = true;
+
+    pass = test_welford<float, float>("fp32") && pass;
+    pass = test_welford<ck::half_t, ck::half_t>("fp16") && pass;
+
+    if(pass)
+    {
+        std::cout << "test Welford: Pass" << std::endl;
+        return 0;
+    }
+    else
+    {
+        std::cout << "test Welford: Fail" << std::endl;
+        return -1;
+    }
+}